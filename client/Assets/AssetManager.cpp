@@ -0,0 +1,124 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** AssetManager - Textures decoded on a worker thread and uploaded within a frame budget
+*/
+
+#include "Assets/AssetManager.hpp"
+#include <array>
+#include <chrono>
+#include "../common/Logger/Logger.hpp"
+
+namespace Assets {
+    AssetManager::AssetManager(Graphics::IGraphics &graphics)
+        : _graphics(graphics), _worker(&AssetManager::WorkerLoop, this) {}
+
+    AssetManager::~AssetManager() {
+        _jobs.push(std::nullopt);
+        _worker.join();
+    }
+
+    void AssetManager::WorkerLoop() {
+        while (std::optional<Job> job = _jobs.pop()) {
+            Decoded result{std::move(job->name), job->generation, false, {}};
+            result.decoded = _graphics.DecodeImage(job->path.c_str(), result.image);
+            _decoded.push(std::move(result));
+        }
+    }
+
+    void AssetManager::Request(const AssetRequest &request) {
+        auto [iter, inserted] =
+            _assets.try_emplace(request.name, Entry{request.path, AssetState::Pending, 0});
+        Entry &entry = iter->second;
+        if (!inserted) {
+            if (entry.path == request.path) {
+                return;  // Already loaded, pending or failed from this file
+            }
+            entry.path = request.path;
+            if (entry.state != AssetState::Pending) {
+                _pendingCount++;
+            }
+            entry.state = AssetState::Pending;
+        } else {
+            _pendingCount++;
+            if (request.placeholder) {
+                const unsigned int color = PLACEHOLDER_COLOR;
+                const std::array<unsigned char, 4> pixel = {
+                    static_cast<unsigned char>(color >> 16), static_cast<unsigned char>(color >> 8),
+                    static_cast<unsigned char>(color), static_cast<unsigned char>(color >> 24)};
+                _graphics.CreateTextureFromMemory(request.name.c_str(), pixel.data(), 1, 1,
+                                                  Graphics::PIXEL_FORMAT_RGBA8);
+            }
+        }
+
+        entry.generation = _nextGeneration++;
+        _jobs.push(Job{request.name, request.path, entry.generation});
+    }
+
+    void AssetManager::Preload(std::span<const AssetRequest> manifest) {
+        for (const AssetRequest &request : manifest) {
+            Request(request);
+        }
+        LOG_INFO("[AssetManager] ", _pendingCount, " texture(s) queued");
+    }
+
+    size_t AssetManager::Update(double budgetSeconds) {
+        using Clock = std::chrono::steady_clock;
+        const Clock::time_point start = Clock::now();
+        const auto budget = std::chrono::duration<double>(budgetSeconds);
+
+        size_t uploads = 0;
+        while (uploads == 0 || Clock::now() - start < budget) {
+            std::optional<Decoded> result = _decoded.tryPop();
+            if (!result) {
+                break;
+            }
+            auto iter = _assets.find(result->name);
+            if (iter == _assets.end() || iter->second.generation != result->generation) {
+                continue;  // Unloaded or requested again from another file since
+            }
+            Upload(iter->second, *result);
+            uploads++;
+        }
+        return uploads;
+    }
+
+    void AssetManager::Upload(Entry &entry, Decoded &result) {
+        _pendingCount--;
+        if (!result.decoded) {
+            entry.state = AssetState::Failed;
+            LOG_WARNING("[AssetManager] Failed to decode ", entry.path, " (", result.name, ")");
+            return;
+        }
+
+        const Graphics::DecodedImage &image = result.image;
+        const int texture = _graphics.CreateTextureFromMemory(result.name.c_str(), image.pixels.data(),
+                                                              image.width, image.height,
+                                                              Graphics::PIXEL_FORMAT_RGBA8);
+        if (texture == Graphics::INVALID_TEXTURE) {
+            entry.state = AssetState::Failed;
+            LOG_WARNING("[AssetManager] Failed to upload ", entry.path, " (", result.name, ")");
+            return;
+        }
+        entry.state = AssetState::Ready;
+        LOG_DEBUG("[AssetManager] Loaded ", result.name, " (", image.width, "x", image.height, ")");
+    }
+
+    void AssetManager::Unload(const std::string &name) {
+        auto iter = _assets.find(name);
+        if (iter == _assets.end()) {
+            return;
+        }
+        if (iter->second.state == AssetState::Pending) {
+            _pendingCount--;
+        }
+        _assets.erase(iter);
+        _graphics.UnloadTexture(name.c_str());
+    }
+
+    AssetState AssetManager::GetState(const std::string &name) const {
+        auto iter = _assets.find(name);
+        return iter != _assets.end() ? iter->second.state : AssetState::Missing;
+    }
+}  // namespace Assets
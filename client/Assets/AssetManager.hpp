@@ -0,0 +1,144 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** AssetManager - Textures decoded on a worker thread and uploaded within a frame budget
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include "Graphics/IGraphics.hpp"
+#include "ThreadSafeQueue.hpp"
+
+namespace Assets {
+    /**
+     * @brief Loading state of a requested texture
+     */
+    enum class AssetState {
+        Missing,  ///< Never requested (or unloaded)
+        Pending,  ///< Decoding or waiting for its upload
+        Ready,    ///< Uploaded
+        Failed    ///< Could not be decoded or uploaded (the placeholder stays, if any)
+    };
+
+    /**
+     * @brief One texture to load
+     */
+    struct AssetRequest {
+        std::string name;          ///< Texture name (what draw calls and GetTextureHandle() use)
+        std::string path;          ///< Image file
+        bool placeholder = true;   ///< Register a placeholder under the name until the texture is ready
+    };
+
+    /**
+     * @brief Asynchronous texture loader
+     *
+     * Image files are decoded by a worker thread (IGraphics::DecodeImage(),
+     * CPU only); the decoded pixels are uploaded on the main thread by
+     * Update(), which stops once its per-frame budget is spent so a burst of
+     * textures is spread over several frames instead of hitching one.
+     *
+     * Until its texture is uploaded, a name can be backed by a 1x1
+     * placeholder: sprites using it draw as plain boxes, and the handle
+     * resolved from the placeholder stays valid once the real texture
+     * replaces it. A texture that fails to load keeps its placeholder.
+     *
+     * All methods but the worker's are called from the main thread.
+     */
+    class AssetManager {
+       public:
+        static constexpr unsigned int PLACEHOLDER_COLOR = 0x60FFFFFF;  ///< Translucent white (0xAARRGGBB)
+
+        /**
+         * @brief Start the decoding thread
+         * @param graphics Graphics backend that decodes and uploads the textures
+         */
+        explicit AssetManager(Graphics::IGraphics &graphics);
+
+        /**
+         * @brief Stop the decoding thread (textures already uploaded stay loaded)
+         */
+        ~AssetManager();
+
+        AssetManager(const AssetManager &) = delete;
+        AssetManager &operator=(const AssetManager &) = delete;
+
+        /**
+         * @brief Queue a texture for loading
+         *
+         * Requesting a name already loaded or pending from the same path does
+         * nothing; from another path, the texture is reloaded (the current one
+         * is drawn until the new one is uploaded).
+         */
+        void Request(const AssetRequest &request);
+
+        /**
+         * @brief Queue every texture of a manifest
+         */
+        void Preload(std::span<const AssetRequest> manifest);
+
+        /**
+         * @brief Upload decoded textures until the budget is spent
+         * @param budgetSeconds Upload time allowed this frame (at least one texture is uploaded)
+         * @return Textures uploaded
+         */
+        size_t Update(double budgetSeconds);
+
+        /**
+         * @brief Unload a texture (a decode still in flight is dropped)
+         */
+        void Unload(const std::string &name);
+
+        [[nodiscard]] AssetState GetState(const std::string &name) const;
+
+        /**
+         * @brief Textures requested and not uploaded yet
+         */
+        [[nodiscard]] size_t GetPendingCount() const { return _pendingCount; }
+
+       private:
+        /**
+         * @brief Decoding job (the generation tells a reload from a stale result)
+         */
+        struct Job {
+            std::string name;
+            std::string path;
+            uint32_t generation;
+        };
+
+        /**
+         * @brief Result of a job, waiting for its upload
+         */
+        struct Decoded {
+            std::string name;
+            uint32_t generation;
+            bool decoded;
+            Graphics::DecodedImage image;
+        };
+
+        struct Entry {
+            std::string path;
+            AssetState state;
+            uint32_t generation;
+        };
+
+        void WorkerLoop();
+        void Upload(Entry &entry, Decoded &result);
+
+        Graphics::IGraphics &_graphics;
+        std::unordered_map<std::string, Entry> _assets;  ///< Requested textures, by name
+        uint32_t _nextGeneration = 0;
+        size_t _pendingCount = 0;
+
+        ThreadSafeQueue<std::optional<Job>> _jobs;  ///< To the worker (std::nullopt stops it)
+        ThreadSafeQueue<Decoded> _decoded;          ///< From the worker
+        std::thread _worker;                         ///< Started last: the queues exist before it runs
+    };
+}  // namespace Assets
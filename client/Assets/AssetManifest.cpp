@@ -0,0 +1,58 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** AssetManifest - Textures to preload before a match starts
+*/
+
+#include "Assets/AssetManifest.hpp"
+#include <algorithm>
+#include <filesystem>
+#include "../common/Logger/Logger.hpp"
+#include "common/MapLoader/MapLoader.hpp"
+
+namespace Assets {
+    std::vector<AssetRequest> SpriteManifest() {
+        return {
+            {"PlayerShips.gif", "assets/sprites/PlayerShips.gif"},
+            {"Projectiles", "assets/sprites/Projectiles.gif"},
+            {"Wall.png", "assets/sprites/Wall.png"},
+            {"OrbitalModule", "assets/sprites/Module.gif"},
+        };
+    }
+
+    AssetRequest BackgroundRequest(const std::string &background) {
+        return {background, "assets/" + background, false};
+    }
+
+    std::vector<AssetRequest> MapManifest(const std::string &mapsDirectory) {
+        std::error_code error;
+        std::vector<std::filesystem::path> mapFiles;
+        for (const auto &file : std::filesystem::directory_iterator(mapsDirectory, error)) {
+            if (file.path().extension() == ".json") {
+                mapFiles.push_back(file.path());
+            }
+        }
+        if (error) {
+            LOG_WARNING("[AssetManifest] Cannot list maps in ", mapsDirectory, ": ", error.message());
+            return {};
+        }
+        std::ranges::sort(mapFiles);
+
+        std::vector<AssetRequest> manifest;
+        auto add = [&manifest](const std::string &background) {
+            const bool listed = std::ranges::any_of(
+                manifest, [&background](const AssetRequest &request) { return request.name == background; });
+            if (!background.empty() && !listed) {
+                manifest.push_back(BackgroundRequest(background));
+            }
+        };
+        for (const auto &mapFile : mapFiles) {
+            if (auto mapData = map::MapLoader::loadFromFile(mapFile.string())) {
+                add(mapData->getBackgroundSprite());
+                add(mapData->getParallaxBackgroundSprite());
+            }
+        }
+        return manifest;
+    }
+}  // namespace Assets
@@ -0,0 +1,39 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** AssetManifest - Textures to preload before a match starts
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "Assets/AssetManager.hpp"
+
+namespace Assets {
+    /**
+     * @brief Sprite sheets of the entity renderer (players, projectiles, walls, orbital modules)
+     */
+    std::vector<AssetRequest> SpriteManifest();
+
+    /**
+     * @brief Request of a map background, as named by the map's JSON
+     * @param background Background path relative to the assets directory (e.g. "backgrounds/bg-full.png")
+     *
+     * The texture is named after that path, so every map sharing a
+     * background shares its texture. No placeholder: an unloaded
+     * background is simply not drawn.
+     */
+    AssetRequest BackgroundRequest(const std::string &background);
+
+    /**
+     * @brief Backgrounds of every map found in a directory of map JSON files
+     * @param mapsDirectory Directory of the map JSON files (e.g. "assets/maps")
+     * @return One request per distinct background, in map file order
+     *
+     * Preloading them while in the menus keeps GameStart from loading
+     * backgrounds on the first frames of the match.
+     */
+    std::vector<AssetRequest> MapManifest(const std::string &mapsDirectory);
+}  // namespace Assets
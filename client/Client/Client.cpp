@@ -173,15 +173,16 @@ void Client::run() {
                 SetServer(ip, port);
 
                 // Launch connection in separate thread to avoid blocking UI
+                // (its result is enqueued, GameLoop delivers it on the game thread)
                 std::thread([this]() {
                     if (!Connect()) {
                         LOG_ERROR("[Client] Connection failed!");
                         // Publish CONNECTION_FAILED event
-                        _eventBus->publish(UIEvent(UIEventType::CONNECTION_FAILED, "Server unreachable"));
+                        _eventBus->enqueue(UIEvent(UIEventType::CONNECTION_FAILED, "Server unreachable"));
                     } else {
                         LOG_INFO("[Client] ✓ Connected successfully!");
                         // Publish CONNECTION_SUCCESS event
-                        _eventBus->publish(UIEvent(UIEventType::CONNECTION_SUCCESS, ""));
+                        _eventBus->enqueue(UIEvent(UIEventType::CONNECTION_SUCCESS, ""));
                     }
                 }).detach();
             }
@@ -8,13 +8,12 @@
 #ifndef EVENTBUS_HPP
 #define EVENTBUS_HPP
 
-#include <functional>
-#include <memory>
-#include <typeindex>
-#include <unordered_map>
-#include <vector>
+#include <tuple>
 #include "../../common/Logger/Logger.hpp"
-#include "Events/IEvent.hpp"
+#include "Core/EventBus/EventChannel.hpp"
+#include "Events/InputEvent/InputEvent.hpp"
+#include "Events/NetworkEvent/NetworkEvent.hpp"
+#include "Events/UIEvent.hpp"
 
 /**
  * @class EventBus
@@ -26,7 +25,10 @@
  * Architecture:
  * - Components subscribe to specific event types
  * - When an event is published, all concerned subscribers are notified
- * - Type-safe thanks to C++ templates
+ * - Each event type has its own EventChannel, found at compile time:
+ *   publishing a type the bus does not carry does not compile
+ * - Events posted from other threads (network, connection) are enqueued and
+ *   delivered by dispatchDeferred(), called once per frame by GameLoop::update()
  * 
  * Usage example:
  * @code
@@ -39,6 +41,9 @@
  * 
  * // Publish an event
  * eventBus.publish(InputEvent(InputAction::SHOOT, InputState::PRESSED));
+ *
+ * // Post an event from another thread, delivered on the next dispatchDeferred()
+ * eventBus.enqueue(UIEvent(UIEventType::AUTH_SUCCESS, "player"));
  * @endcode
  */
 class EventBus {
@@ -87,41 +92,82 @@ class EventBus {
      * 
      * @note If no subscriber exists, the event is ignored
      * @note Exceptions in callbacks are not handled
+     * @note Game thread only: other threads use enqueue()
      */
     template <typename T>
     void publish(const T &event);
 
+    /**
+     * @brief Queue an event for the next dispatchDeferred()
+     *
+     * Thread-safe: this is how the network and connection threads hand events
+     * to the game thread, whose subscribers are not synchronized.
+     *
+     * @tparam T Event type (must inherit from IEvent)
+     * @param event Event to deliver later
+     */
+    template <typename T>
+    void enqueue(T event);
+
+    /**
+     * @brief Publish every deferred event, type by type, each in enqueue order
+     *
+     * Called once per frame at a fixed point of the game loop.
+     *
+     * @return Events delivered
+     */
+    size_t dispatchDeferred();
+
     /**
      * @brief Clear all subscriptions
      * 
-     * Removes all registered callbacks for all event types.
+     * Removes all registered callbacks for all event types,
+     * and drops the deferred events.
      * Useful for system reset or avoiding memory leaks.
      */
     void clear();
 
    private:
-    std::unordered_map<std::type_index, std::vector<std::function<void(const IEvent &)>>> _subscribers;
+    /**
+     * @brief Channel of an event type (compile error if the bus does not carry it)
+     */
+    template <typename T>
+    EventChannel<T> &channel() {
+        return std::get<EventChannel<T>>(_channels);
+    }
+
+    std::tuple<EventChannel<NetworkEvent>, EventChannel<ConnectionEvent>, EventChannel<UIEvent>,
+               EventChannel<InputEvent>>
+        _channels;
 };
 
 // Template implementations must be in header for linker
 template <typename T>
 size_t EventBus::subscribe(EventCallback<T> callback) {
-    auto &vec = _subscribers[std::type_index(typeid(T))];
-    LOG_DEBUG("[EventBus] Subscribe to type: ", typeid(T).name(), " (Total: ", vec.size() + 1, ")");
-    vec.push_back([callback = std::move(callback)](const IEvent &e) { callback(static_cast<const T &>(e)); });
-    return vec.size() - 1;
+    EventChannel<T> &events = channel<T>();
+    LOG_DEBUG("[EventBus] Subscribe to type: ", typeid(T).name(), " (Total: ",
+              events.getSubscriberCount() + 1, ")");
+    return events.subscribe(std::move(callback));
 }
 
 template <typename T>
 void EventBus::publish(const T &event) {
-    auto it = _subscribers.find(std::type_index(typeid(T)));
-    if (it != _subscribers.end()) {
-        for (const auto &callback : it->second) {
-            callback(event);
-        }
-    } else {
-        LOG_DEBUG("[EventBus] No subscribers for event: ", typeid(T).name());
-    }
+    channel<T>().publish(event);
+}
+
+template <typename T>
+void EventBus::enqueue(T event) {
+    channel<T>().enqueue(std::move(event));
+}
+
+inline size_t EventBus::dispatchDeferred() {
+    size_t delivered = 0;
+    std::apply([&delivered](auto &...channels) { ((delivered += channels.dispatch()), ...); }, _channels);
+    return delivered;
+}
+
+inline void EventBus::clear() {
+    std::apply([](auto &...channels) { (channels.clear(), ...); }, _channels);
 }
 
 #endif
@@ -0,0 +1,105 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** EventChannel.hpp - Subscribers and deferred queue of a single event type
+*/
+
+#ifndef EVENTCHANNEL_HPP
+#define EVENTCHANNEL_HPP
+
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * @class EventChannel
+ * @brief Event distribution for one event type, resolved at compile time
+ *
+ * Subscribers are stored contiguously and called directly: publishing costs
+ * no map lookup, no type-erased cast and nothing when nobody listens.
+ *
+ * Events can also be deferred: enqueue() stores them (thread-safe, so other
+ * threads can post to the game thread), and dispatch() delivers them on the
+ * caller's thread. The queue is double-buffered: dispatch() swaps the write
+ * buffer out under the lock, then calls the subscribers without holding it.
+ * Both buffers keep their capacity, so a steady flow of events allocates
+ * nothing once they have grown.
+ *
+ * @tparam T Event type (must inherit from IEvent)
+ */
+template <typename T>
+class EventChannel {
+   public:
+    using Callback = std::function<void(const T &)>;
+
+    /**
+     * @brief Add a subscriber
+     * @return Subscription index (subscribers are called in this order)
+     */
+    size_t subscribe(Callback callback) {
+        _subscribers.push_back(std::move(callback));
+        return _subscribers.size() - 1;
+    }
+
+    /**
+     * @brief Call every subscriber now, on the caller's thread
+     */
+    void publish(const T &event) const {
+        for (const Callback &callback : _subscribers) {
+            callback(event);
+        }
+    }
+
+    /**
+     * @brief Queue an event for the next dispatch() (callable from any thread)
+     */
+    void enqueue(T event) {
+        std::lock_guard<std::mutex> lock(_queueMutex);
+        _writeQueue.push_back(std::move(event));
+    }
+
+    /**
+     * @brief Publish every queued event, in enqueue order
+     *
+     * Events enqueued by the subscribers while dispatching wait for the next call.
+     *
+     * @return Events delivered
+     */
+    size_t dispatch() {
+        {
+            std::lock_guard<std::mutex> lock(_queueMutex);
+            if (_writeQueue.empty()) {
+                return 0;
+            }
+            _writeQueue.swap(_readQueue);
+        }
+        for (const T &event : _readQueue) {
+            publish(event);
+        }
+        const size_t delivered = _readQueue.size();
+        _readQueue.clear();
+        return delivered;
+    }
+
+    /**
+     * @brief Remove every subscriber and drop the queued events
+     */
+    void clear() {
+        _subscribers.clear();
+        std::lock_guard<std::mutex> lock(_queueMutex);
+        _writeQueue.clear();
+    }
+
+    [[nodiscard]] size_t getSubscriberCount() const { return _subscribers.size(); }
+
+   private:
+    std::vector<Callback> _subscribers;
+
+    std::mutex _queueMutex;      ///< Guards _writeQueue only
+    std::vector<T> _writeQueue;  ///< Filled by enqueue()
+    std::vector<T> _readQueue;   ///< Delivered by dispatch() (game thread only)
+};
+
+#endif
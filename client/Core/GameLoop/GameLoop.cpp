@@ -6,9 +6,9 @@
 */
 
 #include "GameLoop.hpp"
-#include <cmath>
-#include <unordered_set>
+#include <algorithm>
 #include "../ClientGameRules.hpp"
+#include "Assets/AssetManifest.hpp"
 #include "GameruleKeys.hpp"
 #include "Input/KeyBindings.hpp"
 
@@ -32,8 +32,14 @@ bool GameLoop::initialize() {
 
     // 2. Rendering
     _rendering = std::make_unique<Rendering>(*_eventBus);
+    _rendering->SetFrameProfiler(&_profiler);
     LOG_INFO("Rendering initialized");
 
+    // Snapshots are interpolated by server tick: bunched arrivals still fill the history
+    if (_replicator) {
+        _replicator->getSnapshotIntake().setInterpolationAnchors(EntityRenderer::SnapshotRing::CAPACITY - 1);
+    }
+
     // 3. Subscribe to network events for entity updates
     _eventBus->subscribe<NetworkEvent>([this](const NetworkEvent &event) { handleNetworkMessage(event); });
     LOG_INFO("Subscribed to NetworkEvent");
@@ -171,28 +177,10 @@ void GameLoop::run() {
 
     _rendering->Initialize(800, 600, "R-Type Client");
 
-    // Load sprite sheets
-    LOG_INFO("Loading sprite sheets...");
-    if (!_rendering->LoadTexture("PlayerShips.gif", "assets/sprites/PlayerShips.gif")) {
-        LOG_WARNING("Failed to load PlayerShips.gif");
-    } else {
-        LOG_INFO("✓ Loaded PlayerShips.gif (player ship)");
-    }
-    if (!_rendering->LoadTexture("Projectiles", "assets/sprites/Projectiles.gif")) {
-        LOG_WARNING("Failed to load Projectiles.gif");
-    } else {
-        LOG_INFO("✓ Loaded Projectiles.gif (projectiles)");
-    }
-    if (!_rendering->LoadTexture("Wall.png", "assets/sprites/Wall.png")) {
-        LOG_WARNING("Failed to load Wall.png");
-    } else {
-        LOG_INFO("✓ Loaded Wall.png (obstacles)");
-    }
-    if (!_rendering->LoadTexture("OrbitalModule", "assets/sprites/Module.gif")) {
-        LOG_WARNING("Failed to load Module.gif");
-    } else {
-        LOG_INFO("✓ Loaded Module.gif (orbital modules)");
-    }
+    // Stream sprite sheets and map backgrounds: decoded off the main thread, uploaded over the next frames
+    LOG_INFO("Loading sprite sheets and map backgrounds...");
+    _rendering->PreloadAssets(Assets::SpriteManifest());
+    _rendering->PreloadAssets(Assets::MapManifest("assets/maps"));
 
     // Apply stored entity ID if GameStart was received before run()
     if (_myEntityId.has_value()) {
@@ -221,6 +209,8 @@ void GameLoop::run() {
     }
 
     while (_running) {
+        _profiler.beginFrame();
+
         // Get player ID from replicator (once authenticated)
         if (_myPlayerId == 0 && _replicator) {
             _myPlayerId = _replicator->getMyPlayerId();
@@ -232,11 +222,14 @@ void GameLoop::run() {
 
         // 1. Process network messages from network thread
         if (_replicator) {
+            Profiling::ScopedTimer timer(&_profiler, Profiling::Stage::NetworkDrain);
             _replicator->processMessages();  // ← Reads from network thread queue
         }
 
         // 2. Fixed timestep updates (physics, ECS, input sending)
         while (_accumulator >= _fixedTimestep) {
+            Profiling::ScopedTimer timer(&_profiler, Profiling::Stage::Prediction);
+
             // Process and send inputs at fixed rate (60 Hz)
             processInput();
 
@@ -301,10 +294,19 @@ void GameLoop::update(float deltaTime) {
     // - Camera updates
     // - Animations
 
+    // Deliver events posted by the network and connection threads
+    {
+        Profiling::ScopedTimer timer(&_profiler, Profiling::Stage::NetworkDrain);
+        _eventBus->dispatchDeferred();
+    }
+
     // Update entity interpolation for smooth rendering
     // Only update if rendering system is fully initialized
     if (_rendering && _rendering->IsWindowOpen()) {
-        _rendering->UpdateInterpolation(deltaTime);
+        {
+            Profiling::ScopedTimer timer(&_profiler, Profiling::Stage::Interpolation);
+            _rendering->UpdateInterpolation(deltaTime);
+        }
 
         // Update ping display and adaptive reconciliation
         if (_replicator != nullptr) {
@@ -370,9 +372,6 @@ void GameLoop::processInput() {
     // Collect all currently pressed actions
     std::vector<RType::Messages::Shared::Action> actions;
 
-    // Calculate movement delta (distance per frame at fixed 60Hz, scaled by game speed)
-    float moveDelta = _playerSpeed * _fixedTimestep * _gameSpeedMultiplier;
-
     // Collect input directions first
     int dx = 0, dy = 0;
 
@@ -430,26 +429,29 @@ void GameLoop::processInput() {
         _rendering->SetLocalPlayerMoving(_isMoving);
     }
 
-    // CLIENT-SIDE PREDICTION: Apply movement with diagonal normalization (MUST MATCH SERVER!)
+    // Don't send inputs if in spectator mode (avoid unnecessary network traffic)
+    if (_replicator->isSpectator()) {
+        return;
+    }
+
+    // CLIENT-SIDE PREDICTION: same rules as the server's input handling and systems
     // Only predict if entity is initialized (prevents moving before spawn)
-    if (_myEntityId.has_value() && _entityInitialized && _clientSidePredictionEnabled && _isMoving) {
-        float moveX = static_cast<float>(dx);
-        float moveY = static_cast<float>(dy);
+    if (_myEntityId.has_value() && _entityInitialized && _clientSidePredictionEnabled) {
+        const InputPrediction::Axes input = InputPrediction::readActions(actions);
+        const float tickTime = _fixedTimestep * _gameSpeedMultiplier;  // Server's scaled timestep
 
-        // Normalize diagonal movement to prevent going faster diagonally
-        if (dx != 0 && dy != 0) {
-            float length = std::sqrt(moveX * moveX + moveY * moveY);  // √2 ≈ 1.414
-            moveX /= length;                                          // 1/√2 ≈ 0.707
-            moveY /= length;                                          // 1/√2 ≈ 0.707
+        ecs::PlayerRules::Vec2 moved;
+        InputPrediction::applyMovement(moved, input, _playerSpeed, tickTime);
+        if (_isMoving) {
+            _rendering->MoveEntityLocally(_myEntityId.value(), moved.x, moved.y);
         }
 
-        // Apply normalized movement
-        _rendering->MoveEntityLocally(_myEntityId.value(), moveX * moveDelta, moveY * moveDelta);
-    }
-
-    // Don't send inputs if in spectator mode (avoid unnecessary network traffic)
-    if (_replicator->isSpectator()) {
-        return;
+        // Weapon after movement (WeaponSystem runs after MovementSystem): the shot leaves the new position
+        if (auto charge = ecs::PlayerRules::stepWeapon(_predictedWeapon, input.shoot, _playerFireRate,
+                                                       ecs::PlayerRules::DEFAULT_CHARGE_RATE, tickTime)) {
+            _rendering->FirePredictedShot(_myEntityId.value(), *charge, _gameSpeedMultiplier,
+                                          _predictedShotCount);
+        }
     }
 
     // Create current snapshot
@@ -468,7 +470,9 @@ void GameLoop::processInput() {
     std::vector<RType::Messages::C2S::PlayerInput::InputSnapshot> historyVector(_inputHistory.begin(),
                                                                                 _inputHistory.end());
 
-    RType::Messages::C2S::PlayerInput inputPacket(historyVector);
+    // The render delay lets the server rewind hit detection to what this player saw
+    const uint32_t interpolationDelayMs = _rendering ? _rendering->GetInterpolationDelayMs() : 0;
+    RType::Messages::C2S::PlayerInput inputPacket(historyVector, interpolationDelayMs);
 
     // Serialize and wrap in network message
     std::vector<uint8_t> payload = inputPacket.serialize();
@@ -491,15 +495,19 @@ float GameLoop::calculateDeltaTime() {
 
 void GameLoop::handleNetworkMessage(const NetworkEvent &event) {
     auto messageType = NetworkMessages::getMessageType(event.getData());
+
+    // Game states arrive every tick: read them in place instead of copying the payload
+    if (messageType == NetworkMessages::MessageType::S2C_GAME_STATE) {
+        handleGameState(NetworkMessages::getPayloadView(event.getData()));
+        return;
+    }
+
     auto payload = NetworkMessages::getPayload(event.getData());
 
     switch (messageType) {
         case NetworkMessages::MessageType::S2C_GAME_START:
             handleGameStart(payload);
             break;
-        case NetworkMessages::MessageType::S2C_GAME_STATE:
-            handleGameState(payload);
-            break;
         case NetworkMessages::MessageType::S2C_GAMERULE_UPDATE:
             handleGameruleUpdate(payload);
             break;
@@ -545,12 +553,15 @@ void GameLoop::handleGameStart(const std::vector<uint8_t> &payload) {
                      "', speed=", mapConfig.scrollSpeed, ", parallaxFactor=", mapConfig.parallaxSpeedFactor);
             _rendering->SetBackground(mapConfig.background, mapConfig.parallaxBackground,
                                       mapConfig.scrollSpeed, mapConfig.parallaxSpeedFactor);
+            _rendering->SetWorldScrollOffset(gameStart.initialState.scrollOffset);
         }
 
         for (const auto &entity : gameStart.initialState.entities) {
             if (entity.entityId == gameStart.yourEntityId) {
                 _myEntityId = entity.entityId;
                 _entityInitialized = true;
+                _predictedWeapon = {};
+                _predictedShotCount = 1;
                 LOG_INFO("✓ Stored local player entity ID: ", entity.entityId);
 
                 // Set the entity ID in the rendering system
@@ -675,103 +686,66 @@ void GameLoop::handleEntityDestroyed(const std::vector<uint8_t> &payload) {
     }
 }
 
-void GameLoop::handleGameState(const std::vector<uint8_t> &payload) {
-    try {
-        auto gameState = RType::Messages::S2C::GameState::deserialize(payload);
-
-        // Track which entities are in this GameState
-        std::unordered_set<uint32_t> currentEntityIds;
-
-        for (const auto &entity : gameState.entities) {
-            currentEntityIds.insert(entity.entityId);
-
-            if (entity.entityId == _myEntityId.value_or(0) && _clientSidePredictionEnabled) {
-                processServerReconciliation(entity);
-            } else {
-                _rendering->UpdateEntity(entity.entityId, entity.type, entity.position.x, entity.position.y,
-                                         entity.health.value_or(-1), entity.currentAnimation, entity.spriteX,
-                                         entity.spriteY, entity.spriteW, entity.spriteH);
-            }
-        }
-
-        // Remove entities that no longer exist in the GameState
-        // (e.g., collectibles that were picked up)
-        if (_rendering) {
-            std::vector<uint32_t> entitiesToRemove;
-
-            // Check which previously seen entities are now missing
-            for (uint32_t id : _knownEntityIds) {
-                if (currentEntityIds.find(id) == currentEntityIds.end()) {
-                    entitiesToRemove.push_back(id);
-                }
-            }
+void GameLoop::handleGameState(std::span<const uint8_t> payload) {
+    if (!_rendering) {
+        return;
+    }
 
-            // Remove obsolete entities
-            for (uint32_t id : entitiesToRemove) {
-                _rendering->RemoveEntity(id);
-                LOG_DEBUG("[CLEANUP] Removed entity ", id, " (no longer in GameState)");
+    Profiling::ScopedTimer timer(&_profiler, Profiling::Stage::SnapshotApply);
+    try {
+        // Walk the Cap'n Proto reader in place: no EntityState vector, no ID set per snapshot
+        RType::Messages::S2C::GameState::read(payload, _snapshotBuffer, [this](::GameState::Reader state) {
+            _rendering->SetWorldScrollOffset(state.getScrollOffset());
+
+            uint32_t predictedId = _clientSidePredictionEnabled ? _myEntityId.value_or(0) : 0;
+            auto predicted = _rendering->ApplyGameState(state, predictedId);
+            if (predicted) {
+                processServerReconciliation(*predicted);
             }
-
-            // Update our known entity list
-            _knownEntityIds = currentEntityIds;
-        }
+        });
     } catch (const std::exception &e) {
         LOG_ERROR("Failed to parse GameState: ", e.what());
     }
 }
 
-void GameLoop::processServerReconciliation(const RType::Messages::S2C::EntityState &entity) {
+void GameLoop::processServerReconciliation(::EntityState::Reader entity) {
+    Profiling::ScopedTimer timer(&_profiler, Profiling::Stage::Prediction);
+
+    // Multishot buffs of our ship (older servers do not send it: single shot)
+    _predictedShotCount = std::max<int>(entity.getShotCount(), 1);
+
     // 1. Prune history: Remove inputs already processed by server
-    while (!_inputHistory.empty() && _inputHistory.back().sequenceId <= entity.lastProcessedInput) {
+    while (!_inputHistory.empty() && _inputHistory.back().sequenceId <= entity.getLastProcessedInput()) {
         _inputHistory.pop_back();
     }
 
     // 2. Re-simulate: Start from Server Position
-    float predictedX = entity.position.x;
-    float predictedY = entity.position.y;
+    float predictedX = entity.getPosition().getX();
+    float predictedY = entity.getPosition().getY();
 
     simulateInputHistory(predictedX, predictedY);
 
     if (_rendering) {
-        _rendering->UpdateEntity(entity.entityId, entity.type, predictedX, predictedY,
-                                 entity.health.value_or(-1), entity.currentAnimation, entity.spriteX,
-                                 entity.spriteY, entity.spriteW, entity.spriteH);
+        auto animation = entity.getCurrentAnimation();
+        const int32_t health = entity.getHealth();
+        _rendering->UpdateEntity(entity.getEntityId(),
+                                 RType::Messages::Shared::fromCapnpEntityType(entity.getType()), predictedX,
+                                 predictedY, health >= 0 ? health : -1,
+                                 std::string_view(animation.cStr(), animation.size()), entity.getSpriteX(),
+                                 entity.getSpriteY(), entity.getSpriteW(), entity.getSpriteH());
     }
 }
 
 void GameLoop::simulateInputHistory(float &x, float &y) {
+    // Scaled by the game speed multiplier to match server's slowed game time
+    const float tickTime = _fixedTimestep * _gameSpeedMultiplier;
+    ecs::PlayerRules::Vec2 position{x, y};
     for (auto it = _inputHistory.rbegin(); it != _inputHistory.rend(); ++it) {
-        const auto &snapshot = *it;
-        int dx = 0, dy = 0;
-
-        for (auto act : snapshot.actions) {
-            if (act == RType::Messages::Shared::Action::MoveUp)
-                dy = -1;
-            else if (act == RType::Messages::Shared::Action::MoveDown)
-                dy = 1;
-            else if (act == RType::Messages::Shared::Action::MoveLeft)
-                dx = -1;
-            else if (act == RType::Messages::Shared::Action::MoveRight)
-                dx = 1;
-        }
-
-        if (dx != 0 || dy != 0) {
-            float moveX = static_cast<float>(dx);
-            float moveY = static_cast<float>(dy);
-
-            // Normalize diagonal
-            if (dx != 0 && dy != 0) {
-                float length = std::sqrt(moveX * moveX + moveY * moveY);
-                moveX /= length;
-                moveY /= length;
-            }
-
-            // Scale by game speed multiplier to match server's slowed game time
-            float frameDelta = _playerSpeed * (1.0f / 60.0f) * _gameSpeedMultiplier;
-            x += moveX * frameDelta;
-            y += moveY * frameDelta;
-        }
+        InputPrediction::applyMovement(position, InputPrediction::readActions(it->actions), _playerSpeed,
+                                       tickTime);
     }
+    x = position.x;
+    y = position.y;
 }
 
 void GameLoop::handleGameruleUpdate(const std::vector<uint8_t> &payload) {
@@ -789,6 +763,13 @@ void GameLoop::handleGameruleUpdate(const std::vector<uint8_t> &payload) {
             LOG_INFO("  - Player speed updated to: ", _playerSpeed);
         }
 
+        // Apply player fire rate from gamerules (predicted shots)
+        float fireRate = clientRules.get(GameruleKey::PLAYER_FIRE_RATE, _playerFireRate);
+        if (fireRate != _playerFireRate) {
+            _playerFireRate = fireRate;
+            LOG_INFO("  - Player fire rate updated to: ", _playerFireRate);
+        }
+
         // Apply game speed multiplier from gamerules
         float gameSpeed = clientRules.get(GameruleKey::GAME_SPEED_MULTIPLIER, _gameSpeedMultiplier);
         if (gameSpeed != _gameSpeedMultiplier) {
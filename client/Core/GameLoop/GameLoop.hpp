@@ -14,14 +14,16 @@
 #include <iostream>
 #include <memory>
 #include <optional>
-#include <unordered_set>
+#include <span>
 #include "../common/Logger/Logger.hpp"
 #include "Capnp/Messages/Messages.hpp"
 #include "Capnp/NetworkMessages.hpp"
 #include "Core/EventBus/EventBus.hpp"
+#include "Core/Profiler/FrameProfiler.hpp"
 #include "Events/NetworkEvent/NetworkEvent.hpp"
 #include "Events/UIEvent.hpp"
 #include "Input/InputBuffer.hpp"
+#include "../common/Prediction/InputPrediction.hpp"
 #include "Network/Replicator.hpp"
 #include "Rendering/Rendering.hpp"
 
@@ -231,7 +233,7 @@ class GameLoop {
 
     // Network message handlers
     void handleGameStart(const std::vector<uint8_t> &payload);
-    void handleGameState(const std::vector<uint8_t> &payload);
+    void handleGameState(std::span<const uint8_t> payload);
     void handleGameruleUpdate(const std::vector<uint8_t> &payload);
     void handleRoomList(const std::vector<uint8_t> &payload);
     void handleRoomState(const std::vector<uint8_t> &payload);
@@ -241,7 +243,7 @@ class GameLoop {
     void handleGameOver(const std::vector<uint8_t> &payload);
 
     // Helpers
-    void processServerReconciliation(const RType::Messages::S2C::EntityState &entity);
+    void processServerReconciliation(::EntityState::Reader entity);
     void simulateInputHistory(float &x, float &y);
 
     EventBus *_eventBus;  // Non-owning pointer (owned by Client)
@@ -271,12 +273,18 @@ class GameLoop {
         false;  // Flag to track if we just created the current room           // True after first server update received
     std::string _playerName;                   // Local player's display name (for host detection)
     bool _isMoving = false;                    // True when player is actively moving
-    float _playerSpeed = 300.0f;               // pixels per second (MUST MATCH SERVER!)
+    float _playerSpeed = 300.0f;               // pixels per second (gamerule player.speed)
+    float _playerFireRate = 3.0f;              // shots per second (gamerule player.fireRate)
     bool _clientSidePredictionEnabled = true;  // Client-side prediction for smooth movement
     float _gameSpeedMultiplier = 1.0f;         // Game speed multiplier from server
+    ecs::PlayerRules::WeaponState _predictedWeapon;  // Local weapon charge/cooldown (shot prediction)
+    int _predictedShotCount = 1;                     // Projectiles per shot, replicated with our entity
 
-    // Entity tracking for cleanup
-    std::unordered_set<uint32_t> _knownEntityIds;  // Track all entities we've seen for proper cleanup
+    // Word-aligned copy of the last GameState payload (reused: no allocation per snapshot)
+    std::vector<uint64_t> _snapshotBuffer;
+
+    // Per-stage frame times (overlay and dumps handled by Rendering)
+    Profiling::FrameProfiler _profiler;
 };
 
 #endif
@@ -0,0 +1,209 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** FrameProfiler - Per-stage frame times of the client main loop, kept for the last few seconds
+*/
+
+#include "Core/Profiler/FrameProfiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+
+namespace Profiling {
+    namespace {
+        constexpr std::array<const char *, STAGE_COUNT> STAGE_NAMES = {
+            "Network drain", "Snapshot apply", "Interpolation", "Prediction", "UI update", "Draw submission"};
+
+        constexpr std::array<const char *, STAGE_COUNT> CSV_COLUMNS = {
+            "network_drain_ms", "snapshot_apply_ms", "interpolation_ms",
+            "prediction_ms",    "ui_update_ms",      "draw_submission_ms"};
+
+        constexpr double MS = 1000.0;
+        constexpr double US = 1000000.0;
+
+        /**
+         * @brief Fixed-point output for the dump, restoring the stream's format afterwards
+         */
+        class FixedFormat {
+           public:
+            FixedFormat(std::ostream &out, int precision)
+                : _out(out), _flags(out.flags()), _precision(out.precision()) {
+                _out << std::fixed << std::setprecision(precision);
+            }
+
+            ~FixedFormat() {
+                _out.flags(_flags);
+                _out.precision(_precision);
+            }
+
+            FixedFormat(const FixedFormat &) = delete;
+            FixedFormat &operator=(const FixedFormat &) = delete;
+
+           private:
+            std::ostream &_out;
+            std::ios::fmtflags _flags;
+            std::streamsize _precision;
+        };
+    }  // namespace
+
+    const char *stageName(Stage stage) {
+        const auto index = static_cast<size_t>(stage);
+        return index < STAGE_COUNT ? STAGE_NAMES[index] : "Unknown";
+    }
+
+    double FrameSample::other() const {
+        double staged = 0.0;
+        for (double stage : stageSeconds) {
+            staged += stage;
+        }
+        return std::max(0.0, seconds - staged);
+    }
+
+    FrameProfiler::FrameProfiler(TimeSource now) : _now(now), _origin(now()) {}
+
+    double FrameProfiler::steadySeconds() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void FrameProfiler::beginFrame() {
+        const double now = _now() - _origin;
+        if (_frameOpen) {
+            _current.seconds = now - _current.start;
+            _history[_next] = _current;
+            _next = (_next + 1) % HISTORY;
+            _count = std::min(_count + 1, HISTORY);
+        }
+
+        _current = FrameSample{};
+        _current.index = _frameIndex++;
+        _current.start = now;
+        _frameOpen = true;
+        _entered = 0;
+        _depth = 0;  // A stage left open by the previous frame is not carried over
+    }
+
+    void FrameProfiler::beginStage(Stage stage) {
+        const double now = _now() - _origin;
+        if (_depth > 0 && _depth <= MAX_DEPTH) {
+            _current.stageSeconds[static_cast<size_t>(_stack[_depth - 1])] += now - _segmentStart;
+        }
+        if (_depth < MAX_DEPTH) {
+            _stack[_depth] = stage;
+            const uint32_t bit = 1U << static_cast<uint32_t>(stage);
+            if ((_entered & bit) == 0) {
+                _entered |= bit;
+                _current.stageStart[static_cast<size_t>(stage)] = now - _current.start;
+            }
+        }
+        _depth++;
+        _segmentStart = now;
+    }
+
+    void FrameProfiler::endStage() {
+        if (_depth == 0) {
+            return;
+        }
+        const double now = _now() - _origin;
+        if (_depth <= MAX_DEPTH) {
+            _current.stageSeconds[static_cast<size_t>(_stack[_depth - 1])] += now - _segmentStart;
+        }
+        _depth--;
+        _segmentStart = now;
+    }
+
+    const FrameSample &FrameProfiler::getFrame(size_t age) const {
+        return _history[(_next + HISTORY - 1 - age) % HISTORY];
+    }
+
+    ProfileSummary FrameProfiler::summarize() const {
+        ProfileSummary summary;
+        summary.frames = _count;
+        if (_count == 0) {
+            return summary;
+        }
+        for (size_t age = 0; age < _count; ++age) {
+            const FrameSample &frame = getFrame(age);
+            summary.averageFrame += frame.seconds;
+            summary.maxFrame = std::max(summary.maxFrame, frame.seconds);
+            for (size_t stage = 0; stage < STAGE_COUNT; ++stage) {
+                summary.averageStage[stage] += frame.stageSeconds[stage];
+                summary.maxStage[stage] = std::max(summary.maxStage[stage], frame.stageSeconds[stage]);
+            }
+        }
+        const auto frames = static_cast<double>(_count);
+        summary.averageFrame /= frames;
+        for (double &average : summary.averageStage) {
+            average /= frames;
+        }
+        return summary;
+    }
+
+    void FrameProfiler::writeCsv(std::ostream &out) const {
+        const FixedFormat format(out, 3);
+        out << "frame,start_ms,frame_ms";
+        for (const char *column : CSV_COLUMNS) {
+            out << ',' << column;
+        }
+        out << ",other_ms\n";
+
+        for (size_t age = _count; age-- > 0;) {
+            const FrameSample &frame = getFrame(age);
+            out << frame.index << ',' << frame.start * MS << ',' << frame.seconds * MS;
+            for (double stage : frame.stageSeconds) {
+                out << ',' << stage * MS;
+            }
+            out << ',' << frame.other() * MS << '\n';
+        }
+    }
+
+    void FrameProfiler::writeChromeTrace(std::ostream &out) const {
+        const FixedFormat format(out, 1);  // Microseconds
+
+        // Row names: the frames on tid 0, each stage on its own row below
+        out << "{\"traceEvents\":[\n";
+        out << R"({"name":"thread_name","ph":"M","pid":1,"tid":0,"args":{"name":"Frame"}})";
+        for (size_t stage = 0; stage < STAGE_COUNT; ++stage) {
+            out << ",\n"
+                << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << stage + 1
+                << R"(,"args":{"name":")" << STAGE_NAMES[stage] << "\"}}";
+        }
+
+        for (size_t age = _count; age-- > 0;) {
+            const FrameSample &frame = getFrame(age);
+            out << ",\n"
+                << R"({"name":"Frame","ph":"X","pid":1,"tid":0,"ts":)" << frame.start * US
+                << R"(,"dur":)" << frame.seconds * US << R"(,"args":{"frame":)" << frame.index << "}}";
+            for (size_t stage = 0; stage < STAGE_COUNT; ++stage) {
+                if (frame.stageSeconds[stage] <= 0.0) {
+                    continue;
+                }
+                out << ",\n"
+                    << R"({"name":")" << STAGE_NAMES[stage] << R"(","ph":"X","pid":1,"tid":)" << stage + 1
+                    << R"(,"ts":)" << (frame.start + frame.stageStart[stage]) * US << R"(,"dur":)"
+                    << frame.stageSeconds[stage] * US << R"(,"args":{"frame":)" << frame.index << "}}";
+            }
+        }
+        out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    bool FrameProfiler::dump(const std::string &basePath) const {
+        const std::filesystem::path base(basePath);
+        std::error_code error;
+        if (base.has_parent_path()) {
+            std::filesystem::create_directories(base.parent_path(), error);
+        }
+
+        std::ofstream csv(basePath + ".csv");
+        std::ofstream trace(basePath + ".trace.json");
+        if (!csv || !trace) {
+            return false;
+        }
+        writeCsv(csv);
+        writeChromeTrace(trace);
+        return csv.good() && trace.good();
+    }
+}  // namespace Profiling
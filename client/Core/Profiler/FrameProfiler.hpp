@@ -0,0 +1,182 @@
+/*
+** EPITECH PROJECT, 2025
+** r-type
+** File description:
+** FrameProfiler - Per-stage frame times of the client main loop, kept for the last few seconds
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace Profiling {
+    /**
+     * @brief Instrumented parts of a client frame
+     */
+    enum class Stage : uint8_t {
+        NetworkDrain,    ///< Replicator::processMessages() and the deferred EventBus events
+        SnapshotApply,   ///< Decoding and applying a GameState
+        Interpolation,   ///< Remote entity interpolation
+        Prediction,      ///< Local input prediction and server reconciliation
+        UIUpdate,        ///< Menus, chat and HUD logic
+        DrawSubmission,  ///< Draw calls, up to (not including) the buffer swap
+        Count
+    };
+
+    inline constexpr size_t STAGE_COUNT = static_cast<size_t>(Stage::Count);
+
+    /**
+     * @brief Human-readable stage name (overlay legend, CSV header, trace rows)
+     */
+    const char *stageName(Stage stage);
+
+    /**
+     * @brief Timings of one frame
+     *
+     * Stage times are exclusive: a stage running inside another one (a
+     * snapshot applied while draining the network) is not counted in its
+     * parent, so the stages of a frame add up to at most its duration. The
+     * rest (buffer swap and frame cap wait, texture uploads...) is other().
+     */
+    struct FrameSample {
+        uint64_t index = 0;    ///< Frame number since the profiler was created
+        double start = 0.0;    ///< Seconds since the profiler was created
+        double seconds = 0.0;  ///< Whole frame, up to the start of the next one
+        std::array<double, STAGE_COUNT> stageSeconds{};  ///< Exclusive time of each stage
+        std::array<double, STAGE_COUNT> stageStart{};    ///< First entry in each stage, from the frame start
+
+        /**
+         * @brief Time spent outside every stage
+         */
+        [[nodiscard]] double other() const;
+    };
+
+    /**
+     * @brief Average and worst frame over the recorded history
+     */
+    struct ProfileSummary {
+        size_t frames = 0;
+        double averageFrame = 0.0;
+        double maxFrame = 0.0;
+        std::array<double, STAGE_COUNT> averageStage{};
+        std::array<double, STAGE_COUNT> maxStage{};
+    };
+
+    /**
+     * @brief Frame-time recorder of the client main loop
+     *
+     * The loop calls beginFrame() once per iteration; the instrumented code
+     * brackets its stages with ScopedTimer. The last HISTORY frames are kept
+     * in a ring buffer (no allocation while recording), always on, so a hitch
+     * can still be dumped after it happened: writeCsv() for spreadsheets,
+     * writeChromeTrace() for chrome://tracing or Perfetto.
+     *
+     * Main thread only.
+     */
+    class FrameProfiler {
+       public:
+        using TimeSource = double (*)();
+
+        static constexpr size_t HISTORY = 300;  ///< Five seconds at 60 FPS
+        static constexpr size_t MAX_DEPTH = 8;  ///< Nested stages tracked (deeper ones are ignored)
+
+        /**
+         * @param now Clock in seconds (steady clock by default, injectable for tests)
+         */
+        explicit FrameProfiler(TimeSource now = steadySeconds);
+
+        /**
+         * @brief Close the current frame (if any) into the history and start the next one
+         */
+        void beginFrame();
+
+        /**
+         * @brief Enter a stage (pauses the enclosing one)
+         */
+        void beginStage(Stage stage);
+
+        /**
+         * @brief Leave the innermost stage (resumes the enclosing one)
+         */
+        void endStage();
+
+        /**
+         * @brief Frames recorded, up to HISTORY
+         */
+        [[nodiscard]] size_t getFrameCount() const { return _count; }
+
+        /**
+         * @brief A recorded frame
+         * @param age 0 for the last completed frame, up to getFrameCount() - 1
+         */
+        [[nodiscard]] const FrameSample &getFrame(size_t age) const;
+
+        [[nodiscard]] ProfileSummary summarize() const;
+
+        /**
+         * @brief One line per recorded frame, oldest first, times in milliseconds
+         */
+        void writeCsv(std::ostream &out) const;
+
+        /**
+         * @brief Chrome trace event format: one row per stage, a complete event per stage and frame
+         */
+        void writeChromeTrace(std::ostream &out) const;
+
+        /**
+         * @brief Write @p basePath.csv and @p basePath.trace.json (parent directories are created)
+         * @return False if a file could not be written
+         */
+        bool dump(const std::string &basePath) const;
+
+        /**
+         * @brief Seconds of std::chrono::steady_clock
+         */
+        static double steadySeconds();
+
+       private:
+        TimeSource _now;
+        double _origin;  ///< Clock value at construction
+
+        std::array<FrameSample, HISTORY> _history{};
+        size_t _next = 0;   ///< Slot of the next completed frame
+        size_t _count = 0;  ///< Completed frames in _history
+
+        FrameSample _current{};
+        bool _frameOpen = false;
+        uint64_t _frameIndex = 0;
+        uint32_t _entered = 0;  ///< Bit per stage already entered this frame
+
+        std::array<Stage, MAX_DEPTH> _stack{};
+        size_t _depth = 0;           ///< Open stages, including ignored ones past MAX_DEPTH
+        double _segmentStart = 0.0;  ///< When the innermost stage last started or resumed
+    };
+
+    /**
+     * @brief Times the enclosing scope as a stage (does nothing without a profiler)
+     */
+    class ScopedTimer {
+       public:
+        ScopedTimer(FrameProfiler *profiler, Stage stage) : _profiler(profiler) {
+            if (_profiler != nullptr) {
+                _profiler->beginStage(stage);
+            }
+        }
+
+        ~ScopedTimer() {
+            if (_profiler != nullptr) {
+                _profiler->endStage();
+            }
+        }
+
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+       private:
+        FrameProfiler *_profiler;
+    };
+}  // namespace Profiling
@@ -0,0 +1,279 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** HeadlessGraphics
+*/
+
+#include "HeadlessGraphics.hpp"
+
+namespace Graphics {
+    HeadlessGraphics::HeadlessGraphics() : _start(std::chrono::steady_clock::now()) {}
+
+    // Window management
+
+    void HeadlessGraphics::InitWindow(int width, int height, const char *) {
+        _width = width;
+        _height = height;
+        _windowOpen = true;
+    }
+
+    void HeadlessGraphics::ClearWindow() {}
+
+    void HeadlessGraphics::StartDrawing() {}
+
+    void HeadlessGraphics::DisplayWindow() {}
+
+    bool HeadlessGraphics::IsWindowOpen() const {
+        return _windowOpen;
+    }
+
+    void HeadlessGraphics::CloseWindow() {
+        _windowOpen = false;
+    }
+
+    int HeadlessGraphics::GetWindowWidth() const {
+        return _width;
+    }
+
+    int HeadlessGraphics::GetWindowHeight() const {
+        return _height;
+    }
+
+    void HeadlessGraphics::SetWindowTitle(const char *) {}
+
+    void HeadlessGraphics::SetWindowSize(int width, int height) {
+        _width = width;
+        _height = height;
+    }
+
+    void HeadlessGraphics::ToggleFullScreen() {}
+
+    void HeadlessGraphics::SetTargetFPS(int fps) {
+        if (fps > 0) {
+            _frameTime = 1.0f / static_cast<float>(fps);
+        }
+    }
+
+    void HeadlessGraphics::SetClearColor(unsigned int) {}
+
+    void HeadlessGraphics::TakeScreenshot(const char *) {}
+
+    // Time / profiling
+
+    float HeadlessGraphics::GetTime() const {
+        return std::chrono::duration<float>(std::chrono::steady_clock::now() - _start).count();
+    }
+
+    float HeadlessGraphics::GetDeltaTime() const {
+        return _frameTime;
+    }
+
+    // Basic drawing primitives
+
+    void HeadlessGraphics::DrawRect(int, int, int, int, unsigned int) {
+        _drawCalls++;
+    }
+
+    void HeadlessGraphics::DrawRectFilled(int, int, int, int, unsigned int) {
+        _drawCalls++;
+    }
+
+    void HeadlessGraphics::DrawCircle(int, int, int, unsigned int) {
+        _drawCalls++;
+    }
+
+    void HeadlessGraphics::DrawCircleFilled(int, int, int, unsigned int) {
+        _drawCalls++;
+    }
+
+    // Fonts / text
+
+    int HeadlessGraphics::LoadFont(const char *, int) {
+        return -1;  // Callers fall back to the default font
+    }
+
+    void HeadlessGraphics::UnloadFont(int) {}
+
+    void HeadlessGraphics::DrawText(int, const char *, int, int, int, unsigned int) {
+        _drawCalls++;
+    }
+
+    int HeadlessGraphics::GetFontHeight(int, int fontSize) {
+        return fontSize;
+    }
+
+    // Textures / sprites / images
+
+    TextureHandle HeadlessGraphics::RegisterTexture(const char *textureName) {
+        const auto nextHandle = static_cast<TextureHandle>(_textureHandles.size());
+        return _textureHandles.try_emplace(textureName, nextHandle).first->second;
+    }
+
+    int HeadlessGraphics::LoadTexture(const char *textureName, const char *) {
+        return RegisterTexture(textureName);  // The file is not read: there is nothing to draw it on
+    }
+
+    bool HeadlessGraphics::DecodeImage(const char *, DecodedImage &image) const {
+        image = DecodedImage{};  // Nothing to draw it on: an empty image uploads as a named texture
+        return true;
+    }
+
+    int HeadlessGraphics::CreateTextureFromMemory(const char *textureName, const void *, int, int, int) {
+        return RegisterTexture(textureName);
+    }
+
+    void HeadlessGraphics::UpdateTexture(const char *, const void *) {}
+
+    void HeadlessGraphics::UnloadTexture(const char *) {}
+
+    void HeadlessGraphics::DrawTexture(const char *, int, int, unsigned int) {
+        _drawCalls++;
+    }
+
+    void HeadlessGraphics::DrawTextureEx(const char *, int, int, int, int, float, float, float, float,
+                                         unsigned int) {
+        _drawCalls++;
+    }
+
+    bool HeadlessGraphics::GetTextureSize(const char *, int &width, int &height) const {
+        width = 0;
+        height = 0;
+        return false;
+    }
+
+    void HeadlessGraphics::DrawTexturePro(const char *, int, int, int, int, float, float, float, float,
+                                          unsigned int) {
+        _drawCalls++;
+    }
+
+    TextureHandle HeadlessGraphics::GetTextureHandle(const char *textureName) const {
+        auto iter = _textureHandles.find(textureName);
+        return iter != _textureHandles.end() ? iter->second : INVALID_TEXTURE;
+    }
+
+    void HeadlessGraphics::DrawSpriteRun(TextureHandle, std::span<const SpriteDraw> sprites) {
+        _drawCalls += sprites.size();
+    }
+
+    // Input helpers
+
+    bool HeadlessGraphics::IsKeyPressed(int) const {
+        return false;
+    }
+
+    bool HeadlessGraphics::IsKeyDown(int) const {
+        return false;
+    }
+
+    bool HeadlessGraphics::IsKeyReleased(int) const {
+        return false;
+    }
+
+    bool HeadlessGraphics::IsGamepadAvailable(int) const {
+        return false;
+    }
+
+    bool HeadlessGraphics::IsGamepadButtonPressed(int, int) const {
+        return false;
+    }
+
+    bool HeadlessGraphics::IsGamepadButtonDown(int, int) const {
+        return false;
+    }
+
+    float HeadlessGraphics::GetGamepadAxisMovement(int, int) const {
+        return 0.0f;
+    }
+
+    bool HeadlessGraphics::IsMouseButtonPressed(int) const {
+        return false;
+    }
+
+    bool HeadlessGraphics::IsMouseButtonDown(int) const {
+        return false;
+    }
+
+    void HeadlessGraphics::GetMousePosition(float &x, float &y) const {
+        x = 0.0f;
+        y = 0.0f;
+    }
+
+    bool HeadlessGraphics::WindowShouldClose() const {
+        return !_windowOpen;
+    }
+
+    int HeadlessGraphics::GetMouseX() const {
+        return 0;
+    }
+
+    int HeadlessGraphics::GetMouseY() const {
+        return 0;
+    }
+
+    int HeadlessGraphics::GetCharPressed() const {
+        return 0;
+    }
+
+    int HeadlessGraphics::GetScreenWidth() const {
+        return _width;
+    }
+
+    int HeadlessGraphics::GetScreenHeight() const {
+        return _height;
+    }
+
+    void HeadlessGraphics::DrawRectangle(int, int, int, int, unsigned int) {
+        _drawCalls++;
+    }
+
+    void HeadlessGraphics::DrawRectangleLines(int, int, int, int, unsigned int) {
+        _drawCalls++;
+    }
+
+    void HeadlessGraphics::DrawText(const char *, int, int, int, unsigned int) {
+        _drawCalls++;
+    }
+
+    // Colorblind filter
+
+    void HeadlessGraphics::SetColorblindFilter(ColorblindFilterType filter) {
+        _colorblindFilter = filter;
+    }
+
+    ColorblindFilterType HeadlessGraphics::GetColorblindFilter() const {
+        return _colorblindFilter;
+    }
+
+    void HeadlessGraphics::BeginColorblindCapture() {}
+
+    void HeadlessGraphics::EndColorblindCapture() {}
+
+    // Audio management
+
+    void HeadlessGraphics::InitAudioDevice() {
+        _audioInitialized = true;
+    }
+
+    void HeadlessGraphics::CloseAudioDevice() {
+        _audioInitialized = false;
+    }
+
+    bool HeadlessGraphics::IsAudioDeviceReady() const {
+        return _audioInitialized;
+    }
+
+    bool HeadlessGraphics::LoadSound(const char *, const char *) {
+        return true;
+    }
+
+    void HeadlessGraphics::UnloadSound(const char *) {}
+
+    void HeadlessGraphics::PlaySound(const char *) {}
+
+    void HeadlessGraphics::SetSoundVolume(const char *, float) {}
+
+    bool HeadlessGraphics::IsSoundPlaying(const char *) const {
+        return false;
+    }
+}  // namespace Graphics
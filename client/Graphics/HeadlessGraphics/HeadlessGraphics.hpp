@@ -0,0 +1,145 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** HeadlessGraphics - IGraphics backend that draws nothing
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include "../IGraphics.hpp"
+
+namespace Graphics {
+    /**
+     * @brief IGraphics implementation without a window, GPU or audio device
+     *
+     * Every draw call is counted and discarded, input reports nothing
+     * pressed and resources load without touching the disk (textures still
+     * get handles). Used to run the client rendering code where no display
+     * exists (benchmarks, tests, load-testing bots) and to measure its CPU
+     * cost alone.
+     */
+    class HeadlessGraphics : public IGraphics {
+       public:
+        /**
+         * @brief Construct a headless backend with a 1920x1080 virtual window
+         */
+        HeadlessGraphics();
+        ~HeadlessGraphics() override = default;
+
+        /**
+         * @brief Get the number of draw calls received since the last reset
+         */
+        [[nodiscard]] size_t GetDrawCallCount() const { return _drawCalls; }
+
+        /**
+         * @brief Reset the draw call counter
+         */
+        void ResetDrawCallCount() { _drawCalls = 0; }
+
+        // Window management
+        void InitWindow(int width, int height, const char *title) override;
+        void ClearWindow() override;
+        void StartDrawing() override;
+        void DisplayWindow() override;
+        bool IsWindowOpen() const override;
+        void CloseWindow() override;
+        [[nodiscard]] int GetWindowWidth() const override;
+        [[nodiscard]] int GetWindowHeight() const override;
+        void SetWindowTitle(const char *title) override;
+        void SetWindowSize(int width, int height) override;
+        void ToggleFullScreen() override;
+        void SetTargetFPS(int fps) override;
+        void SetClearColor(unsigned int color) override;
+        void TakeScreenshot(const char *filepath) override;
+
+        // Time / profiling
+        float GetTime() const override;
+        float GetDeltaTime() const override;
+
+        // Basic drawing primitives
+        void DrawRect(int x, int y, int width, int height, unsigned int color) override;
+        void DrawRectFilled(int x, int y, int width, int height, unsigned int color) override;
+        void DrawCircle(int x, int y, int radius, unsigned int color) override;
+        void DrawCircleFilled(int x, int y, int radius, unsigned int color) override;
+
+        // Fonts / text
+        int LoadFont(const char *filepath, int size) override;
+        void UnloadFont(int fontHandle) override;
+        void DrawText(int fontHandle, const char *text, int x, int y, int fontSize,
+                      unsigned int color) override;
+        int GetFontHeight(int fontHandle, int fontSize) override;
+
+        // Textures / sprites / images
+        int LoadTexture(const char *name, const char *filepath) override;
+        bool DecodeImage(const char *filepath, DecodedImage &image) const override;
+        int CreateTextureFromMemory(char const *textureName, const void *pixels, int width, int height,
+                                    int format) override;
+        void UpdateTexture(const char *textureName, const void *pixels) override;
+        void UnloadTexture(const char *textureName) override;
+        void DrawTexture(const char *textureName, int x, int y, unsigned int tint) override;
+        void DrawTextureEx(const char *textureName, int srcX, int srcY, int srcW, int srcH, float destX,
+                           float destY, float rotation, float scale, unsigned int tint) override;
+        bool GetTextureSize(const char *textureName, int &width, int &height) const override;
+        void DrawTexturePro(const char *textureName, int srcX, int srcY, int srcW, int srcH, float destX,
+                            float destY, float destW, float destH, unsigned int tint) override;
+        [[nodiscard]] TextureHandle GetTextureHandle(const char *textureName) const override;
+        void DrawSpriteRun(TextureHandle texture, std::span<const SpriteDraw> sprites) override;
+
+        // Input helpers
+        bool IsKeyPressed(int key) const override;
+        bool IsKeyDown(int key) const override;
+        bool IsKeyReleased(int key) const override;
+        bool IsGamepadAvailable(int gamepad) const override;
+        bool IsGamepadButtonPressed(int gamepad, int button) const override;
+        bool IsGamepadButtonDown(int gamepad, int button) const override;
+        float GetGamepadAxisMovement(int gamepad, int axis) const override;
+        bool IsMouseButtonPressed(int button) const override;
+        bool IsMouseButtonDown(int button) const override;
+        void GetMousePosition(float &x, float &y) const override;
+        bool WindowShouldClose() const override;
+        int GetMouseX() const override;
+        int GetMouseY() const override;
+        int GetCharPressed() const override;
+        int GetScreenWidth() const override;
+        int GetScreenHeight() const override;
+        void DrawRectangle(int x, int y, int width, int height, unsigned int color) override;
+        void DrawRectangleLines(int x, int y, int width, int height, unsigned int color) override;
+        void DrawText(const char *text, int x, int y, int fontSize, unsigned int color) override;
+
+        // Colorblind filter
+        void SetColorblindFilter(ColorblindFilterType filter) override;
+        [[nodiscard]] ColorblindFilterType GetColorblindFilter() const override;
+        void BeginColorblindCapture() override;
+        void EndColorblindCapture() override;
+        // Audio management
+        void InitAudioDevice() override;
+        void CloseAudioDevice() override;
+        bool IsAudioDeviceReady() const override;
+        bool LoadSound(const char *soundName, const char *filepath) override;
+        void UnloadSound(const char *soundName) override;
+        void PlaySound(const char *soundName) override;
+        void SetSoundVolume(const char *soundName, float volume) override;
+        bool IsSoundPlaying(const char *soundName) const override;
+
+       private:
+        /**
+         * @brief Give a texture name a handle (the same one if the name was loaded before)
+         */
+        TextureHandle RegisterTexture(const char *textureName);
+
+        std::unordered_map<std::string, TextureHandle> _textureHandles;  ///< Handle of each texture name
+        std::chrono::steady_clock::time_point _start;  ///< Reference of GetTime()
+        int _width = 1920;                             ///< Virtual window width
+        int _height = 1080;                            ///< Virtual window height
+        float _frameTime = 1.0f / 60.0f;               ///< Delta time reported (from SetTargetFPS)
+        bool _windowOpen = false;                      ///< Set by InitWindow(), cleared by CloseWindow()
+        bool _audioInitialized = false;                ///< Set by InitAudioDevice()
+        size_t _drawCalls = 0;                         ///< Draw calls since the last reset
+        ColorblindFilterType _colorblindFilter{ColorblindFilterType::NONE};
+    };
+}  // namespace Graphics
@@ -7,6 +7,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
 namespace Graphics {
 
     /**
@@ -20,6 +26,45 @@ namespace Graphics {
         MONOCHROMACY = 4   ///< Complete color blindness (grayscale)
     };
 
+    /**
+     * @brief Integer handle of a loaded texture
+     *
+     * Returned by LoadTexture() or GetTextureHandle() and kept by the caller,
+     * so drawing does not look the texture up by name.
+     */
+    using TextureHandle = int;
+
+    inline constexpr TextureHandle INVALID_TEXTURE = -1;  ///< Texture not loaded
+
+    /// 8-bit RGBA pixels, the format of DecodedImage (raylib's PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    inline constexpr int PIXEL_FORMAT_RGBA8 = 7;
+
+    /**
+     * @brief Image decoded in CPU memory, ready to be uploaded as a texture
+     */
+    struct DecodedImage {
+        std::vector<unsigned char> pixels;  ///< PIXEL_FORMAT_RGBA8 pixels, row by row
+        int width = 0;                      ///< Width in pixels
+        int height = 0;                     ///< Height in pixels
+    };
+
+    /**
+     * @brief One textured quad of a sprite batch
+     */
+    struct SpriteDraw {
+        TextureHandle texture;  ///< Texture to sample
+        float srcX;             ///< Source rectangle X in the texture
+        float srcY;             ///< Source rectangle Y in the texture
+        float srcW;             ///< Source rectangle width
+        float srcH;             ///< Source rectangle height
+        float destX;            ///< Destination X (top-left corner)
+        float destY;            ///< Destination Y (top-left corner)
+        float destW;            ///< Destination width
+        float destH;            ///< Destination height
+        unsigned int tint;      ///< Tint color in 0xAARRGGBB format
+        uint8_t layer = 0;      ///< Draw order between textures: lower layers are drawn first
+    };
+
     /**
  * @brief Abstract interface for graphics rendering operations
  * 
@@ -216,18 +261,29 @@ namespace Graphics {
 
         /**
      * @brief Load a texture from an image file
+     * @param textureName Name the texture is registered under (reloading a name keeps its handle)
      * @param filepath Path to the image file (e.g., .png, .jpg)
-     * @return Texture handle (integer ID) for use in drawing operations
+     * @return Texture handle for DrawSpriteBatch(), or INVALID_TEXTURE on failure
      */
         virtual int LoadTexture(const char *textureName, const char *filepath) = 0;
 
+        /**
+     * @brief Decode an image file to RGBA pixels, without touching the GPU
+     * @param filepath Path to the image file (e.g., .png, .gif: first frame)
+     * @param image Receives the pixels, to upload with CreateTextureFromMemory(PIXEL_FORMAT_RGBA8)
+     * @return true if the file was decoded
+     *
+     * Thread-safe: unlike LoadTexture(), it can run on a worker thread.
+     */
+        virtual bool DecodeImage(const char *filepath, DecodedImage &image) const = 0;
+
         /**
      * @brief Create a texture from raw pixel data in memory
      * @param pixels Pointer to raw pixel data
      * @param width Width of the texture in pixels
      * @param height Height of the texture in pixels
      * @param format Pixel format (implementation-specific)
-     * @return Texture handle (integer ID) for use in drawing operations
+     * @return Texture handle for DrawSpriteBatch(), or INVALID_TEXTURE on failure
      */
         virtual int CreateTextureFromMemory(const char *textureName, const void *pixels, int width,
                                             int height, int format) = 0;
@@ -280,6 +336,51 @@ namespace Graphics {
      */
         virtual bool GetTextureSize(const char *textureName, int &width, int &height) const = 0;
 
+        /**
+     * @brief Resolve the handle of a texture loaded by name
+     * @param textureName Name of the texture
+     * @return The handle, or INVALID_TEXTURE if no texture was loaded under that name
+     *
+     * Resolve once and keep the handle: it stays valid while the texture is
+     * loaded and is reused if the same name is loaded again.
+     */
+        [[nodiscard]] virtual TextureHandle GetTextureHandle(const char *textureName) const = 0;
+
+        /**
+     * @brief Draw many sprites in one call, grouped by texture
+     * @param sprites Sprites to draw (reordered in place)
+     *
+     * Sprites are sorted by layer, then by texture handle, keeping the
+     * submission order within a layer and texture, then each run of one
+     * texture is handed to DrawSpriteRun() in a single pass. Layers are drawn
+     * back to front; order between textures of the same layer is not kept.
+     * A batch that is already sorted is not reordered (and does not allocate).
+     */
+        void DrawSpriteBatch(std::span<SpriteDraw> sprites) {
+            auto byLayerThenTexture = [](const SpriteDraw &lhs, const SpriteDraw &rhs) {
+                return lhs.layer != rhs.layer ? lhs.layer < rhs.layer : lhs.texture < rhs.texture;
+            };
+            if (!std::is_sorted(sprites.begin(), sprites.end(), byLayerThenTexture)) {
+                std::stable_sort(sprites.begin(), sprites.end(), byLayerThenTexture);
+            }
+            for (size_t first = 0; first < sprites.size();) {
+                size_t last = first + 1;
+                while (last < sprites.size() && sprites[last].texture == sprites[first].texture &&
+                       sprites[last].layer == sprites[first].layer) {
+                    last++;
+                }
+                DrawSpriteRun(sprites[first].texture, sprites.subspan(first, last - first));
+                first = last;
+            }
+        }
+
+        /**
+     * @brief Draw sprites sharing one texture (called by DrawSpriteBatch())
+     * @param texture Texture of every sprite of the run (may be INVALID_TEXTURE or unloaded)
+     * @param sprites Sprites to draw in order
+     */
+        virtual void DrawSpriteRun(TextureHandle texture, std::span<const SpriteDraw> sprites) = 0;
+
         /**
      * @brief Draw a texture with separate width/height scaling (for non-uniform scaling)
      * @param textureName Name of the texture to draw
@@ -16,8 +16,10 @@ namespace Graphics {
         for (const Font &font : _fonts) {
             ::UnloadFont(font);
         }
-        for (const auto &[name, texture] : _textures) {
-            ::UnloadTexture(texture);
+        for (const Texture2D &texture : _textures) {
+            if (texture.id != 0) {
+                ::UnloadTexture(texture);
+            }
         }
         for (const auto &[name, sound] : _sounds) {
             ::UnloadSound(sound);
@@ -185,12 +187,52 @@ namespace Graphics {
     }
 
     // Textures / sprites / images
+    TextureHandle RaylibGraphics::RegisterTexture(const char *textureName, Texture2D texture) {
+        const auto nextHandle = static_cast<TextureHandle>(_textures.size());
+        auto [iter, inserted] = _textureHandles.try_emplace(textureName, nextHandle);
+        if (inserted) {
+            _textures.push_back(texture);
+        } else {
+            Texture2D &previous = _textures[iter->second];
+            if (previous.id != 0) {
+                ::UnloadTexture(previous);
+            }
+            previous = texture;
+        }
+        return iter->second;
+    }
+
+    const Texture2D *RaylibGraphics::FindTexture(const char *textureName) const {
+        auto iter = _textureHandles.find(textureName);
+        if (iter == _textureHandles.end() || _textures[iter->second].id == 0) {
+            return nullptr;
+        }
+        return &_textures[iter->second];
+    }
+
     int RaylibGraphics::LoadTexture(const char *textureName, const char *filepath) {
         Texture2D texture = ::LoadTexture(filepath);
         if (texture.id == 0)
-            return -1;
-        _textures[textureName] = texture;
-        return 0;
+            return INVALID_TEXTURE;
+        return RegisterTexture(textureName, texture);
+    }
+
+    bool RaylibGraphics::DecodeImage(const char *filepath, DecodedImage &image) const {
+        static_assert(PIXEL_FORMAT_RGBA8 == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+        // CPU only (stb_image): no GL call, safe off the main thread
+        Image decoded = ::LoadImage(filepath);
+        if (decoded.data == nullptr) {
+            return false;
+        }
+        ::ImageFormat(&decoded, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+        const auto *pixels = static_cast<const unsigned char *>(decoded.data);
+        image.width = decoded.width;
+        image.height = decoded.height;
+        image.pixels.assign(pixels, pixels + static_cast<size_t>(decoded.width) * decoded.height * 4);
+        ::UnloadImage(decoded);
+        return true;
     }
 
     int RaylibGraphics::CreateTextureFromMemory(const char *textureName, const void *pixels, int width,
@@ -203,43 +245,40 @@ namespace Graphics {
         img.mipmaps = 1;
         Texture2D texture = ::LoadTextureFromImage(img);
         if (texture.id == 0)
-            return -1;
-        _textures[textureName] = texture;
-        return 0;
+            return INVALID_TEXTURE;
+        return RegisterTexture(textureName, texture);
     }
 
     void RaylibGraphics::UpdateTexture(const char *textureName, const void *pixels) {
-        auto iter = _textures.find(textureName);
-        if (iter != _textures.end()) {
-            ::UpdateTexture(iter->second, pixels);
+        if (const Texture2D *texture = FindTexture(textureName)) {
+            ::UpdateTexture(*texture, pixels);
         }
     }
 
     void RaylibGraphics::UnloadTexture(const char *textureName) {
-        auto iter = _textures.find(textureName);
-        if (iter != _textures.end()) {
-            ::UnloadTexture(iter->second);
-            _textures.erase(iter);
+        auto iter = _textureHandles.find(textureName);
+        if (iter != _textureHandles.end() && _textures[iter->second].id != 0) {
+            // The name keeps its handle: holders skip it until it is loaded again
+            ::UnloadTexture(_textures[iter->second]);
+            _textures[iter->second] = Texture2D{};
         }
     }
 
     void RaylibGraphics::DrawTexture(const char *textureName, int xPos, int yPos, unsigned int tint) {
-        auto iter = _textures.find(textureName);
-        if (iter != _textures.end()) {
+        if (const Texture2D *texture = FindTexture(textureName)) {
             Color clr;
             clr.a = (tint >> 24) & 0xFF;
             clr.r = (tint >> 16) & 0xFF;
             clr.g = (tint >> 8) & 0xFF;
             clr.b = tint & 0xFF;
-            ::DrawTexture(iter->second, xPos, yPos, clr);
+            ::DrawTexture(*texture, xPos, yPos, clr);
         }
     }
 
     void RaylibGraphics::DrawTextureEx(const char *textureName, int srcX, int srcY, int srcW, int srcH,
                                        float destX, float destY, float rotation, float scale,
                                        unsigned int tint) {
-        auto iter = _textures.find(textureName);
-        if (iter != _textures.end()) {
+        if (const Texture2D *texture = FindTexture(textureName)) {
             Color clr;
             clr.a = (tint >> 24) & 0xFF;
             clr.r = (tint >> 16) & 0xFF;
@@ -250,7 +289,7 @@ namespace Graphics {
             Rectangle dest = {destX, destY, (float)srcW * scale, (float)srcH * scale};
             Vector2 origin = {0, 0};
 
-            ::DrawTexturePro(iter->second, source, dest, origin, rotation, clr);
+            ::DrawTexturePro(*texture, source, dest, origin, rotation, clr);
         } else {
             // DEBUG: Texture not found - fallback to colored rectangle
             TraceLog(LOG_WARNING, "DrawTextureEx: Texture '%s' not found! Drawing fallback rectangle",
@@ -260,10 +299,9 @@ namespace Graphics {
     }
 
     bool RaylibGraphics::GetTextureSize(const char *textureName, int &width, int &height) const {
-        auto iter = _textures.find(textureName);
-        if (iter != _textures.end()) {
-            width = iter->second.width;
-            height = iter->second.height;
+        if (const Texture2D *texture = FindTexture(textureName)) {
+            width = texture->width;
+            height = texture->height;
             return true;
         }
         return false;
@@ -272,8 +310,7 @@ namespace Graphics {
     void RaylibGraphics::DrawTexturePro(const char *textureName, int srcX, int srcY, int srcW, int srcH,
                                         float destX, float destY, float destW, float destH,
                                         unsigned int tint) {
-        auto iter = _textures.find(textureName);
-        if (iter != _textures.end()) {
+        if (const Texture2D *texture = FindTexture(textureName)) {
             Color clr;
             clr.a = (tint >> 24) & 0xFF;
             clr.r = (tint >> 16) & 0xFF;
@@ -285,7 +322,31 @@ namespace Graphics {
             Rectangle dest = {destX, destY, destW, destH};
             Vector2 origin = {0, 0};
 
-            ::DrawTexturePro(iter->second, source, dest, origin, 0.0f, clr);
+            ::DrawTexturePro(*texture, source, dest, origin, 0.0f, clr);
+        }
+    }
+
+    TextureHandle RaylibGraphics::GetTextureHandle(const char *textureName) const {
+        auto iter = _textureHandles.find(textureName);
+        return iter != _textureHandles.end() ? iter->second : INVALID_TEXTURE;
+    }
+
+    void RaylibGraphics::DrawSpriteRun(TextureHandle texture, std::span<const SpriteDraw> sprites) {
+        if (texture < 0 || static_cast<size_t>(texture) >= _textures.size() || _textures[texture].id == 0) {
+            return;
+        }
+        // One texture for the whole run: rlgl keeps appending to the same draw batch
+        const Texture2D &sheet = _textures[texture];
+        const Vector2 origin = {0, 0};
+        for (const SpriteDraw &sprite : sprites) {
+            Color clr;
+            clr.a = (sprite.tint >> 24) & 0xFF;
+            clr.r = (sprite.tint >> 16) & 0xFF;
+            clr.g = (sprite.tint >> 8) & 0xFF;
+            clr.b = sprite.tint & 0xFF;
+            ::DrawTexturePro(sheet, Rectangle{sprite.srcX, sprite.srcY, sprite.srcW, sprite.srcH},
+                             Rectangle{sprite.destX, sprite.destY, sprite.destW, sprite.destH}, origin, 0.0f,
+                             clr);
         }
     }
 
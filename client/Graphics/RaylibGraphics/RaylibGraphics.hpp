@@ -65,6 +65,7 @@ namespace Graphics {
 
         // Textures / sprites / images
         int LoadTexture(const char *name, const char *filepath) override;
+        bool DecodeImage(const char *filepath, DecodedImage &image) const override;
         int CreateTextureFromMemory(char const *textureName, const void *pixels, int width, int height,
                                     int format) override;
         void UpdateTexture(const char *textureName, const void *pixels) override;
@@ -75,6 +76,8 @@ namespace Graphics {
         bool GetTextureSize(const char *textureName, int &width, int &height) const override;
         void DrawTexturePro(const char *textureName, int srcX, int srcY, int srcW, int srcH, float destX,
                             float destY, float destW, float destH, unsigned int tint) override;
+        [[nodiscard]] TextureHandle GetTextureHandle(const char *textureName) const override;
+        void DrawSpriteRun(TextureHandle texture, std::span<const SpriteDraw> sprites) override;
 
         // Input helpers
         bool IsKeyPressed(int key) const override;
@@ -116,8 +119,19 @@ namespace Graphics {
         void LoadColorblindShader();
         void UnloadColorblindShader();
 
+        /**
+         * @brief Store a texture under a name, reusing the handle of the name if it had one
+         */
+        TextureHandle RegisterTexture(const char *textureName, Texture2D texture);
+
+        /**
+         * @brief Get a loaded texture by name (nullptr if not loaded)
+         */
+        const Texture2D *FindTexture(const char *textureName) const;
+
         std::vector<Font> _fonts;
-        std::unordered_map<std::string, Texture2D> _textures;
+        std::vector<Texture2D> _textures;                                ///< By handle (id 0: unloaded)
+        std::unordered_map<std::string, TextureHandle> _textureHandles;  ///< Handle of each name
         std::unordered_map<std::string, Sound> _sounds;
         Color _clearColor{255, 255, 255, 255};
         bool _windowInitialized = false;
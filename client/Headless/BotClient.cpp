@@ -0,0 +1,275 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** BotClient
+*/
+
+#include "BotClient.hpp"
+#include <array>
+#include <chrono>
+#include <utility>
+#include "../common/Logger/Logger.hpp"
+
+namespace Headless {
+    namespace {
+        using RType::Messages::Shared::Action;
+
+        Action toAction(InputAction action) {
+            switch (action) {
+                case InputAction::MOVE_UP:
+                    return Action::MoveUp;
+                case InputAction::MOVE_DOWN:
+                    return Action::MoveDown;
+                case InputAction::MOVE_LEFT:
+                    return Action::MoveLeft;
+                case InputAction::MOVE_RIGHT:
+                    return Action::MoveRight;
+                default:
+                    return Action::Shoot;
+            }
+        }
+    }  // namespace
+
+    BotClient::BotClient(BotConfig config)
+        : _config(std::move(config)), _replicator(_eventBus), _entities(_graphics) {
+        _eventBus.subscribe<NetworkEvent>([this](const NetworkEvent &event) { handleNetworkMessage(event); });
+        _inputHistory.reserve(INPUT_HISTORY_SIZE);
+    }
+
+    BotClient::~BotClient() {
+        stop();
+    }
+
+    bool BotClient::start(double now) {
+        _now = now;
+        if (!_replicator.connect(_config.host, _config.port)) {
+            LOG_ERROR("[Bot ", _config.playerName, "] Failed to initiate connection");
+            enterPhase(Phase::Failed);
+            return false;
+        }
+        enterPhase(Phase::Connecting);
+        return true;
+    }
+
+    void BotClient::stop() {
+        if (_phase == Phase::Idle) {
+            return;
+        }
+        if (_phase == Phase::Lobby || _phase == Phase::Playing) {
+            _replicator.sendLeaveRoom();
+        }
+        _replicator.disconnect();
+    }
+
+    void BotClient::update(double now) {
+        _now = now;
+        _replicator.processMessages();
+        _eventBus.dispatchDeferred();
+
+        switch (_phase) {
+            case Phase::Connecting:
+                if (_replicator.isConnected()) {
+                    _replicator.sendConnectRequest(_config.playerName, "guest", "guest");
+                    enterPhase(Phase::Authenticating);
+                }
+                break;
+            case Phase::Authenticating:
+                if (_replicator.isAuthenticated()) {
+                    _replicator.sendAutoMatchmaking();
+                    enterPhase(Phase::Matchmaking);
+                }
+                break;
+            case Phase::Lobby:
+                updateLobby();
+                break;
+            case Phase::Playing:
+                // After a stall, resume the input rate instead of sending the missed frames in a burst
+                if (_now - _nextInput > MAX_INPUT_LAG) {
+                    _nextInput = _now;
+                }
+                while (_now >= _nextInput) {
+                    sendScriptedInput();
+                    _nextInput += INPUT_PERIOD;
+                }
+                if (_now >= _nextRttSample) {
+                    _stats.rttMs.add(static_cast<double>(_replicator.getLatency()));
+                    _nextRttSample = _now + RTT_SAMPLE_PERIOD;
+                }
+                return;
+            default:
+                return;
+        }
+
+        // Waiting steps give up after their deadline (the lobby also waits for the host's start)
+        double deadline = _config.stepTimeoutSeconds;
+        if (_phase == Phase::Lobby) {
+            deadline += _config.lobbyWaitSeconds;
+        }
+        if (_phase != Phase::Finished && _phase != Phase::Failed && _now - _phaseStart > deadline) {
+            LOG_WARNING("[Bot ", _config.playerName, "] Timed out while ", phaseName(_phase));
+            enterPhase(Phase::Failed);
+        }
+    }
+
+    BotStats BotClient::getStats() const {
+        BotStats stats = _stats;
+        const auto &intake = _replicator.getSnapshotIntake();
+        stats.staleSnapshots = intake.getStaleCount();
+        stats.coalescedSnapshots = intake.getCoalescedCount();
+        return stats;
+    }
+
+    const char *BotClient::phaseName(Phase phase) {
+        switch (phase) {
+            case Phase::Idle:
+                return "idle";
+            case Phase::Connecting:
+                return "connecting";
+            case Phase::Authenticating:
+                return "authenticating";
+            case Phase::Matchmaking:
+                return "matchmaking";
+            case Phase::Lobby:
+                return "lobby";
+            case Phase::Playing:
+                return "playing";
+            case Phase::Finished:
+                return "finished";
+            case Phase::Failed:
+                return "failed";
+        }
+        return "unknown";
+    }
+
+    void BotClient::enterPhase(Phase phase) {
+        LOG_DEBUG("[Bot ", _config.playerName, "] ", phaseName(_phase), " -> ", phaseName(phase));
+        _phase = phase;
+        _phaseStart = _now;
+    }
+
+    void BotClient::handleNetworkMessage(const NetworkEvent &event) {
+        if (event.getType() == NetworkMessageType::DISCONNECT) {
+            if (_phase != Phase::Finished && _phase != Phase::Failed) {
+                LOG_WARNING("[Bot ", _config.playerName, "] Disconnected while ", phaseName(_phase));
+                enterPhase(Phase::Failed);
+            }
+            return;
+        }
+
+        const auto &data = event.getData();
+        switch (NetworkMessages::getMessageType(data)) {
+            case NetworkMessages::MessageType::S2C_GAME_STATE:
+                if (_phase == Phase::Playing) {
+                    handleGameState(NetworkMessages::getPayloadView(data), data.size());
+                }
+                break;
+            case NetworkMessages::MessageType::S2C_ROOM_STATE:
+                handleRoomState(NetworkMessages::getPayload(data));
+                break;
+            case NetworkMessages::MessageType::S2C_GAME_START:
+                _jitter.reset();
+                _nextInput = _now;
+                _nextRttSample = _now;
+                enterPhase(Phase::Playing);
+                break;
+            case NetworkMessages::MessageType::S2C_GAME_OVER:
+                enterPhase(Phase::Finished);
+                break;
+            default:
+                break;
+        }
+    }
+
+    void BotClient::handleRoomState(const std::vector<uint8_t> &payload) {
+        try {
+            auto roomState = RType::Messages::S2C::RoomState::deserialize(payload);
+            const uint32_t myPlayerId = _replicator.getMyPlayerId();
+
+            _isRoomHost = false;
+            for (const auto &player : roomState.players) {
+                if (player.playerId == myPlayerId) {
+                    _isRoomHost = player.isHost;
+                }
+            }
+            _roomFull = roomState.currentPlayers >= roomState.maxPlayers;
+
+            if (_phase == Phase::Matchmaking) {
+                _startRequested = false;
+                enterPhase(Phase::Lobby);
+            }
+        } catch (const std::exception &e) {
+            LOG_ERROR("[Bot ", _config.playerName, "] Failed to parse RoomState: ", e.what());
+        }
+    }
+
+    void BotClient::handleGameState(std::span<const uint8_t> payload, size_t packetSize) {
+        try {
+            const auto applyStart = std::chrono::steady_clock::now();
+            uint32_t serverTick = 0;
+            RType::Messages::S2C::GameState::read(payload, _snapshotBuffer,
+                                                  [this, &serverTick](::GameState::Reader state) {
+                                                      serverTick = state.getServerTick();
+                                                      _entities.applyGameState(state, 0);
+                                                  });
+            const std::chrono::duration<double, std::micro> applyTime =
+                std::chrono::steady_clock::now() - applyStart;
+
+            _stats.applyUs.add(applyTime.count());
+            _stats.snapshotBytes.add(static_cast<double>(packetSize));
+            if (auto transitDelta = _jitter.onSnapshot(serverTick, _now)) {
+                _stats.jitterMs.add(*transitDelta * 1000.0);
+            }
+        } catch (const std::exception &e) {
+            LOG_ERROR("[Bot ", _config.playerName, "] Failed to parse GameState: ", e.what());
+        }
+    }
+
+    void BotClient::updateLobby() {
+        if (!_isRoomHost || _startRequested) {
+            return;
+        }
+        if (_roomFull || _now - _phaseStart >= _config.lobbyWaitSeconds) {
+            _startRequested = _replicator.sendStartGame();
+        }
+    }
+
+    void BotClient::scriptFrame(uint32_t frame) {
+        static constexpr std::array<InputAction, 4> SWEEP = {InputAction::MOVE_UP, InputAction::MOVE_RIGHT,
+                                                             InputAction::MOVE_DOWN, InputAction::MOVE_LEFT};
+        static constexpr uint32_t FRAMES_PER_LEG = 45;
+        static constexpr uint32_t SHOOT_PERIOD = 10;
+
+        _inputBuffer.addInput(frame, SWEEP[(frame / FRAMES_PER_LEG + _config.seed) % SWEEP.size()],
+                              InputState::HELD);
+        // Fire held for half of every shoot period
+        if ((frame + _config.seed) % SHOOT_PERIOD < SHOOT_PERIOD / 2) {
+            _inputBuffer.addInput(frame, InputAction::SHOOT, InputState::HELD);
+        }
+    }
+
+    void BotClient::sendScriptedInput() {
+        scriptFrame(_frame);
+
+        // Resend the last frames with every packet, newest first, like GameLoop's input history
+        const uint32_t oldestFrame = _frame >= INPUT_HISTORY_SIZE - 1 ? _frame - (INPUT_HISTORY_SIZE - 1) : 0;
+        _inputBuffer.clearUntil(oldestFrame);
+
+        _inputHistory.resize(_frame - oldestFrame + 1);
+        for (size_t age = 0; age < _inputHistory.size(); ++age) {
+            _inputHistory[age].sequenceId = _frame - static_cast<uint32_t>(age);
+            _inputHistory[age].actions.clear();
+        }
+        for (const auto &input : _inputBuffer.getInputsSince(oldestFrame)) {
+            _inputHistory[_frame - input.frameNumber].actions.push_back(toAction(input.action));
+        }
+
+        RType::Messages::C2S::PlayerInput inputPacket(_inputHistory);
+        std::vector<uint8_t> packet = NetworkMessages::createMessage(
+            NetworkMessages::MessageType::C2S_PLAYER_INPUT, inputPacket.serialize());
+        _replicator.sendPacket(NetworkMessageType::PLAYER_INPUT, packet);
+
+        _stats.inputsSent++;
+        _frame++;
+    }
+}  // namespace Headless
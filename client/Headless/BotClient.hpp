@@ -0,0 +1,145 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** BotClient - scripted headless player used to load-test the server
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+#include "Core/EventBus/EventBus.hpp"
+#include "Events/NetworkEvent/NetworkEvent.hpp"
+#include "Graphics/HeadlessGraphics/HeadlessGraphics.hpp"
+#include "Input/InputBuffer.hpp"
+#include "LoadStats.hpp"
+#include "Network/Replicator.hpp"
+#include "Rendering/EntityRenderer.hpp"
+
+namespace Headless {
+    /**
+     * @brief Settings of one bot
+     */
+    struct BotConfig {
+        std::string host = "127.0.0.1";
+        uint16_t port = 4242;
+        std::string playerName = "bot";
+        uint32_t seed = 0;                 ///< Offsets the input script so bots do not move in lockstep
+        double lobbyWaitSeconds = 3.0;     ///< How long a room host waits for the room to fill
+        double stepTimeoutSeconds = 10.0;  ///< Connection, authentication or matchmaking step deadline
+    };
+
+    /**
+     * @brief One scripted player: the client network and snapshot path without a window
+     *
+     * Runs the same Replicator, InputBuffer and EntityRenderer::applyGameState()
+     * code as the real client, on a HeadlessGraphics backend. The bot
+     * connects, authenticates as a guest, asks for auto-matchmaking, starts
+     * the game if it ends up room host, then sends a scripted input every
+     * 1/60 s and measures RTT, snapshot size, jitter and apply time.
+     *
+     * Not thread-safe: a BotSwarm updates every bot from one thread, each
+     * Replicator still owning its network thread.
+     */
+    class BotClient {
+       public:
+        /**
+         * @brief Lifecycle of a bot
+         */
+        enum class Phase : uint8_t {
+            Idle,            ///< Not started
+            Connecting,      ///< Waiting for the ENet connection
+            Authenticating,  ///< Handshake sent
+            Matchmaking,     ///< Auto-matchmaking requested, no room yet
+            Lobby,           ///< In a room, waiting for the game to start
+            Playing,         ///< Sending inputs, receiving snapshots
+            Finished,        ///< Game over received
+            Failed           ///< Step timeout, refused or lost connection
+        };
+
+        static constexpr double INPUT_PERIOD = 1.0 / 60.0;  ///< Same rate as the client game loop
+        static constexpr double MAX_INPUT_LAG = 0.25;       ///< Input backlog dropped after a stall
+        static constexpr double SERVER_TICK = 1.0 / 60.0;   ///< Server fixed timestep (stamped on snapshots)
+        static constexpr double RTT_SAMPLE_PERIOD = 0.25;   ///< Seconds between two RTT samples
+        static constexpr uint32_t INPUT_HISTORY_SIZE = 12;  ///< Frames resent per input packet, as GameLoop
+
+        explicit BotClient(BotConfig config);
+        ~BotClient();
+
+        BotClient(const BotClient &) = delete;
+        BotClient &operator=(const BotClient &) = delete;
+
+        /**
+         * @brief Start connecting to the server
+         *
+         * @param now Current time in seconds (same clock as update())
+         * @return false if the connection could not even be initiated
+         */
+        bool start(double now);
+
+        /**
+         * @brief Process received messages and advance the script
+         *
+         * Call as often as possible (about every millisecond): arrival times,
+         * hence jitter, are only as precise as this call rate.
+         *
+         * @param now Current time in seconds
+         */
+        void update(double now);
+
+        /**
+         * @brief Leave the room and disconnect (the phase is kept for the report)
+         */
+        void stop();
+
+        [[nodiscard]] Phase getPhase() const { return _phase; }
+        [[nodiscard]] const std::string &getName() const { return _config.playerName; }
+
+        /**
+         * @brief Measurements so far, with the snapshot intake counters
+         */
+        [[nodiscard]] BotStats getStats() const;
+
+        /**
+         * @brief Printable name of a phase
+         */
+        static const char *phaseName(Phase phase);
+
+       private:
+        void enterPhase(Phase phase);
+        void handleNetworkMessage(const NetworkEvent &event);
+        void handleRoomState(const std::vector<uint8_t> &payload);
+        void handleGameState(std::span<const uint8_t> payload, size_t packetSize);
+        void updateLobby();
+        void sendScriptedInput();
+
+        /**
+         * @brief Actions held on a frame: a square sweep with periodic shots
+         */
+        void scriptFrame(uint32_t frame);
+
+        BotConfig _config;
+        EventBus _eventBus;
+        Replicator _replicator;
+        InputBuffer _inputBuffer;
+        Graphics::HeadlessGraphics _graphics;
+        EntityRenderer _entities;               ///< Apply path of the real client, nothing is drawn
+        std::vector<uint64_t> _snapshotBuffer;  ///< Reused Cap'n Proto read buffer
+        std::vector<RType::Messages::C2S::PlayerInput::InputSnapshot> _inputHistory;  ///< Reused frames
+
+        Phase _phase = Phase::Idle;
+        double _now = 0.0;             ///< Time of the current update()
+        double _phaseStart = 0.0;      ///< When the current phase was entered
+        double _nextInput = 0.0;       ///< Due time of the next input packet
+        double _nextRttSample = 0.0;   ///< Due time of the next RTT sample
+        uint32_t _frame = 0;           ///< Input frame, also the packet sequence ID
+        bool _isRoomHost = false;      ///< Set by the last RoomState
+        bool _roomFull = false;        ///< Set by the last RoomState
+        bool _startRequested = false;  ///< StartGame sent for the current room
+        JitterEstimator _jitter{SERVER_TICK};
+        BotStats _stats;
+    };
+}  // namespace Headless
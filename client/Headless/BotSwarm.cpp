@@ -0,0 +1,115 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** BotSwarm
+*/
+
+#include "BotSwarm.hpp"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <utility>
+#include "../common/Logger/Logger.hpp"
+
+namespace Headless {
+    namespace {
+        constexpr auto UPDATE_PERIOD = std::chrono::milliseconds(1);
+
+        bool isRunning(BotClient::Phase phase) {
+            return phase != BotClient::Phase::Finished && phase != BotClient::Phase::Failed;
+        }
+
+        void printSummary(const char *label, const char *unit, const SampleSeries &series) {
+            const SampleSummary summary = series.summarize();
+            std::printf("  %-15s %10zu %10.2f %10.2f %10.2f %10.2f %10.2f  %s\n", label, summary.count,
+                        summary.mean, summary.p50, summary.p95, summary.p99, summary.max, unit);
+        }
+    }  // namespace
+
+    BotSwarm::BotSwarm(SwarmConfig config)
+        : _config(std::move(config)), _start(std::chrono::steady_clock::now()) {
+        _bots.reserve(_config.botCount);
+    }
+
+    double BotSwarm::now() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+    }
+
+    void BotSwarm::run(const std::atomic<bool> &stopRequested) {
+        const double runStart = now();
+        const double rampEnd = runStart + _config.spawnIntervalSeconds * _config.botCount;
+        double nextSpawn = runStart;
+
+        LOG_INFO("[BotSwarm] Spawning ", _config.botCount, " bots on ", _config.host, ":", _config.port);
+        while (!stopRequested.load(std::memory_order_relaxed)) {
+            const double time = now();
+
+            while (_bots.size() < _config.botCount && time >= nextSpawn) {
+                BotConfig botConfig;
+                botConfig.host = _config.host;
+                botConfig.port = _config.port;
+                botConfig.playerName = "bot_" + std::to_string(_bots.size());
+                botConfig.seed = static_cast<uint32_t>(_bots.size());
+                botConfig.lobbyWaitSeconds = _config.lobbyWaitSeconds;
+                _bots.push_back(std::make_unique<BotClient>(std::move(botConfig)));
+                _bots.back()->start(time);
+                nextSpawn += _config.spawnIntervalSeconds;
+            }
+
+            bool anyRunning = _bots.size() < _config.botCount;
+            for (auto &bot : _bots) {
+                bot->update(time);
+                anyRunning = anyRunning || isRunning(bot->getPhase());
+            }
+
+            if (!anyRunning || time >= rampEnd + _config.durationSeconds) {
+                break;
+            }
+            std::this_thread::sleep_for(UPDATE_PERIOD);
+        }
+        _elapsed = now() - runStart;
+
+        for (auto &bot : _bots) {
+            bot->stop();
+        }
+    }
+
+    BotStats BotSwarm::collectStats() const {
+        BotStats total;
+        for (const auto &bot : _bots) {
+            total.merge(bot->getStats());
+        }
+        return total;
+    }
+
+    void BotSwarm::printReport() const {
+        static constexpr size_t PHASE_COUNT = static_cast<size_t>(BotClient::Phase::Failed) + 1;
+        std::array<uint32_t, PHASE_COUNT> phases{};
+        for (const auto &bot : _bots) {
+            phases[static_cast<size_t>(bot->getPhase())]++;
+        }
+
+        const BotStats stats = collectStats();
+        std::printf("==================================\n");
+        std::printf("R-Type load test: %zu bots, %.1f s\n", _bots.size(), _elapsed);
+        std::printf("==================================\n");
+        for (size_t phase = 0; phase < PHASE_COUNT; ++phase) {
+            if (phases[phase] > 0) {
+                std::printf("  %-15s %u\n", BotClient::phaseName(static_cast<BotClient::Phase>(phase)),
+                            phases[phase]);
+            }
+        }
+        std::printf("  %-15s %10s %10s %10s %10s %10s %10s\n", "", "samples", "mean", "p50", "p95", "p99",
+                    "max");
+        printSummary("rtt", "ms", stats.rttMs);
+        printSummary("snapshot size", "bytes", stats.snapshotBytes);
+        printSummary("jitter", "ms", stats.jitterMs);
+        printSummary("apply", "us", stats.applyUs);
+        std::printf("  inputs sent %llu, snapshots stale %llu, coalesced %llu\n",
+                    static_cast<unsigned long long>(stats.inputsSent),
+                    static_cast<unsigned long long>(stats.staleSnapshots),
+                    static_cast<unsigned long long>(stats.coalescedSnapshots));
+    }
+}  // namespace Headless
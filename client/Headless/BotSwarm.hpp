@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** BotSwarm - N scripted bots in one process, to drive load against a server
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "BotClient.hpp"
+
+namespace Headless {
+    /**
+     * @brief Settings of a load test
+     */
+    struct SwarmConfig {
+        std::string host = "127.0.0.1";
+        uint16_t port = 4242;
+        uint32_t botCount = 8;
+        double spawnIntervalSeconds = 0.05;  ///< Ramp-up delay between two bot connections
+        double durationSeconds = 30.0;       ///< Measured time once the last bot is spawned
+        double lobbyWaitSeconds = 3.0;       ///< Passed to every BotConfig
+    };
+
+    /**
+     * @brief Spawns bots, updates them from a single thread and reports their measurements
+     *
+     * The update loop runs about every millisecond so snapshot arrival
+     * times stay precise; each bot's Replicator keeps its own network
+     * thread, so a swarm of N bots uses N + 1 threads.
+     */
+    class BotSwarm {
+       public:
+        explicit BotSwarm(SwarmConfig config);
+
+        /**
+         * @brief Run the whole test: ramp-up, measurement, then disconnect every bot
+         *
+         * @param stopRequested Checked every iteration to end the test early (Ctrl+C)
+         */
+        void run(const std::atomic<bool> &stopRequested);
+
+        /**
+         * @brief Measurements of every bot, merged
+         */
+        [[nodiscard]] BotStats collectStats() const;
+
+        /**
+         * @brief Print the phase of every bot and the merged measurement summaries to stdout
+         */
+        void printReport() const;
+
+       private:
+        /**
+         * @brief Seconds since the swarm was created
+         */
+        [[nodiscard]] double now() const;
+
+        SwarmConfig _config;
+        std::vector<std::unique_ptr<BotClient>> _bots;  ///< Not movable: the Replicator captures its EventBus
+        double _elapsed = 0.0;                          ///< Duration of the last run()
+        std::chrono::steady_clock::time_point _start;
+    };
+}  // namespace Headless
@@ -0,0 +1,68 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** LoadStats
+*/
+
+#include "LoadStats.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace Headless {
+    void SampleSeries::merge(const SampleSeries &other) {
+        _samples.insert(_samples.end(), other._samples.begin(), other._samples.end());
+    }
+
+    SampleSummary SampleSeries::summarize() const {
+        SampleSummary summary;
+        if (_samples.empty()) {
+            return summary;
+        }
+
+        std::vector<double> sorted(_samples);
+        std::sort(sorted.begin(), sorted.end());
+
+        // Nearest rank: the smallest sample with at least `fraction` of the samples at or below it
+        auto percentile = [&sorted](double fraction) {
+            auto rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+            return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+        };
+
+        summary.count = sorted.size();
+        const double sum = std::accumulate(sorted.begin(), sorted.end(), 0.0);
+        summary.mean = sum / static_cast<double>(summary.count);
+        summary.p50 = percentile(0.50);
+        summary.p95 = percentile(0.95);
+        summary.p99 = percentile(0.99);
+        summary.max = sorted.back();
+        return summary;
+    }
+
+    std::optional<double> JitterEstimator::onSnapshot(uint32_t serverTick, double arrivalSeconds) {
+        if (!_previousTick || serverTick <= *_previousTick) {
+            _previousTick = serverTick;
+            _previousArrival = arrivalSeconds;
+            return std::nullopt;
+        }
+
+        const double sendDelta = static_cast<double>(serverTick - *_previousTick) * _tickSeconds;
+        const double transitDelta = std::abs((arrivalSeconds - _previousArrival) - sendDelta);
+        _jitter += (transitDelta - _jitter) / 16.0;
+
+        _previousTick = serverTick;
+        _previousArrival = arrivalSeconds;
+        return transitDelta;
+    }
+
+    void BotStats::merge(const BotStats &other) {
+        rttMs.merge(other.rttMs);
+        snapshotBytes.merge(other.snapshotBytes);
+        jitterMs.merge(other.jitterMs);
+        applyUs.merge(other.applyUs);
+        inputsSent += other.inputsSent;
+        staleSnapshots += other.staleSnapshots;
+        coalescedSnapshots += other.coalescedSnapshots;
+    }
+}  // namespace Headless
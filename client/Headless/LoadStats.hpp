@@ -0,0 +1,122 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** LoadStats - network measurements recorded by the load-testing bots
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Headless {
+    /**
+     * @brief Percentile summary of a SampleSeries
+     */
+    struct SampleSummary {
+        size_t count = 0;  ///< Number of samples
+        double mean = 0.0;
+        double p50 = 0.0;
+        double p95 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+    };
+
+    /**
+     * @brief Every sample of one measured quantity, kept for exact percentiles
+     *
+     * A load test runs for minutes at 60 samples per second per bot: storing
+     * the raw values is a few megabytes and avoids histogram binning choices.
+     */
+    class SampleSeries {
+       public:
+        /**
+         * @brief Record one sample
+         */
+        void add(double value) { _samples.push_back(value); }
+
+        /**
+         * @brief Append every sample of another series (swarm totals)
+         */
+        void merge(const SampleSeries &other);
+
+        /**
+         * @brief Number of samples recorded
+         */
+        [[nodiscard]] size_t count() const { return _samples.size(); }
+
+        /**
+         * @brief Compute mean, nearest-rank percentiles and maximum
+         *
+         * @return A zeroed summary if no sample was recorded
+         */
+        [[nodiscard]] SampleSummary summarize() const;
+
+       private:
+        std::vector<double> _samples;
+    };
+
+    /**
+     * @brief Interarrival jitter of server snapshots (RFC 3550, section 6.4.1)
+     *
+     * Snapshots are stamped with the server tick they were built on, so the
+     * send time of each one is known: tick * tickSeconds. The transit delta
+     * D = (arrival_j - arrival_i) - (send_j - send_i) between two snapshots
+     * is the jitter sample; J += (|D| - J) / 16 is the smoothed estimate.
+     */
+    class JitterEstimator {
+       public:
+        /**
+         * @param tickSeconds Duration of one server tick
+         */
+        explicit JitterEstimator(double tickSeconds) : _tickSeconds(tickSeconds) {}
+
+        /**
+         * @brief Record the arrival of a snapshot
+         *
+         * @param serverTick Tick stamped on the snapshot
+         * @param arrivalSeconds Local time of arrival
+         * @return |D| in seconds, or nothing for the first snapshot of a timeline
+         *
+         * @note A tick not newer than the previous one starts a new timeline (game restart)
+         */
+        std::optional<double> onSnapshot(uint32_t serverTick, double arrivalSeconds);
+
+        /**
+         * @brief Smoothed jitter J, in seconds
+         */
+        [[nodiscard]] double getJitter() const { return _jitter; }
+
+        /**
+         * @brief Forget the previous snapshot (new game)
+         */
+        void reset() { _previousTick.reset(); }
+
+       private:
+        double _tickSeconds;
+        std::optional<uint32_t> _previousTick;  ///< Tick of the previous snapshot
+        double _previousArrival = 0.0;          ///< Arrival time of the previous snapshot
+        double _jitter = 0.0;                   ///< Smoothed estimate
+    };
+
+    /**
+     * @brief Everything one bot measured, mergeable into swarm totals
+     */
+    struct BotStats {
+        SampleSeries rttMs;               ///< Replicator round-trip time, sampled every 250 ms in game
+        SampleSeries snapshotBytes;       ///< Size of every S2C_GAME_STATE packet applied
+        SampleSeries jitterMs;            ///< |D| between consecutive snapshots
+        SampleSeries applyUs;             ///< Time to decode and apply a snapshot
+        uint64_t inputsSent = 0;          ///< C2S_PLAYER_INPUT packets sent
+        uint64_t staleSnapshots = 0;      ///< Snapshots rejected by the intake (late or duplicated)
+        uint64_t coalescedSnapshots = 0;  ///< Snapshots skipped because a newer one was queued
+
+        /**
+         * @brief Add another bot's measurements to this one
+         */
+        void merge(const BotStats &other);
+    };
+}  // namespace Headless
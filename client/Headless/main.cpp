@@ -0,0 +1,97 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** main.cpp - headless load generator: r-type_bots [host] [port] [options]
+*/
+
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include "../common/Logger/Logger.hpp"
+#include "BotSwarm.hpp"
+#include "NetworkFactory.hpp"
+
+namespace {
+    std::atomic<bool> stopRequested{false};
+
+    void onSignal(int) {
+        stopRequested.store(true);
+    }
+
+    void printUsage(const char *program) {
+        std::cout << "Usage: " << program << " [host] [port] [options]" << std::endl;
+        std::cout << "  --bots N             Number of bot clients (default 8)" << std::endl;
+        std::cout << "  --duration S         Seconds measured after the last bot connects (default 30)"
+                  << std::endl;
+        std::cout << "  --spawn-interval S   Seconds between two bot connections (default 0.05)" << std::endl;
+        std::cout << "  --lobby-wait S       Seconds a room host waits for players (default 3)" << std::endl;
+        std::cout << "  --verbose            Keep the client INFO logs" << std::endl;
+    }
+
+    // Parse command line arguments; returns false if the usage should be printed
+    bool parseCommandLine(int argc, char **argv, Headless::SwarmConfig &config, bool &verbose) {
+        int positional = 0;
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            const bool hasValue = i + 1 < argc;
+            if (arg == "--bots" && hasValue) {
+                config.botCount = static_cast<uint32_t>(std::atoi(argv[++i]));
+            } else if (arg == "--duration" && hasValue) {
+                config.durationSeconds = std::atof(argv[++i]);
+            } else if (arg == "--spawn-interval" && hasValue) {
+                config.spawnIntervalSeconds = std::atof(argv[++i]);
+            } else if (arg == "--lobby-wait" && hasValue) {
+                config.lobbyWaitSeconds = std::atof(argv[++i]);
+            } else if (arg == "--verbose") {
+                verbose = true;
+            } else if (arg.starts_with("-")) {
+                return false;
+            } else if (positional == 0) {
+                config.host = arg;
+                positional++;
+            } else if (positional == 1) {
+                config.port = static_cast<uint16_t>(std::atoi(arg.c_str()));
+                positional++;
+            } else {
+                return false;
+            }
+        }
+        return config.botCount > 0;
+    }
+}  // namespace
+
+int main(int argc, char **argv) {
+    Headless::SwarmConfig config;
+    bool verbose = false;
+    if (!parseCommandLine(argc, argv, config, verbose)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // Per-message client logs times N bots would drown the report and the measurements
+    logger::Logger::setLevel(verbose ? logger::Level::INFO : logger::Level::WARNING);
+    logger::Logger::startAsync();
+
+    if (!initializeNetworking()) {
+        logger::Logger::stopAsync();
+        std::cerr << "Failed to initialize networking" << std::endl;
+        return 1;
+    }
+
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+
+    {
+        Headless::BotSwarm swarm(config);
+        swarm.run(stopRequested);
+        logger::Logger::flush();
+        swarm.printReport();
+    }
+
+    deinitializeNetworking();
+    logger::Logger::stopAsync();
+    return 0;
+}
@@ -45,6 +45,10 @@ namespace Input {
         _bindings[GameAction::MENU_BACK] = {KEY_ESCAPE,
                                             GamepadButtonToBinding(GAMEPAD_BUTTON_RIGHT_FACE_RIGHT)};
 
+        // Debug - frame-time overlay and its CSV / Chrome trace dump
+        _bindings[GameAction::TOGGLE_PROFILER] = {KEY_F3, KEY_NULL};
+        _bindings[GameAction::DUMP_PROFILE] = {KEY_F4, KEY_NULL};
+
         NotifyBindingsChanged();
     }
 
@@ -248,6 +252,8 @@ namespace Input {
             {GameAction::MENU_PREVIOUS, "Menu Previous"},
             {GameAction::MENU_CONFIRM, "Menu Confirm"},
             {GameAction::MENU_BACK, "Menu Back"},
+            {GameAction::TOGGLE_PROFILER, "Profiler Overlay"},
+            {GameAction::DUMP_PROFILE, "Dump Frame Profile"},
         };
 
         auto it = actionNames.find(action);
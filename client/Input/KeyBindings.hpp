@@ -64,6 +64,10 @@ namespace Input {
         MENU_CONFIRM,
         MENU_BACK,
 
+        // Debug (appended: saved bindings are indexed by value)
+        TOGGLE_PROFILER,
+        DUMP_PROFILE,
+
         COUNT  // Keep last for iteration
     };
 
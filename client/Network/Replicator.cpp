@@ -129,6 +129,20 @@ void Replicator::networkThreadLoop(std::stop_token stopToken) {
                         _latency.store(static_cast<uint32_t>(smoothed));
                     }
 
+                    // Drop late or duplicated snapshots before they reach the game thread
+                    if (messageType == NetworkMessages::MessageType::S2C_GAME_STATE) {
+                        try {
+                            auto payload = NetworkMessages::getPayload(event.packet->getData());
+                            uint32_t tick = RType::Messages::S2C::GameState::peekServerTick(payload);
+                            if (!_snapshotIntake.accept(tick)) {
+                                break;
+                            }
+                        } catch (const std::exception &e) {
+                            LOG_ERROR("Failed to read GameState tick: ", e.what());
+                            break;
+                        }
+                    }
+
                     // Decode message type and push to queue
                     std::string messageContent;
 
@@ -148,7 +162,7 @@ void Replicator::networkThreadLoop(std::stop_token stopToken) {
                                          ", Name: ", handshakeResp.playerName);
 
                                 // Publish AUTH_SUCCESS with displayName from server
-                                _eventBus.publish(
+                                _eventBus.enqueue(
                                     UIEvent(UIEventType::AUTH_SUCCESS, handshakeResp.playerName));
                             } else {
                                 _authenticated.store(false);
@@ -167,18 +181,18 @@ void Replicator::networkThreadLoop(std::stop_token stopToken) {
                             if (registerResp.success) {
                                 LOG_INFO("✓ Registration successful: ", registerResp.message);
                                 messageContent = "Registration successful: " + registerResp.message;
-                                _eventBus.publish(
+                                _eventBus.enqueue(
                                     UIEvent(UIEventType::REGISTER_SUCCESS, registerResp.message));
                             } else {
                                 LOG_WARNING("✗ Registration failed: ", registerResp.message);
                                 messageContent = "Registration failed: " + registerResp.message;
-                                _eventBus.publish(
+                                _eventBus.enqueue(
                                     UIEvent(UIEventType::REGISTER_FAILED, registerResp.message));
                             }
                         } catch (const std::exception &e) {
                             LOG_ERROR("Failed to parse RegisterResponse: ", e.what());
                             messageContent = "Registration error";
-                            _eventBus.publish(UIEvent(UIEventType::REGISTER_FAILED, "Registration error"));
+                            _eventBus.enqueue(UIEvent(UIEventType::REGISTER_FAILED, "Registration error"));
                         }
                     } else if (messageType == NetworkMessages::MessageType::LOGIN_RESPONSE) {
                         // Parse LoginResponse
@@ -192,27 +206,28 @@ void Replicator::networkThreadLoop(std::stop_token stopToken) {
                                 _autoMatchmakingPreference = loginResp.autoMatchmaking;
 
                                 // Publish event to apply the preference to the settings menu
-                                _eventBus.publish(UIEvent(UIEventType::APPLY_AUTO_MATCHMAKING_PREF,
+                                _eventBus.enqueue(UIEvent(UIEventType::APPLY_AUTO_MATCHMAKING_PREF,
                                                           loginResp.autoMatchmaking ? "1" : "0"));
 
                                 // Publish AUTH_SUCCESS event with username (extract from message or store separately)
                                 // For now, we'll extract it from the stored username during sendLoginAccount
                                 // This is handled by storing _lastLoginUsername in sendLoginAccount
                                 if (!_lastLoginUsername.empty()) {
-                                    _eventBus.publish(UIEvent(UIEventType::AUTH_SUCCESS, _lastLoginUsername));
+                                    _eventBus.enqueue(UIEvent(UIEventType::AUTH_SUCCESS, _lastLoginUsername));
                                 }
                             } else {
                                 LOG_WARNING("✗ Login failed: ", loginResp.message);
                                 messageContent = "Login failed: " + loginResp.message;
-                                _eventBus.publish(UIEvent(UIEventType::LOGIN_FAILED, loginResp.message));
+                                _eventBus.enqueue(UIEvent(UIEventType::LOGIN_FAILED, loginResp.message));
                             }
                         } catch (const std::exception &e) {
                             LOG_ERROR("Failed to parse LoginResponse: ", e.what());
                             messageContent = "Login error";
-                            _eventBus.publish(UIEvent(UIEventType::LOGIN_FAILED, "Login error"));
+                            _eventBus.enqueue(UIEvent(UIEventType::LOGIN_FAILED, "Login error"));
                         }
                     } else if (messageType == NetworkMessages::MessageType::S2C_GAME_START) {
                         messageContent = "GameStart received";
+                        _snapshotIntake.reset();  // The new room loop counts ticks from 0
                     }
 
                     NetworkEvent netEvent(NetworkMessageType::WORLD_STATE, event.packet->getData());
@@ -223,6 +238,7 @@ void Replicator::networkThreadLoop(std::stop_token stopToken) {
 
             case NetworkEventType::CONNECT:
                 _connected.store(true);
+                _snapshotIntake.reset();
                 // Publish connection event
                 {
                     NetworkEvent netEvent(NetworkMessageType::CONNECT, {});
@@ -250,14 +266,30 @@ void Replicator::networkThreadLoop(std::stop_token stopToken) {
 void Replicator::processMessages() {
     using namespace RType::Messages;
 
-    // Process all available messages from network thread
+    // Take every message available from the network thread
+    _pendingMessages.clear();
+    size_t pendingSnapshots = 0;
     while (auto eventOpt = _incomingMessages.tryPop()) {
-        auto &netEvent = *eventOpt;
+        if (NetworkMessages::getMessageType(eventOpt->getData()) ==
+            NetworkMessages::MessageType::S2C_GAME_STATE) {
+            pendingSnapshots++;
+        }
+        _pendingMessages.push_back(std::move(*eventOpt));
+    }
 
+    // Snapshots piled up during a slow frame: only the newest ones are worth decoding
+    size_t snapshotsToSkip = _snapshotIntake.coalesce(pendingSnapshots);
+
+    for (auto &netEvent : _pendingMessages) {
         // Decode and log specific message types
         auto messageType = NetworkMessages::getMessageType(netEvent.getData());
 
-        if (messageType != NetworkMessages::MessageType::S2C_GAME_STATE) {
+        if (messageType == NetworkMessages::MessageType::S2C_GAME_STATE) {
+            if (snapshotsToSkip > 0) {
+                snapshotsToSkip--;
+                continue;
+            }
+        } else {
             LOG_DEBUG("[Replicator] Popped message type: ", static_cast<int>(messageType));
         }
 
@@ -324,6 +356,7 @@ void Replicator::processMessages() {
         // Publish on EventBus for game systems to process
         _eventBus.publish(netEvent);
     }
+    _pendingMessages.clear();
 }
 
 void Replicator::sendPacket(NetworkMessageType type, const std::vector<uint8_t> &data) {
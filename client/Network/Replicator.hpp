@@ -25,6 +25,7 @@
 #include "IHost.hpp"
 #include "IPeer.hpp"
 #include "NetworkFactory.hpp"
+#include "SnapshotIntake.hpp"
 #include "ThreadSafeQueue.hpp"
 
 /**
@@ -315,6 +316,14 @@ class Replicator {
      */
     bool sendChatMessage(const std::string &message);
 
+    /**
+     * @brief Get the snapshot filter (stale/coalesced counters, interpolation anchors)
+     * 
+     * @return Reference to the S2C_GAME_STATE intake stage
+     */
+    SnapshotIntake &getSnapshotIntake() { return _snapshotIntake; }
+    const SnapshotIntake &getSnapshotIntake() const { return _snapshotIntake; }
+
     /**
      * @brief Get the user's auto-matchmaking preference from server
      * 
@@ -331,6 +340,8 @@ class Replicator {
      * 
      * Continuously polls the network for incoming packets.
      * Runs in a dedicated thread until stop is requested.
+     * Authentication and registration results are enqueued on the EventBus,
+     * so their UIEvents reach the subscribers on the game thread.
      * 
      * @param stopToken Token to check for stop requests
      */
@@ -364,6 +375,8 @@ class Replicator {
     // Multi-threading components
     std::jthread _networkThread;                      ///< Dedicated network thread
     ThreadSafeQueue<NetworkEvent> _incomingMessages;  ///< Queue for messages from network thread
+    SnapshotIntake _snapshotIntake;                   ///< Stale-tick rejection and per-frame coalescing
+    std::vector<NetworkEvent> _pendingMessages;       ///< Messages popped this frame (reused buffer)
 
     // Smoothed ping calculation (exponential moving average)
     static constexpr float PING_SMOOTHING_FACTOR = 0.3f;  // 30% new, 70% old
@@ -0,0 +1,26 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** SnapshotIntake.cpp
+*/
+
+#include "SnapshotIntake.hpp"
+
+bool SnapshotIntake::accept(uint32_t serverTick) {
+    if (_newestTick && serverTick <= *_newestTick && *_newestTick - serverTick < RESTART_WINDOW) {
+        _staleCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    _newestTick = serverTick;
+    return true;
+}
+
+size_t SnapshotIntake::coalesce(size_t queued) {
+    const size_t kept = _anchors + 1;
+    if (queued <= kept) {
+        return 0;
+    }
+    _coalescedCount += queued - kept;
+    return queued - kept;
+}
@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** SnapshotIntake.hpp
+*/
+
+#ifndef SNAPSHOTINTAKE_HPP
+#define SNAPSHOTINTAKE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+/**
+ * @class SnapshotIntake
+ * @brief Filters S2C_GAME_STATE snapshots before the game thread decodes them
+ *
+ * Game state is sent UNSEQUENCED: snapshots can arrive late, twice or out
+ * of order, and several can pile up in the queue during a slow frame.
+ * Applying all of them in arrival order wastes deserialization time and
+ * moves entities backwards (rubber-banding).
+ *
+ * Two stages:
+ * - accept(): network thread, per received snapshot. Rejects any tick not
+ *   newer than the newest accepted one.
+ * - coalesce(): game thread, once per frame. Of the snapshots queued since
+ *   the last frame, only the newest (plus the configured number of
+ *   interpolation anchors before it) are worth applying.
+ *
+ * A tick far behind the newest one is not stale but a new server timeline
+ * (room loops restart their tick at 0), and resets the filter.
+ */
+class SnapshotIntake {
+   public:
+    static constexpr uint32_t RESTART_WINDOW = 600;  ///< Ticks behind the newest that mean a restart (10 s)
+
+    /**
+     * @brief Decide whether a received snapshot should be queued
+     *
+     * @param serverTick Tick read from the snapshot header
+     * @return true if the snapshot is newer than every accepted one
+     *
+     * @note Network thread only
+     */
+    bool accept(uint32_t serverTick);
+
+    /**
+     * @brief Forget the newest accepted tick (new game, reconnection)
+     *
+     * @note Network thread only
+     */
+    void reset() { _newestTick.reset(); }
+
+    /**
+     * @brief Number of queued snapshots the game thread should skip
+     *
+     * @param queued Snapshots popped this frame
+     * @return Count of the oldest ones to drop; the rest are applied in order
+     *
+     * @note Game thread only
+     */
+    size_t coalesce(size_t queued);
+
+    /**
+     * @brief Set how many older snapshots are applied along with the newest one
+     *
+     * The default is 0 (newest snapshot only). The game client raises it to
+     * fill the interpolation history: its interpolator keys on server ticks,
+     * so snapshots applied in the same frame still land at their own time.
+     */
+    void setInterpolationAnchors(size_t anchors) { _anchors = anchors; }
+
+    /**
+     * @brief Get the number of snapshots rejected as stale or duplicated
+     */
+    uint64_t getStaleCount() const { return _staleCount.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Get the number of snapshots skipped because a newer one was queued
+     */
+    uint64_t getCoalescedCount() const { return _coalescedCount; }
+
+   private:
+    std::optional<uint32_t> _newestTick;   ///< Newest accepted tick (network thread)
+    size_t _anchors = 0;                   ///< Older snapshots kept per frame
+    std::atomic<uint64_t> _staleCount{0};  ///< Rejected by accept()
+    uint64_t _coalescedCount = 0;          ///< Skipped by coalesce()
+};
+
+#endif
@@ -6,35 +6,134 @@
 */
 
 #include "EntityRenderer.hpp"
+#include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <cstdio>
+#include "../common/ECS/Systems/PlayerRules/PlayerRules.hpp"
 #include "../common/Logger/Logger.hpp"
 
-EntityRenderer::EntityRenderer(Graphics::RaylibGraphics &graphics) : _graphics(graphics) {
+EntityRenderer::EntityRenderer(Graphics::IGraphics &graphics) : _graphics(graphics) {
+    _textureHandles.fill(Graphics::INVALID_TEXTURE);
     LOG_DEBUG("EntityRenderer created");
 }
 
+uint32_t EntityRenderer::EntityBucket::push(uint32_t id, RType::Messages::Shared::EntityType type, float posX,
+                                            float posY, int hp, const SpriteRect &sprite,
+                                            uint32_t generation) {
+    ids.push_back(id);
+    types.push_back(type);
+    x.push_back(posX);
+    y.push_back(posY);
+    prevX.push_back(posX);
+    prevY.push_back(posY);
+    targetX.push_back(posX);
+    targetY.push_back(posY);
+    interpolationFactor.push_back(1.0f);
+    health.push_back(hp);
+    sprites.push_back(sprite);
+    snapshots.emplace_back();
+    generations.push_back(generation);
+    return static_cast<uint32_t>(ids.size() - 1);
+}
+
+void EntityRenderer::EntityBucket::swapRemove(uint32_t index) {
+    forEachColumn([index](auto &column) {
+        column[index] = column.back();
+        column.pop_back();
+    });
+}
+
+void EntityRenderer::EntityBucket::clear() {
+    forEachColumn([](auto &column) { column.clear(); });
+}
+
+EntityRenderer::RenderBucket EntityRenderer::bucketOf(RType::Messages::Shared::EntityType type) {
+    switch (type) {
+        case RType::Messages::Shared::EntityType::Player:
+            return RenderBucket::Player;
+        case RType::Messages::Shared::EntityType::EnemyType1:
+            return RenderBucket::Enemy;
+        case RType::Messages::Shared::EntityType::PlayerBullet:
+        case RType::Messages::Shared::EntityType::EnemyBullet:
+            return RenderBucket::Projectile;
+        case RType::Messages::Shared::EntityType::Wall:
+            return RenderBucket::Wall;
+        case RType::Messages::Shared::EntityType::OrbitalModule:
+            return RenderBucket::OrbitalModule;
+        default:
+            return RenderBucket::Unknown;
+    }
+}
+
+const EntityRenderer::EntitySlot *EntityRenderer::findSlot(uint32_t id) const {
+    if (id >= _slots.size() || _slots[id].bucket == RenderBucket::Count) {
+        return nullptr;
+    }
+    return &_slots[id];
+}
+
+bool EntityRenderer::insertEntity(uint32_t id, RType::Messages::Shared::EntityType type, float x, float y,
+                                  int health, const SpriteRect &sprite) {
+    if (id >= MAX_ENTITY_ID) {
+        LOG_WARNING("Entity ID ", id, " out of range, not rendered");
+        return false;
+    }
+    if (id >= _slots.size()) {
+        _slots.resize(id + 1);
+    }
+
+    const RenderBucket kind = bucketOf(type);
+    if (kind == RenderBucket::Unknown) {
+        LOG_WARNING("Unknown entity type: ", static_cast<int>(type));
+    }
+    _slots[id] = EntitySlot{kind, bucket(kind).push(id, type, x, y, health, sprite, _snapshotGeneration)};
+    _entityCount++;
+    return true;
+}
+
+void EntityRenderer::eraseSlot(EntitySlot slot) {
+    EntityBucket &entities = bucket(slot.bucket);
+    if (slot.bucket == RenderBucket::Projectile) {
+        _projectilePredictor.forget(entities.ids[slot.index]);
+    }
+    _slots[entities.ids[slot.index]] = EntitySlot{};
+    entities.swapRemove(slot.index);
+    if (slot.index < entities.size()) {
+        _slots[entities.ids[slot.index]].index = slot.index;
+    }
+    _entityCount--;
+}
+
 void EntityRenderer::updateEntity(uint32_t id, RType::Messages::Shared::EntityType type, float x, float y,
-                                  int health, const std::string &currentAnimation, int srcX, int srcY,
+                                  int health, std::string_view currentAnimation, int srcX, int srcY,
                                   int srcW, int srcH, float velocityX, float velocityY, uint32_t serverTick) {
-    uint64_t currentTime = getCurrentTimeMs();
+    const Snapshot snapshot{x, y, velocityX, velocityY, serverTick};
 
-    auto it = _entities.find(id);
-    if (it != _entities.end()) {
+    const EntitySlot *found = findSlot(id);
+    if (found != nullptr && found->bucket != bucketOf(type)) {
+        // The entity changed to a type drawn by another bucket: recreate it there
+        eraseSlot(*found);
+        found = nullptr;
+    }
+
+    if (found != nullptr) {
+        EntityBucket &entities = bucket(found->bucket);
+        const uint32_t i = found->index;
         bool isLocalPlayer = (id == _myEntityId);
 
         // Always update type and health first (critical data)
-        it->second.type = type;
-        it->second.health = health;
+        entities.types[i] = type;
+        entities.health[i] = health;
+        entities.generations[i] = _snapshotGeneration;
 
         // Check if entity is a projectile (bullets should NOT be interpolated)
-        bool isProjectile = (type == RType::Messages::Shared::EntityType::PlayerBullet ||
-                             type == RType::Messages::Shared::EntityType::EnemyBullet);
+        bool isProjectile = (found->bucket == RenderBucket::Projectile);
 
         if (isLocalPlayer && _clientSidePredictionEnabled) {
             // CLIENT-SIDE PREDICTION for local player
-            float errorX = x - it->second.x;
-            float errorY = y - it->second.y;
+            float errorX = x - entities.x[i];
+            float errorY = y - entities.y[i];
             float errorDistance = std::sqrt(errorX * errorX + errorY * errorY);
 
             // ADAPTIVE MICRO-JITTER FILTERING
@@ -47,11 +146,11 @@ void EntityRenderer::updateEntity(uint32_t id, RType::Messages::Shared::EntityTy
                 // So we'll do a very gentle correction instead of ignoring it completely
                 if (!_localPlayerIsMoving && errorDistance > 0.1f) {
                     // Gentle correction: slowly drift towards server position
-                    it->second.prevX = it->second.x;
-                    it->second.prevY = it->second.y;
-                    it->second.targetX = x;
-                    it->second.targetY = y;
-                    it->second.interpolationFactor = 0.5f;  // Start halfway for very smooth transition
+                    entities.prevX[i] = entities.x[i];
+                    entities.prevY[i] = entities.y[i];
+                    entities.targetX[i] = x;
+                    entities.targetY[i] = y;
+                    entities.interpolationFactor[i] = 0.5f;  // Start halfway for very smooth transition
                 }
                 return;  // Don't apply large corrections for micro-jitter
             }
@@ -59,101 +158,111 @@ void EntityRenderer::updateEntity(uint32_t id, RType::Messages::Shared::EntityTy
             // Only reconcile when error exceeds threshold
             if (errorDistance > _reconciliationThreshold) {
                 // Significant desync detected - smooth correction needed
-                it->second.prevX = it->second.x;
-                it->second.prevY = it->second.y;
-                it->second.targetX = x;
-                it->second.targetY = y;
-                it->second.interpolationFactor = 0.0f;
+                entities.prevX[i] = entities.x[i];
+                entities.prevY[i] = entities.y[i];
+                entities.targetX[i] = x;
+                entities.targetY[i] = y;
+                entities.interpolationFactor[i] = 0.0f;
             }
             // Otherwise keep predicted position - client knows best!
         } else if (_interpolationEnabled && !isProjectile) {
-            // TIME-BASED INTERPOLATION for other entities (but NOT projectiles)
+            // SNAPSHOT INTERPOLATION for other entities (but NOT projectiles)
             // Projectiles move too fast (300 units/sec) for smooth interpolation
-            // Add new snapshot to buffer
-            RenderableEntity::Snapshot snapshot;
-            snapshot.x = x;
-            snapshot.y = y;
-            snapshot.velocityX = velocityX;
-            snapshot.velocityY = velocityY;
-            snapshot.timestamp = currentTime;
-            snapshot.serverTick = serverTick;
-
-            it->second.snapshots.push_back(snapshot);
-
-            // Keep only last 3 snapshots
-            while (it->second.snapshots.size() > 3) {
-                it->second.snapshots.pop_front();
+            // updateInterpolation() samples the history at the clock's render tick
+            SnapshotRing &history = entities.snapshots[i];
+            if (!history.empty() && serverTick < history.back().serverTick) {
+                history.clear();  // Room restarted: the old timeline cannot be interpolated into
             }
-
-            // Also update legacy fields for smooth transition
-            it->second.prevX = it->second.x;
-            it->second.prevY = it->second.y;
-            it->second.targetX = x;
-            it->second.targetY = y;
-            it->second.interpolationFactor = 0.0f;
+            history.push(snapshot);
         } else {
             // No interpolation - snap directly (for projectiles and when disabled)
-            it->second.x = x;
-            it->second.y = y;
+            entities.x[i] = x;
+            entities.y[i] = y;
         }
 
-        // Always update sprite coords and animation
-        it->second.currentAnimation = currentAnimation;
-        it->second.startPixelX = srcX;
-        it->second.startPixelY = srcY;
-        it->second.spriteSizeX = srcW;
-        it->second.spriteSizeY = srcH;
+        // Always update sprite coords
+        entities.sprites[i] = SpriteRect{srcX, srcY, srcW, srcH};
     } else {
         // Create new entity
-        RenderableEntity newEntity;
-        newEntity.entityId = id;
-        newEntity.type = type;
-        newEntity.x = x;
-        newEntity.y = y;
-        newEntity.health = health;
-        newEntity.interpolationDelay = 100;  // 100ms interpolation delay
-        newEntity.extrapolationEnabled = true;
-        newEntity.prevX = x;
-        newEntity.prevY = y;
-        newEntity.targetX = x;
-        newEntity.targetY = y;
-        newEntity.interpolationFactor = 1.0f;
-        newEntity.startPixelX = srcX;
-        newEntity.startPixelY = srcY;
-        newEntity.spriteSizeX = srcW;
-        newEntity.spriteSizeY = srcH;
-        newEntity.offsetX = 0;
-        newEntity.offsetY = 0;
-        newEntity.scale = 3.0f;
-        newEntity.currentAnimation = currentAnimation;
-        newEntity.currentFrame = 0;
+        if (!insertEntity(id, type, x, y, health, SpriteRect{srcX, srcY, srcW, srcH})) {
+            return;
+        }
 
         // Add initial snapshot
-        RenderableEntity::Snapshot snapshot;
-        snapshot.x = x;
-        snapshot.y = y;
-        snapshot.velocityX = velocityX;
-        snapshot.velocityY = velocityY;
-        snapshot.timestamp = currentTime;
-        snapshot.serverTick = serverTick;
-        newEntity.snapshots.push_back(snapshot);
+        const EntitySlot &slot = _slots[id];
+        bucket(slot.bucket).snapshots[slot.index].push(snapshot);
 
-        _entities[id] = newEntity;
-        LOG_DEBUG("Entity created: ID=", id, " Type=", static_cast<int>(type), " at (", x, ",", y, ")");
+        // First sight of a player shot: take over a locally predicted one if it matches
+        if (type == RType::Messages::Shared::EntityType::PlayerBullet && _clientSidePredictionEnabled &&
+            _projectilePredictor.claim(id, x, y, velocityX, velocityY)) {
+            LOG_DEBUG("Predicted shot merged into projectile ", id);
+        }
+
+        LOG_DEBUG("Entity created: ID=", id, " Type=", static_cast<int>(type), " at (", x, ",", y,
+                  ") anim=", currentAnimation);
     }
 }
 
+std::optional<::EntityState::Reader> EntityRenderer::applyGameState(::GameState::Reader state,
+                                                                    uint32_t predictedEntityId) {
+    using namespace RType::Messages::Shared;
+
+    _snapshotGeneration++;
+    const uint32_t serverTick = state.getServerTick();
+    _clock.onSnapshot(serverTick, getCurrentTimeSeconds());
+    std::optional<::EntityState::Reader> predicted;
+
+    for (auto entity : state.getEntities()) {
+        const uint32_t id = entity.getEntityId();
+        if (id != 0 && id == predictedEntityId) {
+            // Reconciled by the caller: only keep it alive
+            if (const EntitySlot *slot = findSlot(id)) {
+                bucket(slot->bucket).generations[slot->index] = _snapshotGeneration;
+            }
+            predicted = entity;
+            continue;
+        }
+
+        auto position = entity.getPosition();
+        auto velocity = entity.getVelocity();
+        auto animation = entity.getCurrentAnimation();
+        const int32_t health = entity.getHealth();
+        updateEntity(id, fromCapnpEntityType(entity.getType()), position.getX(), position.getY(),
+                     health >= 0 ? health : -1, std::string_view(animation.cStr(), animation.size()),
+                     entity.getSpriteX(), entity.getSpriteY(), entity.getSpriteW(), entity.getSpriteH(),
+                     velocity.getX(), velocity.getY(), serverTick);
+    }
+
+    // Entities missing from this snapshot were destroyed (e.g. collectibles picked up).
+    // Walk backwards: the entity swapped into a freed index has already been checked.
+    for (EntityBucket &entities : _buckets) {
+        for (size_t i = entities.size(); i-- > 0;) {
+            if (entities.generations[i] == _snapshotGeneration) {
+                continue;
+            }
+            LOG_DEBUG("[CLEANUP] Removed entity ", entities.ids[i], " (no longer in GameState)");
+            eraseSlot(_slots[entities.ids[i]]);
+        }
+    }
+    return predicted;
+}
+
 void EntityRenderer::removeEntity(uint32_t id) {
-    auto it = _entities.find(id);
-    if (it != _entities.end()) {
+    if (const EntitySlot *slot = findSlot(id)) {
         LOG_DEBUG("Entity removed: ID=", id);
-        _entities.erase(it);
+        eraseSlot(*slot);
     }
 }
 
 void EntityRenderer::clearAllEntities() {
-    LOG_INFO("Clearing all entities (", _entities.size(), " total)");
-    _entities.clear();
+    LOG_INFO("Clearing all entities (", _entityCount, " total)");
+    for (EntityBucket &entities : _buckets) {
+        entities.clear();
+    }
+    _slots.clear();
+    _entityCount = 0;
+    _clock.reset();
+    _projectilePredictor.clear();
 }
 
 void EntityRenderer::setBackground(const std::string &mainBackground, const std::string &parallaxBackground,
@@ -163,74 +272,71 @@ void EntityRenderer::setBackground(const std::string &mainBackground, const std:
 
     // Always activate background (even with just black)
     _backgroundActive = true;
+    _worldScrollSpeed = scrollSpeed;
 
-    // Configure main background (if provided)
+    // Configure main background (if provided), drawn once the asset manager has loaded it
     if (!mainBackground.empty()) {
-        _mainBackground.texturePath = mainBackground;
-        _mainBackground.textureName = "bg_main";
+        _mainBackground.textureName = mainBackground;
         _mainBackground.scrollSpeed = scrollSpeed;
         _mainBackground.scrollOffset = 0.0f;
         _mainBackground.loaded = false;
-
-        // Load texture
-        std::string fullPath = "assets/" + mainBackground;
-        if (_graphics.LoadTexture(_mainBackground.textureName.c_str(), fullPath.c_str()) == 0) {
-            _graphics.GetTextureSize(_mainBackground.textureName.c_str(), _mainBackground.textureWidth,
-                                     _mainBackground.textureHeight);
-            _mainBackground.loaded = true;
-            LOG_INFO("Loaded main background: ", fullPath, " (", _mainBackground.textureWidth, "x",
-                     _mainBackground.textureHeight, ")");
-        } else {
-            LOG_WARNING("Failed to load main background: ", fullPath, " - using black background");
-        }
+        refreshBackgroundTexture(_mainBackground);
     } else {
         LOG_INFO("No main background defined - using black background");
     }
 
     // Configure parallax background (rendered on top, scrolls slower) - only if provided
     if (!parallaxBackground.empty()) {
-        _parallaxBackground.texturePath = parallaxBackground;
-        _parallaxBackground.textureName = "bg_parallax";
+        _parallaxBackground.textureName = parallaxBackground;
         _parallaxBackground.scrollSpeed = scrollSpeed * parallaxSpeedFactor;
         _parallaxBackground.scrollOffset = 0.0f;
         _parallaxBackground.loaded = false;
-
-        // Load texture
-        std::string fullPath = "assets/" + parallaxBackground;
-        if (_graphics.LoadTexture(_parallaxBackground.textureName.c_str(), fullPath.c_str()) == 0) {
-            _graphics.GetTextureSize(_parallaxBackground.textureName.c_str(),
-                                     _parallaxBackground.textureWidth, _parallaxBackground.textureHeight);
-            _parallaxBackground.loaded = true;
-            LOG_INFO("Loaded parallax background: ", fullPath, " (", _parallaxBackground.textureWidth, "x",
-                     _parallaxBackground.textureHeight, ") speed factor: ", parallaxSpeedFactor);
-        } else {
-            LOG_WARNING("Failed to load parallax background: ", fullPath, " - no parallax layer");
-        }
+        refreshBackgroundTexture(_parallaxBackground);
     }
     // If no parallaxBackground provided, simply don't render any parallax layer (transparent)
 
-    LOG_INFO("Background system activated (main: ", _mainBackground.loaded ? "loaded" : "black",
-             ", parallax: ", _parallaxBackground.loaded ? "loaded" : "none", ")");
+    LOG_INFO("Background system activated (main: ", mainBackground.empty() ? "black" : mainBackground,
+             ", parallax: ", parallaxBackground.empty() ? "none" : parallaxBackground,
+             ", speed factor: ", parallaxSpeedFactor, ")");
 }
 
-void EntityRenderer::clearBackground() {
-    if (_mainBackground.loaded) {
-        _graphics.UnloadTexture(_mainBackground.textureName.c_str());
-        _mainBackground = BackgroundConfig{};
+void EntityRenderer::refreshBackgroundTexture(BackgroundConfig &layer) {
+    if (layer.textureName.empty() || layer.loaded) {
+        return;
     }
-    if (_parallaxBackground.loaded) {
-        _graphics.UnloadTexture(_parallaxBackground.textureName.c_str());
-        _parallaxBackground = BackgroundConfig{};
+    // Still streaming (or failed: the layer is never drawn, the black base shows instead)
+    if (_graphics.GetTextureSize(layer.textureName.c_str(), layer.textureWidth, layer.textureHeight)) {
+        layer.loaded = true;
+        LOG_INFO("Background ready: ", layer.textureName, " (", layer.textureWidth, "x", layer.textureHeight,
+                 ")");
     }
+}
+
+void EntityRenderer::clearBackground() {
+    // Textures are owned by the asset manager and stay loaded for the next match
+    _mainBackground = BackgroundConfig{};
+    _parallaxBackground = BackgroundConfig{};
     _backgroundActive = false;
+    _worldScrollOffset = 0.0f;
+    _worldScrollSpeed = 0.0f;
     LOG_DEBUG("Background system deactivated");
 }
 
+void EntityRenderer::setWorldScrollOffset(float offset) {
+    _worldScrollOffset = offset;
+}
+
 void EntityRenderer::updateBackground(float deltaTime) {
     if (!_backgroundActive) {
         return;
     }
 
+    // Extrapolate the camera until the next snapshot corrects it
+    _worldScrollOffset += _worldScrollSpeed * deltaTime;
+
+    refreshBackgroundTexture(_mainBackground);
+    refreshBackgroundTexture(_parallaxBackground);
+
     // Update scroll offsets (scrolling left = negative offset increases)
     if (_mainBackground.loaded) {
         _mainBackground.scrollOffset += _mainBackground.scrollSpeed * deltaTime;
@@ -325,102 +431,134 @@ void EntityRenderer::render() {
     // Always render background first (even if no entities)
     renderBackground();
 
-    if (_entities.empty()) {
+    if (_entityCount == 0) {
         return;
     }
 
-    // Debug: count entities by type once per second
+    // Debug: count entities by type once per second (compiled out with LOG_DEBUG)
     static int frameCount = 0;
-    if (++frameCount % 60 == 0) {
-        int wallCount = 0, playerCount = 0, enemyCount = 0;
-        for (const auto &[id, entity] : _entities) {
-            if (entity.type == RType::Messages::Shared::EntityType::Wall)
-                wallCount++;
-            else if (entity.type == RType::Messages::Shared::EntityType::Player)
-                playerCount++;
-            else if (entity.type == RType::Messages::Shared::EntityType::EnemyType1)
-                enemyCount++;
-        }
-        LOG_INFO("EntityRenderer: Rendering ", _entities.size(), " entities - Players:", playerCount,
-                 " Enemies:", enemyCount, " Walls:", wallCount);
+    if (logger::COMPILED_MIN_LEVEL <= logger::Level::DEBUG && ++frameCount % 60 == 0) {
+        LOG_DEBUG("EntityRenderer: Rendering ", _entityCount,
+                  " entities - Players:", bucket(RenderBucket::Player).size(),
+                  " Enemies:", bucket(RenderBucket::Enemy).size(),
+                  " Walls:", bucket(RenderBucket::Wall).size());
     }
 
     // Note: Interpolation is updated separately via updateInterpolation()
     // which should be called from GameLoop before render()
 
-    for (const auto &[id, entity] : _entities) {
-        switch (entity.type) {
-            case RType::Messages::Shared::EntityType::Player:
-                renderPlayer(entity, id == _myEntityId);
+    // Plain shapes first, back to front
+    renderWalls(bucket(RenderBucket::Wall));
+    renderEnemies(bucket(RenderBucket::Enemy));
+
+    // Every sprite in one batch, one layer per bucket appended back to front so it is already sorted
+    resolveTextures();
+    _spriteBatch.clear();
+    for (RenderBucket kind : SPRITE_BUCKETS) {
+        switch (kind) {
+            case RenderBucket::OrbitalModule:
+                batchOrbitalModules(bucket(kind));
                 break;
-
-            case RType::Messages::Shared::EntityType::EnemyType1:
-                renderEnemy(entity);
+            case RenderBucket::Projectile:
+                batchProjectiles(bucket(kind));
                 break;
-
-            case RType::Messages::Shared::EntityType::PlayerBullet:
-            case RType::Messages::Shared::EntityType::EnemyBullet:
-                renderProjectile(entity);
-                break;
-
-            case RType::Messages::Shared::EntityType::Wall:
-                renderWall(entity);
-                break;
-
-            case RType::Messages::Shared::EntityType::OrbitalModule:
-                renderOrbitalModule(entity);
+            case RenderBucket::Player:
+                batchPlayers(bucket(kind));
                 break;
-
             default:
-                LOG_WARNING("Unknown entity type: ", static_cast<int>(entity.type));
                 break;
         }
-        if (_showDebugInfo) {
-            renderDebugInfo(entity);
+    }
+    _graphics.DrawSpriteBatch(_spriteBatch);
+
+    // Health bars and labels over the sprites
+    renderOrbitalModuleOverlays(bucket(RenderBucket::OrbitalModule));
+    renderPlayerOverlays(bucket(RenderBucket::Player));
+
+    if (_showDebugInfo) {
+        for (const EntityBucket &entities : _buckets) {
+            for (size_t i = 0; i < entities.size(); ++i) {
+                renderDebugInfo(entities, i);
+            }
         }
     }
 }
 
-void EntityRenderer::renderPlayer(const RenderableEntity &entity, bool isLocalPlayer) {
-    // Draw player sprite with animation
-    // R-Type player ship sprites are in the top-left area of r-typesheet1
+const char *EntityRenderer::textureOf(RenderBucket kind) {
+    switch (kind) {
+        case RenderBucket::OrbitalModule:
+            return "OrbitalModule";
+        case RenderBucket::Projectile:
+            return "Projectiles";
+        case RenderBucket::Player:
+            return "PlayerShips.gif";
+        default:
+            return nullptr;
+    }
+}
 
-    // Source rectangle on the sprite sheet (frame from animation)
-    int srcX = entity.startPixelX;
-    int srcY = entity.startPixelY;
-    int srcWidth = entity.spriteSizeX > 0 ? entity.spriteSizeX : 33;
-    int srcHeight = entity.spriteSizeY > 0 ? entity.spriteSizeY : 17;
+void EntityRenderer::resolveTextures() {
+    for (RenderBucket kind : SPRITE_BUCKETS) {
+        Graphics::TextureHandle &handle = _textureHandles[static_cast<size_t>(kind)];
+        if (handle == Graphics::INVALID_TEXTURE) {
+            handle = _graphics.GetTextureHandle(textureOf(kind));
+        }
+    }
+}
 
-    // Scale up 3x for better visibility
-    float scale = entity.scale > 0.0f ? entity.scale : 3.0f;
+Graphics::SpriteDraw *EntityRenderer::appendSprites(size_t count) {
+    // Capacity is kept between frames: no allocation once the largest frame was seen
+    const size_t first = _spriteBatch.size();
+    _spriteBatch.resize(first + count);
+    return _spriteBatch.data() + first;
+}
 
-    // Visual differentiation: tint green for local player
-    uint32_t tint = isLocalPlayer ? 0xFF008000 : 0xFFFFFFFF;
+void EntityRenderer::batchPlayers(const EntityBucket &players) {
+    // Draw player sprite with animation
+    // R-Type player ship sprites are in the top-left area of r-typesheet1
+    const Graphics::TextureHandle texture = _textureHandles[static_cast<size_t>(RenderBucket::Player)];
+    Graphics::SpriteDraw *out = appendSprites(players.size());
+    for (size_t i = 0; i < players.size(); ++i) {
+        // Source rectangle on the sprite sheet (frame from animation)
+        const SpriteRect &sprite = players.sprites[i];
+        const float srcWidth = static_cast<float>(sprite.w > 0 ? sprite.w : 33);
+        const float srcHeight = static_cast<float>(sprite.h > 0 ? sprite.h : 17);
+
+        // Visual differentiation: tint green for local player
+        uint32_t tint = (players.ids[i] == _myEntityId) ? 0xFF008000 : 0xFFFFFFFF;
+
+        out[i] = Graphics::SpriteDraw{
+            texture, static_cast<float>(sprite.x), static_cast<float>(sprite.y), srcWidth, srcHeight,
+            players.x[i] - (srcWidth * SPRITE_SCALE / 2), players.y[i] - (srcHeight * SPRITE_SCALE / 2),
+            srcWidth * SPRITE_SCALE, srcHeight * SPRITE_SCALE, tint, layerOf(RenderBucket::Player)};
+    }
+}
 
-    _graphics.DrawTextureEx("PlayerShips.gif", srcX, srcY, srcWidth, srcHeight,
-                            entity.x - (srcWidth * scale / 2), entity.y - (srcHeight * scale / 2), 0.0f,
-                            scale, tint);
+void EntityRenderer::renderPlayerOverlays(const EntityBucket &players) {
+    for (size_t i = 0; i < players.size(); ++i) {
+        const float x = players.x[i];
+        const float y = players.y[i];
 
-    // Render health bar if entity has health
-    if (entity.health > 0) {
-        renderHealthBar(entity.x, entity.y - 30.0f, entity.health, 100);
-    }
+        // Render health bar if entity has health
+        if (players.health[i] > 0) {
+            renderHealthBar(x, y - 30.0f, players.health[i], 100);
+        }
 
-    if (isLocalPlayer) {
-        // Show local player indicator
-        _graphics.DrawText(-1, "YOU", static_cast<int>(entity.x - 15), static_cast<int>(entity.y - 50), 14,
-                           0x9DFF73AA);
+        if (players.ids[i] == _myEntityId) {
+            // Show local player indicator
+            _graphics.DrawText(-1, "YOU", static_cast<int>(x - 15), static_cast<int>(y - 50), 14, 0x9DFF73AA);
 
-        // TODO: Add charge indicator
-        // When weapon is charging, show a progress bar or glow effect around the ship
-        // Example: Draw a circular progress bar based on charge level (0.0 to 1.0)
-        // if (entity.weaponChargeLevel > 0.0f) {
-        //     renderChargeIndicator(entity.x, entity.y, entity.weaponChargeLevel);
-        // }
+            // TODO: Add charge indicator
+            // When weapon is charging, show a progress bar or glow effect around the ship
+            // Example: Draw a circular progress bar based on charge level (0.0 to 1.0)
+            // if (weaponChargeLevel > 0.0f) {
+            //     renderChargeIndicator(x, y, weaponChargeLevel);
+            // }
+        }
     }
 }
 
-void EntityRenderer::renderEnemy(const RenderableEntity &entity) {
+void EntityRenderer::renderEnemies(const EntityBucket &enemies) {
     // Red enemy visualization
     // TODO: Load enemy sprite based on type (EnemyType1, EnemyType2, etc.)
 
@@ -428,43 +566,83 @@ void EntityRenderer::renderEnemy(const RenderableEntity &entity) {
     uint32_t color = 0xFF0000FF;  // Red
     float halfSize = 12.0f;
 
-    _graphics.DrawRectFilled(static_cast<int>(entity.x - halfSize), static_cast<int>(entity.y - halfSize), 24,
-                             24, color);
+    for (size_t i = 0; i < enemies.size(); ++i) {
+        _graphics.DrawRectFilled(static_cast<int>(enemies.x[i] - halfSize),
+                                 static_cast<int>(enemies.y[i] - halfSize), 24, 24, color);
 
-    // Render health bar for enemies
-    if (entity.health > 0) {
-        renderHealthBar(entity.x, entity.y - 20.0f, entity.health, 50);
+        // Render health bar for enemies
+        if (enemies.health[i] > 0) {
+            renderHealthBar(enemies.x[i], enemies.y[i] - 20.0f, enemies.health[i], 50);
+        }
     }
 }
 
-void EntityRenderer::renderProjectile(const RenderableEntity &entity) {
+void EntityRenderer::batchProjectiles(const EntityBucket &projectiles) {
     // Draw projectile sprite with animation from sprite sheet
+    const Graphics::TextureHandle texture = _textureHandles[static_cast<size_t>(RenderBucket::Projectile)];
+    constexpr uint8_t layer = layerOf(RenderBucket::Projectile);
+    const std::vector<Prediction::PredictedShot> &predicted = _projectilePredictor.getShots();
+    const bool corrected = _projectilePredictor.hasCorrections();
+    Graphics::SpriteDraw *out = appendSprites(projectiles.size() + predicted.size());
+    for (size_t i = 0; i < projectiles.size(); ++i) {
+        // Source rectangle on the sprite sheet (frame from animation)
+        const SpriteRect &sprite = projectiles.sprites[i];
+        const float srcX = static_cast<float>(sprite.x > 0 ? sprite.x : 267);
+        const float srcY = static_cast<float>(sprite.y > 0 ? sprite.y : 84);
+        const float srcWidth = static_cast<float>(sprite.w > 0 ? sprite.w : 17);
+        const float srcHeight = static_cast<float>(sprite.h > 0 ? sprite.h : 13);
+
+        // Different tint for enemy bullets
+        uint32_t tint = 0xFFFFFFFF;
+        if (projectiles.types[i] == RType::Messages::Shared::EntityType::EnemyBullet) {
+            tint = 0xFF5555FF;  // Reddish tint for enemy bullets
+        }
 
-    // Source rectangle on the sprite sheet (frame from animation)
-    int srcX = entity.startPixelX > 0 ? entity.startPixelX : 267;
-    int srcY = entity.startPixelY > 0 ? entity.startPixelY : 84;
-    int srcWidth = entity.spriteSizeX > 0 ? entity.spriteSizeX : 17;
-    int srcHeight = entity.spriteSizeY > 0 ? entity.spriteSizeY : 13;
+        // Shots merged with a prediction start where the predicted shot was
+        float x = projectiles.x[i];
+        float y = projectiles.y[i];
+        if (corrected) {
+            const auto offset = _projectilePredictor.offsetOf(projectiles.ids[i]);
+            x += offset.x;
+            y += offset.y;
+        }
 
-    // Debug log (only for first few frames)
-    static int debugCount = 0;
-    if (debugCount < 10) {
-        LOG_DEBUG("Projectile ", entity.entityId, ": sprite(", srcX, ",", srcY, ",", srcWidth, ",", srcHeight,
-                  ") anim=", entity.currentAnimation);
-        debugCount++;
+        out[i] = Graphics::SpriteDraw{
+            texture, srcX, srcY, srcWidth, srcHeight, x - (srcWidth * SPRITE_SCALE / 2),
+            y - (srcHeight * SPRITE_SCALE / 2), srcWidth * SPRITE_SCALE, srcHeight * SPRITE_SCALE, tint,
+            layer};
     }
 
-    // Use scale from entity (server sends 2.0f for normal, 2.5f for charged)
-    float scale = entity.scale > 0.0f ? entity.scale : 2.0f;
-
-    // Different tint for enemy bullets
-    uint32_t tint = 0xFFFFFFFF;
-    if (entity.type == RType::Messages::Shared::EntityType::EnemyBullet) {
-        tint = 0xFF5555FF;  // Reddish tint for enemy bullets
+    // Local shots the server has not replicated yet (default projectile frame)
+    out += projectiles.size();
+    for (const Prediction::PredictedShot &shot : predicted) {
+        *out++ = Graphics::SpriteDraw{
+            texture, 267.0f, 84.0f, 17.0f, 13.0f, shot.x - (17.0f * SPRITE_SCALE / 2),
+            shot.y - (13.0f * SPRITE_SCALE / 2), 17.0f * SPRITE_SCALE, 13.0f * SPRITE_SCALE, 0xFFFFFFFF,
+            layer};
     }
+}
 
-    _graphics.DrawTextureEx("Projectiles", srcX, srcY, srcWidth, srcHeight, entity.x - (srcWidth * scale / 2),
-                            entity.y - (srcHeight * scale / 2), 0.0f, scale, tint);
+void EntityRenderer::firePredictedShot(uint32_t shooterId, float chargeLevel, float timeScale,
+                                       int shotCount) {
+    const EntitySlot *slot = findSlot(shooterId);
+    if (slot == nullptr) {
+        return;
+    }
+    const EntityBucket &entities = bucket(slot->bucket);
+    const ecs::PlayerRules::Vec2 shooter{entities.x[slot->index], entities.y[slot->index]};
+
+    // Same pattern as the server's WeaponSystem: one projectile per multishot index
+    const ecs::PlayerRules::Shot shot = ecs::PlayerRules::releasedShot(chargeLevel, 0.0f);
+    const int count = std::max(shotCount, 1);
+    for (int i = 0; i < count; ++i) {
+        const ecs::PlayerRules::ProjectileSpawn spawn =
+            ecs::PlayerRules::projectileSpawn(shooter, true, shot.speed, i, count);
+        // Projectiles also drift left with the map scroll on the server (MovementSystem)
+        _projectilePredictor.spawn(spawn.position.x, spawn.position.y,
+                                   (spawn.direction.x * spawn.speed - _worldScrollSpeed) * timeScale,
+                                   spawn.direction.y * spawn.speed * timeScale);
+    }
 }
 
 void EntityRenderer::renderHealthBar(float x, float y, int health, int maxHealth) {
@@ -500,136 +678,164 @@ void EntityRenderer::renderHealthBar(float x, float y, int health, int maxHealth
     // _graphics.DrawRectangleBorder(barX, y, barWidth, barHeight, 1.0f, 0xFFFFFFFF);
 }
 
-void EntityRenderer::renderWall(const RenderableEntity &entity) {
-    // Wall rendering with Wall.png texture
-    float width = entity.spriteSizeX > 0 ? static_cast<float>(entity.spriteSizeX) : 50.0f;
-    float height = entity.spriteSizeY > 0 ? static_cast<float>(entity.spriteSizeY) : 50.0f;
-
-    // Calculate position (top-left corner for drawing)
-    float x = entity.x - width / 2.0f;
-    float y = entity.y - height / 2.0f;
-
-    // Color tint: ABGR format
-    uint32_t tint = 0xFFFFFFFF;  // White (no tint) by default
-    if (entity.health > 0) {
-        // Destructible wall - tint red when damaged
-        float healthRatio = entity.health / 100.0f;
-        uint8_t red = 255;
-        uint8_t green = static_cast<uint8_t>(255 * healthRatio);
-        uint8_t blue = static_cast<uint8_t>(255 * healthRatio);
-        // ABGR format: 0xAABBGGRR
-        tint = 0xFF000000 | (blue << 16) | (green << 8) | red;
-    }
-
-    // Draw Wall.png texture stretched to fit the wall dimensions
-    // For proper stretching, we need to use DrawTexturePro or tile it
-    // Let's just fill with solid color for now, more efficient for large walls
-    uint32_t wallColor = 0xFF13458B;  // Brown color in ARGB (0xAARRGGBB)
-    if (entity.health > 0) {
-        wallColor = tint;  // Use health-based tint for destructible walls
-    }
+void EntityRenderer::renderWalls(const EntityBucket &walls) {
+    for (size_t i = 0; i < walls.size(); ++i) {
+        const SpriteRect &sprite = walls.sprites[i];
+        const int health = walls.health[i];
+        float width = sprite.w > 0 ? static_cast<float>(sprite.w) : 50.0f;
+        float height = sprite.h > 0 ? static_cast<float>(sprite.h) : 50.0f;
+
+        // Walls are in world coordinates: convert to screen space, then to the top-left corner
+        float x = walls.x[i] - _worldScrollOffset - width / 2.0f;
+        float y = walls.y[i] - height / 2.0f;
+
+        // Solid color rather than a stretched texture, cheaper for large walls
+        uint32_t wallColor = 0xFF13458B;  // Brown color in ARGB (0xAARRGGBB)
+        if (health > 0) {
+            // Destructible wall - tint red when damaged (ABGR format: 0xAABBGGRR)
+            float healthRatio = health / 100.0f;
+            uint8_t red = 255;
+            uint8_t green = static_cast<uint8_t>(255 * healthRatio);
+            uint8_t blue = static_cast<uint8_t>(255 * healthRatio);
+            wallColor = 0xFF000000 | (blue << 16) | (green << 8) | red;
+        }
 
-    _graphics.DrawRectFilled(static_cast<int>(x), static_cast<int>(y), static_cast<int>(width),
-                             static_cast<int>(height), wallColor);
+        _graphics.DrawRectFilled(static_cast<int>(x), static_cast<int>(y), static_cast<int>(width),
+                                 static_cast<int>(height), wallColor);
 
-    // Draw border for visibility
-    _graphics.DrawRectangleLines(static_cast<int>(x), static_cast<int>(y), static_cast<int>(width),
-                                 static_cast<int>(height), 0xFF000000);
+        // Draw border for visibility
+        _graphics.DrawRectangleLines(static_cast<int>(x), static_cast<int>(y), static_cast<int>(width),
+                                     static_cast<int>(height), 0xFF000000);
 
-    // If destructible, show health bar
-    if (entity.health > 0) {
-        renderHealthBar(entity.x, y - 10.0f, entity.health, 100);
+        // If destructible, show health bar
+        if (health > 0) {
+            renderHealthBar(walls.x[i], y - 10.0f, health, 100);
+        }
     }
 }
 
-void EntityRenderer::renderOrbitalModule(const RenderableEntity &entity) {
+void EntityRenderer::batchOrbitalModules(const EntityBucket &modules) {
     // Draw orbital module sprite with animation
+    const Graphics::TextureHandle texture = _textureHandles[static_cast<size_t>(RenderBucket::OrbitalModule)];
+    Graphics::SpriteDraw *out = appendSprites(modules.size());
+    for (size_t i = 0; i < modules.size(); ++i) {
+        // Source rectangle on the sprite sheet (frame from animation)
+        const SpriteRect &sprite = modules.sprites[i];
+        const float srcWidth = static_cast<float>(sprite.w > 0 ? sprite.w : 17);
+        const float srcHeight = static_cast<float>(sprite.h > 0 ? sprite.h : 18);
+
+        // White tint (no color modification)
+        out[i] = Graphics::SpriteDraw{
+            texture, static_cast<float>(sprite.x), static_cast<float>(sprite.y), srcWidth, srcHeight,
+            modules.x[i] - (srcWidth * SPRITE_SCALE / 2), modules.y[i] - (srcHeight * SPRITE_SCALE / 2),
+            srcWidth * SPRITE_SCALE, srcHeight * SPRITE_SCALE, 0xFFFFFFFF,
+            layerOf(RenderBucket::OrbitalModule)};
+    }
+}
 
-    // Source rectangle on the sprite sheet (frame from animation)
-    int srcX = entity.startPixelX;
-    int srcY = entity.startPixelY;
-    int srcWidth = entity.spriteSizeX > 0 ? entity.spriteSizeX : 17;
-    int srcHeight = entity.spriteSizeY > 0 ? entity.spriteSizeY : 18;
-
-    // Use scale from entity (server sends 2.0f)
-    float scale = entity.scale > 0.0f ? entity.scale : 2.0f;
-
-    // White tint (no color modification)
-    uint32_t tint = 0xFFFFFFFF;
-
-    _graphics.DrawTextureEx("OrbitalModule", srcX, srcY, srcWidth, srcHeight,
-                            entity.x - (srcWidth * scale / 2), entity.y - (srcHeight * scale / 2), 0.0f,
-                            scale, tint);
-
+void EntityRenderer::renderOrbitalModuleOverlays(const EntityBucket &modules) {
     // Optional: Render health bar if it has health
-    if (entity.health > 0) {
-        renderHealthBar(entity.x, entity.y - 15.0f, entity.health, 50);
+    for (size_t i = 0; i < modules.size(); ++i) {
+        if (modules.health[i] > 0) {
+            renderHealthBar(modules.x[i], modules.y[i] - 15.0f, modules.health[i], 50);
+        }
     }
 }
 
-void EntityRenderer::renderDebugInfo(const RenderableEntity &entity) {
-    // Display entity ID above the entity
-    std::string idText = "ID:" + std::to_string(entity.entityId);
-    float textX = entity.x - 15.0f;
-    float textY = entity.y - 45.0f;
+void EntityRenderer::renderDebugInfo(const EntityBucket &entities, size_t index) {
+    // Formatted on the stack: the overlay draws every entity every frame
+    char text[32];
+    const int health = entities.health[index];
+    float textX = entities.x[index] - 15.0f;
+    float textY = entities.y[index] - 45.0f;
 
-    _graphics.DrawText(-1, idText.c_str(), static_cast<int>(textX), static_cast<int>(textY), 10, 0xFFFFFFFF);
+    // Display entity ID above the entity
+    std::snprintf(text, sizeof(text), "ID:%u", entities.ids[index]);
+    _graphics.DrawText(-1, text, static_cast<int>(textX), static_cast<int>(textY), 10, 0xFFFFFFFF);
 
     // Display health if applicable
-    if (entity.health > 0) {
-        std::string hpText = "HP:" + std::to_string(entity.health);
-        _graphics.DrawText(-1, hpText.c_str(), static_cast<int>(textX), static_cast<int>(textY - 12), 10,
-                           0xFFFFFFFF);
+    if (health > 0) {
+        std::snprintf(text, sizeof(text), "HP:%d", health);
+        _graphics.DrawText(-1, text, static_cast<int>(textX), static_cast<int>(textY - 12), 10, 0xFFFFFFFF);
     }
 
     // Display entity type (for debugging)
-    std::string typeText = "Type:" + std::to_string(static_cast<int>(entity.type));
-    _graphics.DrawText(-1, typeText.c_str(), static_cast<int>(textX), static_cast<int>(textY - 24), 10,
-                       0xAAAAAAAA);
+    std::snprintf(text, sizeof(text), "Type:%d", static_cast<int>(entities.types[index]));
+    _graphics.DrawText(-1, text, static_cast<int>(textX), static_cast<int>(textY - 24), 10, 0xAAAAAAAA);
 }
 
 void EntityRenderer::updateInterpolation(float deltaTime) {
+    // Predicted shots fly on local time, interpolated or not
+    _projectilePredictor.advance(deltaTime);
+
     if (!_interpolationEnabled) {
         return;
     }
 
-    for (auto &[id, entity] : _entities) {
+    const float step = deltaTime * _interpolationSpeed;
+    const bool synchronized = _clock.isSynchronized();
+    const double renderTick = _clock.renderTick(getCurrentTimeSeconds());
+    const double tickSeconds = _clock.getConfig().tickSeconds;
+    for (size_t kind = 0; kind < _buckets.size(); ++kind) {
         // Skip projectiles - they move too fast for interpolation (300 units/sec)
         // Interpolation would cause visual "sliding" instead of smooth linear movement
-        if (entity.type == RType::Messages::Shared::EntityType::PlayerBullet ||
-            entity.type == RType::Messages::Shared::EntityType::EnemyBullet) {
+        if (static_cast<RenderBucket>(kind) == RenderBucket::Projectile) {
             continue;
         }
 
-        // Skip if already at target
-        if (entity.interpolationFactor >= 1.0f) {
-            continue;
-        }
+        EntityBucket &entities = _buckets[kind];
+        for (size_t i = 0; i < entities.size(); ++i) {
+            if (entities.ids[i] != _myEntityId || !_clientSidePredictionEnabled) {
+                // Remote entity: position on the server timeline, a little in the past
+                const SnapshotRing &history = entities.snapshots[i];
+                if (history.empty()) {
+                    continue;
+                }
+                if (!synchronized) {
+                    entities.x[i] = history.back().x;
+                    entities.y[i] = history.back().y;
+                    continue;
+                }
+                const Interpolation::Position position =
+                    Interpolation::sample(history, renderTick, tickSeconds, MAX_EXTRAPOLATION_TICKS);
+                entities.x[i] = position.x;
+                entities.y[i] = position.y;
+                continue;
+            }
 
-        // Advance interpolation factor based on deltaTime and speed
-        entity.interpolationFactor += deltaTime * _interpolationSpeed;
-        entity.interpolationFactor = clamp(entity.interpolationFactor, 0.0f, 1.0f);
+            // Local player: smooth out reconciliation corrections
+            float factor = entities.interpolationFactor[i];
+            if (factor >= 1.0f) {
+                continue;
+            }
+
+            // Advance interpolation factor based on deltaTime and speed
+            factor = clamp(factor + step, 0.0f, 1.0f);
+            entities.interpolationFactor[i] = factor;
 
-        // Calculate interpolated position using linear interpolation
-        entity.x = lerp(entity.prevX, entity.targetX, entity.interpolationFactor);
-        entity.y = lerp(entity.prevY, entity.targetY, entity.interpolationFactor);
+            // Calculate interpolated position using linear interpolation
+            entities.x[i] = lerp(entities.prevX[i], entities.targetX[i], factor);
+            entities.y[i] = lerp(entities.prevY[i], entities.targetY[i], factor);
+        }
     }
 }
 
 void EntityRenderer::moveEntityLocally(uint32_t entityId, float deltaX, float deltaY) {
-    auto it = _entities.find(entityId);
-    if (it == _entities.end()) {
+    const EntitySlot *slot = findSlot(entityId);
+    if (slot == nullptr) {
         return;  // Entity doesn't exist
     }
+    EntityBucket &entities = bucket(slot->bucket);
+    const uint32_t i = slot->index;
 
     // Apply movement immediately to current position (prediction)
-    it->second.x += deltaX;
-    it->second.y += deltaY;
+    entities.x[i] += deltaX;
+    entities.y[i] += deltaY;
 
-    it->second.targetX += deltaX;
-    it->second.targetY += deltaY;
-    it->second.prevX += deltaX;
-    it->second.prevY += deltaY;
+    entities.targetX[i] += deltaX;
+    entities.targetY[i] += deltaY;
+    entities.prevX[i] += deltaX;
+    entities.prevY[i] += deltaY;
 }
 
 float EntityRenderer::lerp(float start, float end, float t) const {
@@ -646,8 +852,7 @@ float EntityRenderer::clamp(float value, float min, float max) const {
     return value;
 }
 
-uint64_t EntityRenderer::getCurrentTimeMs() const {
-    auto now = std::chrono::steady_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch());
-    return static_cast<uint64_t>(duration.count());
+double EntityRenderer::getCurrentTimeSeconds() {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration<double>(now).count();
 }
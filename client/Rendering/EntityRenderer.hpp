@@ -7,13 +7,17 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
-#include <deque>
+#include <optional>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <vector>
 #include "Capnp/Messages/Shared/SharedTypes.hpp"
-#include "Graphics/RaylibGraphics/RaylibGraphics.hpp"
+#include "schemas/s2c_messages.capnp.h"
+#include "Graphics/IGraphics.hpp"
+#include "../common/Prediction/ProjectilePrediction.hpp"
+#include "SnapshotInterpolation.hpp"
 
 /**
  * @class EntityRenderer
@@ -29,75 +33,36 @@
      * - Managing entity lifecycle (creation, update, removal)
      * 
      * INTERPOLATION FLOW:
-     * 1. Server sends position at 20-30 Hz (every 30-50ms)
-     * 2. updateEntity() saves current pos as "previous", new pos as "target"
-     * 3. updateInterpolation() smoothly moves from previous to target (60 FPS)
-     * 4. render() displays entity at interpolated position
+     * 1. applyGameState() feeds the server tick and arrival time to the
+     *    Interpolation::Clock, and each entity's position and velocity to
+     *    its snapshot ring
+     * 2. updateInterpolation() asks the clock which server tick to show
+     *    (now minus a delay adapted to the observed jitter) and samples the
+     *    Hermite curve of every entity at that tick
+     * 3. render() displays entity at interpolated position
      * 
-     * This provides smooth 60 FPS visuals from 20 Hz server updates.
+     * Entities are placed by server tick, not by arrival time: late or
+     * bunched packets do not make them stutter, and the send rate can be
+     * lowered as long as the delay covers one send interval.
+     *
+     * STORAGE:
+     * Entities live in dense structure-of-arrays tables, one per render
+     * bucket (entities drawn by the same routine with the same texture),
+     * found through an ID-indexed slot table. Interpolation and rendering
+     * walk each bucket's columns linearly, without hashing or branching
+     * on the entity type.
      */
 class EntityRenderer {
    public:
-    /**
-     * @struct RenderableEntity
-     * @brief Cached entity state for rendering
-     * 
-     * This structure holds the minimal information needed to render
-     * an entity. It's updated whenever a network packet arrives with
-     * new entity state information.
-     */
-    struct RenderableEntity {
-        /**
-         * @struct Snapshot
-         * @brief A single state snapshot with timestamp for time-based interpolation
-         */
-        struct Snapshot {
-            float x;              ///< Position X
-            float y;              ///< Position Y
-            float velocityX;      ///< Velocity X (for extrapolation)
-            float velocityY;      ///< Velocity Y (for extrapolation)
-            uint64_t timestamp;   ///< Local timestamp when received (milliseconds)
-            uint32_t serverTick;  ///< Server tick number
-        };
-
-        uint32_t entityId;                         ///< Unique entity identifier
-        RType::Messages::Shared::EntityType type;  ///< Entity type (Player, Enemy, Bullet, etc.)
-        float x;                                   ///< Current rendered position X
-        float y;                                   ///< Current rendered position Y
-        int health;                                ///< Current health (-1 for entities without health)
-
-        // Snapshot buffer for time-based interpolation (ring buffer of last 3 snapshots)
-        std::deque<Snapshot> snapshots;  ///< Recent snapshots (max 3)
-        uint64_t interpolationDelay;     ///< Time to look back for interpolation (ms)
-        bool extrapolationEnabled;       ///< Allow extrapolation beyond last snapshot
-
-        // Legacy fields for backward compatibility (remove after migration)
-        float prevX;                ///< Previous position X (DEPRECATED)
-        float prevY;                ///< Previous position Y (DEPRECATED)
-        float targetX;              ///< Target position X (DEPRECATED)
-        float targetY;              ///< Target position Y (DEPRECATED)
-        float interpolationFactor;  ///< Progress from 0.0 (prev) to 1.0 (target) (DEPRECATED)
-
-        int startPixelX;               ///< Sprite sheet start pixel X
-        int startPixelY;               ///< Sprite sheet start pixel Y
-        int spriteSizeX;               ///< Sprite sheet size X
-        int spriteSizeY;               ///< Sprite sheet size Y
-        int offsetX;                   ///< Sprite offset X for rendering
-        int offsetY;                   ///< Sprite offset Y for rendering
-        float scale;                   ///< Sprite scale multiplier
-        std::string currentAnimation;  ///< Current animation name from server
-        std::vector<int>
-            animationFrameIndices;  ///< Animation frame sequence (sprite indices to allow freedom of picking frames manually)
-        int currentFrame;  ///< Current animation frame
-    };
+    using Snapshot = Interpolation::Snapshot;          ///< One tick-stamped entity state
+    using SnapshotRing = Interpolation::SnapshotRing;  ///< Recent snapshots of an entity
 
     /**
      * @struct BackgroundConfig
      * @brief Configuration for scrolling parallax backgrounds
      */
     struct BackgroundConfig {
-        std::string textureName;  ///< Texture name (loaded texture)
-        std::string texturePath;  ///< Asset path for texture loading
+        std::string textureName;  ///< Texture name (the map's background path, loaded by the asset manager)
         float scrollSpeed;        ///< Scroll speed in pixels/second
         float scrollOffset;       ///< Current scroll offset (updates each frame)
         int textureWidth;         ///< Texture width for tiling
@@ -107,12 +72,12 @@ class EntityRenderer {
 
     /**
          * @brief Constructor
-         * @param graphics Reference to the graphics subsystem (RaylibGraphics)
+         * @param graphics Reference to the graphics backend (RaylibGraphics, HeadlessGraphics...)
          *
          * The EntityRenderer does not own the graphics object, it only
          * holds a reference to use its drawing primitives.
          */
-    explicit EntityRenderer(Graphics::RaylibGraphics &graphics);
+    explicit EntityRenderer(Graphics::IGraphics &graphics);
 
     /**
          * @brief Destructor
@@ -126,14 +91,15 @@ class EntityRenderer {
      * @param x World position X
      * @param y World position Y
      * @param health Current health (-1 if not applicable)
-     * @param currentAnimation Current animation clip name (e.g., "idle", "shoot")
+     * @param currentAnimation Current animation clip name (e.g., "idle", "shoot"), only logged:
+     *                         the sprite rectangle already selects the frame
      * @param srcX Sprite source X
      * @param srcY Sprite source Y
      * @param srcW Sprite width
      * @param srcH Sprite height
-     * @param velocityX Entity velocity X (for extrapolation, default=0)
-     * @param velocityY Entity velocity Y (for extrapolation, default=0)
-     * @param serverTick Server tick number (default=0)
+     * @param velocityX Entity velocity X in pixels/second (curve tangent, default=0)
+     * @param velocityY Entity velocity Y in pixels/second (curve tangent, default=0)
+     * @param serverTick Server tick the state was built on (default=0)
      * 
      * If the entity already exists, its state is updated.
      * If it's a new entity, it's added to the cache.
@@ -142,9 +108,24 @@ class EntityRenderer {
      * message is received from the server.
      */
     void updateEntity(uint32_t id, RType::Messages::Shared::EntityType type, float x, float y, int health,
-                      const std::string &currentAnimation, int srcX, int srcY, int srcW, int srcH,
+                      std::string_view currentAnimation, int srcX, int srcY, int srcW, int srcH,
                       float velocityX = 0.0f, float velocityY = 0.0f, uint32_t serverTick = 0);
 
+    /**
+     * @brief Apply a whole GameState straight from its Cap'n Proto reader
+     * @param state Root reader of the snapshot
+     * @param predictedEntityId Entity left untouched (locally predicted player, 0 for none)
+     * @return Reader of the predicted entity if the snapshot contains it, for reconciliation
+     *
+     * Updates every entity of the snapshot, then removes the cached
+     * entities the snapshot no longer contains. Entities are marked with
+     * the snapshot generation instead of collecting IDs in a set, names
+     * are read in place and destroyed entities free a slot that the next
+     * spawn reuses, so a steady-state snapshot performs no heap allocation.
+     */
+    std::optional<::EntityState::Reader> applyGameState(::GameState::Reader state,
+                                                        uint32_t predictedEntityId);
+
     /**
          * @brief Remove an entity from the rendering cache
          * @param id Entity unique identifier to remove
@@ -170,6 +151,9 @@ class EntityRenderer {
      *
      * The main background scrolls at scrollSpeed, while the parallax layer
      * scrolls at scrollSpeed * parallaxSpeedFactor for depth effect.
+     *
+     * Textures are not loaded here: each layer uses the texture named after
+     * its path (Assets::BackgroundRequest()) and is drawn once it is loaded.
      */
     void setBackground(const std::string &mainBackground, const std::string &parallaxBackground,
                        float scrollSpeed, float parallaxSpeedFactor);
@@ -178,6 +162,7 @@ class EntityRenderer {
      * @brief Clear background configuration
      *
      * Called when leaving the game scene to stop background rendering.
+     * The textures stay loaded for the next match.
      */
     void clearBackground();
 
@@ -189,6 +174,15 @@ class EntityRenderer {
      */
     void updateBackground(float deltaTime);
 
+    /**
+     * @brief Set the world scroll offset received in a game state snapshot
+     * @param offset Server camera X in pixels
+     *
+     * Walls live in world coordinates and are drawn at worldX - offset.
+     * The offset is extrapolated with the map scroll speed between snapshots.
+     */
+    void setWorldScrollOffset(float offset);
+
     /**
          * @brief Set the local player's entity ID for visual differentiation
          * @param id The entity ID that represents the local player
@@ -204,9 +198,9 @@ class EntityRenderer {
     /**
          * @brief Render all cached entities
          * 
-         * Iterates through all entities in the cache and renders them
-         * based on their type. Entities are rendered in insertion order
-         * (no Z-ordering implemented yet).
+         * Draws the shape buckets (walls, then enemies), then every sprite in
+         * one batch grouped by texture, then health bars and labels, each in
+         * one pass over a bucket table.
          * 
          * Should be called once per frame from Rendering::Render().
          */
@@ -216,14 +210,14 @@ class EntityRenderer {
          * @brief Get the number of entities currently cached
          * @return Size of the entity cache
          */
-    size_t getEntityCount() const { return _entities.size(); }
+    size_t getEntityCount() const { return _entityCount; }
 
     /**
          * @brief Check if an entity exists in the cache
          * @param id Entity unique identifier
          * @return true if entity exists, false otherwise
          */
-    bool hasEntity(uint32_t id) const { return _entities.count(id) > 0; }
+    bool hasEntity(uint32_t id) const { return findSlot(id) != nullptr; }
 
     /**
          * @brief Toggle debug information overlay
@@ -285,11 +279,17 @@ class EntityRenderer {
          * @brief Update interpolation for all entities
          * @param deltaTime Time elapsed since last frame (in seconds)
          * 
-         * Should be called every frame before render() to advance interpolation.
-         * This provides smooth movement between discrete server updates.
+         * Should be called every frame before render(). Remote entities are
+         * sampled at the clock's render tick; deltaTime only advances the
+         * smoothing of local player corrections.
          */
     void updateInterpolation(float deltaTime);
 
+    /**
+     * @brief Get the server clock mapping (interpolation delay, observed jitter)
+     */
+    [[nodiscard]] const Interpolation::Clock &getInterpolationClock() const { return _clock; }
+
     /**
          * @brief Move an entity locally (client-side prediction)
          * @param entityId Entity to move
@@ -304,6 +304,26 @@ class EntityRenderer {
          */
     void moveEntityLocally(uint32_t entityId, float deltaX, float deltaY);
 
+    /**
+     * @brief Show a shot of the local player before the server spawns it (client-side prediction)
+     * @param shooterId Entity firing (the local player)
+     * @param chargeLevel Charge level at release (ecs::PlayerRules::stepWeapon())
+     * @param timeScale Game speed multiplier (the shot flies on scaled server time)
+     * @param shotCount Projectiles per shot (multishot buffs, replicated with the shooter)
+     *
+     * Every projectile of the shot is spawned by the server's rules from the
+     * shooter's predicted position. Each is merged into its server projectile
+     * when that one is first replicated (see Prediction::ProjectilePredictor).
+     */
+    void firePredictedShot(uint32_t shooterId, float chargeLevel, float timeScale, int shotCount);
+
+    /**
+     * @brief Get the locally predicted shots not yet replicated by the server
+     */
+    [[nodiscard]] const std::vector<Prediction::PredictedShot> &getPredictedShots() const {
+        return _projectilePredictor.getShots();
+    }
+
     /**
      * @brief Set whether the local player is currently moving
      * @param moving true if player is actively moving, false if stopped
@@ -316,38 +336,197 @@ class EntityRenderer {
 
    private:
     /**
-         * @brief Render a player entity
-         * @param entity Entity to render
-         * @param isLocalPlayer true if this is the player's own entity
-         * 
-         * Players are rendered differently based on whether they are
-         * the local player (green/highlighted) or other players (blue).
-         */
-    void renderPlayer(const RenderableEntity &entity, bool isLocalPlayer);
+     * @enum RenderBucket
+     * @brief Group of entity types drawn by the same routine with the same texture, in draw order
+     */
+    enum class RenderBucket : uint8_t {
+        Wall = 0,       ///< Untextured rectangles in world coordinates
+        Enemy,          ///< Untextured rectangles (placeholder until enemy sprites)
+        OrbitalModule,  ///< "OrbitalModule" texture
+        Projectile,     ///< "Projectiles" texture, player and enemy bullets (never interpolated)
+        Player,         ///< "PlayerShips.gif" texture, drawn on top
+        Unknown,        ///< Types without a renderer: tracked but not drawn
+        Count           ///< Number of buckets (also marks an unused slot)
+    };
 
     /**
-         * @brief Render an enemy entity
-         * @param entity Enemy entity to render
-         */
-    void renderEnemy(const RenderableEntity &entity);
+     * @struct SpriteRect
+     * @brief Source rectangle of an entity on its sprite sheet
+     */
+    struct SpriteRect {
+        int x;  ///< Sprite sheet start pixel X
+        int y;  ///< Sprite sheet start pixel Y
+        int w;  ///< Sprite sheet size X (0 = default of the bucket)
+        int h;  ///< Sprite sheet size Y (0 = default of the bucket)
+    };
 
     /**
-         * @brief Render a projectile (player or enemy bullet)
-         * @param entity Projectile entity to render
+     * @struct EntityBucket
+     * @brief Dense structure-of-arrays table holding every entity of one bucket
+     *
+     * All columns share the same index. Removing an entity moves the last
+     * one into its index, so the columns stay packed and keep their
+     * capacity for the next spawns.
+     */
+    struct EntityBucket {
+        std::vector<uint32_t> ids;                                ///< Entity identifier
+        std::vector<RType::Messages::Shared::EntityType> types;  ///< Exact type within the bucket
+        std::vector<float> x;                                     ///< Current rendered position X
+        std::vector<float> y;                                     ///< Current rendered position Y
+        std::vector<float> prevX;                                 ///< Correction start X (local player)
+        std::vector<float> prevY;                                 ///< Correction start Y (local player)
+        std::vector<float> targetX;                               ///< Correction target X (local player)
+        std::vector<float> targetY;                               ///< Correction target Y (local player)
+        std::vector<float> interpolationFactor;                   ///< Correction progress, 0 (prev) to 1
+        std::vector<int> health;                                  ///< Health (-1 for entities without health)
+        std::vector<SpriteRect> sprites;                          ///< Sprite sheet rectangle
+        std::vector<SnapshotRing> snapshots;                      ///< Recent snapshots (interpolation)
+        std::vector<uint32_t> generations;                        ///< Last GameState containing the entity
+
+        size_t size() const { return ids.size(); }
+
+        /**
+         * @brief Append an entity at rest at (x, y)
+         * @return Index of the new entity
          */
-    void renderProjectile(const RenderableEntity &entity);
+        uint32_t push(uint32_t id, RType::Messages::Shared::EntityType type, float posX, float posY,
+                      int hp, const SpriteRect &sprite, uint32_t generation);
 
-    /**
-         * @brief Render a wall/obstacle
-         * @param entity Wall entity to render
+        /**
+         * @brief Remove an entity by moving the last one into its index
          */
-    void renderWall(const RenderableEntity &entity);
+        void swapRemove(uint32_t index);
 
-    /**
-         * @brief Render an orbital module (drone)
-         * @param entity Orbital module entity to render
+        /**
+         * @brief Remove every entity (capacity kept)
+         */
+        void clear();
+
+        /**
+         * @brief Call a function on every column
          */
-    void renderOrbitalModule(const RenderableEntity &entity);
+        template <typename Func>
+        void forEachColumn(Func &&func) {
+            func(ids);
+            func(types);
+            func(x);
+            func(y);
+            func(prevX);
+            func(prevY);
+            func(targetX);
+            func(targetY);
+            func(interpolationFactor);
+            func(health);
+            func(sprites);
+            func(snapshots);
+            func(generations);
+        }
+    };
+
+    /**
+     * @struct EntitySlot
+     * @brief Location of an entity in the bucket tables
+     */
+    struct EntitySlot {
+        RenderBucket bucket = RenderBucket::Count;  ///< Bucket holding the entity (Count = no entity)
+        uint32_t index = 0;                         ///< Index in the bucket columns
+    };
+
+    /// Highest entity ID accepted (the slot table is indexed by ID)
+    static constexpr uint32_t MAX_ENTITY_ID = 1U << 20;
+
+    /**
+     * @brief Get the bucket an entity type is drawn from
+     */
+    static RenderBucket bucketOf(RType::Messages::Shared::EntityType type);
+
+    /**
+     * @brief Find the slot of an entity
+     * @return The slot, or nullptr if the entity is not cached
+     */
+    const EntitySlot *findSlot(uint32_t id) const;
+
+    /**
+     * @brief Add a new entity to the table of its bucket
+     * @return false if the ID is out of range of the slot table
+     */
+    bool insertEntity(uint32_t id, RType::Messages::Shared::EntityType type, float x, float y, int health,
+                      const SpriteRect &sprite);
+
+    /**
+     * @brief Remove the entity stored at a slot and repoint the entity moved in its place
+     */
+    void eraseSlot(EntitySlot slot);
+
+    EntityBucket &bucket(RenderBucket kind) { return _buckets[static_cast<size_t>(kind)]; }
+
+    /**
+     * @brief Get the texture a bucket is drawn with
+     * @return Texture name, or nullptr for buckets drawn with plain shapes
+     */
+    static const char *textureOf(RenderBucket kind);
+
+    /**
+     * @brief Resolve the texture handles not resolved yet
+     *
+     * Handles are looked up by name once, then kept: the sprite batch
+     * never names a texture.
+     */
+    void resolveTextures();
+
+    /**
+     * @brief Mark a background layer loaded (and read its size) once its texture is available
+     */
+    void refreshBackgroundTexture(BackgroundConfig &layer);
+
+    /**
+     * @brief Sprite batch layer of a bucket (its back-to-front rank)
+     */
+    static constexpr uint8_t layerOf(RenderBucket kind) { return static_cast<uint8_t>(kind); }
+
+    /**
+     * @brief Grow the sprite batch by a number of sprites
+     * @return First of the new sprites, to be filled by the caller
+     */
+    Graphics::SpriteDraw *appendSprites(size_t count);
+
+    /**
+     * @brief Append the sprite of every player to the sprite batch
+     *
+     * Players are rendered differently based on whether they are
+     * the local player (green/highlighted) or other players (blue).
+     */
+    void batchPlayers(const EntityBucket &players);
+
+    /**
+     * @brief Render player health bars and the local player label
+     */
+    void renderPlayerOverlays(const EntityBucket &players);
+
+    /**
+     * @brief Render every enemy
+     */
+    void renderEnemies(const EntityBucket &enemies);
+
+    /**
+     * @brief Append the sprite of every projectile (player or enemy bullet) to the sprite batch
+     */
+    void batchProjectiles(const EntityBucket &projectiles);
+
+    /**
+     * @brief Render every wall/obstacle
+     */
+    void renderWalls(const EntityBucket &walls);
+
+    /**
+     * @brief Append the sprite of every orbital module (drone) to the sprite batch
+     */
+    void batchOrbitalModules(const EntityBucket &modules);
+
+    /**
+     * @brief Render orbital module health bars
+     */
+    void renderOrbitalModuleOverlays(const EntityBucket &modules);
 
     /**
          * @brief Render a health bar above an entity
@@ -363,12 +542,13 @@ class EntityRenderer {
 
     /**
          * @brief Render debug information for an entity
-         * @param entity Entity to display debug info for
+         * @param entities Bucket holding the entity
+         * @param index Index of the entity in the bucket
          *
          * Shows entity ID and health as text overlay.
          * Only rendered when _showDebugInfo is true.
          */
-    void renderDebugInfo(const RenderableEntity &entity);
+    void renderDebugInfo(const EntityBucket &entities, size_t index);
 
     /**
      * @brief Render scrolling background layers
@@ -397,19 +577,50 @@ class EntityRenderer {
     [[nodiscard]] float clamp(float value, float min, float max) const;
 
     /**
-     * @brief Get current time in milliseconds
-     * @return Current monotonic timestamp
+     * @brief Get current time in seconds
+     * @return Monotonic timestamp (clock of the Interpolation::Clock)
      */
-    [[nodiscard]] uint64_t getCurrentTimeMs() const;
+    [[nodiscard]] static double getCurrentTimeSeconds();
+
+    /// Entity tables, one per render bucket
+    std::array<EntityBucket, static_cast<size_t>(RenderBucket::Count)> _buckets;
+
+    /// Location of each entity, indexed by entity ID (grown on demand, never shrunk)
+    std::vector<EntitySlot> _slots;
+
+    /// Number of cached entities, all buckets together
+    size_t _entityCount = 0;
+
+    /// Scale applied to every sprite
+    static constexpr float SPRITE_SCALE = 3.0f;
+
+    /// Texture handle of each bucket (INVALID_TEXTURE until the texture is loaded)
+    std::array<Graphics::TextureHandle, static_cast<size_t>(RenderBucket::Count)> _textureHandles;
 
-    /// Entity cache: maps entity ID to its renderable state
-    std::unordered_map<uint32_t, RenderableEntity> _entities;
+    /// Textured buckets back to front (increasing layer), so the sprite batch is built already sorted
+    static constexpr std::array<RenderBucket, 3> SPRITE_BUCKETS{
+        RenderBucket::OrbitalModule, RenderBucket::Projectile, RenderBucket::Player};
+
+    /// Sprites of the frame, submitted in one DrawSpriteBatch() call (capacity kept between frames)
+    std::vector<Graphics::SpriteDraw> _spriteBatch;
+
+    /// Server tick to local time mapping and adaptive interpolation delay
+    Interpolation::Clock _clock;
+
+    /// Local player shots awaiting their server projectile, and merge corrections
+    Prediction::ProjectilePredictor _projectilePredictor;
+
+    /// Longest extrapolation past the newest snapshot when one is late (6 ticks = 100 ms)
+    static constexpr double MAX_EXTRAPOLATION_TICKS = 6.0;
+
+    /// Generation of the GameState being applied (stamped on every entity it contains)
+    uint32_t _snapshotGeneration = 0;
 
     /// Local player's entity ID (for visual differentiation)
     uint32_t _myEntityId = 0;
 
     /// Reference to graphics subsystem for drawing operations
-    Graphics::RaylibGraphics &_graphics;
+    Graphics::IGraphics &_graphics;
 
     /// Debug mode: show entity IDs and health bars (toggle with F3)
     bool _showDebugInfo = true;
@@ -417,7 +628,7 @@ class EntityRenderer {
     /// Interpolation enabled flag
     bool _interpolationEnabled = true;
 
-    /// Interpolation speed multiplier (higher = faster convergence)
+    /// Local player correction speed multiplier (higher = faster convergence)
     /// Set to 10.0 for smooth corrections over ~100ms (6 frames at 60 FPS)
     /// This allows client prediction to feel responsive while still correcting server authority
     float _interpolationSpeed = 10.0f;
@@ -444,4 +655,10 @@ class EntityRenderer {
 
     /// Whether backgrounds are configured and active
     bool _backgroundActive = false;
+
+    /// World scroll offset (camera X) used to place walls, extrapolated between snapshots
+    float _worldScrollOffset = 0.0f;
+
+    /// Map scroll speed used to extrapolate _worldScrollOffset (pixels/second)
+    float _worldScrollSpeed = 0.0f;
 };
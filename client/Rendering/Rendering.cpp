@@ -6,7 +6,13 @@
 */
 
 #include "Rendering.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
 #include <thread>
+#include "Assets/AssetManifest.hpp"
 #include "Events/UIEvent.hpp"
 #include "Input/KeyBindings.hpp"
 #include "Settings/AccessibilitySettings.hpp"
@@ -737,6 +743,18 @@ bool Rendering::GetShowFps() const {
     return _showFps;
 }
 
+void Rendering::SetFrameProfiler(Profiling::FrameProfiler *profiler) {
+    _profiler = profiler;
+}
+
+void Rendering::SetShowProfiler(bool enabled) {
+    _showProfiler = enabled;
+}
+
+bool Rendering::GetShowProfiler() const {
+    return _showProfiler;
+}
+
 void Rendering::SetPlayerName(const std::string &name) {
     if (_mainMenu) {
         _mainMenu->SetProfileName(name);
@@ -812,26 +830,40 @@ void Rendering::Render() {
 
     UpdateFpsCounter();
 
+    // Upload the textures decoded since the last frame (bounded, so a burst does not hitch)
+    _assets.Update(ASSET_UPLOAD_BUDGET);
+
     if (_quitRequested) {
         _initialized = false;
         return;
     }
 
-    HandleEscapeKeyInput();
-    UpdateUI();
+    HandleProfilerKeys();
+    {
+        Profiling::ScopedTimer timer(_profiler, Profiling::Stage::UIUpdate);
+        HandleEscapeKeyInput();
+        UpdateUI();
+    }
 
-    _graphics.StartDrawing();
-    _graphics.ClearWindow();
+    {
+        // Up to the buffer swap: DisplayWindow() also waits for vsync / the FPS cap
+        Profiling::ScopedTimer timer(_profiler, Profiling::Stage::DrawSubmission);
+        _graphics.StartDrawing();
+        _graphics.ClearWindow();
 
-    // Begin colorblind capture if filter is active
-    _graphics.BeginColorblindCapture();
+        // Begin colorblind capture if filter is active
+        _graphics.BeginColorblindCapture();
 
-    RenderGameScene();
-    RenderUI();
-    RenderHUD();
+        RenderGameScene();
+        RenderUI();
+        RenderHUD();
 
-    // End colorblind capture and apply filter
-    _graphics.EndColorblindCapture();
+        // End colorblind capture and apply filter
+        _graphics.EndColorblindCapture();
+
+        // Debug overlay, not filtered
+        RenderProfilerOverlay();
+    }
 
     _graphics.DisplayWindow();
 
@@ -882,6 +914,33 @@ void Rendering::HandleEscapeKeyInput() {
     }
 }
 
+void Rendering::HandleProfilerKeys() {
+    if (_profiler == nullptr) {
+        return;
+    }
+    auto &bindings = Input::KeyBindings::getInstance();
+    auto pressed = [this, &bindings](Input::GameAction action) {
+        const int key = bindings.GetPrimaryKey(action);
+        const int keyAlt = bindings.GetSecondaryKey(action);
+        return (key != KEY_NULL && _graphics.IsKeyPressed(key)) ||
+               (keyAlt != KEY_NULL && _graphics.IsKeyPressed(keyAlt));
+    };
+
+    if (pressed(Input::GameAction::TOGGLE_PROFILER)) {
+        _showProfiler = !_showProfiler;
+    }
+    if (pressed(Input::GameAction::DUMP_PROFILE)) {
+        const auto now = std::chrono::system_clock::now().time_since_epoch();
+        const auto stamp = std::chrono::duration_cast<std::chrono::seconds>(now).count();
+        const std::string basePath = std::string(PROFILE_DUMP_DIRECTORY) + "/frames_" + std::to_string(stamp);
+        if (_profiler->dump(basePath)) {
+            LOG_INFO("[Rendering] Frame profile written to ", basePath, ".csv and ", basePath, ".trace.json");
+        } else {
+            LOG_ERROR("[Rendering] Failed to write frame profile ", basePath);
+        }
+    }
+}
+
 void Rendering::UpdateUI() {
     // Update chat visibility based on scene
     UpdateChatVisibility();
@@ -1143,6 +1202,79 @@ void Rendering::RenderHUD() {
     }
 }
 
+void Rendering::RenderProfilerOverlay() {
+    if (!_showProfiler || _profiler == nullptr) {
+        return;
+    }
+
+    // Stage colors (0xAARRGGBB), then the time outside every stage
+    static constexpr std::array<unsigned int, Profiling::STAGE_COUNT> stageColors = {
+        0xFF42A5F5, 0xFFAB47BC, 0xFF26A69A, 0xFFFFCA28, 0xFFEF5350, 0xFF66BB6A};
+    static constexpr unsigned int otherColor = 0xFF616161;
+
+    const int fontSize = 14;
+    const int margin = 10;
+    const int pad = 6;
+    const int graphWidth = static_cast<int>(Profiling::FrameProfiler::HISTORY);
+    const int legendWidth = 240;
+    const int rows = static_cast<int>(Profiling::STAGE_COUNT) + 2;  // Frame, stages, other
+    const int panelHeight = std::max(PROFILER_GRAPH_HEIGHT, rows * (fontSize + 2)) + pad * 2;
+    const int panelX = margin;
+    const int panelY = _graphics.GetWindowHeight() - margin - panelHeight;
+    _graphics.DrawRectFilled(panelX, panelY, graphWidth + legendWidth + pad * 3, panelHeight, 0xB0000000);
+
+    // One column per frame, newest on the right, stages stacked from the bottom
+    const int graphX = panelX + pad;
+    const int graphBottom = panelY + pad + PROFILER_GRAPH_HEIGHT;
+    auto toPixels = [](double seconds) {
+        return static_cast<int>(seconds / PROFILER_GRAPH_RANGE * PROFILER_GRAPH_HEIGHT + 0.5);
+    };
+    const size_t frames = _profiler->getFrameCount();
+    for (size_t age = 0; age < frames; ++age) {
+        const Profiling::FrameSample &frame = _profiler->getFrame(age);
+        const int x = graphX + graphWidth - 1 - static_cast<int>(age);
+        int stacked = 0;
+        auto drawSegment = [&](double seconds, unsigned int color) {
+            const int height = std::min(toPixels(seconds), PROFILER_GRAPH_HEIGHT - stacked);
+            if (height > 0) {
+                stacked += height;
+                _graphics.DrawRectFilled(x, graphBottom - stacked, 1, height, color);
+            }
+        };
+        for (size_t stage = 0; stage < Profiling::STAGE_COUNT; ++stage) {
+            drawSegment(frame.stageSeconds[stage], stageColors[stage]);
+        }
+        drawSegment(frame.other(), otherColor);
+    }
+
+    // 60 FPS budget line (the top of the graph is 30 FPS)
+    _graphics.DrawRectFilled(graphX, graphBottom - toPixels(1.0 / 60.0), graphWidth, 1, 0xC0FFFFFF);
+
+    // Legend: average / worst over the history, in milliseconds
+    const Profiling::ProfileSummary summary = _profiler->summarize();
+    const int legendX = graphX + graphWidth + pad;
+    int y = panelY + pad;
+    char text[64];
+    std::snprintf(text, sizeof(text), "Frame %6.2f / %6.2f ms", summary.averageFrame * 1000.0,
+                  summary.maxFrame * 1000.0);
+    _graphics.DrawText(-1, text, legendX, y, fontSize, 0xFFFFFFFF);
+    y += fontSize + 2;
+
+    double averageOther = summary.averageFrame;
+    for (size_t stage = 0; stage < Profiling::STAGE_COUNT; ++stage) {
+        averageOther -= summary.averageStage[stage];
+        _graphics.DrawRectFilled(legendX, y + 3, 8, 8, stageColors[stage]);
+        const char *name = Profiling::stageName(static_cast<Profiling::Stage>(stage));
+        std::snprintf(text, sizeof(text), "%-15s %5.2f / %5.2f", name, summary.averageStage[stage] * 1000.0,
+                      summary.maxStage[stage] * 1000.0);
+        _graphics.DrawText(-1, text, legendX + 12, y, fontSize, 0xFFFFFFFF);
+        y += fontSize + 2;
+    }
+    _graphics.DrawRectFilled(legendX, y + 3, 8, 8, otherColor);
+    std::snprintf(text, sizeof(text), "%-15s %5.2f", "Other", std::max(0.0, averageOther) * 1000.0);
+    _graphics.DrawText(-1, text, legendX + 12, y, fontSize, 0xFFFFFFFF);
+}
+
 bool Rendering::IsWindowOpen() const {
     if (!_initialized) {
         return false;
@@ -1155,6 +1287,10 @@ bool Rendering::LoadTexture(const std::string &textureName, const std::string &p
     return result != -1;
 }
 
+void Rendering::PreloadAssets(std::span<const Assets::AssetRequest> manifest) {
+    _assets.Preload(manifest);
+}
+
 void Rendering::DrawSprite(const std::string &textureId, float xPosition, float yPosition, float rotation,
                            float scale) {
     _graphics.DrawTextureEx(textureId.c_str(), 0, 0, 0, 0, xPosition, yPosition, rotation, scale, 0xFFFFFFFF);
@@ -1185,13 +1321,21 @@ bool Rendering::WindowShouldClose() const {
 // ═══════════════════════════════════════════════════════════
 
 void Rendering::UpdateEntity(uint32_t id, RType::Messages::Shared::EntityType type, float x, float y,
-                             int health, const std::string &currentAnimation, int srcX, int srcY, int srcW,
+                             int health, std::string_view currentAnimation, int srcX, int srcY, int srcW,
                              int srcH) {
     if (_entityRenderer) {
         _entityRenderer->updateEntity(id, type, x, y, health, currentAnimation, srcX, srcY, srcW, srcH);
     }
 }
 
+std::optional<::EntityState::Reader> Rendering::ApplyGameState(::GameState::Reader state,
+                                                               uint32_t predictedEntityId) {
+    if (!_entityRenderer) {
+        return std::nullopt;
+    }
+    return _entityRenderer->applyGameState(state, predictedEntityId);
+}
+
 void Rendering::RemoveEntity(uint32_t id) {
     if (_entityRenderer) {
         _entityRenderer->removeEntity(id);
@@ -1212,6 +1356,12 @@ void Rendering::ClearAllEntities() {
 
 void Rendering::SetBackground(const std::string &mainBackground, const std::string &parallaxBackground,
                               float scrollSpeed, float parallaxSpeedFactor) {
+    // No-op for backgrounds preloaded from the map manifest
+    for (const std::string &background : {mainBackground, parallaxBackground}) {
+        if (!background.empty()) {
+            _assets.Request(Assets::BackgroundRequest(background));
+        }
+    }
     if (_entityRenderer) {
         _entityRenderer->setBackground(mainBackground, parallaxBackground, scrollSpeed, parallaxSpeedFactor);
     }
@@ -1229,6 +1379,12 @@ void Rendering::UpdateBackground(float deltaTime) {
     }
 }
 
+void Rendering::SetWorldScrollOffset(float offset) {
+    if (_entityRenderer) {
+        _entityRenderer->setWorldScrollOffset(offset);
+    }
+}
+
 bool Rendering::IsKeyDown(int key) const {
     return _graphics.IsKeyDown(key);
 }
@@ -1263,6 +1419,13 @@ void Rendering::MoveEntityLocally(uint32_t entityId, float deltaX, float deltaY)
     }
 }
 
+void Rendering::FirePredictedShot(uint32_t shooterId, float chargeLevel, float timeScale,
+                                  int shotCount) {
+    if (_entityRenderer) {
+        _entityRenderer->firePredictedShot(shooterId, chargeLevel, timeScale, shotCount);
+    }
+}
+
 void Rendering::SetClientSidePredictionEnabled(bool enabled) {
     if (_entityRenderer) {
         _entityRenderer->setClientSidePredictionEnabled(enabled);
@@ -1282,6 +1445,13 @@ float Rendering::GetReconciliationThreshold() const {
     return 5.0f;  // Default value
 }
 
+uint32_t Rendering::GetInterpolationDelayMs() const {
+    if (_entityRenderer) {
+        return static_cast<uint32_t>(std::lround(_entityRenderer->getInterpolationClock().getDelay() * 1000.0));
+    }
+    return 0;
+}
+
 void Rendering::SetLocalPlayerMoving(bool moving) {
     if (_entityRenderer) {
         _entityRenderer->setLocalPlayerMoving(moving);
@@ -10,11 +10,16 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include "../common/Logger/Logger.hpp"
+#include "Assets/AssetManager.hpp"
 #include "Capnp/Messages/Shared/SharedTypes.hpp"
 #include "Core/EventBus/EventBus.hpp"
+#include "Core/Profiler/FrameProfiler.hpp"
 #include "EntityRenderer.hpp"
 #include "Events/UIEvent.hpp"
 #include "Graphics/RaylibGraphics/RaylibGraphics.hpp"
@@ -158,6 +163,17 @@ class Rendering {
      */
     bool LoadTexture(const std::string &textureName, const std::string &path);
 
+    /**
+     * @brief Queue textures for asynchronous loading
+     *
+     * Images are decoded on the asset manager's thread and uploaded by
+     * Render(), a few milliseconds per frame. Sprite textures are drawn
+     * as placeholders until then.
+     *
+     * @param manifest Textures to load (see Assets::SpriteManifest(), Assets::MapManifest())
+     */
+    void PreloadAssets(std::span<const Assets::AssetRequest> manifest);
+
     /**
      * @brief Draw a sprite on screen
      * 
@@ -228,7 +244,20 @@ class Rendering {
      * Delegates to EntityRenderer. Call when receiving GameState updates.
      */
     void UpdateEntity(uint32_t id, RType::Messages::Shared::EntityType type, float x, float y, int health,
-                      const std::string &currentAnimation, int srcX, int srcY, int srcW, int srcH);
+                      std::string_view currentAnimation, int srcX, int srcY, int srcW, int srcH);
+
+    /**
+     * @brief Apply a GameState snapshot read in place
+     * @param state Root reader of the snapshot
+     * @param predictedEntityId Locally predicted entity to leave to the caller (0 for none)
+     * @return Reader of the predicted entity if the snapshot contains it
+     * 
+     * Delegates to EntityRenderer::applyGameState(): updates every entity,
+     * removes the ones missing from the snapshot, without heap allocation
+     * in steady state.
+     */
+    std::optional<::EntityState::Reader> ApplyGameState(::GameState::Reader state,
+                                                        uint32_t predictedEntityId);
 
     /**
      * @brief Remove an entity from rendering
@@ -260,7 +289,8 @@ class Rendering {
      * @param scrollSpeed Base scroll speed in pixels/second
      * @param parallaxSpeedFactor Speed factor for parallax layer (0.5 = half speed)
      *
-     * Called when starting a game with map configuration.
+     * Called when starting a game with map configuration. Backgrounds not
+     * preloaded are requested from the asset manager and appear once loaded.
      */
     void SetBackground(const std::string &mainBackground, const std::string &parallaxBackground,
                        float scrollSpeed, float parallaxSpeedFactor);
@@ -280,6 +310,12 @@ class Rendering {
      */
     void UpdateBackground(float deltaTime);
 
+    /**
+     * @brief Set the world scroll offset from the latest game state
+     * @param offset Server camera X in pixels (walls are drawn at worldX - offset)
+     */
+    void SetWorldScrollOffset(float offset);
+
     /**
      * @brief Display the game over screen
      * @param reason Reason for game over (e.g., "Defeat", "Victory")
@@ -345,6 +381,17 @@ class Rendering {
      */
     void MoveEntityLocally(uint32_t entityId, float deltaX, float deltaY);
 
+    /**
+     * @brief Show a shot of the local player before the server confirms it
+     * @param shooterId Entity firing (the local player)
+     * @param chargeLevel Charge level at release
+     * @param timeScale Game speed multiplier
+     * @param shotCount Projectiles per shot (multishot buffs, as replicated by the server)
+     *
+     * Delegates to EntityRenderer.
+     */
+    void FirePredictedShot(uint32_t shooterId, float chargeLevel, float timeScale, int shotCount);
+
     /**
      * @brief Update room list from server data
      * @param rooms Vector of room information
@@ -417,6 +464,14 @@ class Rendering {
      */
     float GetReconciliationThreshold() const;
 
+    /**
+     * @brief Get the adaptive interpolation delay remote entities are rendered with
+     * @return Delay in milliseconds, 0 before the renderer exists
+     *
+     * Sent to the server with the inputs so lag compensation rewinds to what the player saw.
+     */
+    uint32_t GetInterpolationDelayMs() const;
+
     /**
      * @brief Set whether the local player is currently moving
      * @param moving true if player is actively moving, false if stopped
@@ -459,6 +514,22 @@ class Rendering {
      */
     [[nodiscard]] bool GetShowFps() const;
 
+    /**
+     * @brief Frame profiler fed by the game loop (times UI update and draw submission).
+     * @param profiler Non-owning; nullptr disables the timers and the overlay
+     */
+    void SetFrameProfiler(Profiling::FrameProfiler *profiler);
+
+    /**
+     * @brief Enable/disable the frame-time overlay (TOGGLE_PROFILER key).
+     */
+    void SetShowProfiler(bool enabled);
+
+    /**
+     * @brief Get frame-time overlay display state.
+     */
+    [[nodiscard]] bool GetShowProfiler() const;
+
     /**
      * @brief Update the displayed player name (e.g., after authentication)
      * @param name The player's username
@@ -478,6 +549,10 @@ class Rendering {
     uint32_t _height = 0;
     Graphics::RaylibGraphics _graphics;
 
+    // ===== Textures (decoded off the main thread, uploaded within ASSET_UPLOAD_BUDGET per frame) =====
+    Assets::AssetManager _assets{_graphics};
+    static constexpr double ASSET_UPLOAD_BUDGET = 0.002;  // seconds
+
     // ===== Audio =====
     std::unique_ptr<Audio::SoundEffectManager> _soundEffectManager;
 
@@ -526,6 +601,13 @@ class Rendering {
 
     bool _showPing = true;
     bool _showFps = true;
+    bool _showProfiler = false;
+
+    // Frame-time profiler (owned by GameLoop), drawn as a stacked graph of the last frames
+    Profiling::FrameProfiler *_profiler = nullptr;
+    static constexpr int PROFILER_GRAPH_HEIGHT = 100;           // pixels
+    static constexpr double PROFILER_GRAPH_RANGE = 1.0 / 30.0;  // seconds at the top of the graph
+    static constexpr const char *PROFILE_DUMP_DIRECTORY = "profiles";
 
     // ===== HUD stats =====
     uint32_t _fps = 0;
@@ -578,6 +660,11 @@ class Rendering {
      */
     void HandleEscapeKeyInput();
 
+    /**
+     * @brief Handle the profiler keys (toggle the overlay, dump the recorded frames).
+     */
+    void HandleProfilerKeys();
+
     /**
      * @brief Update all UI elements based on current scene.
      */
@@ -597,5 +684,10 @@ class Rendering {
      * @brief Render HUD elements (ping, FPS).
      */
     void RenderHUD();
+
+    /**
+     * @brief Render the frame-time graph and per-stage averages (bottom-left).
+     */
+    void RenderProfilerOverlay();
 };
 #endif
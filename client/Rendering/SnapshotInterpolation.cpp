@@ -0,0 +1,106 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SnapshotInterpolation.cpp
+*/
+
+#include "SnapshotInterpolation.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Interpolation {
+    namespace {
+        /**
+         * @brief Tangent of the curve at a snapshot, in pixels per second
+         *
+         * Entities moved without a Velocity component replicate a zero
+         * velocity: the slope between the two snapshots is used instead.
+         */
+        float tangent(float velocity, float otherVelocity, float chordSlope) {
+            return (velocity == 0.0f && otherVelocity == 0.0f) ? chordSlope : velocity;
+        }
+    }  // namespace
+
+    void Clock::onSnapshot(uint32_t serverTick, double arrivalSeconds) {
+        const double offsetSample = arrivalSeconds - static_cast<double>(serverTick) * _config.tickSeconds;
+
+        if (!_lastTick || serverTick < *_lastTick) {
+            // New timeline: anchor the offset, keep the jitter learnt so far
+            if (_sendInterval == 0.0) {
+                _sendInterval = _config.tickSeconds;
+            }
+            _offset = offsetSample;
+            _lastTick = serverTick;
+            return;
+        }
+        if (serverTick == *_lastTick) {
+            return;
+        }
+
+        const double interval = static_cast<double>(serverTick - *_lastTick) * _config.tickSeconds;
+        _sendInterval += (interval - _sendInterval) / 8.0;
+
+        const double error = offsetSample - _offset;
+        _offset += error / 8.0;
+        _deviation += (std::abs(error) - _deviation) / 4.0;
+        _lastTick = serverTick;
+
+        const double target = std::clamp(_sendInterval + _config.jitterMultiplier * _deviation, _config.minDelay,
+                                         _config.maxDelay);
+        _delay += (target - _delay) / 16.0;
+    }
+
+    double Clock::renderTick(double nowSeconds) const {
+        return (nowSeconds - _offset - _delay) / _config.tickSeconds;
+    }
+
+    Position sample(const SnapshotRing &ring, double renderTick, double tickSeconds,
+                    double maxExtrapolationTicks) {
+        const Snapshot &newest = ring.back();
+        if (renderTick >= static_cast<double>(newest.serverTick)) {
+            const double ahead =
+                std::min(renderTick - static_cast<double>(newest.serverTick), maxExtrapolationTicks) * tickSeconds;
+            return {newest.x + static_cast<float>(newest.velocityX * ahead),
+                    newest.y + static_cast<float>(newest.velocityY * ahead)};
+        }
+
+        const Snapshot &oldest = ring[0];
+        if (renderTick <= static_cast<double>(oldest.serverTick)) {
+            return {oldest.x, oldest.y};
+        }
+
+        // Newest pair around the rendered tick (ticks increase along the ring)
+        size_t next = ring.size() - 1;
+        while (next > 1 && static_cast<double>(ring[next - 1].serverTick) > renderTick) {
+            next--;
+        }
+        const Snapshot &from = ring[next - 1];
+        const Snapshot &to = ring[next];
+        if (to.serverTick <= from.serverTick) {
+            return {to.x, to.y};  // Timeline restarted inside the history
+        }
+
+        const auto ticks = static_cast<double>(to.serverTick - from.serverTick);
+        const auto s = static_cast<float>((renderTick - static_cast<double>(from.serverTick)) / ticks);
+        const auto span = static_cast<float>(ticks * tickSeconds);
+
+        // Cubic Hermite basis
+        const float s2 = s * s;
+        const float s3 = s2 * s;
+        const float h00 = 2.0f * s3 - 3.0f * s2 + 1.0f;
+        const float h10 = s3 - 2.0f * s2 + s;
+        const float h01 = -2.0f * s3 + 3.0f * s2;
+        const float h11 = s3 - s2;
+
+        const float slopeX = (to.x - from.x) / span;
+        const float slopeY = (to.y - from.y) / span;
+        const float fromTangentX = tangent(from.velocityX, from.velocityY, slopeX);
+        const float fromTangentY = tangent(from.velocityY, from.velocityX, slopeY);
+        const float toTangentX = tangent(to.velocityX, to.velocityY, slopeX);
+        const float toTangentY = tangent(to.velocityY, to.velocityX, slopeY);
+
+        return {h00 * from.x + h10 * span * fromTangentX + h01 * to.x + h11 * span * toTangentX,
+                h00 * from.y + h10 * span * fromTangentY + h01 * to.y + h11 * span * toTangentY};
+    }
+}  // namespace Interpolation
@@ -0,0 +1,181 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SnapshotInterpolation.hpp - Tick-stamped snapshot history, server clock mapping and Hermite sampling
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+/**
+ * @namespace Interpolation
+ * @brief Entity interpolation engine of the client, independent of rendering
+ *
+ * Snapshots are placed on the server timeline by the tick they were built
+ * on, not by their arrival time. The Clock maps that timeline to the
+ * local clock and renders a little in the past (the interpolation delay),
+ * so that the two snapshots around the rendered instant have already
+ * arrived. sample() then draws the cubic Hermite curve between them, with
+ * the replicated velocities as tangents.
+ *
+ * Everything takes explicit times, so jitter traces can be replayed in
+ * unit tests.
+ */
+namespace Interpolation {
+    /**
+     * @struct Snapshot
+     * @brief State of an entity at one server tick
+     */
+    struct Snapshot {
+        float x;              ///< Position X
+        float y;              ///< Position Y
+        float velocityX;      ///< Velocity X (pixels/second, tangent of the curve)
+        float velocityY;      ///< Velocity Y (pixels/second, tangent of the curve)
+        uint32_t serverTick;  ///< Server tick the state was built on
+    };
+
+    /**
+     * @struct SnapshotRing
+     * @brief Fixed-capacity ring of the most recent snapshots (oldest dropped first)
+     *
+     * Stored inline in the entity tables: pushing never allocates. Four
+     * snapshots cover the longest interpolation delay at the lowest send
+     * rate the Clock expects.
+     */
+    struct SnapshotRing {
+        static constexpr size_t CAPACITY = 4;  ///< Snapshots kept per entity
+
+        /**
+         * @brief Append a snapshot, overwriting the oldest one when full
+         */
+        void push(const Snapshot &snapshot) {
+            _items[(_first + _count) % CAPACITY] = snapshot;
+            if (_count < CAPACITY) {
+                _count++;
+            } else {
+                _first = (_first + 1) % CAPACITY;
+            }
+        }
+
+        /**
+         * @brief Get a snapshot by age (0 = oldest)
+         */
+        const Snapshot &operator[](size_t index) const { return _items[(_first + index) % CAPACITY]; }
+
+        /**
+         * @brief Get the newest snapshot (ring must not be empty)
+         */
+        const Snapshot &back() const { return (*this)[_count - 1]; }
+
+        size_t size() const { return _count; }
+        bool empty() const { return _count == 0; }
+        void clear() { _first = _count = 0; }
+
+       private:
+        std::array<Snapshot, CAPACITY> _items{};  ///< Storage
+        size_t _first = 0;                        ///< Index of the oldest snapshot
+        size_t _count = 0;                        ///< Snapshots stored
+    };
+
+    /**
+     * @struct Position
+     * @brief Sampled position of an entity
+     */
+    struct Position {
+        float x;
+        float y;
+    };
+
+    /**
+     * @class Clock
+     * @brief Maps server ticks to the local clock and adapts the interpolation delay to jitter
+     *
+     * Every GameState gives one sample of the clock offset:
+     * arrival - tick * tickSeconds (network delay plus clock difference).
+     * Its mean and mean deviation are smoothed like TCP's RTT estimator
+     * (gains 1/8 and 1/4). The interpolation delay targets
+     * sendInterval + jitterMultiplier * deviation: one send interval so the
+     * next snapshot is always due, plus a margin covering late arrivals.
+     * The delay itself moves toward its target slowly (gain 1/16) so the
+     * rendered timeline never visibly jumps.
+     */
+    class Clock {
+       public:
+        /**
+         * @struct Config
+         * @brief Tuning of the clock
+         */
+        struct Config {
+            double tickSeconds = 1.0 / 60.0;  ///< Server fixed timestep
+            double minDelay = 0.05;           ///< Delay floor (seconds)
+            double maxDelay = 0.25;           ///< Delay ceiling, within the SnapshotRing history
+            double jitterMultiplier = 4.0;    ///< Deviations of lateness covered by the delay
+        };
+
+        Clock() : Clock(Config{}) {}
+        explicit Clock(const Config &config) : _config(config), _delay(config.minDelay) {}
+
+        /**
+         * @brief Record the arrival of a GameState
+         *
+         * @param serverTick Tick stamped on the snapshot
+         * @param arrivalSeconds Local time of arrival
+         *
+         * @note A repeated tick is ignored; an older one starts a new timeline (room restart)
+         */
+        void onSnapshot(uint32_t serverTick, double arrivalSeconds);
+
+        /**
+         * @brief Server time to display at a local time, in ticks
+         *
+         * @param nowSeconds Local time (same clock as onSnapshot())
+         * @return Fractional server tick, interpolation delay included
+         */
+        [[nodiscard]] double renderTick(double nowSeconds) const;
+
+        /**
+         * @brief Whether at least one snapshot has been recorded on the current timeline
+         */
+        [[nodiscard]] bool isSynchronized() const { return _lastTick.has_value(); }
+
+        [[nodiscard]] double getDelay() const { return _delay; }                ///< Current delay (s)
+        [[nodiscard]] double getJitter() const { return _deviation; }           ///< Mean deviation (s)
+        [[nodiscard]] double getSendInterval() const { return _sendInterval; }  ///< Between snapshots (s)
+        [[nodiscard]] const Config &getConfig() const { return _config; }
+
+        /**
+         * @brief Forget the timeline (new game); the delay is kept as a starting point
+         */
+        void reset() { _lastTick.reset(); }
+
+       private:
+        Config _config;
+        std::optional<uint32_t> _lastTick;  ///< Newest tick recorded on this timeline
+        double _offset = 0.0;               ///< Smoothed arrival - send time (s)
+        double _deviation = 0.0;            ///< Smoothed |offset sample - offset| (s)
+        double _sendInterval = 0.0;         ///< Smoothed time between two snapshots (s)
+        double _delay;                      ///< Interpolation delay in use (s)
+    };
+
+    /**
+     * @brief Position of an entity at a server time
+     *
+     * Between two snapshots: cubic Hermite curve, tangents from the
+     * replicated velocities (from the positions when an entity replicates
+     * no velocity). Before the oldest snapshot: the oldest position. After
+     * the newest: extrapolated along its velocity, for at most
+     * maxExtrapolationTicks.
+     *
+     * @param ring Snapshot history (must not be empty)
+     * @param renderTick Fractional server tick to sample
+     * @param tickSeconds Duration of one server tick
+     * @param maxExtrapolationTicks Limit of the extrapolation past the newest snapshot
+     */
+    Position sample(const SnapshotRing &ring, double renderTick, double tickSeconds,
+                    double maxExtrapolationTicks);
+}  // namespace Interpolation
@@ -8,6 +8,7 @@
 #include <iostream>
 #include <string>
 #include "Client/Client.hpp"
+#include "../common/Logger/Logger.hpp"
 
 // Parse command line arguments
 void parseCommandLine(int argc, char **argv, std::string &host, uint16_t &port) {
@@ -37,11 +38,15 @@ int main(int argc, char **argv) {
 
     std::string playerName = "Player";  // Default name, will be updated by login
 
+    // Logging is formatted and written by a background thread
+    logger::Logger::startAsync();
+
     // Create and initialize Client
     // The client handles the login phase internally before connecting
     Client client(playerName, host, port);
 
     if (!client.initialize()) {
+        logger::Logger::stopAsync();
         std::cerr << "Failed to initialize client" << std::endl;
         return 1;
     }
@@ -49,5 +54,6 @@ int main(int argc, char **argv) {
     // Run client - this will show login, connect, and start game
     client.run();
 
+    logger::Logger::stopAsync();
     return 0;
 }
@@ -12,6 +12,13 @@
 #include <unordered_map>
 #include "../ECS/Components/AnimationSet.hpp"
 
+/**
+ * @brief Animation assets of every entity kind.
+ *
+ * Each factory builds its ecs::AnimationSetData once (function-local static)
+ * and returns a lightweight ecs::AnimationSet handle to it, so all entities of
+ * a kind share the same immutable clips.
+ */
 namespace AnimDB {
     /**
      * @brief Helper to create animation clips easily.
@@ -33,19 +40,24 @@ namespace AnimDB {
      * @return ecs::AnimationSet Complete animation set for player
      */
     inline ecs::AnimationSet createPlayerAnimations() {
-        ecs::AnimationSet animSet("PlayerShip");
+        static const ecs::AnimationSetData data = [] {
+            ecs::AnimationSetData data("PlayerShip");
 
-        // Idle animation - single frame
-        animSet.addClip("player_idle", makeClip({{1, 69, 33, 14}}, 0.15f, true));
+            // Idle animation - single frame
+            data.addClip("player_idle", makeClip({{1, 69, 33, 14}}, 0.15f, true));
 
-        // Flying animation - 5 frames loop (slower animation with 0.15s per frame)
-        animSet.addClip(
-            "player_movement",
-            makeClip(
-                {{1, 69, 33, 14}, {34, 69, 33, 14}, {67, 69, 33, 14}, {100, 69, 33, 14}, {133, 69, 33, 14}},
-                0.2f, true));
+            // Flying animation - 5 frames loop (slower animation with 0.15s per frame)
+            data.addClip("player_movement", makeClip({{1, 69, 33, 14},
+                                                      {34, 69, 33, 14},
+                                                      {67, 69, 33, 14},
+                                                      {100, 69, 33, 14},
+                                                      {133, 69, 33, 14}},
+                                                     0.2f, true));
 
-        return animSet;
+            return data;
+        }();
+
+        return ecs::AnimationSet(&data);
     }
 
     /**
@@ -54,24 +66,28 @@ namespace AnimDB {
      * @return ecs::AnimationSet Complete animation set for orbital module
      */
     inline ecs::AnimationSet createOrbitalModuleAnimations() {
-        ecs::AnimationSet animSet("OrbitalModule");
-
-        // Spin animation - 12 frames
-        animSet.addClip("orbital_spin", makeClip({{0, 0, 17, 18},
-                                                  {17, 0, 17, 18},
-                                                  {34, 0, 17, 18},
-                                                  {51, 0, 17, 18},
-                                                  {68, 0, 17, 18},
-                                                  {85, 0, 17, 18},
-                                                  {102, 0, 17, 18},
-                                                  {119, 0, 17, 18},
-                                                  {136, 0, 17, 18},
-                                                  {153, 0, 17, 18},
-                                                  {170, 0, 17, 18},
-                                                  {187, 0, 17, 18}},
-                                                 0.1f, true));
-
-        return animSet;
+        static const ecs::AnimationSetData data = [] {
+            ecs::AnimationSetData data("OrbitalModule");
+
+            // Spin animation - 12 frames
+            data.addClip("orbital_spin", makeClip({{0, 0, 17, 18},
+                                                   {17, 0, 17, 18},
+                                                   {34, 0, 17, 18},
+                                                   {51, 0, 17, 18},
+                                                   {68, 0, 17, 18},
+                                                   {85, 0, 17, 18},
+                                                   {102, 0, 17, 18},
+                                                   {119, 0, 17, 18},
+                                                   {136, 0, 17, 18},
+                                                   {153, 0, 17, 18},
+                                                   {170, 0, 17, 18},
+                                                   {187, 0, 17, 18}},
+                                                  0.1f, true));
+
+            return data;
+        }();
+
+        return ecs::AnimationSet(&data);
     }
 
     /**
@@ -80,28 +96,32 @@ namespace AnimDB {
      * @return ecs::AnimationSet Complete animation set for basic enemy
      */
     inline ecs::AnimationSet createEnemyBasicAnimations() {
-        ecs::AnimationSet animSet("BasicEnemy");
-
-        // Simple 16 frames flying animation
-        animSet.addClip("enemy_fly", makeClip({{0, 0, 33, 34},
-                                               {33, 0, 33, 34},
-                                               {66, 0, 33, 34},
-                                               {99, 0, 33, 34},
-                                               {132, 0, 33, 34},
-                                               {165, 0, 33, 34},
-                                               {198, 0, 33, 34},
-                                               {231, 0, 33, 34},
-                                               {0, 34, 33, 34},
-                                               {33, 34, 33, 34},
-                                               {66, 34, 33, 34},
-                                               {99, 34, 33, 34},
-                                               {132, 34, 33, 34},
-                                               {165, 34, 33, 34},
-                                               {198, 34, 33, 34},
-                                               {231, 34, 33, 34}},
-                                              0.1f, true));
-
-        return animSet;
+        static const ecs::AnimationSetData data = [] {
+            ecs::AnimationSetData data("BasicEnemy");
+
+            // Simple 16 frames flying animation
+            data.addClip("enemy_fly", makeClip({{0, 0, 33, 34},
+                                                {33, 0, 33, 34},
+                                                {66, 0, 33, 34},
+                                                {99, 0, 33, 34},
+                                                {132, 0, 33, 34},
+                                                {165, 0, 33, 34},
+                                                {198, 0, 33, 34},
+                                                {231, 0, 33, 34},
+                                                {0, 34, 33, 34},
+                                                {33, 34, 33, 34},
+                                                {66, 34, 33, 34},
+                                                {99, 34, 33, 34},
+                                                {132, 34, 33, 34},
+                                                {165, 34, 33, 34},
+                                                {198, 34, 33, 34},
+                                                {231, 34, 33, 34}},
+                                               0.1f, true));
+
+            return data;
+        }();
+
+        return ecs::AnimationSet(&data);
     }
 
     /**
@@ -110,25 +130,29 @@ namespace AnimDB {
      * @return ecs::AnimationSet Complete animation set for walking enemy
      */
     inline ecs::AnimationSet createEnemyWalkingAnimations() {
-        ecs::AnimationSet animSet("WalkingEnemy");
+        static const ecs::AnimationSetData data = [] {
+            ecs::AnimationSetData data("WalkingEnemy");
+
+            // Walking animation left 3 frames
+            data.addClip("walk_left",
+                         makeClip({{0, 0, 33, 34}, {33, 0, 33, 34}, {66, 0, 33, 34}}, 0.15f, true));
 
-        // Walking animation left 3 frames
-        animSet.addClip("walk_left",
-                        makeClip({{0, 0, 33, 34}, {33, 0, 33, 34}, {66, 0, 33, 34}}, 0.15f, true));
+            // Walking animation right 3 frames
+            data.addClip("walk_right",
+                         makeClip({{100, 0, 33, 34}, {133, 0, 33, 34}, {166, 0, 33, 34}}, 0.15f, true));
 
-        // Walking animation right 3 frames
-        animSet.addClip("walk_right",
-                        makeClip({{100, 0, 33, 34}, {133, 0, 33, 34}, {166, 0, 33, 34}}, 0.15f, true));
+            // Slightly flying left animation 3 frames
+            data.addClip("fly_left",
+                         makeClip({{0, 34, 33, 34}, {33, 34, 33, 34}, {66, 34, 33, 34}}, 0.1f, true));
 
-        // Slightly flying left animation 3 frames
-        animSet.addClip("fly_left",
-                        makeClip({{0, 34, 33, 34}, {33, 34, 33, 34}, {66, 34, 33, 34}}, 0.1f, true));
+            // Slightly flying right animation 3 frames
+            data.addClip("fly_right",
+                         makeClip({{100, 34, 33, 34}, {133, 34, 33, 34}, {166, 34, 33, 34}}, 0.1f, true));
 
-        // Slightly flying right animation 3 frames
-        animSet.addClip("fly_right",
-                        makeClip({{100, 34, 33, 34}, {133, 34, 33, 34}, {166, 34, 33, 34}}, 0.1f, true));
+            return data;
+        }();
 
-        return animSet;
+        return ecs::AnimationSet(&data);
     }
 
     /**
@@ -137,19 +161,23 @@ namespace AnimDB {
      * @return ecs::AnimationSet Complete animation set for boss body
      */
     inline ecs::AnimationSet createBossBodyAnimations() {
-        ecs::AnimationSet animSet("r-typesheet10");
+        static const ecs::AnimationSetData data = [] {
+            ecs::AnimationSetData data("r-typesheet10");
+
+            // Idle animation
+            data.addClip("idle", makeClip({{0, 0, 128, 128}}, 0.1f, true));
 
-        // Idle animation
-        animSet.addClip("idle", makeClip({{0, 0, 128, 128}}, 0.1f, true));
+            // Hurt animation - flashes then returns to idle
+            data.addClip("hurt", makeClip({{128, 0, 128, 128}, {256, 0, 128, 128}}, 0.08f, false, "idle"));
 
-        // Hurt animation - flashes then returns to idle
-        animSet.addClip("hurt", makeClip({{128, 0, 128, 128}, {256, 0, 128, 128}}, 0.08f, false, "idle"));
+            // Attack animation - returns to idle after
+            data.addClip("attack", makeClip({{0, 128, 128, 128}, {128, 128, 128, 128}, {256, 128, 128, 128}},
+                                            0.12f, false, "idle"));
 
-        // Attack animation - returns to idle after
-        animSet.addClip("attack", makeClip({{0, 128, 128, 128}, {128, 128, 128, 128}, {256, 128, 128, 128}},
-                                           0.12f, false, "idle"));
+            return data;
+        }();
 
-        return animSet;
+        return ecs::AnimationSet(&data);
     }
 
     /**
@@ -158,16 +186,20 @@ namespace AnimDB {
      * @return ecs::AnimationSet Complete animation set for boss arm
      */
     inline ecs::AnimationSet createBossArmAnimations() {
-        ecs::AnimationSet animSet("r-typesheet11");
+        static const ecs::AnimationSetData data = [] {
+            ecs::AnimationSetData data("r-typesheet11");
 
-        // Idle animation
-        animSet.addClip("idle", makeClip({{0, 0, 64, 64}}, 0.1f, true));
+            // Idle animation
+            data.addClip("idle", makeClip({{0, 0, 64, 64}}, 0.1f, true));
 
-        // Attack animation
-        animSet.addClip("attack",
-                        makeClip({{0, 0, 64, 64}, {64, 0, 64, 64}, {128, 0, 64, 64}}, 0.15f, false, "idle"));
+            // Attack animation
+            data.addClip("attack",
+                         makeClip({{0, 0, 64, 64}, {64, 0, 64, 64}, {128, 0, 64, 64}}, 0.15f, false, "idle"));
 
-        return animSet;
+            return data;
+        }();
+
+        return ecs::AnimationSet(&data);
     }
 
     /**
@@ -176,18 +208,22 @@ namespace AnimDB {
      * @return ecs::AnimationSet Complete animation set for player projectile
      */
     inline ecs::AnimationSet createPlayerBulletAnimations() {
-        ecs::AnimationSet animSet("Projectiles");
-
-        animSet.addClip("projectile_fly",
-                        makeClip({{267, 84, 17, 13}, {284, 84, 17, 13}, {301, 84, 17, 13}}, 0.2F, true));
-        animSet.addClip("charged_projectile_1", makeClip(
-                                                    {
-                                                        {200, 121, 32, 10},
-                                                        {232, 121, 32, 10},
-                                                    },
-                                                    0.2F, true));
-
-        return animSet;
+        static const ecs::AnimationSetData data = [] {
+            ecs::AnimationSetData data("Projectiles");
+
+            data.addClip("projectile_fly",
+                         makeClip({{267, 84, 17, 13}, {284, 84, 17, 13}, {301, 84, 17, 13}}, 0.2F, true));
+            data.addClip("charged_projectile_1", makeClip(
+                                                     {
+                                                         {200, 121, 32, 10},
+                                                         {232, 121, 32, 10},
+                                                     },
+                                                     0.2F, true));
+
+            return data;
+        }();
+
+        return ecs::AnimationSet(&data);
     }
 
     /**
@@ -196,12 +232,16 @@ namespace AnimDB {
      * @return ecs::AnimationSet Complete animation set for enemy projectile
      */
     inline ecs::AnimationSet createEnemyBulletAnimations() {
-        ecs::AnimationSet animSet("r-typesheet2");
+        static const ecs::AnimationSetData data = [] {
+            ecs::AnimationSetData data("r-typesheet2");
+
+            // Simple bullet animation
+            data.addClip("fly", makeClip({{0, 48, 8, 8}, {8, 48, 8, 8}}, 0.1f, true));
 
-        // Simple bullet animation
-        animSet.addClip("fly", makeClip({{0, 48, 8, 8}, {8, 48, 8, 8}}, 0.1f, true));
+            return data;
+        }();
 
-        return animSet;
+        return ecs::AnimationSet(&data);
     }
 
     /**
@@ -237,8 +277,11 @@ namespace AnimDB {
         }
 
         // Default fallback - simple idle animation
-        ecs::AnimationSet defaultSet("r-typesheet1");
-        defaultSet.addClip("idle", makeClip({{0, 0, 32, 32}}));
-        return defaultSet;
+        static const ecs::AnimationSetData defaultData = [] {
+            ecs::AnimationSetData data("r-typesheet1");
+            data.addClip("idle", makeClip({{0, 0, 32, 32}}));
+            return data;
+        }();
+        return ecs::AnimationSet(&defaultData);
     }
 }  // namespace AnimDB
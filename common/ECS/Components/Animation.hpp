@@ -8,6 +8,7 @@
 #pragma once
 
 #include <string>
+#include "AnimationClipRegistry.hpp"
 #include "IComponent.hpp"
 
 namespace ecs {
@@ -15,8 +16,9 @@ namespace ecs {
      * @class Animation
      * @brief Component managing current animation playback state.
      * 
-     * Stores the current animation state including which animation clip is playing,
-     * the current frame index, playback timer, and control flags for playback behavior.
+     * Stores the current animation state including which animation clip is playing
+     * (as an interned ClipId), the current frame index, playback timer, and control
+     * flags for playback behavior.
      */
     class Animation : public IComponent {
        public:
@@ -27,7 +29,16 @@ namespace ecs {
          * @param isPlaying Whether animation starts playing immediately
          */
         Animation(const std::string &initialClip = "idle", bool loop = true, bool isPlaying = true)
-            : _currentClipName(initialClip),
+            : Animation(AnimationClipRegistry::intern(initialClip), loop, isPlaying) {}
+
+        /**
+         * @brief Constructor with an already interned clip (no string lookup).
+         * @param initialClip Initial animation clip id
+         * @param loop Whether the animation should loop
+         * @param isPlaying Whether animation starts playing immediately
+         */
+        Animation(ClipId initialClip, bool loop, bool isPlaying)
+            : _currentClipId(initialClip),
               _timer(0.0f),
               _currentFrameIndex(0),
               _isPlaying(isPlaying),
@@ -37,9 +48,15 @@ namespace ecs {
 
         /**
          * @brief Get the current animation clip name.
-         * @return std::string The current clip identifier.
+         * @return const std::string& The current clip identifier.
          */
-        std::string getCurrentClipName() const { return _currentClipName; }
+        const std::string &getCurrentClipName() const { return AnimationClipRegistry::name(_currentClipId); }
+
+        /**
+         * @brief Get the current animation clip id.
+         * @return ClipId The interned id of the current clip.
+         */
+        ClipId getCurrentClipId() const { return _currentClipId; }
 
         /**
          * @brief Get the playback timer.
@@ -69,7 +86,15 @@ namespace ecs {
          * @brief Set the current animation clip name.
          * @param clipName New animation clip identifier
          */
-        void setCurrentClipName(const std::string &clipName) { _currentClipName = clipName; }
+        void setCurrentClipName(const std::string &clipName) {
+            _currentClipId = AnimationClipRegistry::intern(clipName);
+        }
+
+        /**
+         * @brief Set the current animation clip id.
+         * @param clipId New interned animation clip id
+         */
+        void setCurrentClipId(ClipId clipId) { _currentClipId = clipId; }
 
         /**
          * @brief Set the playback timer.
@@ -102,10 +127,10 @@ namespace ecs {
         ComponentType getType() const override { return getComponentType<Animation>(); }
 
        private:
-        std::string _currentClipName;  ///< Current animation clip name
-        float _timer;                  ///< Playback timer in seconds
-        int _currentFrameIndex;        ///< Current frame index
-        bool _isPlaying;               ///< Animation playing state
-        bool _loop;                    ///< Animation looping flag
+        ClipId _currentClipId;   ///< Current animation clip (interned id)
+        float _timer;            ///< Playback timer in seconds
+        int _currentFrameIndex;  ///< Current frame index
+        bool _isPlaying;         ///< Animation playing state
+        bool _loop;              ///< Animation looping flag
     };
 }  // namespace ecs
@@ -0,0 +1,129 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** AnimationClipRegistry
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace ecs {
+    /**
+     * @brief Interned animation clip identifier.
+     *
+     * Clip names are interned once into a small integer so animation
+     * lookups are plain array indexing instead of string hashing.
+     */
+    using ClipId = uint16_t;
+
+    /**
+     * @brief ClipId value meaning "no clip".
+     */
+    constexpr ClipId INVALID_CLIP_ID = 0xFFFF;
+
+    /**
+     * @class AnimationClipRegistry
+     * @brief Process-wide table interning animation clip names into ClipIds.
+     *
+     * Interning takes a mutex and is meant to happen when assets are built or
+     * ids are cached; resolving an id back to its name is lock-free, names are
+     * never moved nor removed once published.
+     *
+     * @code
+     * static const ClipId idle = AnimationClipRegistry::intern("player_idle");
+     * const std::string &name = AnimationClipRegistry::name(idle);  // "player_idle"
+     * @endcode
+     */
+    class AnimationClipRegistry {
+       public:
+        /**
+         * @brief Maximum number of distinct clip names.
+         */
+        static constexpr size_t MAX_CLIPS = 1024;
+
+        /**
+         * @brief Get the id of a clip name, registering it if needed.
+         * @param clipName Clip name
+         * @return ClipId The interned id.
+         * @throws std::runtime_error if MAX_CLIPS distinct names are already registered.
+         */
+        static ClipId intern(std::string_view clipName) {
+            Storage &storage = _storage();
+            std::lock_guard lock(storage.mutex);
+
+            std::string key(clipName);
+            auto it = storage.ids.find(key);
+            if (it != storage.ids.end()) {
+                return it->second;
+            }
+
+            const size_t index = storage.count.load(std::memory_order_relaxed);
+            if (index >= MAX_CLIPS) {
+                throw std::runtime_error(
+                    "[ecs::AnimationClipRegistry::intern] CRITICAL: Clip limit reached (" +
+                    std::to_string(MAX_CLIPS) + ")");
+            }
+
+            storage.names[index] = key;
+            storage.ids.emplace(std::move(key), static_cast<ClipId>(index));
+            storage.count.store(index + 1, std::memory_order_release);
+            return static_cast<ClipId>(index);
+        }
+
+        /**
+         * @brief Get the id of an already interned clip name.
+         * @param clipName Clip name
+         * @return ClipId The id, or INVALID_CLIP_ID if the name was never interned.
+         */
+        static ClipId find(std::string_view clipName) {
+            Storage &storage = _storage();
+            std::lock_guard lock(storage.mutex);
+
+            auto it = storage.ids.find(std::string(clipName));
+            return (it != storage.ids.end()) ? it->second : INVALID_CLIP_ID;
+        }
+
+        /**
+         * @brief Resolve a clip id to its name (lock-free).
+         * @param clipId Interned clip id
+         * @return const std::string& The clip name, or an empty string for unknown ids.
+         */
+        static const std::string &name(ClipId clipId) {
+            static const std::string empty;
+            Storage &storage = _storage();
+
+            if (clipId >= storage.count.load(std::memory_order_acquire)) {
+                return empty;
+            }
+            return storage.names[clipId];
+        }
+
+        /**
+         * @brief Get the number of interned clip names.
+         */
+        static size_t size() { return _storage().count.load(std::memory_order_acquire); }
+
+       private:
+        struct Storage {
+            std::mutex mutex;
+            std::unordered_map<std::string, ClipId> ids;
+            std::array<std::string, MAX_CLIPS> names;
+            std::atomic<size_t> count{0};
+        };
+
+        static Storage &_storage() {
+            static Storage storage;
+            return storage;
+        }
+    };
+}  // namespace ecs
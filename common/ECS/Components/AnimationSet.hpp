@@ -8,8 +8,8 @@
 #pragma once
 
 #include <string>
-#include <unordered_map>
 #include <vector>
+#include "AnimationClipRegistry.hpp"
 #include "IComponent.hpp"
 #include "Sprite.hpp"
 
@@ -17,7 +17,7 @@ namespace ecs {
     /**
      * @struct AnimationClip
      * @brief Defines a sequence of frames for an animation.
-     * 
+     *
      * Contains all frames (as source rectangles), timing information,
      * loop behavior, and optional transition to next animation.
      */
@@ -26,11 +26,18 @@ namespace ecs {
         float frameDuration;            ///< Duration per frame in seconds
         bool loop;                      ///< Whether animation loops
         std::string nextClip;           ///< Next clip name after completion (optional)
+        ClipId id;                      ///< Interned id of this clip (set by AnimationSetData::addClip)
+        ClipId nextClipId;              ///< Interned id of nextClip (INVALID_CLIP_ID if none)
 
         /**
          * @brief Default constructor.
          */
-        AnimationClip() : frameDuration(0.1f), loop(true), nextClip("") {}
+        AnimationClip()
+            : frameDuration(0.1f),
+              loop(true),
+              nextClip(""),
+              id(INVALID_CLIP_ID),
+              nextClipId(INVALID_CLIP_ID) {}
 
         /**
          * @brief Constructor with all parameters.
@@ -41,73 +48,140 @@ namespace ecs {
          */
         AnimationClip(const std::vector<Rectangle> &frames, float duration = 0.1f, bool loop = true,
                       const std::string &nextClip = "")
-            : frames(frames), frameDuration(duration), loop(loop), nextClip(nextClip) {}
+            : frames(frames),
+              frameDuration(duration),
+              loop(loop),
+              nextClip(nextClip),
+              id(INVALID_CLIP_ID),
+              nextClipId(nextClip.empty() ? INVALID_CLIP_ID : AnimationClipRegistry::intern(nextClip)) {}
     };
 
     /**
-     * @class AnimationSet
-     * @brief Component containing all available animations for an entity.
-     * 
-     * Stores the texture key and a map of named animation clips.
-     * This component defines what animations an entity can play.
+     * @class AnimationSetData
+     * @brief Immutable animation asset shared by every entity using it.
+     *
+     * Holds the texture key and the clips of one kind of entity. Clips are
+     * stored contiguously and indexed by interned ClipId, so looking one up
+     * is array indexing. Built once (see AnimDB) then only read through
+     * AnimationSet handles.
      */
-    class AnimationSet : public IComponent {
+    class AnimationSetData {
        public:
         /**
          * @brief Constructor with texture key.
          * @param textureKey Texture identifier for all animations
          */
-        explicit AnimationSet(const std::string &textureKey) : _textureKey(textureKey) {}
+        explicit AnimationSetData(const std::string &textureKey) : _textureKey(textureKey) {}
 
-        ~AnimationSet() override = default;
+        /**
+         * @brief Add an animation clip (asset building only).
+         * @param clipName Name of the clip
+         * @param clip Animation clip data
+         */
+        void addClip(const std::string &clipName, const AnimationClip &clip) {
+            const ClipId clipId = AnimationClipRegistry::intern(clipName);
+
+            if (clipId >= _slots.size()) {
+                _slots.resize(static_cast<size_t>(clipId) + 1, -1);
+            }
+            if (_slots[clipId] >= 0) {
+                _clips[_slots[clipId]] = clip;
+            } else {
+                _slots[clipId] = static_cast<int>(_clips.size());
+                _clips.push_back(clip);
+            }
+            _clips[_slots[clipId]].id = clipId;
+        }
 
         /**
          * @brief Get the texture key.
-         * @return std::string The texture identifier.
+         * @return const std::string& The texture identifier.
          */
-        std::string getTextureKey() const { return _textureKey; }
+        const std::string &getTextureKey() const { return _textureKey; }
 
         /**
          * @brief Get all animation clips.
-         * @return const std::unordered_map<std::string, AnimationClip>& Map of clip names to clips.
+         * @return const std::vector<AnimationClip>& Clips in insertion order.
          */
-        const std::unordered_map<std::string, AnimationClip> &getClips() const { return _clips; }
+        const std::vector<AnimationClip> &getClips() const { return _clips; }
 
         /**
          * @brief Get a specific animation clip.
-         * @param clipName Name of the animation clip
+         * @param clipId Interned clip id
          * @return const AnimationClip* Pointer to clip, or nullptr if not found.
          */
-        const AnimationClip *getClip(const std::string &clipName) const {
-            auto it = _clips.find(clipName);
-            return (it != _clips.end()) ? &it->second : nullptr;
+        const AnimationClip *getClip(ClipId clipId) const {
+            if (clipId >= _slots.size() || _slots[clipId] < 0) {
+                return nullptr;
+            }
+            return &_clips[_slots[clipId]];
         }
 
+       private:
+        std::string _textureKey;            ///< Texture identifier for animations
+        std::vector<AnimationClip> _clips;  ///< Clips, stored contiguously
+        std::vector<int> _slots;            ///< ClipId -> index in _clips (-1 if absent)
+    };
+
+    /**
+     * @class AnimationSet
+     * @brief Component referencing the animations available to an entity.
+     *
+     * Lightweight handle to a shared, immutable AnimationSetData: every
+     * entity of the same kind points to the same asset instead of owning a
+     * copy of its clips.
+     */
+    class AnimationSet : public IComponent {
+       public:
         /**
-         * @brief Check if a clip exists.
-         * @param clipName Name of the animation clip
-         * @return bool True if clip exists.
+         * @brief Constructor from a shared animation asset.
+         * @param data Asset to reference (must outlive the component, see AnimDB)
+         */
+        explicit AnimationSet(const AnimationSetData *data = nullptr) : _data(data) {}
+
+        ~AnimationSet() override = default;
+
+        /**
+         * @brief Get the referenced asset.
+         * @return const AnimationSetData* The asset, or nullptr if none.
          */
-        bool hasClip(const std::string &clipName) const { return _clips.find(clipName) != _clips.end(); }
+        const AnimationSetData *getData() const { return _data; }
 
         /**
-         * @brief Set the texture key.
-         * @param textureKey New texture identifier
+         * @brief Get the texture key.
+         * @return std::string The texture identifier (empty if no asset).
          */
-        void setTextureKey(const std::string &textureKey) { _textureKey = textureKey; }
+        std::string getTextureKey() const { return _data ? _data->getTextureKey() : std::string(); }
 
         /**
-         * @brief Add an animation clip.
-         * @param clipName Name of the clip
-         * @param clip Animation clip data
+         * @brief Get a specific animation clip.
+         * @param clipId Interned clip id
+         * @return const AnimationClip* Pointer to clip, or nullptr if not found.
          */
-        void addClip(const std::string &clipName, const AnimationClip &clip) { _clips[clipName] = clip; }
+        const AnimationClip *getClip(ClipId clipId) const { return _data ? _data->getClip(clipId) : nullptr; }
 
         /**
-         * @brief Remove an animation clip.
-         * @param clipName Name of the clip to remove
+         * @brief Get a specific animation clip by name.
+         * @param clipName Name of the animation clip
+         * @return const AnimationClip* Pointer to clip, or nullptr if not found.
+         */
+        const AnimationClip *getClip(const std::string &clipName) const {
+            return getClip(AnimationClipRegistry::find(clipName));
+        }
+
+        /**
+         * @brief Check if a clip exists.
+         * @param clipId Interned clip id
+         * @return bool True if clip exists.
+         */
+        bool hasClip(ClipId clipId) const { return getClip(clipId) != nullptr; }
+
+        /**
+         * @brief Check if a clip exists.
+         * @param clipName Name of the animation clip
+         * @return bool True if clip exists.
          */
-        void removeClip(const std::string &clipName) { _clips.erase(clipName); }
+        bool hasClip(const std::string &clipName) const { return getClip(clipName) != nullptr; }
 
         /**
          * @brief Get the component type ID.
@@ -116,7 +190,6 @@ namespace ecs {
         ComponentType getType() const override { return getComponentType<AnimationSet>(); }
 
        private:
-        std::string _textureKey;                                ///< Texture identifier for animations
-        std::unordered_map<std::string, AnimationClip> _clips;  ///< Map of animation clips
+        const AnimationSetData *_data;  ///< Shared immutable animation asset
     };
 }  // namespace ecs
@@ -38,6 +38,7 @@ namespace ecs {
               _duration(0.0f),
               _nextMapId(""),
               _elapsedTime(0.0f),
+              _scrollOffset(0.0f),
               _isCompleted(false) {}
 
         /**
@@ -59,6 +60,7 @@ namespace ecs {
               _duration(0.0f),
               _nextMapId(""),
               _elapsedTime(0.0f),
+              _scrollOffset(0.0f),
               _isCompleted(false) {}
 
         /**
@@ -87,6 +89,7 @@ namespace ecs {
               _duration(duration),
               _nextMapId(nextMapId),
               _elapsedTime(0.0f),
+              _scrollOffset(0.0f),
               _isCompleted(false) {}
 
         ~MapData() override = default;
@@ -153,6 +156,16 @@ namespace ecs {
          */
         float getElapsedTime() const { return _elapsedTime; }
 
+        /**
+         * @brief Get the world scroll offset (camera X).
+         *
+         * Static geometry (walls) keeps world coordinates; its screen
+         * position is worldX - scrollOffset.
+         *
+         * @return Distance scrolled since the map started, in pixels
+         */
+        float getScrollOffset() const { return _scrollOffset; }
+
         /**
          * @brief Check if the map is completed.
          * @return True if map is completed
@@ -221,16 +234,23 @@ namespace ecs {
          */
         void updateElapsedTime(float deltaTime) { _elapsedTime += deltaTime; }
 
+        /**
+         * @brief Advance the world scroll offset by the scroll speed.
+         * @param deltaTime Time increment in seconds
+         */
+        void advanceScroll(float deltaTime) { _scrollOffset += _scrollSpeed * deltaTime; }
+
         /**
          * @brief Mark the map as completed.
          */
         void markCompleted() { _isCompleted = true; }
 
         /**
-         * @brief Reset the map state (elapsed time and completion).
+         * @brief Reset the map state (elapsed time, scroll offset and completion).
          */
         void reset() {
             _elapsedTime = 0.0f;
+            _scrollOffset = 0.0f;
             _isCompleted = false;
         }
 
@@ -252,6 +272,7 @@ namespace ecs {
         float _duration;                ///< Map duration in seconds (0 = infinite)
         std::string _nextMapId;         ///< Next map to load after completion
         float _elapsedTime;             ///< Time spent on this map
+        float _scrollOffset;            ///< World scroll offset / camera X (px)
         bool _isCompleted;              ///< Completion flag
     };
 
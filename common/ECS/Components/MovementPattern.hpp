@@ -0,0 +1,295 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** MovementPattern - Data-driven native movement pattern for enemies
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include "IComponent.hpp"
+
+namespace ecs {
+    /**
+     * @brief Kinds of native movement patterns evaluated by AISystem.
+     */
+    enum class MovementPatternType : uint8_t {
+        LINEAR,  ///< Straight line along a fixed direction
+        SINE,    ///< Scroll left while oscillating vertically (sine wave)
+        ZIGZAG,  ///< Scroll left while bouncing vertically (triangle wave)
+        HOMING,  ///< Steer toward the nearest player with a bounded turn rate
+        BEZIER   ///< Follow a cubic Bezier curve, then keep its final tangent
+    };
+
+    /**
+     * @class MovementPattern
+     * @brief Parameters and progress of a native movement pattern.
+     *
+     * AISystem turns the pattern into the entity's Velocity every tick, so
+     * MovementSystem stays the only integrator and scrolling, collisions and
+     * client-side extrapolation keep working unchanged. Lua scripts only pick
+     * a pattern (see setSpawnerConfig / setMovementPattern) instead of moving
+     * entities themselves.
+     *
+     * A speed of 0 means "use the Velocity base speed" (the enemy type speed
+     * chosen at spawn).
+     */
+    class MovementPattern : public IComponent {
+       public:
+        struct Vector2 {
+            float x;  ///< X component
+            float y;  ///< Y component
+        };
+
+        /**
+         * @brief Constructor.
+         * @param type Pattern kind
+         * @param speed Travel speed in units per second (0 = Velocity base speed)
+         */
+        explicit MovementPattern(MovementPatternType type = MovementPatternType::LINEAR, float speed = 0.0f)
+            : _type(type), _speed(speed) {}
+
+        ~MovementPattern() override = default;
+
+        /**
+         * @brief Straight line movement.
+         * @param speed Travel speed (0 = Velocity base speed)
+         * @param dirX Direction X component (normalized by AISystem)
+         * @param dirY Direction Y component (normalized by AISystem)
+         */
+        static MovementPattern linear(float speed = 0.0f, float dirX = -1.0f, float dirY = 0.0f) {
+            MovementPattern pattern(MovementPatternType::LINEAR, speed);
+            pattern._direction = {dirX, dirY};
+            return pattern;
+        }
+
+        /**
+         * @brief Leftward movement with a vertical sine oscillation around the spawn line.
+         * @param speed Horizontal speed (0 = Velocity base speed)
+         * @param amplitude Vertical amplitude in units
+         * @param frequency Oscillations per second
+         * @param phase Phase offset in radians
+         */
+        static MovementPattern sine(float speed, float amplitude, float frequency, float phase = 0.0f) {
+            MovementPattern pattern(MovementPatternType::SINE, speed);
+            pattern._amplitude = amplitude;
+            pattern._frequency = frequency;
+            pattern._phase = phase;
+            return pattern;
+        }
+
+        /**
+         * @brief Leftward movement bouncing between +/- amplitude at constant vertical speed.
+         * @param speed Horizontal speed (0 = Velocity base speed)
+         * @param amplitude Vertical amplitude in units
+         * @param frequency Full zig-zag cycles per second
+         */
+        static MovementPattern zigZag(float speed, float amplitude, float frequency) {
+            MovementPattern pattern(MovementPatternType::ZIGZAG, speed);
+            pattern._amplitude = amplitude;
+            pattern._frequency = frequency;
+            return pattern;
+        }
+
+        /**
+         * @brief Steer toward the nearest player.
+         * @param speed Travel speed (0 = Velocity base speed)
+         * @param turnRate Maximum heading change in radians per second
+         */
+        static MovementPattern homing(float speed, float turnRate) {
+            MovementPattern pattern(MovementPatternType::HOMING, speed);
+            pattern._turnRate = turnRate;
+            return pattern;
+        }
+
+        /**
+         * @brief Cubic Bezier path starting at the spawn position.
+         * @param control1 First control point, relative to the spawn position
+         * @param control2 Second control point, relative to the spawn position
+         * @param end End point, relative to the spawn position
+         * @param duration Time in seconds to travel the whole curve
+         */
+        static MovementPattern bezier(Vector2 control1, Vector2 control2, Vector2 end, float duration) {
+            MovementPattern pattern(MovementPatternType::BEZIER);
+            pattern._controlPoints = {control1, control2, end};
+            pattern._duration = duration;
+            return pattern;
+        }
+
+        /**
+         * @brief Parse a pattern name ("linear", "sine", "zigzag", "homing", "bezier").
+         * @param name Pattern name as written in map scripts
+         * @return std::optional<MovementPatternType> The type, or nullopt for unknown names.
+         */
+        static std::optional<MovementPatternType> typeFromString(std::string_view name) {
+            if (name == "linear") {
+                return MovementPatternType::LINEAR;
+            }
+            if (name == "sine") {
+                return MovementPatternType::SINE;
+            }
+            if (name == "zigzag") {
+                return MovementPatternType::ZIGZAG;
+            }
+            if (name == "homing") {
+                return MovementPatternType::HOMING;
+            }
+            if (name == "bezier") {
+                return MovementPatternType::BEZIER;
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Get the pattern kind.
+         * @return MovementPatternType Pattern kind.
+         */
+        MovementPatternType getPatternType() const { return _type; }
+
+        /**
+         * @brief Get travel speed.
+         * @return float Units per second (0 = Velocity base speed).
+         */
+        float getSpeed() const { return _speed; }
+
+        /**
+         * @brief Get linear direction / current homing heading.
+         * @return Vector2 Direction vector.
+         */
+        Vector2 getDirection() const { return _direction; }
+
+        /**
+         * @brief Get vertical amplitude (sine, zig-zag).
+         * @return float Amplitude in units.
+         */
+        float getAmplitude() const { return _amplitude; }
+
+        /**
+         * @brief Get oscillation frequency (sine, zig-zag).
+         * @return float Cycles per second.
+         */
+        float getFrequency() const { return _frequency; }
+
+        /**
+         * @brief Get sine phase offset.
+         * @return float Phase in radians.
+         */
+        float getPhase() const { return _phase; }
+
+        /**
+         * @brief Get homing turn rate.
+         * @return float Maximum heading change in rad/s.
+         */
+        float getTurnRate() const { return _turnRate; }
+
+        /**
+         * @brief Get Bezier control points.
+         * @return const std::array<Vector2, 3>& P1, P2 and P3, relative to the spawn position.
+         */
+        const std::array<Vector2, 3> &getControlPoints() const { return _controlPoints; }
+
+        /**
+         * @brief Get Bezier travel time.
+         * @return float Seconds to travel the curve.
+         */
+        float getDuration() const { return _duration; }
+
+        /**
+         * @brief Get time spent in the pattern.
+         * @return float Seconds since the pattern started.
+         */
+        float getElapsed() const { return _elapsed; }
+
+        /**
+         * @brief Check whether the pattern has been evaluated at least once.
+         */
+        bool isStarted() const { return _started; }
+
+        /**
+         * @brief Set travel speed.
+         * @param speed Units per second (0 = Velocity base speed)
+         */
+        void setSpeed(float speed) { _speed = speed; }
+
+        /**
+         * @brief Set linear direction / homing heading.
+         * @param dirX Direction X component
+         * @param dirY Direction Y component
+         */
+        void setDirection(float dirX, float dirY) { _direction = {dirX, dirY}; }
+
+        /**
+         * @brief Set vertical amplitude.
+         * @param amplitude Amplitude in units
+         */
+        void setAmplitude(float amplitude) { _amplitude = amplitude; }
+
+        /**
+         * @brief Set oscillation frequency.
+         * @param frequency Cycles per second
+         */
+        void setFrequency(float frequency) { _frequency = frequency; }
+
+        /**
+         * @brief Set sine phase offset.
+         * @param phase Phase in radians
+         */
+        void setPhase(float phase) { _phase = phase; }
+
+        /**
+         * @brief Set homing turn rate.
+         * @param turnRate Maximum heading change in rad/s
+         */
+        void setTurnRate(float turnRate) { _turnRate = turnRate; }
+
+        /**
+         * @brief Set one Bezier control point.
+         * @param index 0 = P1, 1 = P2, 2 = P3 (end point)
+         * @param point Position relative to the spawn position
+         */
+        void setControlPoint(size_t index, Vector2 point) { _controlPoints.at(index) = point; }
+
+        /**
+         * @brief Set Bezier travel time.
+         * @param duration Seconds to travel the curve
+         */
+        void setDuration(float duration) { _duration = duration; }
+
+        /**
+         * @brief Advance pattern time (AISystem only).
+         * @param deltaTime Seconds to add
+         */
+        void advance(float deltaTime) {
+            _elapsed += deltaTime;
+            _started = true;
+        }
+
+        /**
+         * @brief Restart the pattern from the entity's current position.
+         */
+        void reset() {
+            _elapsed = 0.0f;
+            _started = false;
+        }
+
+        ComponentType getType() const override { return getComponentType<MovementPattern>(); }
+
+       private:
+        MovementPatternType _type;                ///< Pattern kind
+        float _speed;                             ///< Travel speed (0 = Velocity base speed)
+        Vector2 _direction{-1.0f, 0.0f};          ///< Linear direction / current homing heading
+        float _amplitude = 0.0f;                  ///< Sine / zig-zag vertical amplitude
+        float _frequency = 0.0f;                  ///< Sine / zig-zag cycles per second
+        float _phase = 0.0f;                      ///< Sine phase offset (radians)
+        float _turnRate = 0.0f;                   ///< Homing max turn rate (rad/s)
+        std::array<Vector2, 3> _controlPoints{};  ///< Bezier P1, P2, P3 relative to P0
+        float _duration = 1.0f;                   ///< Bezier travel time (seconds)
+        float _elapsed = 0.0f;                    ///< Time spent in the pattern
+        bool _started = false;                    ///< True once AISystem evaluated it
+    };
+}  // namespace ecs
@@ -46,6 +46,12 @@ namespace ecs {
          */
         int getPlayerId() const { return _playerId; }
 
+        /**
+         * @brief Get how far in the past this player sees the world.
+         * @return uint32_t Ticks between the server state and what the client rendered when acting.
+         */
+        uint32_t getViewDelayTicks() const { return _viewDelayTicks; }
+
         /**
          * @brief Set player's score.
          * @param score New score value
@@ -64,6 +70,12 @@ namespace ecs {
          */
         void setPlayerId(int playerId) { _playerId = playerId; }
 
+        /**
+         * @brief Set how far in the past this player sees the world (lag compensation).
+         * @param ticks Round trip, input buffering and interpolation delay, in ticks
+         */
+        void setViewDelayTicks(uint32_t ticks) { _viewDelayTicks = ticks; }
+
         /**
          * @brief Get the component type ID.
          * @return ComponentType Unique ID for Player component.
@@ -71,8 +83,9 @@ namespace ecs {
         ComponentType getType() const override { return getComponentType<Player>(); }
 
        private:
-        int _score;     ///< Player's current score
-        int _lives;     ///< Remaining lives
-        int _playerId;  ///< Unique player identifier
+        int _score;                    ///< Player's current score
+        int _lives;                    ///< Remaining lives
+        int _playerId;                 ///< Unique player identifier
+        uint32_t _viewDelayTicks = 0;  ///< Lag compensation rewind, in ticks
     };
 }  // namespace ecs
@@ -7,9 +7,11 @@
 
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 #include "IComponent.hpp"
+#include "MovementPattern.hpp"
 
 namespace ecs {
     /**
@@ -23,8 +25,9 @@ namespace ecs {
         std::string scriptPath;  // Lua script for behavior
         float health;
         int scoreValue;
-        float spawnDelay;         // Delay in seconds from wave start
-        bool hasSpawned = false;  // Track if this request has been spawned
+        float spawnDelay;                                        // Delay in seconds from wave start
+        bool hasSpawned = false;                                 // Track if this request has been spawned
+        std::optional<MovementPattern> movement = std::nullopt;  // Native movement pattern (AISystem)
     };
 
     struct WaveConfig {
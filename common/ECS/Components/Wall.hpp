@@ -16,6 +16,12 @@ namespace ecs {
      * 
      * Walls are obstacles that can be destructible or indestructible.
      * They use Transform, Collider, and optionally Health components.
+     *
+     * Walls are static: CollisionSystem indexes them in its StaticGeometry
+     * and rebuilds it only when a Wall is added or removed. Give a wall its
+     * Transform and Collider before the next collision update (as
+     * PrefabFactory::createWall does), and call
+     * CollisionSystem::invalidateStaticGeometry() after moving or resizing one.
      */
     class Wall : public IComponent {
        public:
@@ -10,6 +10,7 @@
 #include "common/ECS/Components/Collectible.hpp"
 #include "common/ECS/Components/LuaScript.hpp"
 #include "common/ECS/Components/OrbitalModule.hpp"
+#include "common/ECS/Systems/MapSystem/MapSystem.hpp"
 
 namespace ecs {
 
@@ -65,8 +66,9 @@ namespace ecs {
             registry.setComponent(projectile, Collider(10.0f, 10.0f, 0.0f, 0.0f, 4, 0xFFFFFFFF, false));
 
             // Add animation components for projectile rendering
+            static const ClipId flyClip = AnimationClipRegistry::intern("projectile_fly");
             registry.setComponent(projectile, AnimDB::createPlayerBulletAnimations());
-            registry.setComponent(projectile, Animation("projectile_fly", true, true));
+            registry.setComponent(projectile, Animation(flyClip, true, true));
             registry.setComponent(projectile,
                                   Sprite("Projectiles", {267, 84, 17, 13}, 2.0f, 0.0f, false, false, 0));
 
@@ -79,7 +81,8 @@ namespace ecs {
 
     Address PrefabFactory::createEnemy(Registry &registry, const std::string &enemyType, float posX,
                                        float posY, float health, int scoreValue,
-                                       const std::string &scriptPath) {
+                                       const std::string &scriptPath,
+                                       const std::optional<MovementPattern> &movement) {
         try {
             int typeInt = _enemyTypeFromString(enemyType);
             EnemySpawnData spawnData = _getEnemySpawnData(typeInt);
@@ -97,6 +100,9 @@ namespace ecs {
             if (!scriptPath.empty()) {
                 registry.setComponent(enemy, LuaScript(scriptPath));
             }
+            if (movement) {
+                registry.setComponent(enemy, *movement);
+            }
 
             LOG_INFO("✓ Enemy '", enemyType, "' created at (", posX, ", ", posY, ")");
             return enemy;
@@ -108,7 +114,8 @@ namespace ecs {
 
     Address PrefabFactory::createEnemyFromRegistry(Registry &registry, const std::string &enemyType,
                                                    float posX, float posY, float health, int scoreValue,
-                                                   const std::string &scriptPath) {
+                                                   const std::string &scriptPath,
+                                       const std::optional<MovementPattern> &movement) {
         try {
             int typeInt = _enemyTypeFromString(enemyType);
             EnemySpawnData spawnData = _getEnemySpawnData(typeInt);
@@ -126,6 +133,9 @@ namespace ecs {
             if (!scriptPath.empty()) {
                 registry.setComponent(enemy, LuaScript(scriptPath));
             }
+            if (movement) {
+                registry.setComponent(enemy, *movement);
+            }
 
             LOG_INFO("✓ Enemy '", enemyType, "' created at (", posX, ", ", posY, ")");
             return enemy;
@@ -199,8 +209,9 @@ namespace ecs {
     ecs::Address PrefabFactory::createWall(ecs::Registry &registry, float posX, float posY, float width,
                                            float height, bool destructible, int health) {
         try {
+            const float worldX = posX + MapSystem::getScrollOffset(registry);
             ecs::Address wall = registry.newEntity();
-            registry.setComponent(wall, ecs::Transform(posX, posY));
+            registry.setComponent(wall, ecs::Transform(worldX, posY));
             registry.setComponent(wall, ecs::Wall(destructible));
             registry.setComponent(wall, ecs::Collider(width, height, 0.0f, 0.0f, 16, 0xFFFFFFFF,
                                                       false));  // Layer 16 for walls
@@ -254,8 +265,9 @@ namespace ecs {
             registry.setComponent(module, ecs::Health(moduleHealth, moduleHealth));
 
             // Animation components for orbital module
+            static const ClipId spinClip = AnimationClipRegistry::intern("orbital_spin");
             registry.setComponent(module, AnimDB::createOrbitalModuleAnimations());
-            registry.setComponent(module, ecs::Animation("orbital_spin", true, true));
+            registry.setComponent(module, ecs::Animation(spinClip, true, true));
 
             // Visual sprite (initial frame from animation)
             registry.setComponent(module,
@@ -9,6 +9,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include "common/Animation/AnimationDatabase.hpp"
@@ -18,6 +19,7 @@
 #include "common/ECS/Components/Collider.hpp"
 #include "common/ECS/Components/Enemy.hpp"
 #include "common/ECS/Components/Health.hpp"
+#include "common/ECS/Components/MovementPattern.hpp"
 #include "common/ECS/Components/Player.hpp"
 #include "common/ECS/Components/Projectile.hpp"
 #include "common/ECS/Components/Sprite.hpp"
@@ -72,11 +74,13 @@ namespace ecs {
          * @param health Custom health value
          * @param scoreValue Custom score value
          * @param scriptPath Optional Lua script path for AI behavior
+         * @param movement Optional native movement pattern (see AISystem)
          * @return Entity address or 0 if failed
          */
         static ecs::Address createEnemy(ecs::Registry &registry, const std::string &enemyType, float posX,
                                         float posY, float health, int scoreValue,
-                                        const std::string &scriptPath = "");
+                                        const std::string &scriptPath = "",
+                                        const std::optional<MovementPattern> &movement = std::nullopt);
 
         /**
          * @brief Create an enemy entity directly from Registry (for SpawnSystem)
@@ -87,11 +91,13 @@ namespace ecs {
          * @param health Custom health value
          * @param scoreValue Custom score value
          * @param scriptPath Optional Lua script path for AI behavior
+         * @param movement Optional native movement pattern (see AISystem)
          * @return Entity address or 0 if failed
          */
         static ecs::Address createEnemyFromRegistry(ecs::Registry &registry, const std::string &enemyType,
                                                     float posX, float posY, float health, int scoreValue,
-                                                    const std::string &scriptPath = "");
+                                                    const std::string &scriptPath = "",
+                                        const std::optional<MovementPattern> &movement = std::nullopt);
 
         /**
          * @brief Create a projectile entity
@@ -136,8 +142,12 @@ namespace ecs {
 
         /**
          * @brief Create a wall/obstacle entity
+         *
+         * Walls are static geometry stored in world coordinates (see
+         * MapSystem::getScrollOffset); posX is converted from screen space.
+         *
          * @param registry ECS registry
-         * @param posX Starting X position
+         * @param posX Starting X position (screen space at spawn time)
          * @param posY Starting Y position
          * @param width Wall width
          * @param height Wall height
@@ -6,6 +6,7 @@
 */
 
 #include "Registry.hpp"
+#include "RegistrySnapshot.hpp"
 
 namespace ecs {
     Registry::Registry() : _nextAddress(1) {}
@@ -47,26 +48,53 @@ namespace ecs {
     Address Registry::newEntity() {
         std::unique_lock lock(_mutex);
         const Address addr = this->_generateAddress();
-        Signature signature;
 
-        _signatures[addr] = signature;
+        // Reuse the node of a destroyed entity instead of allocating one
+        if (!_signatureNodePool.empty()) {
+            auto node = std::move(_signatureNodePool.back());
+            _signatureNodePool.pop_back();
+            node.key() = addr;
+            node.mapped().reset();
+            _signatures.insert(std::move(node));
+            return addr;
+        }
+
+        _signatures[addr] = Signature();
         return addr;
     }
 
     void Registry::destroyEntity(Address addr) {
         std::unique_lock lock(_mutex);
         // Remove from signatures
-        _signatures.erase(addr);
+        auto signatureNode = _signatures.extract(addr);
+        if (!signatureNode) {
+            return;
+        }
+        if (_signatureNodePool.size() < NODE_POOL_CAPACITY) {
+            _signatureNodePool.push_back(std::move(signatureNode));
+        }
 
-        // Remove all components for this entity
+        // Remove all components for this entity, keeping their nodes for reuse
         for (auto &[componentType, storage] : _componentStorage) {
-            storage.erase(addr);
+            auto node = storage.extract(addr);
+            if (node) {
+                ++_structureVersions[componentType];
+                _recycleComponentNode(componentType, std::move(node));
+            }
         }
 
         // Add address to the pool for reuse
         _freeAddresses.push(addr);
     }
 
+    void Registry::_recycleComponentNode(ComponentType componentType,
+                                         std::unordered_map<Address, std::any>::node_type &&node) {
+        auto &pool = _componentNodePool[componentType];
+        if (pool.size() < NODE_POOL_CAPACITY) {
+            pool.push_back(std::move(node));
+        }
+    }
+
     Signature Registry::getSignature(Address address) {
         std::shared_lock lock(_mutex);
         Signature sign = 0u;
@@ -76,6 +104,11 @@ namespace ecs {
         return sign;
     }
 
+    std::unordered_map<Address, std::any> *Registry::_findStorage(ComponentType componentType) {
+        auto it = _componentStorage.find(componentType);
+        return (it != _componentStorage.end()) ? &it->second : nullptr;
+    }
+
     std::vector<Address> Registry::getEntitiesWithMask(Signature requiredMask) {
         std::shared_lock lock(_mutex);
         std::vector<Address> result;
@@ -89,7 +122,130 @@ namespace ecs {
                 result.push_back(address);
             }
         }
+        if (_orderedIteration) {
+            std::sort(result.begin(), result.end());
+        }
 
         return result;
     }
+
+    void Registry::setOrderedIteration(bool ordered) {
+        std::unique_lock lock(_mutex);
+        _orderedIteration = ordered;
+    }
+
+    bool Registry::isOrderedIteration() const {
+        std::shared_lock lock(_mutex);
+        return _orderedIteration;
+    }
+
+    void Registry::saveSnapshot(RegistrySnapshot &snapshot) const {
+        std::shared_lock lock(_mutex);
+
+        // assign() keeps the capacity of the previous save
+        snapshot._entities.assign(_nextAddress, RegistrySnapshot::EntitySlot{});
+        for (const auto &[address, signature] : _signatures) {
+            snapshot._entities[address] = {signature, true};
+        }
+        snapshot._entityCount = _signatures.size();
+
+        for (ComponentType type = 0; type < N_MAX_COMPONENTS; ++type) {
+            auto &column = snapshot._columns[type];
+            auto it = _componentStorage.find(type);
+            if (it == _componentStorage.end() || it->second.empty()) {
+                if (column) {
+                    column->clear();
+                }
+                continue;
+            }
+            if (_snapshotColumnFactories[type] == nullptr) {
+                const std::string errorMsg =
+                    "[ecs::Registry::saveSnapshot] ERROR: No snapshot column for component type " +
+                    std::to_string(type);
+                std::cerr << errorMsg << std::endl;
+                throw std::runtime_error(errorMsg);
+            }
+            if (!column) {
+                column = _snapshotColumnFactories[type]();
+            }
+            column->save(it->second);
+        }
+
+        snapshot._freeAddresses = _freeAddresses;
+        snapshot._nextAddress = _nextAddress;
+        snapshot._valid = true;
+    }
+
+    void Registry::restoreSnapshot(const RegistrySnapshot &snapshot) {
+        std::unique_lock lock(_mutex);
+        if (!snapshot._valid) {
+            std::cerr << "Registry::restoreSnapshot: snapshot was never saved" << std::endl;
+            throw std::runtime_error("Registry::restoreSnapshot: snapshot was never saved");
+        }
+
+        const auto &slots = snapshot._entities;
+        auto isAlive = [&slots](Address address) {
+            return address < slots.size() && slots[address].alive;
+        };
+
+        // Entities created after the save
+        for (auto it = _signatures.begin(); it != _signatures.end();) {
+            if (isAlive(it->first)) {
+                ++it;
+                continue;
+            }
+            auto node = _signatures.extract(it++);
+            if (_signatureNodePool.size() < NODE_POOL_CAPACITY) {
+                _signatureNodePool.push_back(std::move(node));
+            }
+        }
+
+        // Signatures of saved entities, destroyed ones coming back under their address
+        for (Address address = 0; address < slots.size(); ++address) {
+            if (!slots[address].alive) {
+                continue;
+            }
+            auto it = _signatures.find(address);
+            if (it != _signatures.end()) {
+                it->second = slots[address].signature;
+            } else if (!_signatureNodePool.empty()) {
+                auto node = std::move(_signatureNodePool.back());
+                _signatureNodePool.pop_back();
+                node.key() = address;
+                node.mapped() = slots[address].signature;
+                _signatures.insert(std::move(node));
+            } else {
+                _signatures.emplace(address, slots[address].signature);
+            }
+        }
+
+        // Components added after the save (a type without a saved column had none at save time)
+        for (auto &[componentType, storage] : _componentStorage) {
+            const auto &column = snapshot._columns[componentType];
+            const bool saved = column && column->size() > 0;
+            for (auto it = storage.begin(); it != storage.end();) {
+                if (saved && isAlive(it->first) && slots[it->first].signature.test(componentType)) {
+                    ++it;
+                    continue;
+                }
+                _recycleComponentNode(componentType, storage.extract(it++));
+            }
+        }
+
+        // Saved components, assigned in place or through pooled nodes
+        for (ComponentType type = 0; type < N_MAX_COMPONENTS; ++type) {
+            const auto &column = snapshot._columns[type];
+            if (column && column->size() > 0) {
+                column->restore(_componentStorage[type], _componentNodePool[type]);
+            }
+        }
+
+        _freeAddresses = snapshot._freeAddresses;
+        _nextAddress = snapshot._nextAddress;
+
+        // Any component set may differ from before the restore
+        for (uint64_t &version : _structureVersions) {
+            ++version;
+        }
+    }
 }  // namespace ecs
@@ -16,7 +16,11 @@
 #pragma once
 
 #include <any>
+#include <array>
 #include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <shared_mutex>
@@ -51,6 +55,32 @@ namespace ecs {
  */
     typedef uint32_t Address;
 
+    /**
+ * @brief Query term marking a component as optional in Registry::each().
+ *
+ * Required terms are passed to the callback as `T &`; optional terms are
+ * passed as `T *` and are nullptr when the entity does not have the component.
+ *
+ * @code
+ * registry.each<Transform, Optional<Velocity>>([](Address addr, Transform &t, Velocity *v) {
+ *     if (v) { ... }
+ * });
+ * @endcode
+ */
+    template <typename T>
+    struct Optional {};
+
+    class RegistrySnapshot;
+
+    namespace detail {
+        class SnapshotColumn;
+
+        /**
+         * @brief Creates the typed snapshot column of one component type.
+         */
+        using SnapshotColumnFactory = std::unique_ptr<SnapshotColumn> (*)();
+    }  // namespace detail
+
     /**
  * @class Registry
  * @brief Manages entities, their signatures and component type registrations.
@@ -64,6 +94,10 @@ namespace ecs {
  * - The number of distinct component types is limited by N_MAX_COMPONENTS.
  * - Signatures are implemented as std::bitset and each registered component
  *   occupies a single bit.
+ * - Storage nodes of destroyed entities and removed components are kept in
+ *   per-component-type pools and reused by newEntity()/setComponent(), so
+ *   short-lived prefabs (projectiles, effects) stop allocating once the
+ *   pools are warm.
  */
     class Registry {
 
@@ -81,7 +115,45 @@ namespace ecs {
         std::unordered_map<ComponentType, Signature> _componentMap = {};
         std::unordered_map<ComponentType, std::unordered_map<Address, std::any>> _componentStorage = {};
 
+        /// Component nodes of destroyed entities, per component type, reused by setComponent()
+        std::array<std::vector<std::unordered_map<Address, std::any>::node_type>, N_MAX_COMPONENTS>
+            _componentNodePool = {};
+        /// Signature nodes of destroyed entities, reused by newEntity()
+        std::vector<std::unordered_map<Address, Signature>::node_type> _signatureNodePool = {};
+        /// Snapshot column factory per component type, set by setComponent()
+        std::array<detail::SnapshotColumnFactory, N_MAX_COMPONENTS> _snapshotColumnFactories = {};
+        /// Bumped whenever a component of the type is added to or removed from an entity
+        std::array<uint64_t, N_MAX_COMPONENTS> _structureVersions = {};
+        /// Queries visit entities by increasing address (see setOrderedIteration())
+        bool _orderedIteration = false;
+
+        /**
+     * @brief Keep a detached component node for reuse (dropped once the pool is full).
+     *
+     * @note Must be called with the mutex held.
+     */
+        void _recycleComponentNode(ComponentType componentType,
+                                   std::unordered_map<Address, std::any>::node_type &&node);
+
+        /**
+     * @brief Find the storage of a component type (nullptr if never stored).
+     *
+     * @note Must be called with the mutex held.
+     */
+        std::unordered_map<Address, std::any> *_findStorage(ComponentType componentType);
+
+        /**
+     * @brief Shared implementation of each()/eachParallel() (no locking).
+     */
+        template <typename... Terms, typename Func>
+        void _forEachMatch(Func &&func);
+
        public:
+        /**
+     * @brief Maximum number of recycled nodes kept per component type (and for signatures).
+     */
+        static constexpr size_t NODE_POOL_CAPACITY = 4096;
+
         /**
      * @brief Construct a new Registry object.
      *
@@ -151,6 +223,39 @@ namespace ecs {
         template <typename T>
         void removeComponent(Address address);
 
+        /**
+     * @brief Get a counter that changes whenever the set of entities having T changes.
+     *
+     * Incremented when a T is added to an entity, removed from it (also by
+     * destroyEntity()) or when a snapshot is restored. Assigning a T that an
+     * entity already has does not change it. Systems caching data derived
+     * from rarely changing components (static geometry) compare it with the
+     * value they last saw instead of walking the components every tick.
+     *
+     * @tparam T The component type.
+     * @return uint64_t Current version (0 until a T is first added).
+     */
+        template <typename T>
+        uint64_t getStructureVersion() const;
+
+        /**
+     * @brief Make every query visit entities by increasing address.
+     *
+     * By default view(), getEntitiesWithMask(), each() and eachParallel()
+     * follow the hash map order, which depends on the standard library and on
+     * the insertion history. Ordered iteration sorts the matches first, so
+     * systems process entities in the same order on every platform and run
+     * (deterministic simulation), at the cost of a sort per query.
+     *
+     * @param ordered true to sort by address, false for hash map order
+     */
+        void setOrderedIteration(bool ordered);
+
+        /**
+     * @brief Check whether queries visit entities by increasing address.
+     */
+        bool isOrderedIteration() const;
+
         /**
      * @brief Attach a component type T to an entity (set the component bit).
      *
@@ -170,6 +275,10 @@ namespace ecs {
         /**
      * @brief Remove an entity and its Signature from the registry.
      *
+     * The storage nodes of the entity are kept for reuse by the next
+     * newEntity()/setComponent() calls. Destroying an unknown address is a
+     * no-op (the address is not released twice).
+     *
      * @param address The Address of the entity to destroy.
      */
         void destroyEntity(Address address);
@@ -225,6 +334,83 @@ namespace ecs {
      * @endcode
      */
         std::vector<Address> getEntitiesWithMask(Signature requiredMask);
+
+        /**
+     * @brief Invoke a callback for every entity having all required components.
+     *
+     * Unlike view() + getComponent(), this takes the registry lock once,
+     * resolves each component storage once and hands the callback direct
+     * references: no intermediate vector and no per-component locking.
+     * Iteration is driven by the smallest required component storage.
+     *
+     * Terms wrapped in ecs::Optional<T> do not filter entities and are
+     * passed as `T *` (nullptr when absent).
+     *
+     * @warning The registry is read-locked during the whole iteration: the
+     * callback may mutate the components it receives but must not call back
+     * into the registry (create/destroy entities, add/remove/get components).
+     * Collect structural changes and apply them after each() returns.
+     *
+     * @tparam Terms Component types (or ecs::Optional<T>) to iterate.
+     * @tparam Func Callable as `void(Address, Terms...)`.
+     * @param func Callback invoked once per matching entity.
+     *
+     * @code
+     * registry.each<Transform, Velocity>([](Address addr, Transform &t, Velocity &v) {
+     *     // process...
+     * });
+     * @endcode
+     */
+        template <typename... Terms, typename Func>
+        void each(Func &&func);
+
+        /**
+     * @brief Parallel, chunked variant of each().
+     *
+     * Matching entities are gathered once under the read lock, then split into
+     * chunks of @p chunkSize processed concurrently (the calling thread takes
+     * part in the work). The lock is held until every chunk has completed.
+     * Worth it only when per-entity work dominates the cost of the dispatch.
+     *
+     * @warning Same restrictions as each(); in addition, the callback is run
+     * concurrently and must only touch the components of its own entity.
+     * The first exception thrown by a chunk is rethrown once all chunks have
+     * finished.
+     *
+     * @tparam Terms Component types (or ecs::Optional<T>) to iterate.
+     * @tparam Func Callable as `void(Address, Terms...)`.
+     * @param func Callback invoked once per matching entity.
+     * @param chunkSize Number of entities processed per task (at least 1).
+     */
+        template <typename... Terms, typename Func>
+        void eachParallel(Func &&func, size_t chunkSize = 256);
+
+        /**
+     * @brief Copy every entity, component and free address into a snapshot.
+     *
+     * Components are copied into one typed column per component type, with
+     * no std::any or map node per component. A snapshot reused for the next
+     * save keeps its buffers, so saving the same world again does not
+     * allocate (except for components holding strings that grew).
+     *
+     * @param snapshot Destination, overwritten (reuse it between saves)
+     * @throws std::runtime_error if stored components have no snapshot column
+     *         (columns are registered by setComponent())
+     */
+        void saveSnapshot(RegistrySnapshot &snapshot) const;
+
+        /**
+     * @brief Put the registry back in the state captured by saveSnapshot().
+     *
+     * Entities created since are destroyed, destroyed ones come back under
+     * the same address, and components are assigned in place, so restoring
+     * a recent snapshot (rollback of a few ticks) touches only what
+     * changed and reuses the node pools instead of allocating.
+     *
+     * @param snapshot Snapshot taken from this registry
+     * @throws std::runtime_error if the snapshot was never saved
+     */
+        void restoreSnapshot(const RegistrySnapshot &snapshot);
     };
 }  // namespace ecs
 
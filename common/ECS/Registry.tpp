@@ -1,10 +1,161 @@
 
 #pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <exception>
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace ecs {
+    namespace detail {
+        using ComponentStorage = std::unordered_map<Address, std::any>;
+
+        /**
+         * @brief Maps a query term of Registry::each() to its component type
+         * and to the argument handed to the callback.
+         */
+        template <typename T>
+        struct QueryTerm {
+            using Component = T;
+            static constexpr bool required = true;
+
+            static T &unwrap(T *component) { return *component; }
+        };
+
+        template <typename T>
+        struct QueryTerm<Optional<T>> {
+            using Component = T;
+            static constexpr bool required = false;
+
+            static T *unwrap(T *component) { return component; }
+        };
+
+        template <typename T>
+        T *findComponent(ComponentStorage *storage, Address address) {
+            if (!storage) {
+                return nullptr;
+            }
+            auto it = storage->find(address);
+            return (it != storage->end()) ? std::any_cast<T>(&it->second) : nullptr;
+        }
+
+        /**
+         * @brief Type-erased column of one component type inside a RegistrySnapshot.
+         */
+        class SnapshotColumn {
+           public:
+            virtual ~SnapshotColumn() = default;
+
+            /**
+             * @brief Replace the column content with every component of a storage.
+             */
+            virtual void save(const ComponentStorage &storage) = 0;
+
+            /**
+             * @brief Write the saved components back into a storage.
+             *
+             * Existing entries are assigned in place; missing ones reuse a
+             * pooled node when possible. Entries absent from the column are
+             * left to the caller.
+             */
+            virtual void restore(ComponentStorage &storage,
+                                 std::vector<ComponentStorage::node_type> &pool) const = 0;
+
+            /**
+             * @brief Number of saved components.
+             */
+            size_t size() const { return _count; }
+
+            /**
+             * @brief Forget the saved components (buffers are kept).
+             */
+            void clear() { _count = 0; }
+
+           protected:
+            size_t _count = 0;
+        };
+
+        /**
+         * @brief Snapshot column storing components of type T contiguously.
+         *
+         * Slots past _count are kept alive between saves so copy-assignment
+         * can reuse their storage (string capacity, etc.).
+         */
+        template <typename T>
+        class TypedSnapshotColumn : public SnapshotColumn {
+           public:
+            void save(const ComponentStorage &storage) override {
+                _count = 0;
+                _addresses.resize(storage.size());
+                if constexpr (!std::is_copy_assignable_v<T>) {
+                    _values.clear();
+                }
+                for (const auto &[address, component] : storage) {
+                    const T &value = std::any_cast<const T &>(component);
+                    if constexpr (std::is_copy_assignable_v<T>) {
+                        if (_count < _values.size()) {
+                            _values[_count] = value;
+                        } else {
+                            _values.push_back(value);
+                        }
+                    } else {
+                        _values.push_back(value);
+                    }
+                    _addresses[_count++] = address;
+                }
+            }
+
+            void restore(ComponentStorage &storage,
+                         std::vector<ComponentStorage::node_type> &pool) const override {
+                for (size_t i = 0; i < _count; ++i) {
+                    const Address address = _addresses[i];
+                    const T &value = _values[i];
+                    auto it = storage.find(address);
+                    if constexpr (std::is_copy_assignable_v<T>) {
+                        if (it != storage.end()) {
+                            std::any_cast<T &>(it->second) = value;
+                            continue;
+                        }
+                        if (!pool.empty()) {
+                            auto node = std::move(pool.back());
+                            pool.pop_back();
+                            node.key() = address;
+                            std::any_cast<T &>(node.mapped()) = value;
+                            storage.insert(std::move(node));
+                            continue;
+                        }
+                    }
+                    if (it != storage.end()) {
+                        it->second = value;
+                    } else {
+                        storage.emplace(address, value);
+                    }
+                }
+            }
+
+           private:
+            std::vector<Address> _addresses;
+            std::vector<T> _values;
+        };
+
+        template <typename T>
+        std::unique_ptr<SnapshotColumn> makeSnapshotColumn() {
+            return std::make_unique<TypedSnapshotColumn<T>>();
+        }
+
+        template <typename... Terms, typename Func, size_t... I>
+        void invokeMatch(Func &func,
+                         const std::tuple<Address, typename QueryTerm<Terms>::Component *...> &match,
+                         std::index_sequence<I...>) {
+            func(std::get<0>(match), QueryTerm<Terms>::unwrap(std::get<I + 1>(match))...);
+        }
+    }  // namespace detail
     template <typename T>
     void Registry::setComponent(Address address, const T &component) {
         std::unique_lock lock(_mutex);
@@ -33,9 +184,35 @@ namespace ecs {
 
         // Update signature
         _signatures[address] |= componentSign;
+        _snapshotColumnFactories[componentType] = &detail::makeSnapshotColumn<T>;
 
-        // Store component data
-        _componentStorage[componentType][address] = component;
+        // Store component data, assigning in place when possible so no new node or std::any
+        // payload is allocated
+        auto &storage = _componentStorage[componentType];
+        auto it = storage.find(address);
+        if (it == storage.end()) {
+            ++_structureVersions[componentType];
+        }
+        if constexpr (std::is_copy_assignable_v<T>) {
+            if (it != storage.end()) {
+                std::any_cast<T &>(it->second) = component;
+                return;
+            }
+            auto &pool = _componentNodePool[componentType];
+            if (!pool.empty()) {
+                auto node = std::move(pool.back());
+                pool.pop_back();
+                node.key() = address;
+                std::any_cast<T &>(node.mapped()) = component;
+                storage.insert(std::move(node));
+                return;
+            }
+        }
+        if (it != storage.end()) {
+            it->second = component;
+        } else {
+            storage.emplace(address, component);
+        }
     }
 
     template <typename T>
@@ -87,12 +264,23 @@ namespace ecs {
             _signatures[address] &= ~componentSign;
         }
 
-        // Remove component data
-        if (_componentStorage.contains(componentType)) {
-            _componentStorage[componentType].erase(address);
+        // Remove component data, keeping the node for reuse
+        if (auto *storage = _findStorage(componentType)) {
+            auto node = storage->extract(address);
+            if (node) {
+                ++_structureVersions[componentType];
+                _recycleComponentNode(componentType, std::move(node));
+            }
         }
     }
 
+    template <typename T>
+    uint64_t Registry::getStructureVersion() const {
+        std::shared_lock lock(_mutex);
+        const ComponentType componentType = getComponentType<T>();
+        return componentType < N_MAX_COMPONENTS ? _structureVersions[componentType] : 0;
+    }
+
     template <typename T>
     void Registry::addEntityProp(Address address) {
         std::unique_lock lock(_mutex);
@@ -145,8 +333,128 @@ namespace ecs {
                 result.push_back(address);
             }
         }
+        if (_orderedIteration) {
+            std::sort(result.begin(), result.end());
+        }
 
         return result;
     }
 
+    template <typename... Terms, typename Func>
+    void Registry::_forEachMatch(Func &&func) {
+        static_assert((detail::QueryTerm<Terms>::required || ...),
+                      "Registry::each requires at least one non-optional component");
+
+        constexpr std::array<bool, sizeof...(Terms)> required = {detail::QueryTerm<Terms>::required...};
+        const std::array<detail::ComponentStorage *, sizeof...(Terms)> storages = {
+            _findStorage(getComponentType<typename detail::QueryTerm<Terms>::Component>())...};
+
+        // Drive the iteration with the smallest required storage
+        detail::ComponentStorage *driver = nullptr;
+        for (size_t i = 0; i < storages.size(); ++i) {
+            if (!required[i]) {
+                continue;
+            }
+            if (!storages[i]) {
+                return;
+            }
+            if (!driver || storages[i]->size() < driver->size()) {
+                driver = storages[i];
+            }
+        }
+
+        auto visit = [&](Address address) {
+            [&]<size_t... I>(std::index_sequence<I...>) {
+                using detail::findComponent;
+                using detail::QueryTerm;
+
+                std::tuple<Address, typename QueryTerm<Terms>::Component *...> match{
+                    address, findComponent<typename QueryTerm<Terms>::Component>(storages[I], address)...};
+
+                if (((detail::QueryTerm<Terms>::required && std::get<I + 1>(match) == nullptr) || ...)) {
+                    return;
+                }
+                func(match);
+            }(std::index_sequence_for<Terms...>{});
+        };
+
+        if (!_orderedIteration) {
+            for (const auto &entry : *driver) {
+                visit(entry.first);
+            }
+            return;
+        }
+
+        std::vector<Address> addresses;
+        addresses.reserve(driver->size());
+        for (const auto &entry : *driver) {
+            addresses.push_back(entry.first);
+        }
+        std::sort(addresses.begin(), addresses.end());
+        for (const Address address : addresses) {
+            visit(address);
+        }
+    }
+
+    template <typename... Terms, typename Func>
+    void Registry::each(Func &&func) {
+        std::shared_lock lock(_mutex);
+
+        _forEachMatch<Terms...>([&](const auto &match) {
+            detail::invokeMatch<Terms...>(func, match, std::index_sequence_for<Terms...>{});
+        });
+    }
+
+    template <typename... Terms, typename Func>
+    void Registry::eachParallel(Func &&func, size_t chunkSize) {
+        using Match = std::tuple<Address, typename detail::QueryTerm<Terms>::Component *...>;
+
+        std::shared_lock lock(_mutex);
+        std::vector<Match> matches;
+        _forEachMatch<Terms...>([&](const Match &match) { matches.push_back(match); });
+
+        if (matches.empty()) {
+            return;
+        }
+
+        const size_t chunk = std::max<size_t>(chunkSize, 1);
+        const size_t chunkCount = (matches.size() + chunk - 1) / chunk;
+        const size_t workerCount =
+            std::min<size_t>(chunkCount, std::max<unsigned int>(std::thread::hardware_concurrency(), 1));
+
+        std::atomic<size_t> nextChunk{0};
+        std::exception_ptr firstError;
+        std::mutex errorMutex;
+
+        auto work = [&]() {
+            for (size_t index = nextChunk.fetch_add(1); index < chunkCount; index = nextChunk.fetch_add(1)) {
+                const size_t begin = index * chunk;
+                const size_t end = std::min(begin + chunk, matches.size());
+                try {
+                    for (size_t i = begin; i < end; ++i) {
+                        detail::invokeMatch<Terms...>(func, matches[i], std::index_sequence_for<Terms...>{});
+                    }
+                } catch (...) {
+                    std::lock_guard errorLock(errorMutex);
+                    if (!firstError) {
+                        firstError = std::current_exception();
+                    }
+                }
+            }
+        };
+
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(workerCount - 1);
+            for (size_t i = 1; i < workerCount; ++i) {
+                workers.emplace_back(work);
+            }
+            work();
+        }
+
+        if (firstError) {
+            std::rethrow_exception(firstError);
+        }
+    }
+
 };  // namespace ecs
@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** RegistrySnapshot - Saved state of a Registry for rollback
+*/
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <vector>
+#include "Registry.hpp"
+
+namespace ecs {
+    /**
+ * @class RegistrySnapshot
+ * @brief Copy of every entity and component of a Registry at one point in time.
+ *
+ * Filled by Registry::saveSnapshot() and applied by Registry::restoreSnapshot().
+ * Components are stored per type in contiguous typed columns (address and
+ * value arrays) rather than std::any map nodes, so a snapshot costs one
+ * copy per component and its buffers are reused by the next save.
+ *
+ * Keep a ring of snapshots (one per tick) to roll the world back a few
+ * ticks, re-apply corrected inputs and simulate forward again.
+ *
+ * @note The snapshot lives in memory and only restores into a registry of
+ *       the same build: it is not a serialization format.
+ */
+    class RegistrySnapshot {
+       public:
+        RegistrySnapshot() = default;
+        ~RegistrySnapshot() = default;
+
+        RegistrySnapshot(const RegistrySnapshot &) = delete;
+        RegistrySnapshot &operator=(const RegistrySnapshot &) = delete;
+        RegistrySnapshot(RegistrySnapshot &&) noexcept = default;
+        RegistrySnapshot &operator=(RegistrySnapshot &&) noexcept = default;
+
+        /**
+     * @brief Check whether a registry state was saved into this snapshot.
+     */
+        bool isValid() const { return _valid; }
+
+        /**
+     * @brief Get the number of entities saved.
+     */
+        size_t getEntityCount() const { return _entityCount; }
+
+        /**
+     * @brief Get the number of components saved, all types together.
+     */
+        size_t getComponentCount() const {
+            size_t count = 0;
+            for (const auto &column : _columns) {
+                count += column ? column->size() : 0;
+            }
+            return count;
+        }
+
+        /**
+     * @brief Forget the saved state (buffers are kept for the next save).
+     */
+        void clear() {
+            _valid = false;
+            _entityCount = 0;
+            _entities.clear();
+            for (auto &column : _columns) {
+                if (column) {
+                    column->clear();
+                }
+            }
+        }
+
+       private:
+        friend class Registry;
+
+        /**
+     * @brief Signature of one address, alive or not.
+     */
+        struct EntitySlot {
+            Signature signature;  ///< Components held by the entity
+            bool alive = false;   ///< Whether the address was in use
+        };
+
+        bool _valid = false;                ///< Set by saveSnapshot()
+        size_t _entityCount = 0;            ///< Alive slots
+        Address _nextAddress = 1;           ///< Registry address counter
+        std::vector<EntitySlot> _entities;  ///< Slots indexed by address, up to _nextAddress
+        /// Registry free address pool
+        std::priority_queue<Address, std::vector<Address>, std::greater<Address>> _freeAddresses;
+        /// Components per type (nullptr for types never saved)
+        std::array<std::unique_ptr<detail::SnapshotColumn>, N_MAX_COMPONENTS> _columns;
+    };
+}  // namespace ecs
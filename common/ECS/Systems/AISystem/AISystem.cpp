@@ -6,40 +6,184 @@
 */
 
 #include "AISystem.hpp"
+#include <algorithm>
 #include <cmath>
 #include "../../Components/IComponent.hpp"
+#include "../../Components/Player.hpp"
 #include "../../Components/Weapon.hpp"
 
 namespace ecs {
+    namespace {
+        constexpr float TWO_PI = 6.28318530718f;
+
+        /**
+         * @brief Unit-period triangle wave in [-1, 1]: 0 -> 1 -> -1 -> 0.
+         */
+        float triangleWave(float cycles) {
+            const float phase = cycles - std::floor(cycles);
+
+            if (phase < 0.25f) {
+                return 4.0f * phase;
+            }
+            if (phase < 0.75f) {
+                return 2.0f - 4.0f * phase;
+            }
+            return 4.0f * phase - 4.0f;
+        }
+
+        /**
+         * @brief Point of a cubic Bezier curve whose first point is the origin.
+         */
+        MovementPattern::Vector2 bezierPoint(const std::array<MovementPattern::Vector2, 3> &points,
+                                             float progress) {
+            const float inverse = 1.0f - progress;
+            const float weight1 = 3.0f * inverse * inverse * progress;
+            const float weight2 = 3.0f * inverse * progress * progress;
+            const float weight3 = progress * progress * progress;
+
+            return {weight1 * points[0].x + weight2 * points[1].x + weight3 * points[2].x,
+                    weight1 * points[0].y + weight2 * points[1].y + weight3 * points[2].y};
+        }
+    }  // namespace
+
     /**
      * @brief Updates all enemy AI behaviors for the current frame.
      */
     void AISystem::update(Registry &registry, float deltaTime) {
-        auto entities = registry.getEntitiesWithMask(this->getComponentMask());
+        _targets.clear();
+        registry.each<Player, Transform>([this](Address, const Player &, const Transform &transform) {
+            _targets.push_back(transform.getPosition());
+        });
 
-        for (auto entityId : entities) {
-            auto &enemy = registry.getComponent<Enemy>(entityId);
-            auto &transform = registry.getComponent<Transform>(entityId);
-            auto &velocity = registry.getComponent<Velocity>(entityId);
+        registry.each<Enemy, Transform, Velocity, Optional<MovementPattern>, Optional<Weapon>>(
+            [this, deltaTime](Address, const Enemy &, const Transform &transform, Velocity &velocity,
+                              MovementPattern *pattern, Weapon *weapon) {
+                if (pattern) {
+                    applyMovementPattern(*pattern, transform, velocity, deltaTime);
+                }
+
+                // Auto-fire for enemies with weapons
+                if (weapon) {
+                    weapon->setShouldShoot(true);
+                }
+            });
+    }
+
+    /**
+     * @brief Drives the entity velocity from its movement pattern.
+     */
+    void AISystem::applyMovementPattern(MovementPattern &pattern, const Transform &transform,
+                                        Velocity &velocity, float deltaTime) const {
+        if (deltaTime <= 0.0f) {
+            return;
+        }
+
+        const float speed = pattern.getSpeed() > 0.0f ? pattern.getSpeed() : velocity.getBaseSpeed();
+
+        if (pattern.getPatternType() == MovementPatternType::HOMING) {
+            steerHoming(pattern, transform, velocity, speed, deltaTime);
+            pattern.advance(deltaTime);
+            return;
+        }
 
-            applyMovementPattern(enemy, transform, velocity, deltaTime);
+        const float time = pattern.getElapsed();
+        const MovementPattern::Vector2 from = pathOffset(pattern, speed, time);
+        const MovementPattern::Vector2 to = pathOffset(pattern, speed, time + deltaTime);
+        const float stepX = to.x - from.x;
+        const float stepY = to.y - from.y;
+        const float distance = std::sqrt(stepX * stepX + stepY * stepY);
 
-            // Auto-fire for enemies with weapons
-            if (registry.hasComponent<Weapon>(entityId)) {
-                auto &weapon = registry.getComponent<Weapon>(entityId);
-                weapon.setShouldShoot(true);
+        if (distance > 0.0f) {
+            velocity.setDirection(stepX / distance, stepY / distance);
+            velocity.setSpeed(distance / deltaTime);
+        } else {
+            velocity.setSpeed(0.0f);
+        }
+        pattern.advance(deltaTime);
+    }
+
+    void AISystem::steerHoming(MovementPattern &pattern, const Transform &transform, Velocity &velocity,
+                               float speed, float deltaTime) const {
+        MovementPattern::Vector2 heading = pattern.getDirection();
+        if (!pattern.isStarted()) {
+            // Start from the spawn direction so enemies curve in instead of snapping
+            const Velocity::Vector2 direction = velocity.getDirection();
+            if (direction.x != 0.0f || direction.y != 0.0f) {
+                heading = {direction.x, direction.y};
             }
         }
+        const float headingLength = std::sqrt(heading.x * heading.x + heading.y * heading.y);
+        if (headingLength > 0.0f) {
+            heading = {heading.x / headingLength, heading.y / headingLength};
+        } else {
+            heading = {-1.0f, 0.0f};
+        }
+
+        const Transform::Vector2 position = transform.getPosition();
+        const Transform::Vector2 *nearest = nullptr;
+        float nearestDistance = 0.0f;
+        for (const auto &target : _targets) {
+            const float dx = target.x - position.x;
+            const float dy = target.y - position.y;
+            const float distance = dx * dx + dy * dy;
+            if (!nearest || distance < nearestDistance) {
+                nearest = &target;
+                nearestDistance = distance;
+            }
+        }
+
+        if (nearest && nearestDistance > 0.0f) {
+            const float desired = std::atan2(nearest->y - position.y, nearest->x - position.x);
+            const float current = std::atan2(heading.y, heading.x);
+            float turn = std::remainder(desired - current, TWO_PI);
+            if (pattern.getTurnRate() > 0.0f) {
+                const float maxTurn = pattern.getTurnRate() * deltaTime;
+                turn = std::clamp(turn, -maxTurn, maxTurn);
+            }
+            heading = {std::cos(current + turn), std::sin(current + turn)};
+        }
+
+        pattern.setDirection(heading.x, heading.y);
+        velocity.setDirection(heading.x, heading.y);
+        velocity.setSpeed(speed);
     }
 
-    /**
-     * @brief Applies specific movement patterns based on enemy type.
-     */
-    void AISystem::applyMovementPattern([[maybe_unused]] const Enemy &enemy,
-                                        [[maybe_unused]] Transform &transform,
-                                        [[maybe_unused]] Velocity &velocity,
-                                        [[maybe_unused]] float deltaTime) {
-        // TODO: Implement different movement patterns based on enemy type
+    MovementPattern::Vector2 AISystem::pathOffset(const MovementPattern &pattern, float speed, float time) {
+        switch (pattern.getPatternType()) {
+            case MovementPatternType::LINEAR: {
+                const MovementPattern::Vector2 direction = pattern.getDirection();
+                const float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+                if (length <= 0.0f) {
+                    return {0.0f, 0.0f};
+                }
+                const float distance = speed * time / length;
+                return {direction.x * distance, direction.y * distance};
+            }
+            case MovementPatternType::SINE: {
+                const float angle = TWO_PI * pattern.getFrequency() * time + pattern.getPhase();
+                return {-speed * time,
+                        pattern.getAmplitude() * (std::sin(angle) - std::sin(pattern.getPhase()))};
+            }
+            case MovementPatternType::ZIGZAG:
+                return {-speed * time, pattern.getAmplitude() * triangleWave(pattern.getFrequency() * time)};
+            case MovementPatternType::BEZIER: {
+                const auto &points = pattern.getControlPoints();
+                const float duration = pattern.getDuration();
+                if (duration <= 0.0f) {
+                    return points[2];
+                }
+                if (time <= duration) {
+                    return bezierPoint(points, time / duration);
+                }
+                // Past the end: keep going along the final tangent at the final speed
+                const float overtime = (time - duration) / duration;
+                return {points[2].x + 3.0f * (points[2].x - points[1].x) * overtime,
+                        points[2].y + 3.0f * (points[2].y - points[1].y) * overtime};
+            }
+            case MovementPatternType::HOMING:
+            default:
+                return {0.0f, 0.0f};
+        }
     }
 
     ComponentMask AISystem::getComponentMask() const {
@@ -7,7 +7,9 @@
 
 #pragma once
 
+#include <vector>
 #include "../../Components/Enemy.hpp"
+#include "../../Components/MovementPattern.hpp"
 #include "../../Components/Transform.hpp"
 #include "../../Components/Velocity.hpp"
 #include "../ISystem.hpp"
@@ -18,7 +20,8 @@ namespace ecs {
      * @brief System managing enemy AI behavior and attack patterns.
      * 
      * Controls enemy movement patterns and attack behaviors.
-     * Requires Enemy, Transform and Velocity components.
+     * Requires Enemy, Transform and Velocity components; enemies with a
+     * MovementPattern have their Velocity driven by it every tick.
      */
     class AISystem : public ISystem {
        public:
@@ -35,8 +38,9 @@ namespace ecs {
         /**
          * @brief Updates all enemy AI behaviors.
          * 
-         * Processes each enemy entity and applies movement patterns
-         * based on their attack pattern type.
+         * Collects player positions (homing targets), then walks every
+         * enemy once: MovementPattern entities get their Velocity set so
+         * that MovementSystem follows the pattern, armed enemies auto-fire.
          * 
          * @param registry Reference to the ECS registry
          * @param deltaTime Time elapsed since last frame (in seconds)
@@ -52,14 +56,36 @@ namespace ecs {
 
        private:
         /**
-         * @brief Applies movement pattern to an enemy entity.
-         * 
-         * @param enemy Enemy component containing pattern information
+         * @brief Sets the velocity that moves an entity along its pattern.
+         *
+         * Path patterns (linear, sine, zig-zag, bezier) are closed-form
+         * offsets from the spawn position: the velocity covers exactly the
+         * offset between the current and next pattern time, so the fixed-step
+         * integration of MovementSystem lands on the path without drift.
+         *
+         * @param pattern Movement pattern (its time is advanced)
          * @param transform Transform component for position data
          * @param velocity Velocity component to modify
          * @param deltaTime Time elapsed since last frame (in seconds)
          */
-        void applyMovementPattern(const Enemy &enemy, Transform &transform, Velocity &velocity,
-                                  float deltaTime);
+        void applyMovementPattern(MovementPattern &pattern, const Transform &transform, Velocity &velocity,
+                                  float deltaTime) const;
+
+        /**
+         * @brief Rotates a homing pattern heading toward the nearest player.
+         */
+        void steerHoming(MovementPattern &pattern, const Transform &transform, Velocity &velocity,
+                         float speed, float deltaTime) const;
+
+        /**
+         * @brief Offset from the spawn position of a path pattern at a given time.
+         * @param pattern Movement pattern
+         * @param speed Resolved travel speed
+         * @param time Pattern time in seconds
+         * @return MovementPattern::Vector2 Offset in world units.
+         */
+        static MovementPattern::Vector2 pathOffset(const MovementPattern &pattern, float speed, float time);
+
+        std::vector<Transform::Vector2> _targets;  ///< Player positions gathered this tick (homing)
     };
 }
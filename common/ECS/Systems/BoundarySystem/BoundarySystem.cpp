@@ -11,6 +11,8 @@
 #include "../../Components/IComponent.hpp"
 #include "../../Components/PendingDestroy.hpp"
 #include "../../Components/Player.hpp"
+#include "../../Components/Wall.hpp"
+#include "../MapSystem/MapSystem.hpp"
 
 namespace ecs {
     BoundarySystem::BoundarySystem(int screenWidth, int screenHeight)
@@ -29,6 +31,7 @@ namespace ecs {
     void BoundarySystem::update(Registry &registry, [[maybe_unused]] float deltaTime) {
         auto entities = registry.getEntitiesWithMask(this->getComponentMask());
         std::vector<std::uint32_t> toMarkForDestruction;
+        const float scrollOffset = MapSystem::getScrollOffset(registry);
 
         for (auto entityId : entities) {
             // Skip entities already marked for destruction
@@ -39,6 +42,11 @@ namespace ecs {
             auto &transform = registry.getComponent<Transform>(entityId);
             auto pos = transform.getPosition();
 
+            // Walls are in world coordinates: bring them into screen space
+            if (registry.hasComponent<Wall>(entityId)) {
+                pos.x -= scrollOffset;
+            }
+
             if (pos.x < -100 || pos.x > _screenWidth + 100 || pos.y < -100 || pos.y > _screenHeight + 100) {
                 // Log if it's a player being destroyed
                 if (registry.hasComponent<Player>(entityId)) {
@@ -0,0 +1,71 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** CollisionHistory
+*/
+
+#include "CollisionHistory.hpp"
+#include <algorithm>
+
+namespace ecs {
+    CollisionHistory::CollisionHistory(size_t window) : _frames(std::max<size_t>(window, 1)) {}
+
+    void CollisionHistory::setWindow(size_t window) {
+        _frames.resize(std::max<size_t>(window, 1));
+        clear();
+    }
+
+    CollisionHistory::Frame &CollisionHistory::beginFrame(std::uint64_t tick) {
+        Frame &frame = _frames[_next];
+        frame.tick = tick;
+        frame.records.clear();  // Keeps capacity: no allocation in steady state
+
+        _next = (_next + 1) % _frames.size();
+        _count = std::min(_count + 1, _frames.size());
+        _latest = tick;
+        return frame;
+    }
+
+    void CollisionHistory::endFrame() {
+        Frame &frame = _frames[(_next + _frames.size() - 1) % _frames.size()];
+        std::sort(frame.records.begin(), frame.records.end(),
+                  [](const Record &lhs, const Record &rhs) { return lhs.entity < rhs.entity; });
+    }
+
+    const CollisionHistory::Frame *CollisionHistory::find(std::uint64_t tick) const {
+        if (_count == 0 || tick > _latest || _latest - tick >= _count) {
+            return nullptr;
+        }
+        // Ticks are consecutive: the frame is as many slots behind the newest as ticks
+        const size_t back = static_cast<size_t>(_latest - tick);
+        const Frame &frame = _frames[(_next + _frames.size() - 1 - back) % _frames.size()];
+        return frame.tick == tick ? &frame : nullptr;
+    }
+
+    const CollisionHistory::Record *CollisionHistory::find(const Frame &frame, Address entity) {
+        auto it = std::lower_bound(frame.records.begin(), frame.records.end(), entity,
+                                   [](const Record &record, Address value) { return record.entity < value; });
+        return (it != frame.records.end() && it->entity == entity) ? &*it : nullptr;
+    }
+
+    bool CollisionHistory::isContinuous(Address entity, std::uint64_t fromTick) const {
+        for (std::uint64_t tick = fromTick; tick <= _latest; ++tick) {
+            const Frame *frame = find(tick);
+            if (frame == nullptr || find(*frame, entity) == nullptr) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void CollisionHistory::clear() {
+        for (Frame &frame : _frames) {
+            frame.tick = 0;
+            frame.records.clear();
+        }
+        _next = 0;
+        _count = 0;
+        _latest = 0;
+    }
+}  // namespace ecs
@@ -0,0 +1,125 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** CollisionHistory - Bounded ring buffer of past collider boxes for lag compensation
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "../../Registry.hpp"
+
+namespace ecs {
+    /**
+     * @class CollisionHistory
+     * @brief Collider boxes of hittable entities over the last N ticks.
+     *
+     * Clients render other entities an interpolation delay plus a round trip
+     * in the past. CollisionSystem records where every enemy was each tick so
+     * a player's projectile can be tested against the world as that player
+     * saw it, instead of against a present the player never saw.
+     *
+     * Memory is bounded by the window: one frame per tick is kept, the oldest
+     * frame is overwritten, and record vectors keep their capacity, so the
+     * buffer stops allocating once it has seen the largest wave.
+     */
+    class CollisionHistory {
+       public:
+        /**
+         * @brief Collider box of one entity at one tick (same space as Transform).
+         */
+        struct Record {
+            Address entity;       ///< Recorded entity
+            float left;           ///< Left edge
+            float top;            ///< Top edge
+            float right;          ///< Right edge
+            float bottom;         ///< Bottom edge
+            std::uint32_t layer;  ///< Collision layer
+            std::uint32_t mask;   ///< Collision mask
+        };
+
+        /**
+         * @brief Every recorded box of one tick, sorted by entity.
+         */
+        struct Frame {
+            std::uint64_t tick = 0;       ///< Tick the boxes were recorded at
+            std::vector<Record> records;  ///< Boxes sorted by entity address
+        };
+
+        static constexpr size_t DEFAULT_WINDOW = 20;  ///< Ticks kept (~333 ms at 60 Hz)
+
+        /**
+         * @brief Constructor.
+         * @param window Number of ticks kept (at least 1)
+         */
+        explicit CollisionHistory(size_t window = DEFAULT_WINDOW);
+
+        /**
+         * @brief Change the number of ticks kept (drops the recorded history).
+         * @param window Number of ticks kept (at least 1)
+         */
+        void setWindow(size_t window);
+
+        /**
+         * @brief Get the number of ticks kept.
+         */
+        size_t getWindow() const { return _frames.size(); }
+
+        /**
+         * @brief Get the number of ticks currently recorded.
+         */
+        size_t size() const { return _count; }
+
+        /**
+         * @brief Start recording a tick, overwriting the oldest frame once the window is full.
+         *
+         * Add the records, then call endFrame().
+         *
+         * @param tick Tick being recorded (must increase)
+         * @return Frame& Empty frame to fill
+         */
+        Frame &beginFrame(std::uint64_t tick);
+
+        /**
+         * @brief Finish the frame started by beginFrame() (sorts it for lookups).
+         */
+        void endFrame();
+
+        /**
+         * @brief Get the frame of a tick.
+         * @param tick Tick to look up
+         * @return const Frame* The frame, or nullptr if the tick is outside the window
+         */
+        const Frame *find(std::uint64_t tick) const;
+
+        /**
+         * @brief Find the box of an entity in a frame.
+         * @return const Record* The record, or nullptr if the entity was not recorded
+         */
+        static const Record *find(const Frame &frame, Address entity);
+
+        /**
+         * @brief Check that an entity was recorded at every tick from one tick to the latest.
+         *
+         * Addresses are reused: a gap means the entity was destroyed and the
+         * address now belongs to another entity, whose old boxes must not be hit.
+         *
+         * @param entity Entity address
+         * @param fromTick First tick to check
+         */
+        bool isContinuous(Address entity, std::uint64_t fromTick) const;
+
+        /**
+         * @brief Drop every recorded frame (keeps the window).
+         */
+        void clear();
+
+       private:
+        std::vector<Frame> _frames;  ///< Ring buffer, one frame per tick
+        size_t _next = 0;            ///< Frame overwritten by the next beginFrame()
+        size_t _count = 0;           ///< Frames recorded, up to the window
+        std::uint64_t _latest = 0;   ///< Tick of the newest frame
+    };
+}  // namespace ecs
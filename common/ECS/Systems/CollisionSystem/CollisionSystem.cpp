@@ -6,11 +6,13 @@
 */
 
 #include "CollisionSystem.hpp"
+#include <algorithm>
 #include "../../Components/Enemy.hpp"
 #include "../../Components/IComponent.hpp"
 #include "../../Components/OrbitalModule.hpp"
 #include "../../Components/Projectile.hpp"
 #include "../../Components/Wall.hpp"
+#include "../MapSystem/MapSystem.hpp"
 #include "common/Logger/Logger.hpp"
 
 namespace ecs {
@@ -18,9 +20,22 @@ namespace ecs {
      * @brief Performs collision detection between all collidable entities.
      */
     void CollisionSystem::update(Registry &registry, [[maybe_unused]] float deltaTime) {
+        refreshStaticGeometry(registry);
+
+        // Record where enemies are now, then find the shots that must see them as they were
+        _tick++;
+        recordHistory(registry);
+        collectRewoundShots(registry);
+
+        // Walls are static geometry: keep them out of the pairwise test
         auto entities = registry.getEntitiesWithMask(this->getComponentMask());
-        std::vector<std::uint32_t> entitiesVec(entities.begin(), entities.end());
-        std::vector<std::uint32_t> projectilesToDestroy;
+        std::vector<std::uint32_t> entitiesVec;
+        entitiesVec.reserve(entities.size());
+        for (auto entity : entities) {
+            if (!registry.hasComponent<Wall>(entity)) {
+                entitiesVec.push_back(entity);
+            }
+        }
 
         // Collect entities to destroy after collision processing
         std::vector<Address> entitiesToDestroy;
@@ -50,9 +65,6 @@ namespace ecs {
 
                 if (checkAABB(transform1.getPosition(), collider1.getSize(), collider1.getOffset(),
                               transform2.getPosition(), collider2.getSize(), collider2.getOffset())) {
-                    // Check for wall collisions
-                    bool entity1IsWall = registry.hasComponent<Wall>(entity1);
-                    bool entity2IsWall = registry.hasComponent<Wall>(entity2);
                     bool entity1IsPlayer = registry.hasComponent<Player>(entity1);
                     bool entity2IsPlayer = registry.hasComponent<Player>(entity2);
                     bool entity1IsCollectible = registry.hasComponent<Collectible>(entity1);
@@ -64,15 +76,6 @@ namespace ecs {
                     bool entity1IsProjectile = registry.hasComponent<Projectile>(entity1);
                     bool entity2IsProjectile = registry.hasComponent<Projectile>(entity2);
 
-                    // Handle Player-Wall collision: block player movement
-                    if (entity1IsPlayer && entity2IsWall) {
-                        resolveWallCollision(entity1, entity2, transform1, collider1, transform2, collider2,
-                                             registry);
-                    } else if (entity2IsPlayer && entity1IsWall) {
-                        resolveWallCollision(entity2, entity1, transform2, collider2, transform1, collider1,
-                                             registry);
-                    }
-
                     // Handle Orbital Module - Enemy collision (module damages enemy)
                     if (entity1IsOrbitalModule && entity2IsEnemy) {
                         handleModuleEnemyCollision(entity1, entity2, registry);
@@ -100,12 +103,24 @@ namespace ecs {
                         handlePickup(entity2, entity1, registry, entitiesToDestroy);
                     }
 
-                    // Handle projectile-entity collisions (damage system)
-                    handleProjectileCollision(registry, entity1, entity2, entitiesToDestroy);
+                    // Handle projectile-entity collisions (damage system); rewound shots are resolved below
+                    if (!isRewound(entity1) && !isRewound(entity2)) {
+                        handleProjectileCollision(registry, entity1, entity2, entitiesToDestroy);
+                    }
                 }
             }
         }
 
+        collideRewoundShots(registry, entitiesToDestroy);
+
+        // Dynamic vs static: players and projectiles query the wall index directly
+        if (!_staticGeometry.empty()) {
+            const float scrollOffset = MapSystem::getScrollOffset(registry);
+            for (auto entity : entitiesVec) {
+                collideWithWalls(entity, scrollOffset, registry, entitiesToDestroy);
+            }
+        }
+
         // Destroy collected entities after all collision processing
         for (Address addr : entitiesToDestroy) {
             if (registry.hasComponent<Transform>(addr)) {  // Check if still exists
@@ -291,18 +306,155 @@ namespace ecs {
         return !(right1 < left2 || left1 > right2 || bottom1 < top2 || top1 > bottom2);
     }
 
+    void CollisionSystem::refreshStaticGeometry(Registry &registry) {
+        const std::uint64_t version = registry.getStructureVersion<Wall>();
+        if (_staticGeometryValid && version == _staticGeometryVersion) {
+            return;
+        }
+
+        _staticGeometry.clear();
+        registry.each<Wall, Transform, Collider>(
+            [this](Address address, const Wall &, const Transform &transform, const Collider &collider) {
+                const Transform::Vector2 position = transform.getPosition();
+                const Collider::Vector2 size = collider.getSize();
+                const Collider::Vector2 offset = collider.getOffset();
+                const float left = position.x + offset.x - size.x / 2.0f;
+                const float top = position.y + offset.y - size.y / 2.0f;
+
+                _staticGeometry.add({address, left, top, left + size.x, top + size.y, collider.getLayer(),
+                                     collider.getMask()});
+            });
+        _staticGeometry.build();
+        _staticGeometryVersion = version;
+        _staticGeometryValid = true;
+    }
+
+    void CollisionSystem::recordHistory(Registry &registry) {
+        CollisionHistory::Frame &frame = _history.beginFrame(_tick);
+        registry.each<Enemy, Health, Transform, Collider>(
+            [&frame](Address address, const Enemy &, const Health &, const Transform &transform,
+                     const Collider &collider) {
+                const Transform::Vector2 position = transform.getPosition();
+                const Collider::Vector2 size = collider.getSize();
+                const Collider::Vector2 offset = collider.getOffset();
+                const float left = position.x + offset.x - size.x / 2.0f;
+                const float top = position.y + offset.y - size.y / 2.0f;
+
+                frame.records.push_back({address, left, top, left + size.x, top + size.y, collider.getLayer(),
+                                         collider.getMask()});
+            });
+        _history.endFrame();
+    }
+
+    void CollisionSystem::collectRewoundShots(Registry &registry) {
+        _rewoundShots.clear();
+        if (_history.size() < 2) {
+            return;  // Nothing to rewind to yet
+        }
+
+        const std::uint64_t maxRewind = _history.size() - 1;
+        registry.each<Projectile, Transform, Collider>(
+            [this, &registry, maxRewind](Address address, const Projectile &projectile, const Transform &,
+                                         const Collider &) {
+                if (!projectile.isFriendly() || !registry.hasComponent<Player>(projectile.getOwnerId())) {
+                    return;
+                }
+                const std::uint64_t rewind = std::min<std::uint64_t>(
+                    registry.getComponent<Player>(projectile.getOwnerId()).getViewDelayTicks(), maxRewind);
+                if (rewind > 0) {
+                    _rewoundShots.push_back({address, _tick - rewind});
+                }
+            });
+        std::sort(_rewoundShots.begin(), _rewoundShots.end(),
+                  [](const RewoundShot &lhs, const RewoundShot &rhs) {
+                      return lhs.projectile < rhs.projectile;
+                  });
+    }
+
+    bool CollisionSystem::isRewound(Address projectileAddr) const {
+        auto it = std::lower_bound(
+            _rewoundShots.begin(), _rewoundShots.end(), projectileAddr,
+            [](const RewoundShot &shot, Address value) { return shot.projectile < value; });
+        return it != _rewoundShots.end() && it->projectile == projectileAddr;
+    }
+
+    void CollisionSystem::collideRewoundShots(Registry &registry, std::vector<Address> &entitiesToDestroy) {
+        for (const RewoundShot &shot : _rewoundShots) {
+            const CollisionHistory::Frame *frame = _history.find(shot.tick);
+            if (frame == nullptr || !registry.hasComponent<Transform>(shot.projectile)) {
+                continue;
+            }
+
+            const Collider &collider = registry.getComponent<Collider>(shot.projectile);
+            const Transform &transform = registry.getComponent<Transform>(shot.projectile);
+            const Transform::Vector2 position = transform.getPosition();
+            const Collider::Vector2 size = collider.getSize();
+            const Collider::Vector2 offset = collider.getOffset();
+            const float left = position.x + offset.x - size.x / 2.0f;
+            const float top = position.y + offset.y - size.y / 2.0f;
+            const float right = left + size.x;
+            const float bottom = top + size.y;
+
+            for (const CollisionHistory::Record &record : frame->records) {
+                if (right < record.left || left > record.right || bottom < record.top ||
+                    top > record.bottom ||
+                    !canCollide(collider.getLayer(), collider.getMask(), record.layer, record.mask)) {
+                    continue;
+                }
+                // The enemy must still be alive, and be the same entity (addresses are reused)
+                if (!registry.hasComponent<Enemy>(record.entity) ||
+                    !_history.isContinuous(record.entity, shot.tick)) {
+                    continue;
+                }
+
+                handleProjectileCollision(registry, shot.projectile, record.entity, entitiesToDestroy);
+                if (!entitiesToDestroy.empty() && entitiesToDestroy.back() == shot.projectile) {
+                    break;  // The projectile is spent
+                }
+            }
+        }
+    }
+
+    void CollisionSystem::collideWithWalls(Address entity, float scrollOffset, Registry &registry,
+                                           std::vector<Address> &entitiesToDestroy) {
+        bool isPlayer = registry.hasComponent<Player>(entity);
+        bool isProjectile = registry.hasComponent<Projectile>(entity);
+        if ((!isPlayer && !isProjectile) || !registry.hasComponent<Transform>(entity) ||
+            !registry.hasComponent<Collider>(entity)) {
+            return;
+        }
+
+        const Collider &collider = registry.getComponent<Collider>(entity);
+        const Transform::Vector2 position = registry.getComponent<Transform>(entity).getPosition();
+        const Collider::Vector2 size = collider.getSize();
+        const Collider::Vector2 offset = collider.getOffset();
+
+        // Dynamic entities are in screen space, the index is in world space
+        const float left = position.x + scrollOffset + offset.x - size.x / 2.0f;
+        const float top = position.y + offset.y - size.y / 2.0f;
+        _staticGeometry.query(left, top, left + size.x, top + size.y, _wallHits);
+
+        for (const StaticGeometry::Box *box : _wallHits) {
+            // Skip walls destroyed earlier this tick
+            if (!registry.hasComponent<Wall>(box->wall) ||
+                !canCollide(collider.getLayer(), collider.getMask(), box->layer, box->mask)) {
+                continue;
+            }
+
+            if (isPlayer) {
+                resolveWallCollision(entity, box->wall, registry);
+            } else {
+                handleProjectileWallCollision(entity, box->wall, registry, entitiesToDestroy);
+                return;  // A projectile stops on the first wall it touches
+            }
+        }
+    }
+
     /**
      * @brief Resolves player-wall collision by instantly killing the player.
      */
-    void CollisionSystem::resolveWallCollision(Address playerAddr, Address wallAddr,
-                                               Transform &playerTransform, Collider &playerCollider,
-                                               Transform &wallTransform, Collider &wallCollider,
-                                               Registry &registry) {
+    void CollisionSystem::resolveWallCollision(Address playerAddr, Address wallAddr, Registry &registry) {
         (void)wallAddr;
-        (void)playerTransform;
-        (void)playerCollider;
-        (void)wallTransform;
-        (void)wallCollider;
 
         // Walls are instant death - deal massive damage to kill player
         LOG_INFO("[COLLISION] Player touched wall - instant death!");
@@ -314,6 +466,30 @@ namespace ecs {
         }
     }
 
+    void CollisionSystem::handleProjectileWallCollision(Address projectileAddr, Address wallAddr,
+                                                        Registry &registry,
+                                                        std::vector<Address> &entitiesToDestroy) {
+        // Skip if projectile is already marked for destruction (prevents double hits)
+        for (Address addr : entitiesToDestroy) {
+            if (addr == projectileAddr) {
+                return;
+            }
+        }
+
+        const Projectile &projectile = registry.getComponent<Projectile>(projectileAddr);
+        const Wall &wall = registry.getComponent<Wall>(wallAddr);
+
+        // Player shots wear down destructible walls, HealthSystem removes them at 0 HP
+        if (projectile.isFriendly() && wall.isDestructible() && registry.hasComponent<Health>(wallAddr)) {
+            Health &wallHealth = registry.getComponent<Health>(wallAddr);
+            wallHealth.takeDamage(static_cast<int>(projectile.getDamage()));
+            LOG_DEBUG("[PROJECTILE HIT] Projectile (E", projectileAddr, ") hit wall (E", wallAddr,
+                      "). HP: ", wallHealth.getCurrentHealth(), "/", wallHealth.getMaxHealth());
+        }
+
+        entitiesToDestroy.push_back(projectileAddr);
+    }
+
     /**
      * @brief Checks if two entities can collide based on layer masks.
      */
@@ -390,13 +566,13 @@ namespace ecs {
         if (damageApplied) {
             // Log the hit
             if (targetIsEnemy) {
-                LOG_INFO("[PROJECTILE HIT] Player projectile (E", projectileAddr, ") hit enemy (E",
-                         targetAddr, ") for ", damage, " damage. HP: ", targetHealth.getCurrentHealth(), "/",
-                         targetHealth.getMaxHealth());
+                LOG_DEBUG("[PROJECTILE HIT] Player projectile (E", projectileAddr, ") hit enemy (E",
+                          targetAddr, ") for ", damage, " damage. HP: ", targetHealth.getCurrentHealth(), "/",
+                          targetHealth.getMaxHealth());
             } else if (targetIsPlayer) {
-                LOG_INFO("[PROJECTILE HIT] Enemy projectile (E", projectileAddr, ") hit player (E",
-                         targetAddr, ") for ", damage, " damage. HP: ", targetHealth.getCurrentHealth(), "/",
-                         targetHealth.getMaxHealth());
+                LOG_DEBUG("[PROJECTILE HIT] Enemy projectile (E", projectileAddr, ") hit player (E",
+                          targetAddr, ") for ", damage, " damage. HP: ", targetHealth.getCurrentHealth(), "/",
+                          targetHealth.getMaxHealth());
             }
 
             // Mark projectile for destruction (unless it's a piercing shot)
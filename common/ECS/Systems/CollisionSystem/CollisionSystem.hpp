@@ -14,6 +14,8 @@
 #include "../../Components/Player.hpp"
 #include "../../Components/Transform.hpp"
 #include "../ISystem.hpp"
+#include "CollisionHistory.hpp"
+#include "StaticGeometry.hpp"
 
 namespace ecs {
     /**
@@ -22,6 +24,15 @@ namespace ecs {
      * 
      * Detects AABB collisions and manages layer-based filtering.
      * Requires Transform and Collider components.
+     *
+     * Walls are kept out of the pairwise test: they are indexed in a
+     * StaticGeometry, rebuilt only when walls are added or removed, that
+     * players and projectiles query directly.
+     *
+     * Lag compensation: enemy boxes are recorded every tick in a bounded
+     * CollisionHistory. A projectile fired by a player with a view delay
+     * (Player::getViewDelayTicks) is tested against the enemies where that
+     * player saw them, up to the history window.
      */
     class CollisionSystem : public ISystem {
        public:
@@ -38,7 +49,8 @@ namespace ecs {
         /**
          * @brief Detects and handles collisions between entities.
          * 
-         * Performs N² collision detection between all entities with colliders.
+         * Performs N² collision detection between all dynamic entities with
+         * colliders, then tests players and projectiles against the wall index.
          * Uses AABB (Axis-Aligned Bounding Box) collision detection and
          * layer-based filtering to determine valid collisions.
          * 
@@ -54,6 +66,29 @@ namespace ecs {
          */
         ComponentMask getComponentMask() const override;
 
+        /**
+         * @brief Set how many ticks of enemy positions are kept for lag compensation.
+         *
+         * Bounds both memory and the largest rewind; view delays beyond it
+         * are clamped. A window of 1 disables rewinding.
+         *
+         * @param ticks Number of ticks kept (drops the recorded history)
+         */
+        void setHistoryWindow(size_t ticks) { _history.setWindow(ticks); }
+
+        /**
+         * @brief Get the recorded enemy positions.
+         */
+        const CollisionHistory &getHistory() const { return _history; }
+
+        /**
+         * @brief Forces the wall index to be rebuilt by the next update.
+         *
+         * Needed only after moving or resizing an existing wall: adding and
+         * removing walls is detected through the registry.
+         */
+        void invalidateStaticGeometry() { _staticGeometryValid = false; }
+
        private:
         /**
          * @brief Checks AABB collision between two entities.
@@ -102,6 +137,28 @@ namespace ecs {
         bool canCollide(std::uint32_t layer1, std::uint32_t mask1, std::uint32_t layer2,
                         std::uint32_t mask2) const;
 
+        /**
+         * @brief Rebuilds the wall index when walls were added or removed.
+         *
+         * Compares Registry::getStructureVersion<Wall>() with the version the
+         * index was built from: walls are not visited at all while it is
+         * unchanged. Boxes are rebuilt from scratch otherwise.
+         *
+         * @param registry Reference to the ECS registry
+         */
+        void refreshStaticGeometry(Registry &registry);
+
+        /**
+         * @brief Tests a player or projectile against the wall index.
+         *
+         * @param entity Dynamic entity address
+         * @param scrollOffset World scroll offset (walls are in world coordinates)
+         * @param registry Reference to the ECS registry
+         * @param entitiesToDestroy Vector to collect entities (projectiles) that should be destroyed
+         */
+        void collideWithWalls(Address entity, float scrollOffset, Registry &registry,
+                              std::vector<Address> &entitiesToDestroy);
+
         /**
          * @brief Resolves collision between player and wall by instantly killing the player.
          * 
@@ -109,15 +166,23 @@ namespace ecs {
          * 
          * @param playerAddr Player entity address
          * @param wallAddr Wall entity address
-         * @param playerTransform Player's transform component
-         * @param playerCollider Player's collider component
-         * @param wallTransform Wall's transform component
-         * @param wallCollider Wall's collider component
          * @param registry Reference to the ECS registry
          */
-        void resolveWallCollision(Address playerAddr, Address wallAddr, Transform &playerTransform,
-                                  Collider &playerCollider, Transform &wallTransform, Collider &wallCollider,
-                                  Registry &registry);
+        void resolveWallCollision(Address playerAddr, Address wallAddr, Registry &registry);
+
+        /**
+         * @brief Stops a projectile on a wall.
+         *
+         * The projectile is destroyed; friendly projectiles also damage
+         * destructible walls that have a Health component.
+         *
+         * @param projectileAddr Projectile entity address
+         * @param wallAddr Wall entity address
+         * @param registry Reference to the ECS registry
+         * @param entitiesToDestroy Vector to collect entities that should be destroyed
+         */
+        void handleProjectileWallCollision(Address projectileAddr, Address wallAddr, Registry &registry,
+                                           std::vector<Address> &entitiesToDestroy);
 
         /**
          * @brief Handle collision between orbital module and enemy.
@@ -157,5 +222,50 @@ namespace ecs {
          */
         void handleProjectileCollision(Registry &registry, std::uint32_t entity1, std::uint32_t entity2,
                                        std::vector<Address> &entitiesToDestroy);
+
+        /**
+         * @brief Records the box of every enemy for this tick.
+         *
+         * @param registry Reference to the ECS registry
+         */
+        void recordHistory(Registry &registry);
+
+        /**
+         * @brief Finds the friendly projectiles whose shooter sees the world in the past.
+         *
+         * Fills _rewoundShots with each projectile and the tick it is tested at.
+         *
+         * @param registry Reference to the ECS registry
+         */
+        void collectRewoundShots(Registry &registry);
+
+        /**
+         * @brief Check whether a projectile is resolved against the history this tick.
+         */
+        bool isRewound(Address projectileAddr) const;
+
+        /**
+         * @brief Tests rewound projectiles against enemy boxes from their shooter's view time.
+         *
+         * @param registry Reference to the ECS registry
+         * @param entitiesToDestroy Vector to collect entities (projectiles) that should be destroyed
+         */
+        void collideRewoundShots(Registry &registry, std::vector<Address> &entitiesToDestroy);
+
+        /**
+         * @brief Projectile resolved against the history, and the tick it is tested at.
+         */
+        struct RewoundShot {
+            Address projectile;
+            std::uint64_t tick;
+        };
+
+        StaticGeometry _staticGeometry;                      ///< Wall boxes in world coordinates
+        std::uint64_t _staticGeometryVersion = 0;            ///< Wall structure version indexed
+        bool _staticGeometryValid = false;                   ///< False until built, or when invalidated
+        std::vector<const StaticGeometry::Box *> _wallHits;  ///< Reused query result
+        CollisionHistory _history;                           ///< Enemy boxes of the last ticks
+        std::vector<RewoundShot> _rewoundShots;              ///< This tick's rewound projectiles
+        std::uint64_t _tick = 0;                             ///< Updates run so far
     };
 }  // namespace ecs
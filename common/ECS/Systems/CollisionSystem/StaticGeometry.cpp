@@ -0,0 +1,46 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** StaticGeometry
+*/
+
+#include "StaticGeometry.hpp"
+#include <algorithm>
+
+namespace ecs {
+    void StaticGeometry::clear() {
+        _boxes.clear();
+        _maxWidth = 0.0f;
+    }
+
+    void StaticGeometry::add(const Box &box) {
+        _boxes.push_back(box);
+        _maxWidth = std::max(_maxWidth, box.right - box.left);
+    }
+
+    void StaticGeometry::build() {
+        std::sort(_boxes.begin(), _boxes.end(),
+                  [](const Box &lhs, const Box &rhs) { return lhs.left < rhs.left; });
+    }
+
+    /**
+     * @brief Binary search the first box that may reach the query, then scan until boxes start past it.
+     */
+    void StaticGeometry::query(float left, float top, float right, float bottom,
+                               std::vector<const Box *> &out) const {
+        out.clear();
+
+        // No box is wider than _maxWidth: anything starting before this cannot reach the query
+        const float firstLeft = left - _maxWidth;
+        auto it = std::lower_bound(_boxes.begin(), _boxes.end(), firstLeft,
+                                   [](const Box &box, float value) { return box.left < value; });
+
+        for (; it != _boxes.end() && it->left <= right; ++it) {
+            if (it->right < left || it->bottom < top || it->top > bottom) {
+                continue;
+            }
+            out.push_back(&*it);
+        }
+    }
+}  // namespace ecs
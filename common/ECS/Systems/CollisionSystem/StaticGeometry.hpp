@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** StaticGeometry - Sorted interval index of wall colliders along the scroll axis
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "../../Registry.hpp"
+
+namespace ecs {
+    /**
+     * @class StaticGeometry
+     * @brief Read-only index of wall boxes in world coordinates.
+     *
+     * Walls never move in world space (see MapSystem::getScrollOffset), so
+     * their boxes are stored once, sorted by left edge along the scroll axis.
+     * A query is a binary search followed by a short linear scan, instead of
+     * testing every wall against every dynamic entity.
+     *
+     * CollisionSystem rebuilds the index only when walls are added or
+     * removed; nothing is updated per tick.
+     */
+    class StaticGeometry {
+       public:
+        /**
+         * @brief Axis-aligned box of a wall, in world coordinates.
+         */
+        struct Box {
+            Address wall;         ///< Wall entity
+            float left;           ///< Left edge
+            float top;            ///< Top edge
+            float right;          ///< Right edge
+            float bottom;         ///< Bottom edge
+            std::uint32_t layer;  ///< Collision layer of the wall
+            std::uint32_t mask;   ///< Collision mask of the wall
+        };
+
+        /**
+         * @brief Remove every box.
+         */
+        void clear();
+
+        /**
+         * @brief Add a wall box (call build() once all boxes are added).
+         * @param box Box in world coordinates
+         */
+        void add(const Box &box);
+
+        /**
+         * @brief Sort the boxes so they can be queried.
+         */
+        void build();
+
+        /**
+         * @brief Collect the boxes overlapping a rectangle.
+         *
+         * Edges touching counts as an overlap, like CollisionSystem::checkAABB.
+         *
+         * @param left Query left edge (world coordinates)
+         * @param top Query top edge
+         * @param right Query right edge
+         * @param bottom Query bottom edge
+         * @param out Receives the overlapping boxes (cleared first)
+         */
+        void query(float left, float top, float right, float bottom, std::vector<const Box *> &out) const;
+
+        /**
+         * @brief Get the number of indexed walls.
+         */
+        size_t size() const { return _boxes.size(); }
+
+        /**
+         * @brief Check whether no wall is indexed.
+         */
+        bool empty() const { return _boxes.empty(); }
+
+       private:
+        std::vector<Box> _boxes;  ///< Boxes sorted by left edge
+        float _maxWidth = 0.0f;   ///< Widest box, bounds the backward search window
+    };
+}  // namespace ecs
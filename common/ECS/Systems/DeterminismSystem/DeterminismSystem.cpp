@@ -0,0 +1,118 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** DeterminismSystem - Fixed-point snapping of simulation state and per-tick world hash
+*/
+
+#include "DeterminismSystem.hpp"
+#include <cmath>
+#include "../MapSystem/MapSystem.hpp"
+
+namespace ecs {
+    namespace {
+        /**
+         * @brief SplitMix64 finalizer: spreads every input bit over the whole output.
+         */
+        std::uint64_t mix(std::uint64_t value) {
+            value += 0x9e3779b97f4a7c15ULL;
+            value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+            return value ^ (value >> 31);
+        }
+
+        std::uint64_t combine(std::uint64_t seed, std::int64_t value) {
+            return mix(seed ^ static_cast<std::uint64_t>(value));
+        }
+    }  // namespace
+
+    std::int64_t DeterminismSystem::toFixed(float value) {
+        return std::llround(static_cast<double>(value) * FIXED_SCALE);
+    }
+
+    float DeterminismSystem::fromFixed(std::int64_t value) {
+        return static_cast<float>(static_cast<double>(value) / FIXED_SCALE);
+    }
+
+    void DeterminismSystem::update(Registry &registry, float deltaTime) {
+        (void)deltaTime;
+
+        registry.each<Transform, Optional<Velocity>, Optional<Collider>>(
+            [](Address, Transform &transform, Velocity *velocity, Collider *collider) {
+                const Transform::Vector2 position = transform.getPosition();
+                transform.setPosition(quantize(position.x), quantize(position.y));
+
+                if (velocity) {
+                    const Velocity::Vector2 direction = velocity->getDirection();
+                    velocity->setDirection(quantize(direction.x), quantize(direction.y));
+                    velocity->setSpeed(quantize(velocity->getSpeed()));
+                }
+                if (collider) {
+                    const Collider::Vector2 size = collider->getSize();
+                    const Collider::Vector2 offset = collider->getOffset();
+                    collider->setSize(quantize(size.x), quantize(size.y));
+                    collider->setOffset(quantize(offset.x), quantize(offset.y));
+                }
+            });
+
+        _worldHash = computeWorldHash(registry);
+        _tick++;
+    }
+
+    std::uint64_t DeterminismSystem::computeWorldHash(Registry &registry) {
+        // Entity hashes are summed: the result does not depend on storage order
+        std::uint64_t sum = 0;
+        std::uint64_t count = 0;
+        registry.each<Transform, Optional<Velocity>, Optional<Collider>, Optional<Health>, Optional<Player>>(
+            [&sum, &count](Address address, const Transform &transform, const Velocity *velocity,
+                           const Collider *collider, const Health *health, const Player *player) {
+                sum += hashEntity(address, transform, velocity, collider, health, player);
+                count++;
+            });
+
+        std::uint64_t hash = combine(EMPTY_WORLD_HASH, static_cast<std::int64_t>(count));
+        hash = combine(hash, static_cast<std::int64_t>(sum));
+        return combine(hash, toFixed(MapSystem::getScrollOffset(registry)));
+    }
+
+    std::uint64_t DeterminismSystem::hashEntity(Address address, const Transform &transform,
+                                                const Velocity *velocity, const Collider *collider,
+                                                const Health *health, const Player *player) {
+        const Transform::Vector2 position = transform.getPosition();
+        std::uint64_t hash = mix(address);
+        hash = combine(hash, toFixed(position.x));
+        hash = combine(hash, toFixed(position.y));
+
+        // A tag per optional component so a missing component never hashes like a zeroed one
+        if (velocity) {
+            const Velocity::Vector2 direction = velocity->getDirection();
+            hash = combine(hash, 'V');
+            hash = combine(hash, toFixed(direction.x));
+            hash = combine(hash, toFixed(direction.y));
+            hash = combine(hash, toFixed(velocity->getSpeed()));
+        }
+        if (collider) {
+            const Collider::Vector2 size = collider->getSize();
+            hash = combine(hash, 'C');
+            hash = combine(hash, toFixed(size.x));
+            hash = combine(hash, toFixed(size.y));
+            hash = combine(hash, collider->getLayer());
+        }
+        if (health) {
+            hash = combine(hash, 'H');
+            hash = combine(hash, health->getCurrentHealth());
+            hash = combine(hash, health->getMaxHealth());
+        }
+        if (player) {
+            hash = combine(hash, 'P');
+            hash = combine(hash, player->getScore());
+            hash = combine(hash, player->getLives());
+        }
+        return hash;
+    }
+
+    ComponentMask DeterminismSystem::getComponentMask() const {
+        return (1ULL << getComponentType<Transform>());
+    }
+
+}  // namespace ecs
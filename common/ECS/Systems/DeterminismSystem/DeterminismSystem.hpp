@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** DeterminismSystem - Fixed-point snapping of simulation state and per-tick world hash
+*/
+
+#pragma once
+
+#include <cstdint>
+#include "../../Components/Collider.hpp"
+#include "../../Components/Health.hpp"
+#include "../../Components/Player.hpp"
+#include "../../Components/Transform.hpp"
+#include "../../Components/Velocity.hpp"
+#include "../ISystem.hpp"
+
+namespace ecs {
+
+    /**
+     * @class DeterminismSystem
+     * @brief Last system of a deterministic tick: snaps state to Q16.16 and hashes the world.
+     *
+     * Components keep their float storage, but at the end of every tick the
+     * Transform position, Velocity direction and speed, and Collider size and
+     * offset are rounded to the 1/65536 grid. The state carried from one
+     * tick to the next is then exactly a Q16.16 value: it round-trips
+     * losslessly through integers for rollback or replays, and the next tick
+     * starts from identical inputs on every peer.
+     *
+     * The world hash mixes the fixed-point state of every entity and sums the
+     * per-entity hashes, so it does not depend on storage iteration order.
+     * Peers comparing hashes per tick detect desyncs without exchanging the
+     * full state.
+     */
+    class DeterminismSystem : public ISystem {
+       public:
+        static constexpr int FRACTION_BITS = 16;                                  ///< Q16.16
+        static constexpr double FIXED_SCALE = 1 << FRACTION_BITS;                 ///< 1.0 in fixed-point
+        static constexpr std::uint64_t EMPTY_WORLD_HASH = 0xcbf29ce484222325ULL;  ///< Hash of no entity
+
+        DeterminismSystem() = default;
+        ~DeterminismSystem() override = default;
+
+        /**
+         * @brief Snap simulation state to fixed-point and hash the resulting world.
+         * @param registry Reference to the ECS registry
+         * @param deltaTime Unused
+         */
+        void update(Registry &registry, float deltaTime) override;
+
+        /**
+         * @brief Gets the component mask for this system.
+         * @return ComponentMask requiring Transform component
+         */
+        ComponentMask getComponentMask() const override;
+
+        /**
+         * @brief Get the world hash computed by the last update().
+         * @return std::uint64_t Hash of the world at the end of the last tick
+         */
+        std::uint64_t getWorldHash() const { return _worldHash; }
+
+        /**
+         * @brief Get the number of ticks hashed so far.
+         */
+        std::uint64_t getTick() const { return _tick; }
+
+        /**
+         * @brief Hash the current world state without modifying it.
+         *
+         * Covers Transform, Velocity, Collider, Health and Player state of
+         * every entity with a Transform, plus the map scroll offset.
+         *
+         * @param registry Reference to the ECS registry
+         * @return std::uint64_t Order-independent hash of the world
+         */
+        static std::uint64_t computeWorldHash(Registry &registry);
+
+        /**
+         * @brief Convert a float to Q16.16 (round to nearest).
+         */
+        static std::int64_t toFixed(float value);
+
+        /**
+         * @brief Convert a Q16.16 value back to float.
+         */
+        static float fromFixed(std::int64_t value);
+
+        /**
+         * @brief Round a float to the nearest Q16.16 value.
+         */
+        static float quantize(float value) { return fromFixed(toFixed(value)); }
+
+       private:
+        static std::uint64_t hashEntity(Address address, const Transform &transform, const Velocity *velocity,
+                                        const Collider *collider, const Health *health, const Player *player);
+
+        std::uint64_t _worldHash = EMPTY_WORLD_HASH;  ///< Hash after the last update
+        std::uint64_t _tick = 0;                      ///< Updates run so far
+    };
+
+}  // namespace ecs
@@ -0,0 +1,74 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** DeterministicRandom - Seeded, platform-independent random number generator
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace ecs {
+
+    /**
+     * @class DeterministicRandom
+     * @brief SplitMix64 generator producing the same sequence on every platform.
+     *
+     * Unlike std::rand or the std distributions, every value is derived with
+     * integer operations only, so two peers seeded alike draw identical
+     * numbers. Used for gameplay randomness in deterministic mode (Lua
+     * random() / randomInt()).
+     */
+    class DeterministicRandom {
+       public:
+        explicit DeterministicRandom(std::uint64_t seed = 0) : _state(seed) {}
+
+        /**
+         * @brief Restart the sequence from a seed.
+         */
+        void seed(std::uint64_t seed) { _state = seed; }
+
+        /**
+         * @brief Draw the next 64-bit value.
+         */
+        std::uint64_t next() {
+            std::uint64_t value = (_state += 0x9e3779b97f4a7c15ULL);
+            value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+            return value ^ (value >> 31);
+        }
+
+        /**
+         * @brief Draw an integer in [min, max] (returns min if max < min).
+         */
+        std::int64_t nextInt(std::int64_t min, std::int64_t max) {
+            if (max <= min) {
+                return min;
+            }
+            const std::uint64_t range = static_cast<std::uint64_t>(max) - static_cast<std::uint64_t>(min) + 1;
+            if (range == 0) {  // Full 64-bit range
+                return static_cast<std::int64_t>(next());
+            }
+            return min + static_cast<std::int64_t>(next() % range);
+        }
+
+        /**
+         * @brief Draw a float in [min, max).
+         */
+        float nextFloat(float min, float max) {
+            // 24 random bits: exactly representable, uniform over [0, 1)
+            const float unit = static_cast<float>(next() >> 40) / static_cast<float>(1 << 24);
+            return min + (max - min) * unit;
+        }
+
+        /**
+         * @brief Get the generator state (to save or restore a sequence).
+         */
+        std::uint64_t getState() const { return _state; }
+
+       private:
+        std::uint64_t _state;  ///< SplitMix64 counter
+    };
+
+}  // namespace ecs
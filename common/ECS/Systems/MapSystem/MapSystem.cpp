@@ -6,7 +6,6 @@
 */
 
 #include "MapSystem.hpp"
-#include "../../Components/Player.hpp"
 #include "common/Logger/Logger.hpp"
 
 namespace ecs {
@@ -28,14 +27,9 @@ namespace ecs {
                 continue;
             }
 
-            // Update elapsed time
+            // Update elapsed time and camera position (entities keep their coordinates)
             mapData.updateElapsedTime(deltaTime);
-
-            // Apply scrolling to all entities (except players)
-            float scrollSpeed = mapData.getScrollSpeed();
-            if (scrollSpeed > 0.0f) {
-                _applyScrolling(registry, scrollSpeed, deltaTime);
-            }
+            mapData.advanceScroll(deltaTime);
 
             // Check if map duration is reached (0 = infinite)
             float duration = mapData.getDuration();
@@ -55,24 +49,30 @@ namespace ecs {
         }
     }
 
-    void MapSystem::_applyScrolling(Registry &registry, float scrollSpeed, float deltaTime) {
-        // Get all entities with Transform component
-        ComponentMask transformMask = (1ULL << getComponentType<Transform>());
-        auto entities = registry.getEntitiesWithMask(transformMask);
+    float MapSystem::getScrollOffset(Registry &registry) {
+        float offset = 0.0f;
+        bool found = false;
 
-        // Calculate scroll offset for this frame
-        float scrollOffset = -scrollSpeed * deltaTime;
-
-        for (auto entityId : entities) {
-            // Skip player entities - they move independently
-            if (registry.hasComponent<Player>(entityId)) {
-                continue;
+        registry.each<MapData>([&offset, &found](Address, const MapData &mapData) {
+            if (!found) {
+                offset = mapData.getScrollOffset();
+                found = true;
             }
+        });
+        return offset;
+    }
 
-            auto &transform = registry.getComponent<Transform>(entityId);
-            auto pos = transform.getPosition();
-            transform.setPosition(pos.x + scrollOffset, pos.y);
-        }
+    float MapSystem::getScrollSpeed(Registry &registry) {
+        float speed = 0.0f;
+        bool found = false;
+
+        registry.each<MapData>([&speed, &found](Address, const MapData &mapData) {
+            if (!found) {
+                speed = mapData.isCompleted() ? 0.0f : mapData.getScrollSpeed();
+                found = true;
+            }
+        });
+        return speed;
     }
 
     ComponentMask MapSystem::getComponentMask() const {
@@ -18,7 +18,9 @@ namespace ecs {
      * @brief System managing map state, scrolling, and transitions.
      * 
      * Handles:
-     * - Automatic horizontal scrolling of entities based on map speed
+     * - World scroll offset (camera X) advanced by the map speed; static
+     *   geometry keeps world coordinates, moving entities drift left in
+     *   MovementSystem (see getScrollSpeed())
      * - Map duration tracking and completion detection
      * - Transition events when maps are completed
      * - Background entity management
@@ -40,9 +42,11 @@ namespace ecs {
         /**
          * @brief Updates map state and handles scrolling.
          * 
-         * - Updates elapsed time on active maps
-         * - Applies scrolling to all entities with Transform (except players)
+         * - Updates elapsed time and scroll offset on active maps
          * - Detects map completion based on duration
+         *
+         * Cost is independent of the number of entities: only MapData
+         * entities are visited.
          * 
          * @param registry Reference to the ECS registry
          * @param deltaTime Time elapsed since last frame (in seconds)
@@ -56,14 +60,30 @@ namespace ecs {
          */
         ComponentMask getComponentMask() const override;
 
-       private:
         /**
-         * @brief Apply scrolling to entities (moves them left based on map speed).
+         * @brief Get the current world scroll offset (camera X).
+         *
+         * Walls live in world coordinates: their screen-space X is
+         * worldX - offset. Boundary, collision and snapshot code use this to
+         * bring them into the screen space of every other entity.
+         *
          * @param registry Reference to the ECS registry
-         * @param scrollSpeed Horizontal scroll speed in pixels/second
-         * @param deltaTime Time elapsed since last frame
+         * @return float Offset of the first map entity, 0 if there is no map
          */
-        void _applyScrolling(Registry &registry, float scrollSpeed, float deltaTime);
+        static float getScrollOffset(Registry &registry);
+
+        /**
+         * @brief Get the speed at which the world currently scrolls.
+         *
+         * Every moving entity except players lives in screen space and
+         * drifts left at this speed on top of its own velocity, so enemies,
+         * projectiles and pickups leave the screen with the map.
+         *
+         * @param registry Reference to the ECS registry
+         * @return float Speed of the first map entity in pixels/second, 0 if
+         *         there is no map or it is completed (the offset stops too)
+         */
+        static float getScrollSpeed(Registry &registry);
     };
 
 }  // namespace ecs
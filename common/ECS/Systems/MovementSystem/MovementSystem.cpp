@@ -6,25 +6,34 @@
 */
 
 #include "MovementSystem.hpp"
+#include "../../Components/Player.hpp"
+#include "../MapSystem/MapSystem.hpp"
+#include "../PlayerRules/PlayerRules.hpp"
 
 namespace ecs {
     /**
      * @brief Applies velocity to transform positions for all moving entities.
+     *
+     * Non-player entities also drift left with the map scroll.
      */
     void MovementSystem::update(Registry &registry, float deltaTime) {
         auto entities = registry.getEntitiesWithMask(this->getComponentMask());
+        const float scrollDrift = -MapSystem::getScrollSpeed(registry) * deltaTime;
 
         for (auto entityId : entities) {
             auto &transform = registry.getComponent<Transform>(entityId);
             auto &velocity = registry.getComponent<Velocity>(entityId);
 
             auto direction = velocity.getDirection();
-            float speed = velocity.getSpeed();
             auto pos = transform.getPosition();
 
-            float newX = pos.x + direction.x * speed * deltaTime;
-            float newY = pos.y + direction.y * speed * deltaTime;
-            transform.setPosition(newX, newY);
+            // Same step as client-side prediction
+            PlayerRules::Vec2 position{pos.x, pos.y};
+            PlayerRules::integrate(position, {direction.x, direction.y}, velocity.getSpeed(), deltaTime);
+            if (scrollDrift != 0.0f && !registry.hasComponent<Player>(entityId)) {
+                position.x += scrollDrift;
+            }
+            transform.setPosition(position.x, position.y);
         }
     }
 
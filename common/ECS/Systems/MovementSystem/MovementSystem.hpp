@@ -18,6 +18,8 @@ namespace ecs {
      * @brief System handling entity movement based on velocity.
      * 
      * Updates entity positions by applying their velocity and speed.
+     * Entities other than players also move left at the map scroll speed
+     * (MapSystem::getScrollSpeed()), like the world around them.
      * Requires Transform and Velocity components.
      */
     class MovementSystem : public ISystem {
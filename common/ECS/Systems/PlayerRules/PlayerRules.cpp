@@ -0,0 +1,113 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** PlayerRules
+*/
+
+#include "PlayerRules.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace ecs::PlayerRules {
+    Vec2 moveDirection(int inputX, int inputY) {
+        float dirX = static_cast<float>(inputX);
+        float dirY = static_cast<float>(inputY);
+
+        // Normalize diagonal movement to prevent going faster diagonally
+        if (dirX != 0.0F && dirY != 0.0F) {
+            float length = std::sqrt(dirX * dirX + dirY * dirY);
+            dirX /= length;
+            dirY /= length;
+        }
+        return {dirX, dirY};
+    }
+
+    std::optional<float> stepWeapon(WeaponState &weapon, bool shootHeld, float fireRate, float chargeRate,
+                                    float deltaTime) {
+        weapon.cooldown = std::max(0.0F, weapon.cooldown - deltaTime);
+
+        if (shootHeld && weapon.cooldown <= 0.0F) {
+            // Start or continue charging
+            if (!weapon.charging) {
+                weapon.charging = true;
+                weapon.chargeLevel = 0.0F;
+            }
+            weapon.chargeLevel = std::min(weapon.chargeLevel + chargeRate * deltaTime, 1.0F);
+            return std::nullopt;
+        }
+
+        if (!shootHeld && weapon.charging) {
+            // Button released - fire
+            const float chargeLevel = weapon.chargeLevel;
+            weapon.charging = false;
+            weapon.chargeLevel = 0.0F;
+            weapon.cooldown = fireRate > 0.0F ? 1.0F / fireRate : FALLBACK_COOLDOWN;
+            return chargeLevel;
+        }
+
+        if (!shootHeld) {
+            weapon.chargeLevel = 0.0F;
+        }
+        return std::nullopt;
+    }
+
+    Shot releasedShot(float chargeLevel, float baseDamage) {
+        if (chargeLevel < CHARGE_THRESHOLD) {
+            return {baseDamage, PROJECTILE_SPEED, false};
+        }
+
+        float damageMultiplier = 1.0F + chargeLevel * 1.5F;  // Up to 2.5x at full charge
+        float speedMultiplier = 1.0F + chargeLevel * 0.5F;   // Up to 1.5x at full charge
+        return {baseDamage * damageMultiplier, PROJECTILE_SPEED * speedMultiplier, true};
+    }
+
+    int shotCount(bool multiShot, bool tripleShot, bool doubleShot) {
+        if (multiShot) {
+            return 5;  // MultiShot fires 5 projectiles in a spread
+        }
+        if (tripleShot) {
+            return 3;
+        }
+        return doubleShot ? 2 : 1;
+    }
+
+    ProjectileSpawn projectileSpawn(Vec2 shooter, bool isFriendly, float speed, int index, int count) {
+        // Friendly spawns to the right and goes right, enemy spawns to the left and goes left
+        const float baseDir = isFriendly ? 1.0F : -1.0F;
+        const Vec2 muzzle{shooter.x + baseDir * MUZZLE_OFFSET, shooter.y};
+        if (count <= 1) {
+            return {muzzle, {baseDir, 0.0F}, speed};
+        }
+
+        // Calculate angle spread based on shot count
+        float angleSpread = 0.0F;
+        float startAngle = 0.0F;
+        switch (count) {
+            case 2:                   // DoubleShot
+                angleSpread = 15.0F;  // 15 degrees apart
+                startAngle = -7.5F;   // Center the spread
+                break;
+            case 3:  // TripleShot
+                angleSpread = 15.0F;
+                startAngle = -15.0F;
+                break;
+            case 5:  // MultiShot
+                angleSpread = 15.0F;
+                startAngle = -30.0F;
+                break;
+            default:
+                angleSpread = 10.0F;
+                startAngle = -(angleSpread * (count - 1)) / 2.0F;
+                break;
+        }
+
+        float angle = startAngle + (index * angleSpread);
+        float angleRad = angle * 3.14159F / 180.0F;
+
+        // Slightly offset Y position for visual variety
+        return {{muzzle.x, muzzle.y + (index - count / 2) * 5.0F},
+                {baseDir * std::cos(angleRad), std::sin(angleRad)},
+                speed};
+    }
+}  // namespace ecs::PlayerRules
@@ -0,0 +1,150 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** PlayerRules - Player movement and weapon rules shared by the server systems and client prediction
+*/
+
+#pragma once
+
+#include <optional>
+
+namespace ecs::PlayerRules {
+    /**
+     * @brief Projectile speed of a normal shot (pixels/second).
+     */
+    inline constexpr float PROJECTILE_SPEED = 500.0F;
+
+    /**
+     * @brief Horizontal offset between a shooter and its projectiles (pixels).
+     */
+    inline constexpr float MUZZLE_OFFSET = 40.0F;
+
+    /**
+     * @brief Charge level from which a released shot is a charged shot.
+     */
+    inline constexpr float CHARGE_THRESHOLD = 0.5F;
+
+    /**
+     * @brief Charge gained per second by a player weapon (Weapon's default charge rate).
+     */
+    inline constexpr float DEFAULT_CHARGE_RATE = 1.0F;
+
+    /**
+     * @brief Cooldown after a shot when the weapon has no fire rate (7 shots/sec).
+     */
+    inline constexpr float FALLBACK_COOLDOWN = 1.0F / 7.0F;
+
+    /**
+     * @struct Vec2
+     * @brief Plain 2D vector (the rules do not depend on ECS components).
+     */
+    struct Vec2 {
+        float x = 0.0F;
+        float y = 0.0F;
+    };
+
+    /**
+     * @brief Movement direction of a player input.
+     *
+     * Diagonals are normalized so a player is not faster diagonally.
+     *
+     * @param inputX Horizontal input (-1, 0 or 1)
+     * @param inputY Vertical input (-1, 0 or 1)
+     * @return Unit direction, or (0, 0) without input
+     */
+    Vec2 moveDirection(int inputX, int inputY);
+
+    /**
+     * @brief Advance a position along a direction.
+     *
+     * The one integration step of the game: MovementSystem applies it to
+     * every entity, the client to its predicted player and projectiles.
+     *
+     * @param position Position to advance
+     * @param direction Movement direction
+     * @param speed Speed (pixels/second)
+     * @param deltaTime Simulated time (seconds, game speed included)
+     */
+    inline void integrate(Vec2 &position, Vec2 direction, float speed, float deltaTime) {
+        position.x = position.x + direction.x * speed * deltaTime;
+        position.y = position.y + direction.y * speed * deltaTime;
+    }
+
+    /**
+     * @struct WeaponState
+     * @brief Charge and cooldown state of a player weapon.
+     */
+    struct WeaponState {
+        float cooldown = 0.0F;     ///< Seconds before the weapon can charge again
+        bool charging = false;     ///< Whether the fire button is charging a shot
+        float chargeLevel = 0.0F;  ///< Charge accumulated (0.0 to 1.0)
+    };
+
+    /**
+     * @brief Advance a player weapon by one tick.
+     *
+     * Holding fire charges the weapon once its cooldown is over; releasing
+     * it fires (a charged shot from CHARGE_THRESHOLD) and restarts the
+     * cooldown.
+     *
+     * @param weapon Weapon state, updated in place
+     * @param shootHeld Whether fire is held this tick
+     * @param fireRate Shots per second (FALLBACK_COOLDOWN if not positive)
+     * @param chargeRate Charge gained per second
+     * @param deltaTime Simulated time (seconds, game speed included)
+     * @return Charge level of the shot fired this tick, if any
+     */
+    std::optional<float> stepWeapon(WeaponState &weapon, bool shootHeld, float fireRate, float chargeRate,
+                                    float deltaTime);
+
+    /**
+     * @struct Shot
+     * @brief Damage, speed and kind of a released shot.
+     */
+    struct Shot {
+        float damage;  ///< Damage of each projectile
+        float speed;   ///< Projectile speed (pixels/second)
+        bool charged;  ///< Whether the charged visuals are used
+    };
+
+    /**
+     * @brief Shot released at a charge level.
+     *
+     * Below CHARGE_THRESHOLD the shot is a normal one. Above, damage grows
+     * up to 2.5x and speed up to 1.5x at full charge.
+     *
+     * @param chargeLevel Charge level at release (0.0 to 1.0)
+     * @param baseDamage Weapon damage
+     */
+    Shot releasedShot(float chargeLevel, float baseDamage);
+
+    /**
+     * @brief Number of projectiles of a shot for the active multishot buffs (the highest wins).
+     */
+    int shotCount(bool multiShot, bool tripleShot, bool doubleShot);
+
+    /**
+     * @struct ProjectileSpawn
+     * @brief Initial position and motion of one projectile of a shot.
+     */
+    struct ProjectileSpawn {
+        Vec2 position;   ///< Spawn position
+        Vec2 direction;  ///< Unit direction
+        float speed;     ///< Speed (pixels/second)
+    };
+
+    /**
+     * @brief Spawn of the index-th projectile of a shot.
+     *
+     * A single shot goes straight ahead (right for friendly projectiles,
+     * left for enemy ones). Multishots fan out 15 degrees apart.
+     *
+     * @param shooter Position of the shooter
+     * @param isFriendly Whether the shooter is a player
+     * @param speed Projectile speed
+     * @param index Projectile index (0 to count - 1)
+     * @param count Projectiles in the shot
+     */
+    ProjectileSpawn projectileSpawn(Vec2 shooter, bool isFriendly, float speed, int index, int count);
+}  // namespace ecs::PlayerRules
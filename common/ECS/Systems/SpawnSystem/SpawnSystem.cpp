@@ -10,6 +10,7 @@
 #include "common/ECS/Components/Enemy.hpp"
 #include "common/ECS/Components/Health.hpp"
 #include "common/ECS/Components/LuaScript.hpp"
+#include "common/ECS/Components/MovementPattern.hpp"
 #include "common/ECS/Components/Spawner.hpp"
 #include "common/ECS/Components/Transform.hpp"
 #include "common/ECS/Components/Velocity.hpp"
@@ -137,6 +138,9 @@ namespace ecs {
             if (!request.scriptPath.empty()) {
                 registry.setComponent<LuaScript>(enemy, LuaScript(request.scriptPath));
             }
+            if (request.movement) {
+                registry.setComponent<MovementPattern>(enemy, *request.movement);
+            }
 
         } catch (const std::exception &e) {
             LOG_ERROR("[SpawnSystem] Failed to spawn enemy: ", e.what());
@@ -16,6 +16,7 @@
 #include "../../Components/Velocity.hpp"
 #include "../../Components/Weapon.hpp"
 #include "../ISystem.hpp"
+#include "../PlayerRules/PlayerRules.hpp"
 
 namespace ecs {
     /**
@@ -111,23 +112,16 @@ namespace ecs {
 
        private:
         /**
-         * @brief Calculate projectile initial velocity based on owner's velocity.
-         *
-         * @param baseSpeed Base projectile speed from weapon
-         * @param isFriendly Whether this is a friendly projectile (affects direction)
-         * @return Velocity component for the projectile
-         */
-        Velocity calculateProjectileVelocity(float baseSpeed, bool isFriendly);
-
-        /**
-         * @brief Calculate projectile spawn position based on owner position.
+         * @brief Spawn the projectiles of a shot (several with a multishot buff).
          *
          * @param registry Reference to the ECS registry
          * @param ownerId Entity ID of the weapon owner
-         * @param isFriendly Whether this is a friendly projectile (affects spawn offset)
-         * @return Transform component for the projectile initial position
+         * @param shot Damage, speed and kind of the shot
+         * @param isFriendly Whether this is a friendly projectile
+         * @return Address ID of the projectile, or 0 if several were spawned
          */
-        Transform calculateProjectileTransform(Registry &registry, std::uint32_t ownerId, bool isFriendly);
+        std::uint32_t fireShot(Registry &registry, std::uint32_t ownerId, const PlayerRules::Shot &shot,
+                               bool isFriendly);
 
         /**
          * @brief Create a single projectile with specified properties.
@@ -145,20 +139,6 @@ namespace ecs {
                                        const Velocity &velocity, float damage, bool isFriendly,
                                        bool isCharged);
 
-        /**
-         * @brief Fire multiple projectiles based on multishot buff.
-         * 
-         * @param registry Reference to the ECS registry
-         * @param ownerId Entity ID of the weapon owner
-         * @param damage Projectile damage
-         * @param speed Projectile speed
-         * @param isFriendly Whether projectiles are friendly
-         * @param isCharged Whether this is a charged shot
-         * @param shotCount Number of projectiles to fire
-         */
-        void fireMultipleShots(Registry &registry, std::uint32_t ownerId, float damage, float speed,
-                               bool isFriendly, bool isCharged, int shotCount);
-
         ProjectileCreatedCallback _projectileCreatedCallback;
     };
 }  // namespace ecs
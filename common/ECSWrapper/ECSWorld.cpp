@@ -151,6 +151,14 @@ namespace ecs::wrapper {
         return *_registry;
     }
 
+    void ECSWorld::saveSnapshot(RegistrySnapshot &snapshot) const {
+        _registry->saveSnapshot(snapshot);
+    }
+
+    void ECSWorld::restoreSnapshot(const RegistrySnapshot &snapshot) {
+        _registry->restoreSnapshot(snapshot);
+    }
+
     void ECSWorld::clear() {
         // Get all entity addresses and destroy them
         auto allEntities = _registry->view<>();
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "../ECS/Registry.hpp"
+#include "../ECS/RegistrySnapshot.hpp"
 #include "../ECS/Systems/ISystem.hpp"
 
 namespace ecs::wrapper {
@@ -189,7 +190,17 @@ namespace ecs::wrapper {
         /**
          * @brief Iterate over entities with specific components.
          * 
-         * @tparam Components Component types required
+         * Zero-overhead iteration built on Registry::each(): the callback is a
+         * template parameter (no std::function), no Entity vector is built and
+         * components are handed over as direct references, so there is no need
+         * to go back through Entity::has() / Entity::get().
+         * Terms wrapped in ecs::Optional<T> are passed as `T *` (nullptr if absent).
+         * 
+         * @warning The registry stays read-locked during the iteration: the callback
+         * must not create/destroy entities nor add/remove/get components through
+         * the world or the Entity handle. Collect such changes and apply them after.
+         * 
+         * @tparam Components Component types (or ecs::Optional<T>) required
          * @param callback Function to call for each matching entity
          * 
          * @code
@@ -198,8 +209,22 @@ namespace ecs::wrapper {
          * });
          * @endcode
          */
-        template <typename... Components>
-        void forEach(std::function<void(Entity, Components &...)> callback);
+        template <typename... Components, typename Func>
+        void forEach(Func &&callback);
+
+        /**
+         * @brief Parallel, chunked variant of forEach().
+         * 
+         * Entities are split into chunks processed concurrently (see
+         * Registry::eachParallel()). The callback must only touch the
+         * components it receives.
+         * 
+         * @tparam Components Component types (or ecs::Optional<T>) required
+         * @param callback Function to call for each matching entity
+         * @param chunkSize Number of entities processed per task
+         */
+        template <typename... Components, typename Func>
+        void forEachParallel(Func &&callback, size_t chunkSize = 256);
 
         // System Management
 
@@ -313,6 +338,24 @@ namespace ecs::wrapper {
          */
         const Registry &getRegistry() const;
 
+        /**
+         * @brief Save every entity and component into a snapshot (see Registry::saveSnapshot()).
+         *
+         * Only the registry is captured: state held by systems (timers,
+         * collision history) is not part of the snapshot.
+         *
+         * @param snapshot Destination, reuse it between saves
+         */
+        void saveSnapshot(RegistrySnapshot &snapshot) const;
+
+        /**
+         * @brief Roll the entities and components back to a snapshot.
+         *
+         * @param snapshot Snapshot saved from this world
+         * @throws std::runtime_error if the snapshot was never saved
+         */
+        void restoreSnapshot(const RegistrySnapshot &snapshot);
+
         /**
          * @brief World state (for accessing from Lua scripts)d
          * 0 = not running, 1 = starting event, 2 = running
@@ -71,18 +71,33 @@ namespace ecs::wrapper {
         return result;
     }
 
-    template <typename... Components>
-    void ECSWorld::forEach(std::function<void(Entity, Components &...)> callback) {
-        auto entities = query<Components...>();
+    template <typename... Components, typename Func>
+    void ECSWorld::forEach(Func &&callback) {
+        Registry *registry = _registry.get();
 
-        for (auto &entity : entities) {
+        registry->each<Components...>([&](Address address, auto &&...components) {
             try {
-                callback(entity, entity.template get<Components>()...);
+                callback(Entity(address, registry), std::forward<decltype(components)>(components)...);
             } catch (const std::exception &e) {
-                LOG_ERROR("ECSWorld::forEach - Error processing entity ", entity.getAddress(), ": ",
-                          e.what());
+                LOG_ERROR("ECSWorld::forEach - Error processing entity ", address, ": ", e.what());
             }
-        }
+        });
+    }
+
+    template <typename... Components, typename Func>
+    void ECSWorld::forEachParallel(Func &&callback, size_t chunkSize) {
+        Registry *registry = _registry.get();
+
+        registry->eachParallel<Components...>(
+            [&](Address address, auto &&...components) {
+                try {
+                    callback(Entity(address, registry), std::forward<decltype(components)>(components)...);
+                } catch (const std::exception &e) {
+                    LOG_ERROR("ECSWorld::forEachParallel - Error processing entity ", address, ": ",
+                              e.what());
+                }
+            },
+            chunkSize);
     }
 
     template <typename T>
@@ -0,0 +1,578 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** AsyncLogger - Lock-free per-thread log queues drained by a background writer
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "LogLevel.hpp"
+
+namespace logger {
+
+    /**
+     * @brief Configuration of the asynchronous logging backend
+     */
+    struct AsyncOptions {
+        std::string filePath;                        ///< Also append log lines to this file if not empty
+        bool console = true;                         ///< Write log lines to stdout
+        size_t ringCapacity = 1024;                  ///< Records per producer thread (power of two)
+        std::chrono::milliseconds flushInterval{2};  ///< Writer wake-up period when idle
+    };
+
+    namespace detail {
+
+        /**
+         * @brief Formats a record payload into text (runs on the writer thread)
+         */
+        using DecodeFn = void (*)(const std::byte *payload, std::string &out);
+
+        /**
+         * @brief One log call, stored in a ring slot until the writer formats it
+         *
+         * Arguments are not formatted by the caller: arithmetic values are
+         * copied as-is and strings as length + bytes into the inline payload,
+         * and @c decode (instantiated for the argument types) turns them into
+         * text later. Only arguments without a cheap encoding (custom types
+         * with operator<<) are stringified up front.
+         */
+        struct LogRecord {
+            static constexpr size_t PAYLOAD_SIZE = 216;
+
+            int64_t timestampNs;  ///< system_clock time of the call
+            const char *file;     ///< __FILE__ (string literal, static storage)
+            DecodeFn decode;      ///< Payload decoder for the argument types
+            int line;             ///< __LINE__
+            Level level;          ///< Severity
+            alignas(8) std::byte payload[PAYLOAD_SIZE];
+        };
+        static_assert(std::is_trivially_copyable_v<LogRecord>);
+
+        /**
+         * @brief Bounded writer over a record payload
+         */
+        struct ArgWriter {
+            std::byte *cursor;
+            std::byte *end;
+
+            bool put(const void *data, size_t size) {
+                if (static_cast<size_t>(end - cursor) < size) {
+                    return false;
+                }
+                std::memcpy(cursor, data, size);
+                cursor += size;
+                return true;
+            }
+
+            bool putString(std::string_view text) {
+                const auto length = static_cast<uint32_t>(text.size());
+                return put(&length, sizeof(length)) && put(text.data(), text.size());
+            }
+        };
+
+        /**
+         * @brief How an argument of type T is stored in the payload
+         */
+        template <typename T>
+        using StoredType = std::conditional_t<std::is_arithmetic_v<std::decay_t<T>>, std::decay_t<T>,
+                                              std::string_view>;
+
+        template <typename T>
+        bool encodeArg(ArgWriter &writer, const T &value) {
+            using Decayed = std::decay_t<T>;
+
+            if constexpr (std::is_arithmetic_v<Decayed>) {
+                return writer.put(&value, sizeof(Decayed));
+            } else if constexpr (std::is_convertible_v<const T &, std::string_view>) {
+                if constexpr (std::is_pointer_v<std::remove_cvref_t<T>>) {
+                    if (value == nullptr) {
+                        return writer.putString("(null)");
+                    }
+                }
+                return writer.putString(std::string_view(value));
+            } else {
+                std::ostringstream oss;
+                oss << value;
+                return writer.putString(oss.str());
+            }
+        }
+
+        template <typename T>
+        void appendArithmetic(std::string &out, T value) {
+            if constexpr (std::is_same_v<T, bool>) {
+                out += value ? '1' : '0';
+            } else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> ||
+                                 std::is_same_v<T, unsigned char>) {
+                out += static_cast<char>(value);
+            } else {
+                char buffer[64];
+                std::to_chars_result result;
+                if constexpr (std::is_floating_point_v<T>) {
+                    // Same output as the default ostream formatting (%g, precision 6)
+                    result =
+                        std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, 6);
+                } else {
+                    result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+                }
+                out.append(buffer, result.ptr);
+            }
+        }
+
+        template <typename Stored>
+        void decodeArg(const std::byte *&cursor, std::string &out) {
+            if constexpr (std::is_arithmetic_v<Stored>) {
+                Stored value;
+                std::memcpy(&value, cursor, sizeof(Stored));
+                cursor += sizeof(Stored);
+                appendArithmetic(out, value);
+            } else {
+                uint32_t length;
+                std::memcpy(&length, cursor, sizeof(length));
+                cursor += sizeof(length);
+                out.append(reinterpret_cast<const char *>(cursor), length);
+                cursor += length;
+            }
+        }
+
+        template <typename... Stored>
+        void decodeArgs(const std::byte *payload, std::string &out) {
+            const std::byte *cursor = payload;
+            (decodeArg<Stored>(cursor, out), ...);
+        }
+
+        /**
+         * @brief Decoder for messages too large for the payload (heap string)
+         */
+        inline void decodeOverflow(const std::byte *payload, std::string &out) {
+            std::string *text;
+            std::memcpy(&text, payload, sizeof(text));
+            std::unique_ptr<std::string> owner(text);
+            out += *owner;
+        }
+
+        /**
+         * @brief Encode the arguments of a log call into a record
+         */
+        template <typename... Args>
+        void encodeRecord(LogRecord &record, const Args &...args) {
+            ArgWriter writer{record.payload, record.payload + LogRecord::PAYLOAD_SIZE};
+
+            if ((encodeArg(writer, args) && ...)) {
+                record.decode = &decodeArgs<StoredType<Args>...>;
+                return;
+            }
+
+            // Does not fit inline: format now and hand the string over to the writer
+            std::ostringstream oss;
+            (oss << ... << args);
+            std::string *text = std::make_unique<std::string>(oss.str()).release();
+            std::memcpy(record.payload, &text, sizeof(text));
+            record.decode = &decodeOverflow;
+        }
+
+        /**
+         * @class ThreadRing
+         * @brief Single-producer / single-consumer ring of log records
+         *
+         * Owned by one logging thread (producer) and drained by the writer
+         * thread (consumer). No locks: the producer only moves @c _tail and
+         * the consumer only moves @c _head.
+         */
+        class ThreadRing {
+           public:
+            explicit ThreadRing(size_t capacity)
+                : _capacity(std::bit_ceil(std::max<size_t>(capacity, 2))),
+                  _records(std::make_unique<LogRecord[]>(_capacity)) {}
+
+            /**
+             * @brief Get the next free slot (producer), or nullptr if the ring is full
+             */
+            LogRecord *tryAcquire() {
+                const size_t tail = _tail.load(std::memory_order_relaxed);
+                if (tail - _head.load(std::memory_order_acquire) >= _capacity) {
+                    return nullptr;
+                }
+                return &_records[tail & (_capacity - 1)];
+            }
+
+            /**
+             * @brief Make the slot returned by tryAcquire() visible to the writer
+             */
+            void publish() {
+                _tail.store(_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+
+            /**
+             * @brief Hand every published record to @p func and release the slots (consumer)
+             * @return size_t Number of records consumed
+             */
+            template <typename Func>
+            size_t consume(Func &&func) {
+                const size_t head = _head.load(std::memory_order_relaxed);
+                const size_t tail = _tail.load(std::memory_order_acquire);
+                for (size_t index = head; index != tail; ++index) {
+                    func(_records[index & (_capacity - 1)]);
+                }
+                _head.store(tail, std::memory_order_release);
+                return tail - head;
+            }
+
+            bool empty() const {
+                return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+            }
+
+            std::atomic<uint64_t> dropped{0};  ///< Records lost because the ring was full
+            std::atomic<bool> orphaned{false};  ///< Owning thread has exited
+
+           private:
+            const size_t _capacity;
+            std::unique_ptr<LogRecord[]> _records;
+            alignas(64) std::atomic<size_t> _head{0};
+            alignas(64) std::atomic<size_t> _tail{0};
+        };
+
+    }  // namespace detail
+
+    /**
+     * @class AsyncLogger
+     * @brief Background log writer fed by per-thread lock-free rings
+     *
+     * Logging threads only copy their arguments into their own ring; the
+     * writer thread wakes every flushInterval, merges the rings by timestamp,
+     * formats the batch and writes it with one console/file write. A full ring
+     * drops records (counted and reported) rather than blocking the caller,
+     * except ERROR and CRITICAL ones which are then written synchronously.
+     *
+     * Used through logger::Logger (startAsync / stopAsync / flush).
+     */
+    class AsyncLogger {
+       public:
+        /**
+         * @brief Get the process-wide instance (never destroyed, usable during static teardown)
+         */
+        static AsyncLogger &instance() {
+            static AsyncLogger *logger = new AsyncLogger();
+            return *logger;
+        }
+
+        AsyncLogger(const AsyncLogger &) = delete;
+        AsyncLogger &operator=(const AsyncLogger &) = delete;
+
+        /**
+         * @brief Start the writer thread (no-op if already running)
+         */
+        void start(const AsyncOptions &options) {
+            std::lock_guard lifecycle(_lifecycleMutex);
+            if (_running.load(std::memory_order_acquire)) {
+                return;
+            }
+            _options = options;
+            _ringCapacity.store(options.ringCapacity, std::memory_order_relaxed);
+            if (!_options.filePath.empty()) {
+                _file.open(_options.filePath, std::ios::out | std::ios::app);
+                if (!_file.is_open()) {
+                    std::cerr << "[logger::AsyncLogger] Cannot open log file: " << _options.filePath
+                              << std::endl;
+                }
+            }
+            if (!_atexitRegistered) {
+                std::atexit([] { AsyncLogger::instance().stop(); });
+                _atexitRegistered = true;
+            }
+            _writer = std::jthread([this](std::stop_token stopToken) { _writerLoop(stopToken); });
+            _running.store(true, std::memory_order_release);
+        }
+
+        /**
+         * @brief Drain every pending record and stop the writer thread
+         */
+        void stop() {
+            std::lock_guard lifecycle(_lifecycleMutex);
+            if (!_running.exchange(false)) {
+                return;
+            }
+            // Callers that saw _running before the exchange may still be filling their ring
+            while (_activeProducers.load() != 0) {
+                std::this_thread::yield();
+            }
+            _writer.request_stop();
+            _wakeCv.notify_all();
+            _writer.join();
+            _drain();
+            if (_file.is_open()) {
+                _file.close();
+            }
+            std::lock_guard lock(_wakeMutex);
+            _flushCompleted = _flushRequested;
+            _flushCv.notify_all();
+        }
+
+        /**
+         * @brief Check if records are currently routed to the writer thread
+         */
+        bool isRunning() const { return _running.load(std::memory_order_acquire); }
+
+        /**
+         * @brief Enable or disable ANSI colors on console output
+         */
+        void setColors(bool enable) { _colors.store(enable, std::memory_order_relaxed); }
+
+        /**
+         * @brief Block until every record logged before this call has been written
+         */
+        void flush() {
+            if (!isRunning()) {
+                return;
+            }
+            std::unique_lock lock(_wakeMutex);
+            const uint64_t target = ++_flushRequested;
+            _wakeCv.notify_all();
+            _flushCv.wait(lock, [this, target] { return _flushCompleted >= target || !isRunning(); });
+        }
+
+        /**
+         * @brief Queue a log call on the calling thread's ring (no formatting, no lock)
+         *
+         * Written synchronously instead when the logger was stopped since the
+         * caller checked isRunning(), or when the ring is full and @p level is
+         * ERROR or above.
+         */
+        template <typename... Args>
+        void push(Level level, const char *file, int line, const Args &...args) {
+            const ProducerGuard guard(_activeProducers);
+            if (!_running.load()) {
+                _writeNow(level, file, line, true, false, args...);
+                return;
+            }
+
+            detail::ThreadRing &ring = _localRing();
+            detail::LogRecord *record = ring.tryAcquire();
+            if (record == nullptr) {
+                if (level >= Level::ERROR) {
+                    _writeNow(level, file, line, _options.console, true, args...);
+                } else {
+                    ring.dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+                return;
+            }
+
+            _stamp(*record, level, file, line);
+            detail::encodeRecord(*record, args...);
+            ring.publish();
+        }
+
+       private:
+        AsyncLogger() = default;
+
+        /**
+         * @brief Releases the ring when its thread exits; the writer drains then prunes it
+         */
+        struct RingHandle {
+            std::shared_ptr<detail::ThreadRing> ring;
+
+            ~RingHandle() {
+                if (ring) {
+                    ring->orphaned.store(true, std::memory_order_release);
+                }
+            }
+        };
+
+        /**
+         * @brief Counts a push() in progress; stop() waits for it before the final drain
+         */
+        struct ProducerGuard {
+            std::atomic<uint32_t> &count;
+
+            explicit ProducerGuard(std::atomic<uint32_t> &active) : count(active) { count.fetch_add(1); }
+            ~ProducerGuard() { count.fetch_sub(1, std::memory_order_release); }
+
+            ProducerGuard(const ProducerGuard &) = delete;
+            ProducerGuard &operator=(const ProducerGuard &) = delete;
+        };
+
+        static void _stamp(detail::LogRecord &record, Level level, const char *file, int line) {
+            const auto now = std::chrono::system_clock::now().time_since_epoch();
+            record.timestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+            record.file = file;
+            record.line = line;
+            record.level = level;
+        }
+
+        static void _appendLine(std::string &out, const detail::LogRecord &record, std::string_view message,
+                                bool colors) {
+            const std::chrono::system_clock::time_point time(
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::nanoseconds(record.timestampNs)));
+            appendPrefix(out, time, record.level, record.file, record.line, colors);
+            out += message;
+            out += '\n';
+        }
+
+        /**
+         * @brief Format and write one call on the caller's thread, bypassing the rings
+         */
+        template <typename... Args>
+        void _writeNow(Level level, const char *file, int line, bool console, bool toFile,
+                       const Args &...args) {
+            detail::LogRecord record;
+            _stamp(record, level, file, line);
+            detail::encodeRecord(record, args...);
+            std::string message;
+            record.decode(record.payload, message);
+
+            std::string text;
+            std::lock_guard lock(_outputMutex);
+            if (console) {
+                _appendLine(text, record, message, _colors.load(std::memory_order_relaxed));
+                std::cout << text << std::flush;
+            }
+            if (toFile && _file.is_open()) {
+                text.clear();
+                _appendLine(text, record, message, false);
+                _file << text << std::flush;
+            }
+        }
+
+        detail::ThreadRing &_localRing() {
+            thread_local RingHandle handle;
+            if (!handle.ring) {
+                handle.ring =
+                    std::make_shared<detail::ThreadRing>(_ringCapacity.load(std::memory_order_relaxed));
+                std::lock_guard lock(_ringsMutex);
+                _rings.push_back(handle.ring);
+            }
+            return *handle.ring;
+        }
+
+        void _writerLoop(std::stop_token stopToken) {
+            while (!stopToken.stop_requested()) {
+                uint64_t flushTarget;
+                {
+                    std::lock_guard lock(_wakeMutex);
+                    flushTarget = _flushRequested;
+                }
+
+                const size_t written = _drain();
+
+                std::unique_lock lock(_wakeMutex);
+                if (flushTarget > _flushCompleted) {
+                    _flushCompleted = flushTarget;
+                    _flushCv.notify_all();
+                }
+                if (written == 0) {
+                    _wakeCv.wait_for(lock, stopToken, _options.flushInterval,
+                                     [this] { return _flushRequested != _flushCompleted; });
+                }
+            }
+        }
+
+        /**
+         * @brief Pop all rings, merge by timestamp, format and write one batch
+         * @return size_t Number of records written
+         */
+        size_t _drain() {
+            uint64_t dropped = 0;
+            _batch.clear();
+            {
+                std::lock_guard lock(_ringsMutex);
+                for (const auto &ring : _rings) {
+                    ring->consume([this](const detail::LogRecord &record) { _batch.push_back(record); });
+                    dropped += ring->dropped.exchange(0, std::memory_order_relaxed);
+                }
+                std::erase_if(_rings, [](const auto &ring) {
+                    return ring->orphaned.load(std::memory_order_acquire) && ring->empty();
+                });
+            }
+            if (_batch.empty() && dropped == 0) {
+                return 0;
+            }
+
+            std::stable_sort(_batch.begin(), _batch.end(), [](const auto &lhs, const auto &rhs) {
+                return lhs.timestampNs < rhs.timestampNs;
+            });
+
+            const bool console = _options.console;
+            const bool toFile = _file.is_open();
+            const bool colors = _colors.load(std::memory_order_relaxed);
+            _consoleBuffer.clear();
+            _fileBuffer.clear();
+
+            for (const auto &record : _batch) {
+                _message.clear();
+                record.decode(record.payload, _message);  // Always decode once (releases overflow text)
+                if (console) {
+                    _appendLine(_consoleBuffer, record, _message, colors);
+                }
+                if (toFile) {
+                    _appendLine(_fileBuffer, record, _message, false);
+                }
+            }
+
+            if (dropped > 0) {
+                const std::string notice =
+                    "[logger] " + std::to_string(dropped) + " message(s) dropped (queue full)\n";
+                _consoleBuffer += console ? notice : "";
+                _fileBuffer += toFile ? notice : "";
+            }
+
+            std::lock_guard lock(_outputMutex);
+            if (console) {
+                std::cout.write(_consoleBuffer.data(), static_cast<std::streamsize>(_consoleBuffer.size()));
+                std::cout.flush();
+            }
+            if (toFile) {
+                _file.write(_fileBuffer.data(), static_cast<std::streamsize>(_fileBuffer.size()));
+                _file.flush();
+            }
+            return _batch.size();
+        }
+
+        AsyncOptions _options;                      ///< Written by start() only, while stopped
+        std::atomic<size_t> _ringCapacity{1024};    ///< Capacity of the rings created from now on
+        std::atomic<bool> _running{false};
+        std::atomic<uint32_t> _activeProducers{0};  ///< push() calls in progress
+        std::atomic<bool> _colors{true};
+        bool _atexitRegistered = false;
+        std::mutex _lifecycleMutex;
+
+        std::mutex _ringsMutex;
+        std::vector<std::shared_ptr<detail::ThreadRing>> _rings;
+
+        std::mutex _wakeMutex;
+        std::condition_variable_any _wakeCv;
+        std::condition_variable _flushCv;
+        uint64_t _flushRequested = 0;  ///< Guarded by _wakeMutex
+        uint64_t _flushCompleted = 0;  ///< Guarded by _wakeMutex
+
+        // Writer thread state
+        std::jthread _writer;
+        std::ofstream _file;  ///< Also written by push() (full ring) under _outputMutex
+        std::mutex _outputMutex;
+        std::vector<detail::LogRecord> _batch;
+        std::string _message;
+        std::string _consoleBuffer;
+        std::string _fileBuffer;
+    };
+
+}  // namespace logger
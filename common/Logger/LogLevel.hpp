@@ -0,0 +1,162 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** LogLevel - Log severity levels, colors and line prefix formatting
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Compile-time minimum log level (0 = DEBUG ... 4 = CRITICAL).
+ *
+ * Log macros below this level compile to nothing: their arguments are never
+ * evaluated. Defaults to INFO in release (NDEBUG) builds and DEBUG otherwise;
+ * override with -DRTYPE_LOG_MIN_LEVEL=<n> (CMake: LOG_MIN_LEVEL).
+ */
+#ifndef RTYPE_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define RTYPE_LOG_MIN_LEVEL 1
+#else
+#define RTYPE_LOG_MIN_LEVEL 0
+#endif
+#endif
+
+namespace logger {
+
+    /**
+     * @brief Log severity levels
+     */
+    enum class Level {
+        DEBUG,    // Detailed information for debugging
+        INFO,     // General informational messages
+        WARNING,  // Warning messages for potential issues
+        ERROR,    // Error messages for failures
+        CRITICAL  // Critical errors that may cause termination
+    };
+
+    /**
+     * @brief Lowest level compiled into the binary (see RTYPE_LOG_MIN_LEVEL)
+     */
+    constexpr Level COMPILED_MIN_LEVEL = static_cast<Level>(RTYPE_LOG_MIN_LEVEL);
+
+    /**
+     * @brief ANSI color codes for terminal output
+     */
+    namespace Colors {
+        constexpr const char *RESET = "\033[0m";
+        constexpr const char *LOG_GRAY = "\033[90m";
+        constexpr const char *LOG_GREEN = "\033[32m";
+        constexpr const char *LOG_YELLOW = "\033[33m";
+        constexpr const char *LOG_RED = "\033[31m";
+        constexpr const char *BOLD_RED = "\033[1;31m";
+        constexpr const char *CYAN = "\033[36m";
+        constexpr const char *BOLD_WHITE = "\033[1;37m";
+    }  // namespace Colors
+
+    /**
+     * @brief Get color for log level
+     */
+    constexpr const char *getLevelColor(Level level) {
+        switch (level) {
+            case Level::DEBUG:
+                return Colors::LOG_GRAY;
+            case Level::INFO:
+                return Colors::LOG_GREEN;
+            case Level::WARNING:
+                return Colors::LOG_YELLOW;
+            case Level::ERROR:
+                return Colors::LOG_RED;
+            case Level::CRITICAL:
+                return Colors::BOLD_RED;
+            default:
+                return Colors::RESET;
+        }
+    }
+
+    /**
+     * @brief Get string representation of log level
+     */
+    constexpr const char *getLevelString(Level level) {
+        switch (level) {
+            case Level::DEBUG:
+                return "DEBUG";
+            case Level::INFO:
+                return "INFO";
+            case Level::WARNING:
+                return "WARN";
+            case Level::ERROR:
+                return "ERROR";
+            case Level::CRITICAL:
+                return "CRIT";
+            default:
+                return "UNKNOWN";
+        }
+    }
+
+    /**
+     * @brief Extract basename from file path (no allocation)
+     */
+    constexpr std::string_view getBasename(std::string_view path) {
+        size_t pos = path.find_last_of("/\\");
+        return (pos == std::string_view::npos) ? path : path.substr(pos + 1);
+    }
+
+    /**
+     * @brief Append "[HH:MM:SS.mmm] [LEVEL] [file:line] " to a line buffer
+     *
+     * localtime() is only called when the second changes (cached per thread).
+     */
+    inline void appendPrefix(std::string &out, std::chrono::system_clock::time_point time, Level level,
+                             const char *file, int line, bool colors) {
+        thread_local std::time_t cachedSecond = -1;
+        thread_local char cachedClock[9] = {};
+
+        const std::time_t seconds = std::chrono::system_clock::to_time_t(time);
+        if (seconds != cachedSecond) {
+            std::tm timeInfo;
+#ifdef _WIN32
+            localtime_s(&timeInfo, &seconds);
+#else
+            localtime_r(&seconds, &timeInfo);
+#endif
+            std::strftime(cachedClock, sizeof(cachedClock), "%H:%M:%S", &timeInfo);
+            cachedSecond = seconds;
+        }
+        const auto ms =
+            std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count() % 1000;
+        const char millis[4] = {static_cast<char>('0' + ms / 100), static_cast<char>('0' + (ms / 10) % 10),
+                                static_cast<char>('0' + ms % 10), '\0'};
+
+        const char *resetColor = colors ? Colors::RESET : "";
+        out += colors ? Colors::BOLD_WHITE : "";
+        out += '[';
+        out += cachedClock;
+        out += '.';
+        out += millis;
+        out += ']';
+        out += resetColor;
+        out += ' ';
+        out += colors ? getLevelColor(level) : "";
+        out += '[';
+        out += getLevelString(level);
+        out += ']';
+        out += resetColor;
+        out += ' ';
+        out += colors ? Colors::CYAN : "";
+        out += '[';
+        out += getBasename(file);
+        out += ':';
+        out += std::to_string(line);
+        out += ']';
+        out += resetColor;
+        out += ' ';
+    }
+
+}  // namespace logger
@@ -7,181 +7,132 @@
 
 #pragma once
 
-#include <chrono>
-#include <ctime>
-#include <iomanip>
+#include <atomic>
 #include <iostream>
 #include <mutex>
 #include <sstream>
 #include <string>
-#include <string_view>
+#include "AsyncLogger.hpp"
+#include "LogLevel.hpp"
 
 namespace logger {
 
-    /**
-     * @brief Log severity levels
-     */
-    enum class Level {
-        DEBUG,    // Detailed information for debugging
-        INFO,     // General informational messages
-        WARNING,  // Warning messages for potential issues
-        ERROR,    // Error messages for failures
-        CRITICAL  // Critical errors that may cause termination
-    };
-
-    /**
-     * @brief ANSI color codes for terminal output
-     */
-    namespace Colors {
-        constexpr const char *RESET = "\033[0m";
-        constexpr const char *LOG_GRAY = "\033[90m";
-        constexpr const char *LOG_GREEN = "\033[32m";
-        constexpr const char *LOG_YELLOW = "\033[33m";
-        constexpr const char *LOG_RED = "\033[31m";
-        constexpr const char *BOLD_RED = "\033[1;31m";
-        constexpr const char *CYAN = "\033[36m";
-        constexpr const char *BOLD_WHITE = "\033[1;37m";
-    }  // namespace Colors
-
     /**
      * @class Logger
      * @brief Thread-safe logging system with timestamps and source location
+     *
+     * Synchronous by default (one locked write per call). After startAsync(),
+     * calls only enqueue their arguments on a per-thread ring and formatting
+     * and I/O happen on the AsyncLogger writer thread.
      */
     class Logger {
        private:
         static inline std::mutex _mutex;
-        static inline Level _minLevel = Level::DEBUG;
-        static inline bool _enableColors = true;
+        static inline std::atomic<Level> _minLevel{Level::DEBUG};
+        static inline std::atomic<bool> _enableColors{true};
 
+       public:
         /**
-         * @brief Extract basename from file path
+         * @brief Set minimum log level (messages below this level are ignored)
+         *
+         * Levels below COMPILED_MIN_LEVEL are stripped at compile time and
+         * cannot be re-enabled here.
          */
-        static std::string getBasename(const char *filePath) {
-            std::string path(filePath);
-            size_t pos = path.find_last_of("/\\");
-            return (pos == std::string::npos) ? path : path.substr(pos + 1);
-        }
+        static void setLevel(Level level) { _minLevel.store(level, std::memory_order_relaxed); }
 
         /**
-         * @brief Get current timestamp with milliseconds
+         * @brief Enable or disable colored output
          */
-        static std::string getTimestamp() {
-            auto now = std::chrono::system_clock::now();
-            auto nowTime = std::chrono::system_clock::to_time_t(now);
-            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-
-            std::tm timeInfo;
-#ifdef _WIN32
-            localtime_s(&timeInfo, &nowTime);
-#else
-            timeInfo = *std::localtime(&nowTime);
-#endif
-
-            std::ostringstream oss;
-            oss << std::put_time(&timeInfo, "%H:%M:%S");
-            oss << '.' << std::setfill('0') << std::setw(3) << ms.count();
-            return oss.str();
+        static void setColors(bool enable) {
+            _enableColors.store(enable, std::memory_order_relaxed);
+            AsyncLogger::instance().setColors(enable);
         }
 
         /**
-         * @brief Get color for log level
+         * @brief Check if a level would be logged (checked before arguments are evaluated)
          */
-        static const char *getLevelColor(Level level) {
-            if (!_enableColors)
-                return "";
-
-            switch (level) {
-                case Level::DEBUG:
-                    return Colors::LOG_GRAY;
-                case Level::INFO:
-                    return Colors::LOG_GREEN;
-                case Level::WARNING:
-                    return Colors::LOG_YELLOW;
-                case Level::ERROR:
-                    return Colors::LOG_RED;
-                case Level::CRITICAL:
-                    return Colors::BOLD_RED;
-                default:
-                    return Colors::RESET;
-            }
+        static bool isEnabled(Level level) {
+            return level >= COMPILED_MIN_LEVEL && level >= _minLevel.load(std::memory_order_relaxed);
         }
 
         /**
-         * @brief Get string representation of log level
+         * @brief Route logs through the asynchronous backend
+         *
+         * Call once at startup, before spawning worker threads.
          */
-        static const char *getLevelString(Level level) {
-            switch (level) {
-                case Level::DEBUG:
-                    return "DEBUG";
-                case Level::INFO:
-                    return "INFO";
-                case Level::WARNING:
-                    return "WARN";
-                case Level::ERROR:
-                    return "ERROR";
-                case Level::CRITICAL:
-                    return "CRIT";
-                default:
-                    return "UNKNOWN";
-            }
-        }
+        static void startAsync(const AsyncOptions &options = {}) { AsyncLogger::instance().start(options); }
 
-       public:
         /**
-         * @brief Set minimum log level (messages below this level are ignored)
+         * @brief Write every queued log and go back to synchronous logging
          */
-        static void setLevel(Level level) { _minLevel = level; }
+        static void stopAsync() { AsyncLogger::instance().stop(); }
 
         /**
-         * @brief Enable or disable colored output
+         * @brief Block until every queued log has been written (no-op when synchronous)
          */
-        static void setColors(bool enable) { _enableColors = enable; }
+        static void flush() { AsyncLogger::instance().flush(); }
 
         /**
          * @brief Log a message with source location
          */
         static void log(Level level, const char *file, int line, const std::string &message) {
-            if (level < _minLevel)
-                return;
-
-            std::lock_guard<std::mutex> lock(_mutex);
-
-            const char *levelColor = getLevelColor(level);
-            const char *resetColor = _enableColors ? Colors::RESET : "";
-            const char *fileColor = _enableColors ? Colors::CYAN : "";
-            const char *timeColor = _enableColors ? Colors::BOLD_WHITE : "";
-
-            std::ostringstream oss;
-            oss << timeColor << "[" << getTimestamp() << "]" << resetColor << " ";
-            oss << levelColor << "[" << getLevelString(level) << "]" << resetColor << " ";
-            oss << fileColor << "[" << getBasename(file) << ":" << line << "]" << resetColor << " ";
-            oss << message;
-
-            std::cout << oss.str() << std::endl;
+            logf(level, file, line, message);
         }
 
         /**
          * @brief Log a message with formatted arguments
+         *
+         * CRITICAL messages are flushed before returning, even in async mode.
          */
         template <typename... Args>
         static void logf(Level level, const char *file, int line, Args &&...args) {
-            if (level < _minLevel)
+            if (!isEnabled(level))
+                return;
+
+            AsyncLogger &async = AsyncLogger::instance();
+            if (async.isRunning()) {
+                async.push(level, file, line, args...);
+                if (level == Level::CRITICAL)
+                    async.flush();
                 return;
+            }
 
             std::ostringstream oss;
             (oss << ... << std::forward<Args>(args));
-            log(level, file, line, oss.str());
+
+            std::string text;
+            appendPrefix(text, std::chrono::system_clock::now(), level, file, line,
+                         _enableColors.load(std::memory_order_relaxed));
+            text += oss.str();
+            text += '\n';
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            std::cout << text << std::flush;
         }
     };
 
 }  // namespace logger
 
+/**
+ * @brief Log at @p level if enabled; compiled out entirely below COMPILED_MIN_LEVEL
+ *
+ * The runtime level check happens before the arguments are evaluated.
+ */
+#define LOGGER_LOG(level, ...)                                                    \
+    do {                                                                          \
+        if constexpr ((level) >= logger::COMPILED_MIN_LEVEL) {                    \
+            if (logger::Logger::isEnabled(level)) {                               \
+                logger::Logger::logf((level), __FILE__, __LINE__, __VA_ARGS__);   \
+            }                                                                     \
+        }                                                                         \
+    } while (0)
+
 // Convenience macros for logging
-#define LOG_DEBUG(...) logger::Logger::logf(logger::Level::DEBUG, __FILE__, __LINE__, __VA_ARGS__)
-#define LOG_INFO(...) logger::Logger::logf(logger::Level::INFO, __FILE__, __LINE__, __VA_ARGS__)
-#define LOG_WARNING(...) logger::Logger::logf(logger::Level::WARNING, __FILE__, __LINE__, __VA_ARGS__)
-#define LOG_ERROR(...) logger::Logger::logf(logger::Level::ERROR, __FILE__, __LINE__, __VA_ARGS__)
-#define LOG_CRITICAL(...) logger::Logger::logf(logger::Level::CRITICAL, __FILE__, __LINE__, __VA_ARGS__)
+#define LOG_DEBUG(...) LOGGER_LOG(logger::Level::DEBUG, __VA_ARGS__)
+#define LOG_INFO(...) LOGGER_LOG(logger::Level::INFO, __VA_ARGS__)
+#define LOG_WARNING(...) LOGGER_LOG(logger::Level::WARNING, __VA_ARGS__)
+#define LOG_ERROR(...) LOGGER_LOG(logger::Level::ERROR, __VA_ARGS__)
+#define LOG_CRITICAL(...) LOGGER_LOG(logger::Level::CRITICAL, __VA_ARGS__)
 
 // Short aliases
 #define LOG_D(...) LOG_DEBUG(__VA_ARGS__)
@@ -0,0 +1,35 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** InputPrediction.cpp
+*/
+
+#include "InputPrediction.hpp"
+
+namespace InputPrediction {
+    Axes readActions(std::span<const RType::Messages::Shared::Action> actions) {
+        using enum RType::Messages::Shared::Action;
+        Axes input;
+        for (auto action : actions) {
+            switch (action) {
+                case MoveUp:
+                    input.y = -1;
+                    break;
+                case MoveDown:
+                    input.y = 1;
+                    break;
+                case MoveLeft:
+                    input.x = -1;
+                    break;
+                case MoveRight:
+                    input.x = 1;
+                    break;
+                case Shoot:
+                    input.shoot = true;
+                    break;
+            }
+        }
+        return input;
+    }
+}  // namespace InputPrediction
@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** InputPrediction.hpp - Local player inputs run through the server's movement rules
+*/
+
+#pragma once
+
+#include <span>
+#include "../ECS/Systems/PlayerRules/PlayerRules.hpp"
+#include "Capnp/Messages/Shared/SharedTypes.hpp"
+
+/**
+ * @namespace InputPrediction
+ * @brief Client-side prediction of the local player from its input stream
+ *
+ * Inputs are decoded like the server's Server::_actionToInput() and
+ * applied with ecs::PlayerRules, the functions the server's GameLogic,
+ * MovementSystem and WeaponSystem call: for the same input stream the
+ * predicted and authoritative positions are bit-identical.
+ */
+namespace InputPrediction {
+    /**
+     * @struct Axes
+     * @brief Decoded player input of one tick
+     */
+    struct Axes {
+        int x = 0;           ///< Horizontal input (-1, 0 or 1)
+        int y = 0;           ///< Vertical input (-1, 0 or 1)
+        bool shoot = false;  ///< Whether fire is held
+    };
+
+    /**
+     * @brief Decode the actions of one input snapshot (later actions win, as on the server)
+     */
+    Axes readActions(std::span<const RType::Messages::Shared::Action> actions);
+
+    /**
+     * @brief Move a predicted position by one input tick
+     *
+     * @param position Position to advance
+     * @param input Input of the tick
+     * @param speed Player speed (gamerule player.speed)
+     * @param tickTime Server tick duration, game speed included
+     */
+    inline void applyMovement(ecs::PlayerRules::Vec2 &position, const Axes &input, float speed,
+                              float tickTime) {
+        if (input.x != 0 || input.y != 0) {
+            ecs::PlayerRules::integrate(position, ecs::PlayerRules::moveDirection(input.x, input.y), speed,
+                                        tickTime);
+        }
+    }
+}  // namespace InputPrediction
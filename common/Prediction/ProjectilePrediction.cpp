@@ -0,0 +1,78 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ProjectilePrediction.cpp
+*/
+
+#include "ProjectilePrediction.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Prediction {
+    void ProjectilePredictor::spawn(float x, float y, float velocityX, float velocityY) {
+        _shots.push_back(PredictedShot{x, y, velocityX, velocityY, 0.0F});
+    }
+
+    void ProjectilePredictor::advance(float deltaTime) {
+        for (PredictedShot &shot : _shots) {
+            shot.x += shot.velocityX * deltaTime;
+            shot.y += shot.velocityY * deltaTime;
+            shot.age += deltaTime;
+        }
+        std::erase_if(_shots, [](const PredictedShot &shot) { return shot.age >= MAX_AGE; });
+
+        for (Correction &correction : _corrections) {
+            correction.remaining -= deltaTime;
+        }
+        std::erase_if(_corrections,
+                      [](const Correction &correction) { return correction.remaining <= 0.0F; });
+    }
+
+    bool ProjectilePredictor::claim(uint32_t entityId, float x, float y, float velocityX, float velocityY) {
+        const float heading = std::atan2(velocityY, std::abs(velocityX));
+        for (auto it = _shots.begin(); it != _shots.end(); ++it) {
+            // Same projectile of the shot: multishot projectiles only differ by their heading
+            if ((it->velocityX >= 0.0F) != (velocityX >= 0.0F) ||
+                std::abs(std::atan2(it->velocityY, std::abs(it->velocityX)) - heading) > MATCH_ANGLE) {
+                continue;
+            }
+            // The server entity trails the prediction by up to a round trip of flight
+            const float lead = (it->velocityX >= 0.0F) ? it->x - x : x - it->x;
+            const float maxLead = std::abs(it->velocityX) * MAX_AGE + MATCH_TOLERANCE;
+            if (lead < -MATCH_TOLERANCE || lead > maxLead) {
+                continue;
+            }
+            // On the predicted line, where the shot was when it had the entity's X
+            const float behind = it->velocityX != 0.0F ? (it->x - x) / it->velocityX : 0.0F;
+            if (std::abs(it->y - it->velocityY * behind - y) > MATCH_TOLERANCE) {
+                continue;
+            }
+
+            _corrections.push_back(Correction{entityId, Offset{it->x - x, it->y - y}, CORRECTION_TIME});
+            _shots.erase(it);
+            return true;
+        }
+        return false;
+    }
+
+    ProjectilePredictor::Offset ProjectilePredictor::offsetOf(uint32_t entityId) const {
+        for (const Correction &correction : _corrections) {
+            if (correction.entityId == entityId) {
+                const float weight = correction.remaining / CORRECTION_TIME;
+                return {correction.initial.x * weight, correction.initial.y * weight};
+            }
+        }
+        return {};
+    }
+
+    void ProjectilePredictor::forget(uint32_t entityId) {
+        std::erase_if(_corrections,
+                      [entityId](const Correction &correction) { return correction.entityId == entityId; });
+    }
+
+    void ProjectilePredictor::clear() {
+        _shots.clear();
+        _corrections.clear();
+    }
+}  // namespace Prediction
@@ -0,0 +1,114 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ProjectilePrediction.hpp - Local player shots shown before the server spawns them
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @namespace Prediction
+ * @brief Client-side prediction of the local player's projectiles
+ */
+namespace Prediction {
+    /**
+     * @struct PredictedShot
+     * @brief Projectile fired locally, not yet matched with a server entity
+     */
+    struct PredictedShot {
+        float x;          ///< Position X
+        float y;          ///< Position Y
+        float velocityX;  ///< Velocity X (pixels/second of local time)
+        float velocityY;  ///< Velocity Y (pixels/second of local time)
+        float age;        ///< Seconds since it was fired
+    };
+
+    /**
+     * @class ProjectilePredictor
+     * @brief Predicted shots of the local player and their merge into server projectiles
+     *
+     * A shot is predicted when the local weapon fires (same rules as the
+     * server's WeaponSystem) and flies on its own. When the server's
+     * projectile first appears, claim() matches it with the oldest predicted
+     * shot with the same heading, on the same line: the predicted shot
+     * disappears and the server entity is drawn with a correction offset
+     * (predicted - authoritative) that fades out, so the shot does not jump
+     * back by a round trip.
+     * Unmatched shots (rejected by the server) expire after MAX_AGE.
+     */
+    class ProjectilePredictor {
+       public:
+        static constexpr float MAX_AGE = 0.5F;           ///< Unmatched shot lifetime (s), above playable RTTs
+        static constexpr float MATCH_TOLERANCE = 16.0F;  ///< Line and position tolerance of a match (px)
+        static constexpr float MATCH_ANGLE = 0.09F;      ///< Heading tolerance (rad, about 5 deg)
+        static constexpr float CORRECTION_TIME = 0.15F;  ///< Duration of the merge correction (s)
+
+        /**
+         * @struct Offset
+         * @brief Draw offset of a server projectile merged with a predicted shot
+         */
+        struct Offset {
+            float x = 0.0F;
+            float y = 0.0F;
+        };
+
+        /**
+         * @brief Start a predicted shot
+         */
+        void spawn(float x, float y, float velocityX, float velocityY);
+
+        /**
+         * @brief Move predicted shots, expire old ones and fade merge corrections
+         * @param deltaTime Local time elapsed (seconds)
+         */
+        void advance(float deltaTime);
+
+        /**
+         * @brief Match a newly replicated player projectile with a predicted shot
+         *
+         * @param entityId Server entity ID
+         * @param x Authoritative position X
+         * @param y Authoritative position Y
+         * @param velocityX Authoritative velocity X (only the heading is compared)
+         * @param velocityY Authoritative velocity Y (only the heading is compared)
+         * @return true if a predicted shot was merged into the entity
+         */
+        bool claim(uint32_t entityId, float x, float y, float velocityX, float velocityY);
+
+        /**
+         * @brief Current draw offset of a server projectile (zero when not merged)
+         */
+        [[nodiscard]] Offset offsetOf(uint32_t entityId) const;
+
+        /**
+         * @brief Drop the correction of a destroyed entity
+         */
+        void forget(uint32_t entityId);
+
+        /**
+         * @brief Drop every predicted shot and correction (new game)
+         */
+        void clear();
+
+        [[nodiscard]] const std::vector<PredictedShot> &getShots() const { return _shots; }
+        [[nodiscard]] bool hasCorrections() const { return !_corrections.empty(); }
+
+       private:
+        /**
+         * @struct Correction
+         * @brief Fading offset of a merged server projectile
+         */
+        struct Correction {
+            uint32_t entityId;
+            Offset initial;   ///< Offset when merged
+            float remaining;  ///< Seconds before the offset reaches zero
+        };
+
+        std::vector<PredictedShot> _shots;      ///< Fired, oldest first
+        std::vector<Correction> _corrections;  ///< Merged projectiles still being corrected
+    };
+}  // namespace Prediction
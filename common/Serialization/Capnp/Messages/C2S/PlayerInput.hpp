@@ -31,6 +31,7 @@ namespace RType::Messages::C2S {
         };
 
         std::vector<InputSnapshot> inputs;
+        uint32_t interpolationDelayMs = 0;  ///< Client's adaptive render delay (0 = not reported)
 
         PlayerInput() = default;
 
@@ -40,7 +41,8 @@ namespace RType::Messages::C2S {
         }
 
         // Constructor for full history
-        explicit PlayerInput(const std::vector<InputSnapshot> &history) : inputs(history) {}
+        explicit PlayerInput(const std::vector<InputSnapshot> &history, uint32_t delayMs = 0)
+            : inputs(history), interpolationDelayMs(delayMs) {}
 
         /**
          * @brief Serialize to byte vector
@@ -48,6 +50,7 @@ namespace RType::Messages::C2S {
         [[nodiscard]] std::vector<uint8_t> serialize() const {
             capnp::MallocMessageBuilder message;
             auto builder = message.initRoot<::PlayerInput>();
+            builder.setInterpolationDelayMs(interpolationDelayMs);
 
             auto inputsBuilder = builder.initInputs(static_cast<unsigned int>(inputs.size()));
 
@@ -83,6 +86,7 @@ namespace RType::Messages::C2S {
             auto reader = message.getRoot<::PlayerInput>();
 
             PlayerInput result;
+            result.interpolationDelayMs = reader.getInterpolationDelayMs();
             auto inputsReader = reader.getInputs();
 
             static constexpr size_t MAX_INPUTS_PER_PACKET = 64;  // Safety limit
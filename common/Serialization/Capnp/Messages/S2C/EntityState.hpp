@@ -25,6 +25,7 @@ namespace RType::Messages::S2C {
         uint32_t entityId;
         Shared::EntityType type;
         Shared::Vec2 position;
+        Shared::Vec2 velocity;  // pixels/second, tangent of the client's interpolation curve
         std::optional<int32_t> health;
         std::string currentAnimation;
         int32_t spriteX;
@@ -32,6 +33,7 @@ namespace RType::Messages::S2C {
         int32_t spriteW;
         int32_t spriteH;
         uint32_t lastProcessedInput = 0;  // 0 if N/A
+        uint8_t shotCount = 0;            // Players: projectiles per shot (multishot buffs), 0 if N/A
 
         EntityState()
             : entityId(0),
@@ -49,6 +51,9 @@ namespace RType::Messages::S2C {
             auto posBuilder = builder.initPosition();
             position.toCapnp(posBuilder);
 
+            auto velBuilder = builder.initVelocity();
+            velocity.toCapnp(velBuilder);
+
             builder.setHealth(health.value_or(-1));
             builder.setCurrentAnimation(currentAnimation);
             builder.setSpriteX(spriteX);
@@ -56,6 +61,7 @@ namespace RType::Messages::S2C {
             builder.setSpriteW(spriteW);
             builder.setSpriteH(spriteH);
             builder.setLastProcessedInput(lastProcessedInput);
+            builder.setShotCount(shotCount);
         }
 
         static EntityState fromCapnp(::EntityState::Reader reader) {
@@ -63,7 +69,9 @@ namespace RType::Messages::S2C {
             result.entityId = reader.getEntityId();
             result.type = Shared::fromCapnpEntityType(reader.getType());
             result.position = Shared::Vec2::fromCapnp(reader.getPosition());
+            result.velocity = Shared::Vec2::fromCapnp(reader.getVelocity());
             result.lastProcessedInput = reader.getLastProcessedInput();
+            result.shotCount = reader.getShotCount();
 
             int32_t healthValue = reader.getHealth();
             if (healthValue >= 0) {
@@ -10,6 +10,8 @@
 #include <capnp/message.h>
 #include <capnp/serialize.h>
 #include <cstdint>
+#include <cstring>
+#include <span>
 #include <vector>
 #include "EntityState.hpp"
 #include "schemas/s2c_messages.capnp.h"
@@ -21,6 +23,8 @@ namespace RType::Messages::S2C {
      * @brief Complete snapshot of the game world
      * 
      * Contains the authoritative state of all entities in the game.
+     * Walls are sent in world coordinates; their screen X is
+     * position.x - scrollOffset.
      * 
      * Usage:
      *   GameState state;
@@ -32,14 +36,23 @@ namespace RType::Messages::S2C {
        public:
         uint32_t serverTick;
         std::vector<EntityState> entities{};
+        float scrollOffset;
 
-        GameState() : serverTick(0) {}
+        GameState() : serverTick(0), scrollOffset(0.0f) {}
+
+        /// First segment size per entity (an EntityState is ~10 words with a short animation name)
+        static constexpr unsigned int WORDS_PER_ENTITY = 16;
+        /// First segment size for the root struct and list headers
+        static constexpr unsigned int HEADER_WORDS = 64;
 
         [[nodiscard]] std::vector<uint8_t> serialize() const {
-            capnp::MallocMessageBuilder message;
+            // One segment for the whole snapshot: readers then never allocate a segment table
+            const auto entityCount = static_cast<unsigned int>(entities.size());
+            capnp::MallocMessageBuilder message(entityCount * WORDS_PER_ENTITY + HEADER_WORDS);
             auto builder = message.initRoot<::GameState>();
 
             builder.setServerTick(serverTick);
+            builder.setScrollOffset(scrollOffset);
 
             auto entitiesBuilder = builder.initEntities(static_cast<unsigned int>(entities.size()));
             for (size_t i = 0; i < entities.size(); ++i) {
@@ -51,6 +64,53 @@ namespace RType::Messages::S2C {
             return std::vector<uint8_t>(byteArray.begin(), byteArray.end());
         }
 
+        /**
+         * @brief Read only the server tick of a serialized GameState.
+         *
+         * Cap'n Proto reads fields in place: the entity list is neither
+         * traversed nor copied, so this is cheap enough to run on the
+         * network thread for every received snapshot.
+         */
+        static uint32_t peekServerTick(const std::vector<uint8_t> &data) {
+            KJ_REQUIRE(data.size() % sizeof(capnp::word) == 0,
+                       "Serialized data size must be a multiple of capnp::word");
+            if (reinterpret_cast<uintptr_t>(data.data()) % alignof(capnp::word) != 0) {
+                return deserialize(data).serverTick;
+            }
+            kj::ArrayPtr<const capnp::word> words(reinterpret_cast<const capnp::word *>(data.data()),
+                                                  data.size() / sizeof(capnp::word));
+            capnp::FlatArrayMessageReader message(words);
+            return message.getRoot<::GameState>().getServerTick();
+        }
+
+        /**
+         * @brief Walk a serialized GameState in place, without building EntityState objects.
+         *
+         * The payload is copied into a caller-owned word buffer (network
+         * payloads are not word-aligned), then @p func receives the root
+         * reader, valid only during the call. Reusing the buffer across
+         * snapshots makes reading allocation-free once it has grown to the
+         * largest snapshot.
+         *
+         * @param data Serialized GameState (payload of S2C_GAME_STATE)
+         * @param buffer Scratch storage reused between calls
+         * @param func Callable taking a ::GameState::Reader
+         */
+        template <typename Func>
+        static void read(std::span<const uint8_t> data, std::vector<uint64_t> &buffer, Func &&func) {
+            KJ_REQUIRE(data.size() % sizeof(capnp::word) == 0,
+                       "Serialized data size must be a multiple of capnp::word");
+            buffer.resize(data.size() / sizeof(capnp::word));
+            if (!data.empty()) {
+                std::memcpy(buffer.data(), data.data(), data.size());
+            }
+            kj::ArrayPtr<const capnp::word> words(reinterpret_cast<const capnp::word *>(buffer.data()),
+                                                  buffer.size());
+
+            capnp::FlatArrayMessageReader message(words);
+            func(message.getRoot<::GameState>());
+        }
+
         static GameState deserialize(const std::vector<uint8_t> &data) {
             // Ensure buffer is word-aligned for Cap'n Proto (undefined behavior if not)
             KJ_REQUIRE(data.size() % sizeof(capnp::word) == 0,
@@ -70,6 +130,7 @@ namespace RType::Messages::S2C {
 
             GameState result;
             result.serverTick = reader.getServerTick();
+            result.scrollOffset = reader.getScrollOffset();
 
             auto entitiesReader = reader.getEntities();
             result.entities.reserve(entitiesReader.size());
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -145,11 +146,11 @@ namespace NetworkMessages {
     }
 
     /**
-     * @brief Get payload from packet (without header)
+     * @brief Get a view of the payload inside a packet, without copying it
      * @param packet Complete packet with header
-     * @return Payload data (or empty if invalid)
+     * @return Payload bytes (or empty if invalid), valid while the packet is
      */
-    inline std::vector<uint8_t> getPayload(const std::vector<uint8_t> &packet) {
+    inline std::span<const uint8_t> getPayloadView(const std::vector<uint8_t> &packet) {
         if (packet.size() < 6) {
             return {};
         }
@@ -173,7 +174,17 @@ namespace NetworkMessages {
             return {};
         }
 
-        return std::vector<uint8_t>(packet.begin() + 6, packet.begin() + 6 + length);
+        return std::span<const uint8_t>(packet.data() + 6, length);
+    }
+
+    /**
+     * @brief Get payload from packet (without header)
+     * @param packet Complete packet with header
+     * @return Payload data (or empty if invalid)
+     */
+    inline std::vector<uint8_t> getPayload(const std::vector<uint8_t> &packet) {
+        std::span<const uint8_t> payload = getPayloadView(packet);
+        return std::vector<uint8_t>(payload.begin(), payload.end());
     }
 
     // ============================================================================
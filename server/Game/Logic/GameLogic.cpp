@@ -31,11 +31,13 @@
 #include "common/ECS/Systems/BoundarySystem/BoundarySystem.hpp"
 #include "common/ECS/Systems/BuffSystem/BuffSystem.hpp"
 #include "common/ECS/Systems/CollisionSystem/CollisionSystem.hpp"
+#include "common/ECS/Systems/DeterminismSystem/DeterminismSystem.hpp"
 #include "common/ECS/Systems/HealthSystem/HealthSystem.hpp"
 #include "common/ECS/Systems/ISystem.hpp"
 #include "common/ECS/Systems/MapSystem/MapSystem.hpp"
 #include "common/ECS/Systems/MovementSystem/MovementSystem.hpp"
 #include "common/ECS/Systems/OrbitalSystem/OrbitalSystem.hpp"
+#include "common/ECS/Systems/PlayerRules/PlayerRules.hpp"
 #include "common/ECS/Systems/SpawnSystem/SpawnSystem.hpp"
 #include "common/ECS/Systems/WeaponSystem/WeaponSystem.hpp"
 #include "common/Logger/Logger.hpp"
@@ -98,6 +100,8 @@ namespace server {
             _world->createSystem<ecs::AnimationSystem>("AnimationSystem");
             _world->createSystem<ecs::MapSystem>("MapSystem");
             _world->createSystem<ecs::CollisionSystem>("CollisionSystem");
+            _world->getSystem<ecs::CollisionSystem>("CollisionSystem")
+                ->setHistoryWindow(_gameRules.getLagCompensationWindowTicks());
             _world->createSystem<ecs::BuffSystem>("BuffSystem");
             _world->createSystem<ecs::HealthSystem>("HealthSystem");
 
@@ -114,7 +118,7 @@ namespace server {
             _world->createSystem<ecs::WeaponSystem>("WeaponSystem");
 
             LOG_INFO("✓ All systems registered (", _world->getSystemCount(), " systems)");
-            if (_threadPool) {
+            if (_threadPool && !_deterministic) {
                 LOG_INFO("✓ Systems will execute in parallel mode (4 groups)");
             } else {
                 LOG_INFO("✓ Systems will execute sequentially");
@@ -165,6 +169,26 @@ namespace server {
         _checkGameOverCondition();  // Check BEFORE cleaning up dead entities
 
         _cleanupDeadEntities();
+
+        // Hash the state the next tick starts from
+        if (_deterministic) {
+            _deterministic->update(_world->getRegistry(), deltaTime);
+        }
+    }
+
+    void GameLogic::setDeterministic(uint64_t seed) {
+        if (_initialized) {
+            LOG_WARNING("GameLogic: deterministic mode must be enabled before initialize()");
+            return;
+        }
+        _deterministic = std::make_unique<ecs::DeterminismSystem>();
+        _world->getRegistry().setOrderedIteration(true);
+        _luaEngine->setDeterministic(seed);
+        LOG_INFO("GameLogic: deterministic mode enabled (seed ", seed, ")");
+    }
+
+    uint64_t GameLogic::getWorldHash() const {
+        return _deterministic ? _deterministic->getWorldHash() : 0;
     }
 
     uint32_t GameLogic::spawnPlayer(uint32_t playerId, const std::string &playerName) {
@@ -272,7 +296,18 @@ namespace server {
     void GameLogic::_processInput() {
         std::scoped_lock lock(_inputMutex);
 
-        for (auto &[playerId, inputs] : _pendingInput) {
+        // Projectiles spawned by shots take the next entity addresses: apply players in a fixed order
+        std::vector<uint32_t> playerIds;
+        playerIds.reserve(_pendingInput.size());
+        for (const auto &[playerId, inputs] : _pendingInput) {
+            playerIds.push_back(playerId);
+        }
+        if (_deterministic) {
+            std::sort(playerIds.begin(), playerIds.end());
+        }
+
+        for (const uint32_t playerId : playerIds) {
+            std::deque<PlayerInput> &inputs = _pendingInput[playerId];
             if (inputs.empty()) {
                 continue;
             }
@@ -294,7 +329,51 @@ namespace server {
                 _applyPlayerInput(playerId, input);
                 inputs.pop_front();
             }
+            _updateViewDelay(playerId);
+        }
+    }
+
+    void GameLogic::updatePlayerLatency(uint32_t playerId, uint32_t roundTripMs,
+                                        uint32_t interpolationDelayMs) {
+        std::scoped_lock lock(_inputMutex);
+        PlayerLatency &latency = _latency[playerId];
+        latency.roundTripMs = roundTripMs;
+        if (interpolationDelayMs != 0) {
+            latency.interpolationDelayMs = interpolationDelayMs;
+        }
+    }
+
+    void GameLogic::_updateViewDelay(uint32_t playerId) {
+        auto entityIt = _playerMap.find(playerId);
+        auto latencyIt = _latency.find(playerId);
+        if (entityIt == _playerMap.end() || latencyIt == _latency.end()) {
+            return;
+        }
+
+        ecs::Registry &registry = _world->getRegistry();
+        if (!registry.hasComponent<ecs::Player>(entityIt->second)) {
+            return;
+        }
+
+        // Inputs still queued behind the applied one: it waited that long in the jitter buffer. The
+        // client sends one input per fixed step, so each queued input stands for one input period.
+        size_t buffered = 0;
+        auto pendingIt = _pendingInput.find(playerId);
+        if (pendingIt != _pendingInput.end()) {
+            buffered = pendingIt->second.size();
         }
+        const float inputPeriodMs = 1000.0f / static_cast<float>(_gameRules.getClientInputRateHz());
+
+        // The client's adaptive delay when it reported one, the nominal delay otherwise
+        const PlayerLatency &latency = latencyIt->second;
+        const uint32_t renderDelayMs = latency.interpolationDelayMs != 0
+                                           ? latency.interpolationDelayMs
+                                           : _gameRules.getClientInterpolationDelayMs();
+        const float delayMs = static_cast<float>(latency.roundTripMs + renderDelayMs) +
+                              static_cast<float>(buffered) * inputPeriodMs;
+        const auto delayTicks = static_cast<uint32_t>(std::lround(delayMs / (FIXED_TIMESTEP * 1000.0f)));
+
+        registry.getComponent<ecs::Player>(entityIt->second).setViewDelayTicks(delayTicks);
     }
 
     void GameLogic::_applyPlayerInput(uint32_t playerId, const PlayerInput &input) {
@@ -320,6 +399,8 @@ namespace server {
 
             // Update animation based on movement
             if (entity.has<ecs::Animation>()) {
+                static const ecs::ClipId idleClip = ecs::AnimationClipRegistry::intern("player_idle");
+                static const ecs::ClipId movementClip = ecs::AnimationClipRegistry::intern("player_movement");
                 ecs::Animation &anim = entity.get<ecs::Animation>();
 
                 // If no input (0, 0), stop the player and play idle animation
@@ -327,53 +408,35 @@ namespace server {
                     vel.setDirection(0.0f, 0.0f);
 
                     // Switch to idle animation if currently moving
-                    if (anim.getCurrentClipName() != "player_idle") {
-                        anim.setCurrentClipName("player_idle");
+                    if (anim.getCurrentClipId() != idleClip) {
+                        anim.setCurrentClipId(idleClip);
                         anim.setCurrentFrameIndex(0);
                         anim.setTimer(0.0f);
                     }
                 } else {
-                    // Normalize diagonal movement
-                    float dirX = static_cast<float>(input.inputX);
-                    float dirY = static_cast<float>(input.inputY);
-
-                    // Normalize if diagonal
-                    if (dirX != 0.0f && dirY != 0.0f) {
-                        float length = std::sqrt(dirX * dirX + dirY * dirY);
-                        dirX /= length;
-                        dirY /= length;
-                    }
-
-                    vel.setDirection(dirX, dirY);
+                    // Normalized like the client's prediction (MovementSystem applies it this tick)
+                    const ecs::PlayerRules::Vec2 direction =
+                        ecs::PlayerRules::moveDirection(input.inputX, input.inputY);
+                    vel.setDirection(direction.x, direction.y);
 
                     // Switch to movement animation if currently idle
-                    if (anim.getCurrentClipName() != "player_movement") {
-                        anim.setCurrentClipName("player_movement");
+                    if (anim.getCurrentClipId() != movementClip) {
+                        anim.setCurrentClipId(movementClip);
                         anim.setCurrentFrameIndex(0);
                         anim.setTimer(0.0f);
                     }
                 }
             } else {
                 // Fallback if no Animation component (shouldn't happen for players)
-                // Normalize diagonal movement
-                float dirX = static_cast<float>(input.inputX);
-                float dirY = static_cast<float>(input.inputY);
-
-                // Normalize if diagonal
-                if (dirX != 0.0f && dirY != 0.0f) {
-                    float length = std::sqrt(dirX * dirX + dirY * dirY);
-                    dirX /= length;
-                    dirY /= length;
-                }
-
                 // CRITICAL: Apply movement directly here to match client-side prediction
                 // The client predicts movement per-input at FIXED_TIMESTEP rate
                 // We must do the same to stay synchronized
-                float speed = vel.getSpeed();
                 auto pos = transform.getPosition();
-                float newX = pos.x + dirX * speed * FIXED_TIMESTEP;
-                float newY = pos.y + dirY * speed * FIXED_TIMESTEP;
-                transform.setPosition(newX, newY);
+                ecs::PlayerRules::Vec2 position{pos.x, pos.y};
+                ecs::PlayerRules::integrate(position,
+                                            ecs::PlayerRules::moveDirection(input.inputX, input.inputY),
+                                            vel.getSpeed(), FIXED_TIMESTEP);
+                transform.setPosition(position.x, position.y);
 
                 // Keep velocity direction at (0,0) so MovementSystem doesn't apply additional movement
                 // Player movement is entirely controlled by input processing, not by MovementSystem
@@ -400,8 +463,8 @@ namespace server {
     }
 
     void GameLogic::_executeSystems(float deltaTime) {
-        if (!_threadPool) {
-            // Sequential execution (no ThreadPool)
+        if (!_threadPool || _deterministic) {
+            // Sequential execution (no ThreadPool, or a fixed order is required)
             _world->update(deltaTime);
             return;
         }
@@ -409,8 +472,8 @@ namespace server {
         // Parallel execution with ThreadPool
         // Group systems by dependency - systems in the same group can run in parallel
 
-        // Group 1: Independent systems (can run in parallel)
-        std::vector<std::string> group1 = {"MovementSystem", "OrbitalSystem"};
+        // Group 1: Independent systems (can run in parallel; MapSystem only touches MapData)
+        std::vector<std::string> group1 = {"MovementSystem", "OrbitalSystem", "MapSystem"};
 
         // Group 2: Animation must run after Movement to update sprite frames
         std::vector<std::string> group2 = {"AnimationSystem"};
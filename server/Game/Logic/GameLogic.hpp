@@ -25,7 +25,8 @@ namespace scripting {
 
 namespace ecs {
     class ISystem;
-}
+    class DeterminismSystem;
+}  // namespace ecs
 
 namespace server {
     class ThreadPool;
@@ -81,6 +82,9 @@ namespace server {
             return (it != _lastAppliedSequenceId.end()) ? it->second : 0;
         }
 
+        void updatePlayerLatency(uint32_t playerId, uint32_t roundTripMs,
+                                 uint32_t interpolationDelayMs) override;
+
         ecs::Registry &getRegistry() override { return _world->getRegistry(); }
         bool isGameActive() const override { return _gameActive; }
         void resetGame() override;
@@ -121,6 +125,32 @@ namespace server {
          */
         bool loadMap(const std::string &mapFilePath);
 
+        /**
+         * @brief Opt in to deterministic simulation (call before initialize()).
+         *
+         * Systems run sequentially in registration order (the thread pool is
+         * not used), entities and player inputs are visited by increasing
+         * address / player id instead of hash map order, simulation state is
+         * snapped to Q16.16 after every tick,
+         * Lua randomness and time are seeded / simulated, and a world hash is
+         * computed per tick. Two rooms with the same seed and the same inputs
+         * per tick produce the same hash sequence.
+         *
+         * @param seed Seed of the Lua random generator
+         */
+        void setDeterministic(uint64_t seed);
+
+        /**
+         * @brief Check whether deterministic mode is enabled.
+         */
+        bool isDeterministic() const { return _deterministic != nullptr; }
+
+        /**
+         * @brief Get the world hash at the end of the last tick.
+         * @return uint64_t Hash (0 when deterministic mode is off)
+         */
+        uint64_t getWorldHash() const;
+
        private:
         /**
          * @brief Execute all systems in order
@@ -149,6 +179,9 @@ namespace server {
         // Lua scripting
         std::unique_ptr<scripting::LuaEngine> _luaEngine;
 
+        // Deterministic mode (nullptr when off): snaps state and hashes the world after each tick
+        std::unique_ptr<ecs::DeterminismSystem> _deterministic;
+
         // Player management
         std::unordered_map<uint32_t, ecs::Address> _playerMap;  // playerId -> entityAddress
 
@@ -168,6 +201,18 @@ namespace server {
          */
         void _applyPlayerInput(uint32_t playerId, const PlayerInput &input);
 
+        /**
+         * @brief Update how far in the past a player sees the world (lag compensation)
+         *
+         * Round trip + client interpolation delay + time the applied input
+         * waited in the jitter buffer, in ticks. That wait is the number of
+         * inputs still queued times the client's input period (one input per
+         * client fixed step, GameRules::getClientInputRateHz()).
+         *
+         * @param playerId Player ID
+         */
+        void _updateViewDelay(uint32_t playerId);
+
         // Per-player input queue (FIFO)
         // Use deque for efficient front removal
         std::unordered_map<uint32_t, std::deque<PlayerInput>> _pendingInput;
@@ -176,6 +221,13 @@ namespace server {
         std::unordered_map<uint32_t, uint32_t> _lastReceivedSequenceId;
         std::unordered_map<uint32_t, uint32_t> _lastAppliedSequenceId;
 
+        // Last reported latency per player, in milliseconds
+        struct PlayerLatency {
+            uint32_t roundTripMs = 0;
+            uint32_t interpolationDelayMs = 0;  // 0 until the client reports it
+        };
+        std::unordered_map<uint32_t, PlayerLatency> _latency;
+
         // Game state
         std::shared_ptr<GameStateManager> _stateManager;
         std::shared_ptr<ThreadPool> _threadPool;  // Optional: for parallel system execution
@@ -185,7 +237,7 @@ namespace server {
         std::atomic<bool> _initialized{false};
 
         // Thread synchronization
-        mutable std::mutex _inputMutex;  // Protects _pendingInput
+        mutable std::mutex _inputMutex;  // Protects _pendingInput and _latency
         std::mutex _playerMutex;         // Protects _playerMap
 
         // Game rules
@@ -19,25 +19,68 @@
 
 namespace server {
 
+    namespace {
+        EntitySnapshot makeEntitySnapshot(uint32_t entityId, const ecs::Transform *transform,
+                                          const ecs::Velocity *velocity, const ecs::Health *health,
+                                          const ecs::Player *player) {
+            EntitySnapshot snapshot;
+            snapshot.entityId = entityId;
+            snapshot.posX = 0.0f;
+            snapshot.posY = 0.0f;
+            snapshot.velX = 0.0f;
+            snapshot.velY = 0.0f;
+            snapshot.currentHealth = 0;
+            snapshot.maxHealth = 0;
+            snapshot.playerId = 0;
+            snapshot.isAlive = true;
+
+            if (transform) {
+                snapshot.posX = transform->getPosition().x;
+                snapshot.posY = transform->getPosition().y;
+            }
+
+            if (velocity) {
+                ecs::Velocity::Vector2 dir = velocity->getDirection();
+                float speed = velocity->getSpeed();
+                snapshot.velX = dir.x * speed;
+                snapshot.velY = dir.y * speed;
+            }
+
+            if (health) {
+                snapshot.currentHealth = health->getCurrentHealth();
+                snapshot.maxHealth = health->getMaxHealth();
+                snapshot.isAlive = (health->getCurrentHealth() > 0);
+            }
+
+            if (player) {
+                snapshot.playerId = player->getPlayerId();
+            }
+
+            return snapshot;
+        }
+    }  // namespace
+
     GameStateSnapshot GameStateSerializer::createFullSnapshot(ecs::wrapper::ECSWorld &world,
                                                               uint32_t serverTick) {
         GameStateSnapshot snapshot;
         snapshot.serverTick = serverTick;
         snapshot.activePlayerCount = 0;
 
-        // Get all entities with Transform component (all visible entities)
-        auto entities = world.query<ecs::Transform>();
-
-        // Serialize each entity
-        for (auto &entity : entities) {
-            EntitySnapshot entitySnapshot = serializeEntity(world, entity.getAddress());
-            snapshot.entities.push_back(entitySnapshot);
+        // Serialize all entities with Transform component (all visible entities) in a single pass
+        world.forEach<ecs::Transform, ecs::Optional<ecs::Velocity>, ecs::Optional<ecs::Health>,
+                      ecs::Optional<ecs::Player>>([&snapshot](ecs::wrapper::Entity entity,
+                                                              const ecs::Transform &transform,
+                                                              const ecs::Velocity *velocity,
+                                                              const ecs::Health *health,
+                                                              const ecs::Player *player) {
+            snapshot.entities.push_back(
+                makeEntitySnapshot(entity.getAddress(), &transform, velocity, health, player));
 
             // Count players
-            if (entity.has<ecs::Player>()) {
+            if (player) {
                 snapshot.activePlayerCount++;
             }
-        }
+        });
 
         return snapshot;
     }
@@ -55,54 +98,19 @@ namespace server {
     }
 
     EntitySnapshot GameStateSerializer::serializeEntity(ecs::wrapper::ECSWorld &world, uint32_t entityId) {
-        EntitySnapshot snapshot;
-        snapshot.entityId = entityId;
-        snapshot.posX = 0.0f;
-        snapshot.posY = 0.0f;
-        snapshot.velX = 0.0f;
-        snapshot.velY = 0.0f;
-        snapshot.currentHealth = 0;
-        snapshot.maxHealth = 0;
-        snapshot.playerId = 0;
-        snapshot.isAlive = true;
-
         try {
             ecs::wrapper::Entity entity = world.getEntity(entityId);
 
-            // Try to get Transform
-            if (entity.has<ecs::Transform>()) {
-                const ecs::Transform &transform = entity.get<ecs::Transform>();
-                snapshot.posX = transform.getPosition().x;
-                snapshot.posY = transform.getPosition().y;
-            }
-
-            // Try to get Velocity
-            if (entity.has<ecs::Velocity>()) {
-                const ecs::Velocity &velocity = entity.get<ecs::Velocity>();
-                ecs::Velocity::Vector2 dir = velocity.getDirection();
-                float speed = velocity.getSpeed();
-                snapshot.velX = dir.x * speed;
-                snapshot.velY = dir.y * speed;
-            }
-
-            // Try to get Health
-            if (entity.has<ecs::Health>()) {
-                const ecs::Health &health = entity.get<ecs::Health>();
-                snapshot.currentHealth = health.getCurrentHealth();
-                snapshot.maxHealth = health.getMaxHealth();
-                snapshot.isAlive = (health.getCurrentHealth() > 0);
-            }
-
-            // Try to get Player
-            if (entity.has<ecs::Player>()) {
-                const ecs::Player &player = entity.get<ecs::Player>();
-                snapshot.playerId = player.getPlayerId();
-            }
+            return makeEntitySnapshot(
+                entityId, entity.has<ecs::Transform>() ? &entity.get<ecs::Transform>() : nullptr,
+                entity.has<ecs::Velocity>() ? &entity.get<ecs::Velocity>() : nullptr,
+                entity.has<ecs::Health>() ? &entity.get<ecs::Health>() : nullptr,
+                entity.has<ecs::Player>() ? &entity.get<ecs::Player>() : nullptr);
         } catch (const std::exception &e) {
             LOG_ERROR("Error serializing entity ", entityId, ": ", e.what());
         }
 
-        return snapshot;
+        return makeEntitySnapshot(entityId, nullptr, nullptr, nullptr, nullptr);
     }
 
 }  // namespace server
@@ -88,6 +88,15 @@ namespace server {
          */
         virtual uint32_t getLastProcessedInput(uint32_t playerId) const = 0;
 
+        /**
+         * @brief Report how far in the past a player sees the world (used for lag compensation)
+         * @param playerId Player ID
+         * @param roundTripMs Round-trip time in milliseconds
+         * @param interpolationDelayMs Render delay reported by the client, 0 if it did not report one
+         */
+        virtual void updatePlayerLatency(uint32_t playerId, uint32_t roundTripMs,
+                                         uint32_t interpolationDelayMs) = 0;
+
         /**
          * @brief Get reference to the ECS registry
          * @return Registry reference
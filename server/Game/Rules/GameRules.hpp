@@ -30,6 +30,11 @@ namespace server {
         constexpr uint32_t getPlayerSpawnY() const { return 300; }
         constexpr float getDefaultPlayerFireRate() const { return 3.0f; }
         constexpr uint32_t getDefaultPlayerDamage() const { return 25; }
+
+        // Lag Compensation
+        constexpr uint32_t getClientInterpolationDelayMs() const { return 100; }  // Client render delay
+        constexpr uint32_t getClientInputRateHz() const { return 60; }            // Inputs per second
+        constexpr uint32_t getLagCompensationWindowTicks() const { return 20; }   // Max rewind (~333 ms)
     };
 
 }  // namespace server
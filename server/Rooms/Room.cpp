@@ -18,6 +18,14 @@
 
 namespace server {
 
+    std::atomic<bool> Room::_deterministic{false};
+    std::atomic<uint64_t> Room::_deterministicSeed{0};
+
+    void Room::setDeterministicSeed(uint64_t seed) {
+        _deterministicSeed = seed;
+        _deterministic = true;
+    }
+
     Room::Room(const std::string &id, const std::string &name, size_t maxPlayers, bool isPrivate,
                float gameSpeedMultiplier, std::shared_ptr<EventBus> eventBus)
         : _id(id),
@@ -28,13 +36,17 @@ namespace server {
           _gameSpeedMultiplier(gameSpeedMultiplier),
           _hostPlayerId(0),
           _gameStartSent(false) {
+        const auto creationStart = std::chrono::steady_clock::now();
 
         // Use provided EventBus or create a new one
         _eventBus = eventBus ? eventBus : std::make_shared<EventBus>();
         std::shared_ptr<ecs::wrapper::ECSWorld> ecsWorld = std::make_shared<ecs::wrapper::ECSWorld>();
         std::shared_ptr<ThreadPool> threadPool = std::make_shared<ThreadPool>(4);
         threadPool->start();
-        std::unique_ptr<IGameLogic> gameLogic = std::make_unique<GameLogic>(ecsWorld, threadPool, _eventBus);
+        auto gameLogic = std::make_unique<GameLogic>(ecsWorld, threadPool, _eventBus);
+        if (_deterministic) {
+            gameLogic->setDeterministic(_deterministicSeed);  // Before ServerLoop::initialize()
+        }
         _gameLoop = std::make_unique<ServerLoop>(std::move(gameLogic), _eventBus, _gameSpeedMultiplier);
 
         if (!_gameLoop->initialize()) {
@@ -46,8 +58,11 @@ namespace server {
 
         _gameLogic = std::shared_ptr<IGameLogic>(&_gameLoop->getGameLogic(), [](IGameLogic *) {});
 
+        _creationLatency = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - creationStart);
         LOG_INFO("Room '", _name, "' (", _id, ") created [State: WAITING, Max: ", _maxPlayers,
-                 " players, Private: ", (_isPrivate ? "Yes" : "No"), "] with dedicated GameLoop");
+                 " players, Private: ", (_isPrivate ? "Yes" : "No"), "] with dedicated GameLoop in ",
+                 _creationLatency.count() / 1000.0, " ms");
     }
 
     bool Room::join(uint32_t playerId) {
@@ -67,6 +82,7 @@ namespace server {
             return false;
         }
         _players.push_back(playerId);
+        _notifyMembership(playerId, true);
 
         if (_players.size() == 1) {
             _hostPlayerId = playerId;
@@ -86,6 +102,7 @@ namespace server {
         }
 
         _spectators.push_back(playerId);
+        _notifyMembership(playerId, true);
         LOG_INFO("Spectator ", playerId, " joined room ", _id, " (", _spectators.size(), " spectators)");
         return true;
     }
@@ -97,6 +114,7 @@ namespace server {
         auto it = std::find(_players.begin(), _players.end(), playerId);
         if (it != _players.end()) {
             _players.erase(it);
+            _notifyMembership(playerId, false);
             LOG_INFO("Player ", playerId, " left room ", _id, " (", _players.size(), " remaining)");
 
             if (playerId == _hostPlayerId && !_players.empty()) {
@@ -118,6 +136,7 @@ namespace server {
         auto specIt = std::find(_spectators.begin(), _spectators.end(), playerId);
         if (specIt != _spectators.end()) {
             _spectators.erase(specIt);
+            _notifyMembership(playerId, false);
             LOG_INFO("Spectator ", playerId, " left room ", _id, " (", _spectators.size(),
                      " spectators remaining)");
             return true;
@@ -158,6 +177,31 @@ namespace server {
         return std::ranges::find(_spectators, playerId) != _spectators.end();
     }
 
+    void Room::setMembershipCallback(RoomMembershipCallback callback) {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        // Hand the current members over under the same lock as join/leave: no change falls in between
+        for (uint32_t playerId : _players) {
+            _notifyMembership(playerId, false);
+        }
+        for (uint32_t playerId : _spectators) {
+            _notifyMembership(playerId, false);
+        }
+        _membershipCallback = std::move(callback);
+        for (uint32_t playerId : _players) {
+            _notifyMembership(playerId, true);
+        }
+        for (uint32_t playerId : _spectators) {
+            _notifyMembership(playerId, true);
+        }
+    }
+
+    void Room::_notifyMembership(uint32_t playerId, bool joined) {
+        if (_membershipCallback) {
+            _membershipCallback(playerId, joined);
+        }
+    }
+
     RoomInfo Room::getInfo() const {
         std::lock_guard<std::mutex> lock(_mutex);
         return RoomInfo{
@@ -210,6 +254,7 @@ namespace server {
                     auto it = std::find(_players.begin(), _players.end(), playerId);
                     if (it != _players.end()) {
                         _players.erase(it);
+                        _notifyMembership(playerId, false);
                         LOG_WARNING("Removed player ", playerId, " from room ", _id, " due to spawn failure");
                     }
                 }
@@ -7,7 +7,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -19,6 +22,11 @@
 
 namespace server {
 
+    /**
+     * @brief Callback notified when a player or spectator enters (joined = true) or leaves a room
+     */
+    using RoomMembershipCallback = std::function<void(uint32_t playerId, bool joined)>;
+
     /**
      * @class Room
      * @brief Concrete implementation of IRoom with game instance management
@@ -137,7 +145,37 @@ namespace server {
          */
         bool tryMarkGameStartSent();
 
+        /**
+         * @brief Get the time the constructor took (game logic, Lua VM and game loop startup)
+         * @return Room creation latency
+         */
+        std::chrono::microseconds getCreationLatency() const { return _creationLatency; }
+
+        /**
+         * @brief Set the membership listener (used by RoomManager to index players)
+         *
+         * The previous listener is told every current member left and the new
+         * one that every current member joined, under the room lock, so a
+         * listener never misses a join/leave racing with its registration.
+         * @param callback Called under the room lock on every join/leave, nullptr to clear
+         */
+        void setMembershipCallback(RoomMembershipCallback callback);
+
+        /**
+         * @brief Run the game logic of every room created afterwards in deterministic mode
+         *
+         * Server option (--deterministic <seed>), set once at startup before rooms exist.
+         * See GameLogic::setDeterministic().
+         * @param seed Seed shared by every room: same seed and same inputs give the same world hashes
+         */
+        static void setDeterministicSeed(uint64_t seed);
+
        private:
+        /**
+         * @brief Notify the membership listener (caller holds _mutex)
+         */
+        void _notifyMembership(uint32_t playerId, bool joined);
+
         std::string _id;
         std::string _name;
         RoomState _state;
@@ -152,6 +190,13 @@ namespace server {
         std::shared_ptr<EventBus> _eventBus;    // Event bus for this room
         mutable std::mutex _mutex;              // Thread safety for player management
         bool _gameStartSent;                    // Whether GameStart has been sent to players
+
+        std::chrono::microseconds _creationLatency{0};  // Measured by the constructor
+
+        RoomMembershipCallback _membershipCallback;  // Player index hook (guarded by _mutex)
+
+        static std::atomic<bool> _deterministic;         // Set by setDeterministicSeed()
+        static std::atomic<uint64_t> _deterministicSeed;  // Seed of the deterministic rooms
     };
 
 }  // namespace server
@@ -6,19 +6,24 @@
 */
 
 #include "server/Rooms/RoomManager/RoomManager.hpp"
+#include <algorithm>
 #include "common/Logger/Logger.hpp"
 
 namespace server {
 
     RoomManager::RoomManager()
-        : _matchmaking(std::make_shared<MatchmakingService>(2, 4, nullptr)), _eventBus(nullptr) {
+        : _matchmaking(std::make_shared<MatchmakingService>(2, 4, nullptr)),
+          _eventBus(nullptr),
+          _roomsSnapshot(std::make_shared<const RoomSnapshot>()) {
         _matchmaking->setMatchCreatedCallback([this](std::shared_ptr<Room> room) { _onMatchCreated(room); });
         LOG_INFO("RoomManager created with matchmaking service");
     }
 
     RoomManager::RoomManager(std::shared_ptr<MatchmakingService> matchmaking,
                              std::shared_ptr<EventBus> eventBus)
-        : _matchmaking(matchmaking), _eventBus(eventBus) {
+        : _matchmaking(matchmaking),
+          _eventBus(eventBus),
+          _roomsSnapshot(std::make_shared<const RoomSnapshot>()) {
         if (_matchmaking) {
             _matchmaking->setMatchCreatedCallback(
                 [this](std::shared_ptr<Room> room) { _onMatchCreated(room); });
@@ -26,6 +31,15 @@ namespace server {
         LOG_INFO("RoomManager created with provided matchmaking service");
     }
 
+    RoomManager::~RoomManager() {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+        // Rooms may outlive the manager (shared with the server): detach the index callbacks
+        for (const auto &[id, room] : _rooms) {
+            room->setMembershipCallback(nullptr);
+        }
+    }
+
     void RoomManager::addPlayerToMatchmaking(uint32_t playerId) {
         if (!_matchmaking) {
             LOG_ERROR("Cannot add player to matchmaking - service not initialized");
@@ -60,6 +74,9 @@ namespace server {
             auto room =
                 std::make_shared<Room>(id, name, maxPlayers, isPrivate, gameSpeedMultiplier, _eventBus);
             _rooms[id] = room;
+            _indexRoom(room);
+            _publishRooms();
+            _recordCreation(*room);
 
             LOG_INFO("✓ Room created: '", room->getName(), "' (", id, ")");
             return room;
@@ -86,7 +103,9 @@ namespace server {
         auto it = _rooms.find(id);
         if (it != _rooms.end()) {
             LOG_INFO("✓ Room removed: ", id);
+            _unindexRoom(it->second);
             _rooms.erase(it);
+            _publishRooms();
             return true;
         }
 
@@ -94,16 +113,11 @@ namespace server {
     }
 
     std::vector<std::shared_ptr<Room>> RoomManager::getAllRooms() {
-        std::lock_guard<std::recursive_mutex> lock(_mutex);
-
-        std::vector<std::shared_ptr<Room>> rooms;
-        rooms.reserve(_rooms.size());
-
-        for (const auto &[id, room] : _rooms) {
-            rooms.push_back(room);
-        }
+        return getRoomsSnapshot()->rooms;
+    }
 
-        return rooms;
+    std::shared_ptr<const RoomSnapshot> RoomManager::getRoomsSnapshot() const {
+        return _roomsSnapshot.load(std::memory_order_acquire);
     }
 
     std::vector<std::shared_ptr<Room>> RoomManager::getPublicRooms() {
@@ -144,11 +158,13 @@ namespace server {
         }
 
         for (const auto &id : roomsToRemove) {
+            _unindexRoom(_rooms[id]);
             _rooms.erase(id);
             LOG_INFO("Cleaned up finished room: ", id);
         }
 
         if (!roomsToRemove.empty()) {
+            _publishRooms();
             LOG_INFO("Cleaned up ", roomsToRemove.size(), " finished room(s)");
             return true;
         }
@@ -157,12 +173,11 @@ namespace server {
     }
 
     std::shared_ptr<Room> RoomManager::getRoomByPlayer(uint32_t playerId) {
-        std::lock_guard lock(_mutex);
+        std::shared_lock lock(_playerRoomsMutex);
 
-        for (const auto &[id, room] : _rooms) {
-            if (room->hasPlayer(playerId) || room->hasSpectator(playerId)) {
-                return room;
-            }
+        auto it = _playerRooms.find(playerId);
+        if (it != _playerRooms.end() && !it->second.empty()) {
+            return it->second.front();
         }
 
         return nullptr;
@@ -180,11 +195,13 @@ namespace server {
         }
 
         for (const auto &id : roomsToRemove) {
+            _unindexRoom(_rooms[id]);
             _rooms.erase(id);
             LOG_INFO("Cleaned up finished room: ", id);
         }
 
         if (!roomsToRemove.empty()) {
+            _publishRooms();
             LOG_INFO("Cleaned up ", roomsToRemove.size(), " finished room(s)");
         }
     }
@@ -205,6 +222,9 @@ namespace server {
             }
 
             _rooms[roomId] = room;
+            _indexRoom(room);
+            _publishRooms();
+            _recordCreation(*room);
             LOG_INFO("✓ Match room registered: ", roomId, " (", room->getPlayerCount(), " players)");
             room->setState(RoomState::STARTING);
 
@@ -217,4 +237,60 @@ namespace server {
         }
     }
 
+    RoomCreationStats RoomManager::getRoomCreationStats() const {
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+        return _creationStats;
+    }
+
+    void RoomManager::_recordCreation(const Room &room) {
+        const auto latency = room.getCreationLatency();
+        _creationStats.count++;
+        _creationStats.last = latency;
+        _creationStats.max = std::max(_creationStats.max, latency);
+        _creationStats.total += latency;
+    }
+
+    void RoomManager::_publishRooms() {
+        auto snapshot = std::make_shared<RoomSnapshot>();
+        snapshot->generation = _roomsSnapshot.load(std::memory_order_relaxed)->generation + 1;
+        snapshot->rooms.reserve(_rooms.size());
+        for (const auto &[id, room] : _rooms) {
+            snapshot->rooms.push_back(room);
+        }
+
+        _roomsSnapshot.store(std::move(snapshot), std::memory_order_release);
+    }
+
+    void RoomManager::_indexRoom(const std::shared_ptr<Room> &room) {
+        std::weak_ptr<Room> weakRoom = room;
+        // Members added before registration (e.g. by matchmaking) are replayed as joins
+        room->setMembershipCallback([this, weakRoom](uint32_t playerId, bool joined) {
+            _onMembershipChanged(weakRoom, playerId, joined);
+        });
+    }
+
+    void RoomManager::_unindexRoom(const std::shared_ptr<Room> &room) {
+        // The current members are replayed as leaves to the callback being removed
+        room->setMembershipCallback(nullptr);
+    }
+
+    void RoomManager::_onMembershipChanged(const std::weak_ptr<Room> &room, uint32_t playerId, bool joined) {
+        std::shared_ptr<Room> target = room.lock();
+        if (!target) {
+            return;
+        }
+
+        std::unique_lock lock(_playerRoomsMutex);
+        auto &rooms = _playerRooms[playerId];
+        auto it = std::find(rooms.begin(), rooms.end(), target);
+        if (joined && it == rooms.end()) {
+            rooms.push_back(std::move(target));
+        } else if (!joined && it != rooms.end()) {
+            rooms.erase(it);
+        }
+        if (rooms.empty()) {
+            _playerRooms.erase(playerId);
+        }
+    }
+
 }  // namespace server
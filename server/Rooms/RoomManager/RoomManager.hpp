@@ -7,9 +7,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 #include "server/Rooms/Matchmaking/MatchmakingService.hpp"
 #include "server/Rooms/RoomManager/IRoomManager.hpp"
 
@@ -18,6 +23,36 @@ namespace server {
     // Callback type for when a match is created and players should be notified
     using RoomCreatedCallback = std::function<void(std::shared_ptr<Room>)>;
 
+    /**
+     * @struct RoomSnapshot
+     * @brief Immutable generation of the room list
+     *
+     * Republished only when a room is created or removed; readers keep the
+     * generation alive with a single reference count instead of one per room.
+     */
+    struct RoomSnapshot {
+        uint64_t generation = 0;                   ///< Incremented on every republish
+        std::vector<std::shared_ptr<Room>> rooms;  ///< Rooms registered in this generation
+    };
+
+    /**
+     * @struct RoomCreationStats
+     * @brief Latency of the rooms registered by a RoomManager
+     *
+     * Measured by each Room's constructor (game logic, Lua VM, game loop
+     * startup), aggregated when the room is registered.
+     */
+    struct RoomCreationStats {
+        uint64_t count = 0;                  ///< Rooms measured
+        std::chrono::microseconds last{0};   ///< Latency of the most recent room
+        std::chrono::microseconds max{0};    ///< Slowest room
+        std::chrono::microseconds total{0};  ///< Sum over all measured rooms
+
+        std::chrono::microseconds average() const {
+            return count ? total / static_cast<int64_t>(count) : std::chrono::microseconds{0};
+        }
+    };
+
     /**
      * @class RoomManager
      * @brief Manages all game rooms and matchmaking
@@ -26,6 +61,8 @@ namespace server {
      * - Create/destroy rooms
      * - Automatic matchmaking integration
      * - Room discovery (list public rooms)
+     * - O(1) player -> room lookup (index kept in sync by room membership callbacks)
+     * - Room list snapshots for the server loop without taking the RoomManager mutex (RCU-style)
      * - Thread-safe operations
      */
     class RoomManager : public IRoomManager {
@@ -33,7 +70,7 @@ namespace server {
         RoomManager();
         explicit RoomManager(std::shared_ptr<MatchmakingService> matchmaking,
                              std::shared_ptr<EventBus> eventBus = nullptr);
-        ~RoomManager() override = default;
+        ~RoomManager() override;
 
         std::shared_ptr<Room> createRoom(const std::string &id, const std::string &name = "",
                                          size_t maxPlayers = 4, bool isPrivate = false,
@@ -45,6 +82,25 @@ namespace server {
         size_t getRoomCount() const override;
         bool update(float deltaTime) override;
 
+        /**
+         * @brief Get the current generation of the room list (no RoomManager mutex taken)
+         *
+         * The snapshot is never modified: rooms created or removed afterwards
+         * appear in a later generation. Cheaper than getAllRooms() for per-frame
+         * iteration since no room reference count is touched. Not lock-free:
+         * libstdc++ implements std::atomic<std::shared_ptr> with a small internal
+         * lock, held only for the pointer copy.
+         *
+         * @return Current room list snapshot (never nullptr)
+         */
+        std::shared_ptr<const RoomSnapshot> getRoomsSnapshot() const;
+
+        /**
+         * @brief Get room creation latency statistics
+         * @return Stats over every room created here or by matchmaking
+         */
+        RoomCreationStats getRoomCreationStats() const;
+
         /**
          * @brief Add player to matchmaking queue
          * @param playerId Player ID to add
@@ -71,7 +127,11 @@ namespace server {
 
         /**
          * @brief Get room by player ID (find which room a player is in)
-         * @param playerId Player ID to search for
+         *
+         * Hash lookup in the player index under a shared lock: called for
+         * every input and chat packet, it never scans the rooms.
+         *
+         * @param playerId Player ID to search for (player or spectator)
          * @return Shared pointer to room (nullptr if not found)
          */
         std::shared_ptr<Room> getRoomByPlayer(uint32_t playerId);
@@ -89,12 +149,48 @@ namespace server {
          */
         void _onMatchCreated(std::shared_ptr<Room> room);
 
+        /**
+         * @brief Start tracking a room's members in the player index
+         * @param room Room just registered in _rooms
+         */
+        void _indexRoom(const std::shared_ptr<Room> &room);
+
+        /**
+         * @brief Stop tracking a room and drop its members from the player index
+         * @param room Room being removed from _rooms
+         */
+        void _unindexRoom(const std::shared_ptr<Room> &room);
+
+        /**
+         * @brief Membership callback target: add or remove one player -> room entry
+         */
+        void _onMembershipChanged(const std::weak_ptr<Room> &room, uint32_t playerId, bool joined);
+
+        /**
+         * @brief Publish a new room list generation (caller holds _mutex)
+         */
+        void _publishRooms();
+
+        /**
+         * @brief Add a newly registered room's creation latency to the stats (caller holds _mutex)
+         */
+        void _recordCreation(const Room &room);
+
         std::unordered_map<std::string, std::shared_ptr<Room>> _rooms;
         std::shared_ptr<MatchmakingService> _matchmaking;
         std::shared_ptr<EventBus> _eventBus;
         RoomCreatedCallback _roomCreatedCallback;
         mutable std::recursive_mutex
             _mutex;  // Recursive to allow getAllRooms() from event handlers during update()
+
+        // Player -> rooms they are in (usually one), oldest membership first
+        std::unordered_map<uint32_t, std::vector<std::shared_ptr<Room>>> _playerRooms;
+        mutable std::shared_mutex _playerRoomsMutex;  // Never held while calling into a Room
+
+        // Current room list generation, rebuilt under _mutex on create/remove, read without it
+        std::atomic<std::shared_ptr<const RoomSnapshot>> _roomsSnapshot;
+
+        RoomCreationStats _creationStats;  // Guarded by _mutex
     };
 
 }  // namespace server
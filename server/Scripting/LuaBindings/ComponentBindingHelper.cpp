@@ -9,13 +9,13 @@
 
 namespace scripting::bindings {
 
-    void ComponentBindingHelper::applyComponentBindings(sol::state &lua) {
+    void ComponentBindingHelper::applyComponentBindings(sol::state &lua) const {
         for (const auto &binding : _bindings) {
             binding.bindFunc(lua);
         }
     }
 
-    void ComponentBindingHelper::applyEntityMethods(sol::usertype<ecs::wrapper::Entity> &entityType) {
+    void ComponentBindingHelper::applyEntityMethods(sol::usertype<ecs::wrapper::Entity> &entityType) const {
         for (const auto &[name, getter] : _getters) {
             std::string getMethodName = "get" + name;
             entityType[getMethodName] = getter;
@@ -27,7 +27,7 @@ namespace scripting::bindings {
         }
     }
 
-    void ComponentBindingHelper::applyRemoveFunction(sol::state &lua, ecs::wrapper::ECSWorld *world) {
+    void ComponentBindingHelper::applyRemoveFunction(sol::state &lua, ecs::wrapper::ECSWorld *world) const {
         lua.set_function("removeComponent",
                          [this, world](ecs::Address addr, const std::string &componentName) {
                              auto it = _removers.find(componentName);
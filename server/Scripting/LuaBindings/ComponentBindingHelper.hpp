@@ -71,7 +71,7 @@ namespace scripting::bindings {
          * @brief Apply all component bindings to the Lua state.
          * @param lua Lua state
          */
-        void applyComponentBindings(sol::state &lua);
+        void applyComponentBindings(sol::state &lua) const;
 
         /**
          * @brief Apply get/has methods on Entity for all components.
@@ -82,7 +82,7 @@ namespace scripting::bindings {
          * 
          * @param entityType The Entity usertype
          */
-        void applyEntityMethods(sol::usertype<ecs::wrapper::Entity> &entityType);
+        void applyEntityMethods(sol::usertype<ecs::wrapper::Entity> &entityType) const;
 
         /**
          * @brief Create the global removeComponent function for all components.
@@ -90,7 +90,7 @@ namespace scripting::bindings {
          * @param lua Lua state
          * @param world Pointer to the ECS world
          */
-        void applyRemoveFunction(sol::state &lua, ecs::wrapper::ECSWorld *world);
+        void applyRemoveFunction(sol::state &lua, ecs::wrapper::ECSWorld *world) const;
 
         /**
          * @brief Get the list of registered components.
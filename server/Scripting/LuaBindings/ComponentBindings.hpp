@@ -15,16 +15,16 @@ namespace scripting::bindings {
     /**
      * @brief Bind ECS component types to Lua.
      * 
-     * Binds each component to Lua and registers it with the helper.
+     * Applies the process-wide binding template (built once) to this state.
      * To add a new component:
-     * 1. Bind it to Lua with lua.new_usertype<T>()
-     * 2. Register it with helper.registerComponent<T>("Name")
+     * 1. Write a binding function creating its usertype with lua.new_usertype<T>()
+     * 2. Add it to the template with helper.add<T>("Name", bindFunc)
      * 
      * @param lua Reference to the Lua state
      * @param world Pointer to the ECS world
-     * @return ComponentBindingHelper& The configured helper
+     * @return const ComponentBindingHelper& The shared, read-only helper
      * 
      * @note Currently bound components: Transform, Velocity, Health
      */
-    ComponentBindingHelper &bindComponents(sol::state &lua, ecs::wrapper::ECSWorld *world);
+    const ComponentBindingHelper &bindComponents(sol::state &lua, ecs::wrapper::ECSWorld *world);
 }  // namespace scripting::bindings
@@ -8,7 +8,7 @@
 #include "EntityBindings.hpp"
 
 void scripting::bindings::bindEntity(sol::state &lua, ecs::wrapper::ECSWorld *world,
-                                     ComponentBindingHelper &helper) {
+                                     const ComponentBindingHelper &helper) {
     // Create the Entity usertype
     sol::usertype<ecs::wrapper::Entity> entity_type =
         lua.new_usertype<ecs::wrapper::Entity>("Entity", sol::no_constructor);
@@ -32,6 +32,6 @@ namespace scripting::bindings {
      * Global functions:
      *  - removeComponent(addr, "ComponentName") -> auto-generated
      */
-    void bindEntity(sol::state &lua, ecs::wrapper::ECSWorld *world, ComponentBindingHelper &helper);
+    void bindEntity(sol::state &lua, ecs::wrapper::ECSWorld *world, const ComponentBindingHelper &helper);
 
 }  // namespace scripting::bindings
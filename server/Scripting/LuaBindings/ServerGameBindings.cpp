@@ -6,24 +6,108 @@
 */
 
 #include "ServerGameBindings.hpp"
-#include <cstdlib>
-#include <ctime>
+#include <cmath>
+#include <optional>
 #include "common/ECS/Components/Buff.hpp"
 #include "common/ECS/Components/Collectible.hpp"
 #include "common/ECS/Components/Collider.hpp"
 #include "common/ECS/Components/Enemy.hpp"
 #include "common/ECS/Components/Health.hpp"
 #include "common/ECS/Components/LuaScript.hpp"
+#include "common/ECS/Components/MovementPattern.hpp"
 #include "common/ECS/Components/Spawner.hpp"
 #include "common/ECS/Components/Sprite.hpp"
 #include "common/ECS/Components/Transform.hpp"
 #include "common/ECS/Components/Velocity.hpp"
 #include "common/ECS/Components/Wall.hpp"
+#include "common/ECS/Systems/MapSystem/MapSystem.hpp"
 #include "common/Logger/Logger.hpp"
 #include "server/Scripting/LuaEngine.hpp"
 
 namespace scripting::bindings {
 
+    namespace {
+        /**
+         * @brief Build a native movement pattern from a map script value.
+         *
+         * Accepts a pattern name ("linear", "sine", "zigzag", "homing",
+         * "bezier") or a table such as:
+         * { pattern = "sine", speed = 0, amplitude = 80, frequency = 0.5, phase = 0 }
+         * { pattern = "linear", dirX = -1, dirY = 0.3 }
+         * { pattern = "homing", turnRate = 1.5 }
+         * { pattern = "bezier", duration = 3, points = { {-300, 200}, {-600, -200}, {-900, 0} } }
+         * Bezier points are relative to the spawn position. A speed of 0 keeps
+         * the enemy type speed.
+         *
+         * @return std::optional<ecs::MovementPattern> The pattern, or nullopt for nil / invalid values.
+         */
+        std::optional<ecs::MovementPattern> parseMovementPattern(const sol::object &spec) {
+            if (!spec.valid() || spec.get_type() == sol::type::lua_nil) {
+                return std::nullopt;
+            }
+
+            std::optional<sol::table> table;
+            std::string name;
+            if (spec.get_type() == sol::type::string) {
+                name = spec.as<std::string>();
+            } else if (spec.get_type() == sol::type::table) {
+                table = spec.as<sol::table>();
+                name = table->get_or<std::string>("pattern", "linear");
+            } else {
+                LOG_WARNING("[LUA] Movement pattern must be a name or a table");
+                return std::nullopt;
+            }
+
+            std::optional<ecs::MovementPatternType> type = ecs::MovementPattern::typeFromString(name);
+            if (!type) {
+                LOG_WARNING("[LUA] Unknown movement pattern '", name, "'");
+                return std::nullopt;
+            }
+
+            auto number = [&table](const char *key, float fallback) {
+                return table ? table->get_or(key, fallback) : fallback;
+            };
+            const float speed = number("speed", 0.0f);
+
+            switch (*type) {
+                case ecs::MovementPatternType::LINEAR:
+                    return ecs::MovementPattern::linear(speed, number("dirX", -1.0f), number("dirY", 0.0f));
+                case ecs::MovementPatternType::SINE:
+                    return ecs::MovementPattern::sine(speed, number("amplitude", 80.0f),
+                                                      number("frequency", 0.5f), number("phase", 0.0f));
+                case ecs::MovementPatternType::ZIGZAG:
+                    return ecs::MovementPattern::zigZag(speed, number("amplitude", 80.0f),
+                                                        number("frequency", 0.5f));
+                case ecs::MovementPatternType::HOMING:
+                    return ecs::MovementPattern::homing(speed, number("turnRate", 1.5f));
+                case ecs::MovementPatternType::BEZIER:
+                    break;
+            }
+
+            sol::optional<sol::table> points;
+            if (table) {
+                points = table->get<sol::optional<sol::table>>("points");
+            }
+            if (!points || points->size() < 3) {
+                LOG_WARNING("[LUA] Bezier movement pattern needs 3 points");
+                return std::nullopt;
+            }
+            ecs::MovementPattern::Vector2 controls[3];
+            for (size_t i = 0; i < 3; ++i) {
+                sol::optional<sol::table> point = points->get<sol::optional<sol::table>>(i + 1);
+                if (!point) {
+                    LOG_WARNING("[LUA] Bezier point ", i + 1, " must be a table");
+                    return std::nullopt;
+                }
+                // Points are either { x = .., y = .. } or { x, y }
+                controls[i] = {point->get_or("x", point->get_or(1, 0.0f)),
+                               point->get_or("y", point->get_or(2, 0.0f))};
+            }
+            return ecs::MovementPattern::bezier(controls[0], controls[1], controls[2],
+                                                number("duration", 2.0f));
+        }
+    }  // namespace
+
     void bindServerGame(sol::state &lua, ecs::wrapper::ECSWorld *world, LuaEngine *engine) {
         if (!world) {
             LOG_ERROR("Cannot bind server game functions: world is null");
@@ -34,13 +118,6 @@ namespace scripting::bindings {
             return;
         }
 
-        // Seed random number generator (do this once)
-        static bool seeded = false;
-        if (!seeded) {
-            std::srand(static_cast<unsigned int>(std::time(nullptr)));
-            seeded = true;
-        }
-
         // Spawn a basic enemy at position
         lua.set_function("spawnEnemy",
                          [world](float x, float y, const std::string &enemyType) -> ecs::wrapper::Entity {
@@ -81,9 +158,32 @@ namespace scripting::bindings {
                 }
             });
 
-        // Get current time (useful for timing/animations)
-        lua.set_function("getTime", []() -> float {
-            return static_cast<float>(std::clock()) / static_cast<float>(CLOCKS_PER_SEC);
+        // Get current time (useful for timing/animations); simulated time in deterministic mode
+        lua.set_function("getTime", [engine]() -> float { return static_cast<float>(engine->getTime()); });
+
+        // Randomness goes through the engine generator so a seeded room replays identically
+        lua.set_function("random", [engine](float min, float max) -> float {
+            return engine->getRandom().nextFloat(min, max);
+        });
+        lua.set_function("randomInt", [engine](int64_t min, int64_t max) -> int64_t {
+            return engine->getRandom().nextInt(min, max);
+        });
+
+        // math.random() -> [0, 1), math.random(m) -> [1, m], math.random(m, n) -> [m, n]
+        sol::table math = lua["math"];
+        math.set_function("random", [engine](sol::optional<int64_t> first,
+                                             sol::optional<int64_t> second) -> sol::object {
+            sol::state_view state = engine->getLuaState();
+            if (!first) {
+                return sol::make_object(state, engine->getRandom().nextFloat(0.0f, 1.0f));
+            }
+            if (!second) {
+                return sol::make_object(state, engine->getRandom().nextInt(1, *first));
+            }
+            return sol::make_object(state, engine->getRandom().nextInt(*first, *second));
+        });
+        math.set_function("randomseed", [engine](sol::optional<int64_t> seed) {
+            engine->seedRandom(static_cast<uint64_t>(seed.value_or(0)));
         });
 
         // Math helpers
@@ -207,8 +307,10 @@ namespace scripting::bindings {
                     bool isDestructible = destructible.value_or(false);
                     int wallHealth = health.value_or(0);
 
+                    // Walls live in world coordinates: x is given in screen space
+                    const float worldX = x + ecs::MapSystem::getScrollOffset(world->getRegistry());
                     auto entity = world->createEntity();
-                    entity.with(ecs::Transform(x, y));
+                    entity.with(ecs::Transform(worldX, y));
                     entity.with(ecs::Wall(isDestructible));
                     entity.with(ecs::Collider(width, height, 0.0f, 0.0f, 16, 0xFFFFFFFF, false));
                     entity.with(ecs::Sprite("Wall.png",
@@ -230,10 +332,11 @@ namespace scripting::bindings {
             });
 
         // Queue a spawn request through a Spawner entity
-        // Usage: queueSpawn(spawnerEntity, x, y, type, scriptPath, health, scoreValue)
+        // Usage: queueSpawn(spawnerEntity, x, y, type, scriptPath, health, scoreValue [, movement])
         lua.set_function("queueSpawn", [world](ecs::wrapper::Entity spawner, float x, float y,
                                                const std::string &enemyType, const std::string &scriptPath,
-                                               float health, int scoreValue) {
+                                               float health, int scoreValue,
+                                               sol::optional<sol::object> movement) {
             try {
                 if (!world) {
                     LOG_ERROR("[LUA] queueSpawn: world is null");
@@ -253,6 +356,9 @@ namespace scripting::bindings {
 
                 ecs::Spawner &spawnerComp = spawner.get<ecs::Spawner>();
                 ecs::SpawnRequest request{x, y, enemyType, scriptPath, health, scoreValue, 0.0f};
+                if (movement) {
+                    request.movement = parseMovementPattern(*movement);
+                }
                 spawnerComp.queueSpawn(request);
 
                 LOG_DEBUG("[LUA] Queued spawn for ", enemyType, " at (", x, ", ", y, ")");
@@ -261,6 +367,25 @@ namespace scripting::bindings {
             }
         });
 
+        // Drive an enemy with a native movement pattern (evaluated by AISystem)
+        // Usage: setMovementPattern(entity, "sine")
+        //        setMovementPattern(entity, { pattern = "homing", turnRate = 2 })
+        lua.set_function("setMovementPattern", [world](ecs::wrapper::Entity entity, sol::object spec) {
+            try {
+                if (!world || !entity.isValid()) {
+                    LOG_WARNING("[LUA] setMovementPattern: invalid entity");
+                    return;
+                }
+
+                std::optional<ecs::MovementPattern> pattern = parseMovementPattern(spec);
+                if (pattern) {
+                    entity.with(*pattern);
+                }
+            } catch (const std::exception &e) {
+                LOG_ERROR("[LUA] setMovementPattern exception: ", e.what());
+            }
+        });
+
         lua.set_function("setSpawnerConfig", [world](ecs::wrapper::Entity spawner, sol::table configTable) {
             try {
                 if (!world) {
@@ -308,6 +433,8 @@ namespace scripting::bindings {
                                 request.scoreValue = enemyTable.get_or("scoreValue", 100);
                                 request.spawnDelay = enemyTable.get_or("delay", 0.0f);
                                 request.hasSpawned = false;
+                                sol::object movement = enemyTable["movement"];
+                                request.movement = parseMovementPattern(movement);
                                 waveConfig.enemies.push_back(request);
                             }
                         }
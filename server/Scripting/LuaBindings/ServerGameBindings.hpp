@@ -31,8 +31,10 @@ namespace scripting::bindings {
      * @note Functions exposed:
      * - spawnEnemy(x, y, enemyType) -> Entity
      * - spawnProjectile(x, y, dirX, dirY, speed, damage) -> Entity
-     * - random(min, max) -> float
-     * - getTime() -> float
+     * - setMovementPattern(entity, pattern) -> void (native AISystem movement)
+     * - random(min, max) -> float, randomInt(min, max) -> integer (seeded engine generator)
+     * - math.random / math.randomseed -> same generator as random()
+     * - getTime() -> float (simulated seconds in deterministic mode)
      * - onGameStart(callback) -> void
      */
     void bindServerGame(sol::state &lua, ecs::wrapper::ECSWorld *world, LuaEngine *engine);
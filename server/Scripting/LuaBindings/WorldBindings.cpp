@@ -43,6 +43,15 @@ void scripting::bindings::bindWorld(sol::state &lua, ecs::wrapper::ECSWorld *wor
     // log(string message) -> void
     lua.set_function("log", [](const std::string &message) { LOG_DEBUG("[LUA] " + message); });
 
+    // getEntity(addr) -> Entity (full Entity API from an onUpdateBatch address)
+    lua.set_function("getEntity", [world](ecs::Address addr) -> ecs::wrapper::Entity {
+        if (!world) {
+            LOG_ERROR("World not set in LuaEngine");
+            throw std::runtime_error("World not initialized");
+        }
+        return world->getEntity(addr);
+    });
+
     // entityExists(addr) -> bool
     lua.set_function("entityExists", [world](ecs::Address addr) -> bool {
         if (!world) {
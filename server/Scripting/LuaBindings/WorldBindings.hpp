@@ -25,6 +25,7 @@ namespace scripting::bindings {
      * Lua functions added:
      *  - createEntity() -> Entity
      *  - destroyEntity(Entity e) -> void
+     *  - getEntity(Address addr) -> Entity
      *  - entityExists(Address addr) -> bool
      *  - log(string message) -> void
      */
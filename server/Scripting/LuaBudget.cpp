@@ -0,0 +1,117 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** LuaBudget implementation
+*/
+
+#include "LuaBudget.hpp"
+#include <cstdlib>
+
+namespace scripting {
+
+    void *LuaBudget::allocate(void *userdata, void *ptr, size_t oldSize, size_t newSize) {
+        auto *budget = static_cast<LuaBudget *>(userdata);
+        // When ptr is null, oldSize encodes the object type, not a size
+        const size_t heldSize = ptr ? oldSize : 0;
+
+        if (newSize == 0) {
+            std::free(ptr);
+            budget->_usedBytes -= heldSize;
+            return nullptr;
+        }
+
+        const size_t growth = newSize > heldSize ? newSize - heldSize : 0;
+        if (growth > 0 && budget->_config.memoryLimit != 0 &&
+            budget->_usedBytes + growth > budget->_config.memoryLimit) {
+            // Only growth may fail: Lua assumes shrinking always succeeds
+            budget->_refusedAllocations++;
+            return nullptr;
+        }
+
+        void *block = std::realloc(ptr, newSize);
+        if (block == nullptr) {
+            return nullptr;
+        }
+        budget->_usedBytes = budget->_usedBytes - heldSize + newSize;
+        if (budget->_current != nullptr) {
+            budget->_current->allocatedBytes += growth;
+        }
+        return block;
+    }
+
+    void LuaBudget::installHook(lua_State *state) {
+        if (_pcall == nullptr) {
+            lua_getglobal(state, "pcall");
+            _pcall = lua_tocfunction(state, -1);
+            lua_getglobal(state, "xpcall");
+            _xpcall = lua_tocfunction(state, -1);
+            lua_pop(state, 2);
+        }
+        if (_config.callBudget.count() == 0) {
+            lua_sethook(state, nullptr, 0, 0);
+            return;
+        }
+        lua_sethook(state, &LuaBudget::_hook, LUA_MASKCOUNT, _config.hookInstructionInterval);
+    }
+
+    void LuaBudget::_hook(lua_State *state, lua_Debug *) {
+        void *userdata = nullptr;
+        lua_getallocf(state, &userdata);
+        auto *budget = static_cast<LuaBudget *>(userdata);
+
+        if (budget == nullptr || budget->_current == nullptr) {
+            return;
+        }
+        // Keep raising while past the deadline, so a pcall() inside the script cannot swallow it.
+        // Under a C++ binding the deadline stays passed: the next hook after it returns raises.
+        if (Clock::now() > budget->_deadline && budget->_canRaise(state)) {
+            budget->_aborted = true;
+            luaL_error(state, "script exceeded its time budget (%d us)",
+                       static_cast<int>(budget->_config.callBudget.count()));
+        }
+    }
+
+    bool LuaBudget::_canRaise(lua_State *state) const {
+        // Level 0 is the Lua function running the hook; only this coroutine's frames are unwound
+        lua_Debug frame;
+        for (int level = 1; lua_getstack(state, level, &frame) != 0; ++level) {
+            lua_getinfo(state, "f", &frame);
+            const lua_CFunction function = lua_tocfunction(state, -1);
+            lua_pop(state, 1);
+            if (function != nullptr && function != _pcall && function != _xpcall) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void LuaBudget::beginTick() {
+        _tickSpent = std::chrono::nanoseconds{0};
+    }
+
+    void LuaBudget::beginCall(ScriptStats &stats) {
+        _current = &stats;
+        _aborted = false;
+        _callStart = Clock::now();
+        _deadline = _callStart + _config.callBudget;
+    }
+
+    bool LuaBudget::endCall() {
+        const auto elapsed = Clock::now() - _callStart;
+        const bool aborted = _aborted;
+
+        if (_current != nullptr) {
+            _current->calls++;
+            _current->cpuTime += elapsed;
+            if (aborted) {
+                _current->budgetAborts++;
+            }
+        }
+        _tickSpent += elapsed;
+        _current = nullptr;
+        _aborted = false;
+        return aborted;
+    }
+
+}  // namespace scripting
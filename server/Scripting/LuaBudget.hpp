@@ -0,0 +1,136 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** LuaBudget - Per-room Lua memory cap, time budget and script counters
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <sol/sol.hpp>
+
+namespace scripting {
+
+    /**
+     * @struct LuaBudgetConfig
+     * @brief Limits applied to one room's Lua VM.
+     */
+    struct LuaBudgetConfig {
+        size_t memoryLimit = 64 * 1024 * 1024;        ///< Bytes the VM may hold (0 = unlimited)
+        std::chrono::microseconds tickBudget{4000};   ///< Script time per tick (0 = unlimited)
+        std::chrono::microseconds callBudget{10000};  ///< Time before a call is aborted (0 = unlimited)
+        int hookInstructionInterval = 1000;           ///< VM instructions between two deadline checks
+        uint32_t maxThrottleTicks = 32;               ///< Longest pause after repeated aborts
+    };
+
+    /**
+     * @struct ScriptStats
+     * @brief CPU and allocation counters of one script in one room.
+     */
+    struct ScriptStats {
+        uint64_t calls = 0;                   ///< Completed or aborted calls
+        std::chrono::nanoseconds cpuTime{0};  ///< Time spent inside the script
+        uint64_t allocatedBytes = 0;          ///< Bytes allocated while the script was running
+        uint64_t budgetAborts = 0;            ///< Calls aborted for exceeding callBudget
+        uint64_t deferredCalls = 0;           ///< Calls skipped (tick budget spent or script throttled)
+    };
+
+    /**
+     * @class LuaBudget
+     * @brief Allocator and instruction hook enforcing a LuaBudgetConfig.
+     *
+     * Passed as the allocator userdata of the room's sol::state: the
+     * allocator refuses to grow the VM past memoryLimit (Lua then raises a
+     * "not enough memory" error in the script), and the count hook aborts the
+     * running call once its deadline is past. The hook finds the budget back
+     * through lua_getallocf, so no global state is needed.
+     *
+     * Lua is built as C: the abort is a longjmp, which would skip the
+     * destructors of a C++ binding that re-entered Lua. Past the deadline the
+     * hook therefore only raises when no C function other than pcall/xpcall
+     * is on the stack; under a binding it waits until the binding returns.
+     *
+     * Not thread-safe: used under the owning LuaEngine's mutex.
+     */
+    class LuaBudget {
+       public:
+        explicit LuaBudget(const LuaBudgetConfig &config = {}) : _config(config) {}
+
+        /**
+         * @brief lua_Alloc implementation (userdata must be the LuaBudget).
+         */
+        static void *allocate(void *userdata, void *ptr, size_t oldSize, size_t newSize);
+
+        /**
+         * @brief Install the instruction-count hook on a VM using this budget's allocator.
+         *
+         * No hook is installed when callBudget is 0. The first call also records
+         * the VM's pcall and xpcall (the base library must be open).
+         */
+        void installHook(lua_State *state);
+
+        /**
+         * @brief Start a new tick: reset the time spent by scripts this tick.
+         */
+        void beginTick();
+
+        /**
+         * @brief Check whether scripts may still start this tick.
+         */
+        bool hasTickBudget() const {
+            return _config.tickBudget.count() == 0 || _tickSpent < _config.tickBudget;
+        }
+
+        /**
+         * @brief Start timing and attributing allocations to a script call.
+         * @param stats Counters of the script about to run
+         */
+        void beginCall(ScriptStats &stats);
+
+        /**
+         * @brief Stop timing the current call.
+         * @return true if the call was aborted for exceeding its budget
+         */
+        bool endCall();
+
+        const LuaBudgetConfig &getConfig() const { return _config; }
+        void setConfig(const LuaBudgetConfig &config) { _config = config; }
+
+        /**
+         * @brief Bytes currently held by the VM.
+         */
+        size_t getMemoryUsage() const { return _usedBytes; }
+
+        /**
+         * @brief Number of allocations refused because of memoryLimit.
+         */
+        uint64_t getRefusedAllocations() const { return _refusedAllocations; }
+
+       private:
+        using Clock = std::chrono::steady_clock;
+
+        static void _hook(lua_State *state, lua_Debug *debug);
+
+        /**
+         * @brief Check that a Lua error raised now only unwinds Lua frames (and pcall/xpcall).
+         */
+        bool _canRaise(lua_State *state) const;
+
+        LuaBudgetConfig _config;
+        size_t _usedBytes = 0;
+        uint64_t _refusedAllocations = 0;
+
+        ScriptStats *_current = nullptr;  // Script running now (nullptr outside budgeted calls)
+        Clock::time_point _callStart;
+        Clock::time_point _deadline;
+        bool _aborted = false;
+        std::chrono::nanoseconds _tickSpent{0};
+
+        lua_CFunction _pcall = nullptr;  // C functions an abort may unwind through
+        lua_CFunction _xpcall = nullptr;
+    };
+
+}  // namespace scripting
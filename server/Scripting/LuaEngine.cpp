@@ -6,8 +6,12 @@
 */
 
 #include "LuaEngine.hpp"
+#include <algorithm>
+#include <ctime>
 #include <filesystem>
+#include <random>
 #include <unordered_set>
+#include "ScriptChunkCache.hpp"
 
 #include "LuaBindings/ComponentBindings.hpp"
 #include "LuaBindings/EntityBindings.hpp"
@@ -18,10 +22,22 @@
 #include "common/Logger/Logger.hpp"
 
 namespace scripting {
-    LuaEngine::LuaEngine(const std::string &scriptPath)
-        : _scriptPath(scriptPath), _world(nullptr), _bindingsInitialized(false) {
+    namespace {
+        // Global functions a script may define; copied into its cache entry after loading
+        constexpr const char *SCRIPT_HOOKS[] = {"onUpdate", "onUpdateBatch", "onInit", "onDestroy",
+                                                "onGameStart"};
+    }  // namespace
+
+    LuaEngine::LuaEngine(const std::string &scriptPath, const LuaBudgetConfig &budget)
+        : _budget(std::make_unique<LuaBudget>(budget)),
+          _lua(sol::default_at_panic, &LuaBudget::allocate, _budget.get()),
+          _scriptPath(scriptPath),
+          _world(nullptr),
+          _bindingsInitialized(false),
+          _random(std::random_device{}()) {
         _lua.open_libraries(sol::lib::base, sol::lib::package, sol::lib::math, sol::lib::table,
                             sol::lib::string);
+        _budget->installHook(_lua.lua_state());
 
         LOG_INFO("LuaEngine initialized with script path: " + scriptPath);
         LOG_WARNING("Lua bindings not yet initialized. Call setWorld() before executing scripts.");
@@ -72,8 +88,15 @@ namespace scripting {
                 return false;
             }
             try {
-                // Load the script file
-                const sol::load_result loadResult = _lua.load_file(p.string());
+                // Load the compiled chunk shared by every room instead of recompiling the file
+                std::string compileError;
+                const auto chunk = ScriptChunkCache::instance().get(p, compileError);
+                if (!chunk) {
+                    LOG_ERROR("Lua error loading " + p.string() + ": " + compileError);
+                    return false;
+                }
+                const sol::load_result loadResult =
+                    _lua.load(chunk->bytecode, chunk->chunkName, sol::load_mode::binary);
                 if (!loadResult.valid()) {
                     const sol::error err = loadResult;
                     LOG_ERROR("Lua error loading " + p.string() + ": " + std::string(err.what()));
@@ -82,6 +105,13 @@ namespace scripting {
 
                 const sol::protected_function scriptFunc = loadResult;
 
+                // Forget the hooks of the previously loaded script so they are not
+                // attributed to this one if it does not define them
+                sol::table globals = _lua.globals();
+                for (const char *hook : SCRIPT_HOOKS) {
+                    globals[hook] = sol::lua_nil;
+                }
+
                 // Execute in global environment
                 sol::protected_function_result result = scriptFunc();
                 if (!result.valid()) {
@@ -93,23 +123,16 @@ namespace scripting {
                 // Create a table that captures the state after script execution
                 // Copy only the essential functions (onUpdate, onInit, etc.) not everything
                 sol::table scriptTable = _lua.create_table();
-                sol::table globals = _lua.globals();
 
                 // Copy only known script functions to avoid deep copy issues
-                if (globals["onUpdate"].valid()) {
-                    scriptTable["onUpdate"] = globals["onUpdate"];
-                }
-                if (globals["onInit"].valid()) {
-                    scriptTable["onInit"] = globals["onInit"];
-                }
-                if (globals["onDestroy"].valid()) {
-                    scriptTable["onDestroy"] = globals["onDestroy"];
-                }
-                if (globals["onGameStart"].valid()) {
-                    scriptTable["onGameStart"] = globals["onGameStart"];
+                for (const char *hook : SCRIPT_HOOKS) {
+                    if (globals[hook].valid()) {
+                        scriptTable[hook] = globals[hook];
+                    }
                 }
 
                 _scriptCache[scriptPath] = scriptTable;
+                registerScript(scriptPath, scriptTable);
                 LOG_INFO("Loaded Lua script: " + scriptPath + " (" + p.string() + ")");
                 return true;
             } catch (const sol::error &e) {
@@ -178,7 +201,9 @@ namespace scripting {
 
             sol::protected_function onGameStart = onGameStartOpt.value();
 
-            sol::protected_function_result result = onGameStart(entity);
+            const ScriptId scriptId = _scriptIds.at(scriptPath);
+            sol::protected_function_result result =
+                budgetedCall(_scripts[scriptId].stats, nullptr, onGameStart, entity);
             if (!result.valid()) {
                 sol::error err = result;
                 LOG_ERROR("Lua runtime error in " + scriptPath + ": " + std::string(err.what()));
@@ -190,6 +215,193 @@ namespace scripting {
         }
     }
 
+    template <typename... Args>
+    sol::protected_function_result LuaEngine::budgetedCall(ScriptStats &stats, LoadedScript *script,
+                                                           sol::protected_function &function,
+                                                           Args &&...args) {
+        _budget->beginCall(stats);
+        sol::protected_function_result result;
+        try {
+            result = function(std::forward<Args>(args)...);
+        } catch (...) {
+            _budget->endCall();
+            throw;
+        }
+        const bool aborted = _budget->endCall();
+
+        // Only update calls are throttled; a runaway onGameStart is just aborted
+        if (script != nullptr) {
+            if (!aborted) {
+                script->throttleStrikes = 0;
+            } else {
+                script->throttleStrikes = std::min<uint32_t>(script->throttleStrikes + 1, 31);
+                const uint64_t pause = std::min<uint64_t>(uint64_t{1} << (script->throttleStrikes - 1),
+                                                          _budget->getConfig().maxThrottleTicks);
+                script->resumeTick = _tick + 1 + pause;
+                LOG_WARNING("Lua script " + script->path + " exceeded its time budget, paused for " +
+                            std::to_string(pause) + " tick(s)");
+            }
+        }
+        return result;
+    }
+
+    bool LuaEngine::canRun(LoadedScript &script) {
+        if (!_inTick) {
+            return true;
+        }
+        if (_tick < script.resumeTick || !_budget->hasTickBudget()) {
+            script.stats.deferredCalls++;
+            return false;
+        }
+        return true;
+    }
+
+    void LuaEngine::beginTick() {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+        _tick++;
+        _inTick = true;
+        _budget->beginTick();
+    }
+
+    void LuaEngine::endTick() {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+        _inTick = false;
+    }
+
+    bool LuaEngine::hasTickBudget() const {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+        return !_inTick || _budget->hasTickBudget();
+    }
+
+    void LuaEngine::deferUpdates(ScriptId scriptId, size_t count) {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+        if (scriptId < _scripts.size()) {
+            _scripts[scriptId].stats.deferredCalls += count;
+        }
+    }
+
+    bool LuaEngine::isThrottled(ScriptId scriptId) const {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+        return scriptId < _scripts.size() && _tick < _scripts[scriptId].resumeTick;
+    }
+
+    ScriptStats LuaEngine::getScriptStats(const std::string &scriptPath) const {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+        auto it = _scriptIds.find(scriptPath);
+        return (it != _scriptIds.end()) ? _scripts[it->second].stats : ScriptStats{};
+    }
+
+    std::unordered_map<std::string, ScriptStats> LuaEngine::getAllScriptStats() const {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+        std::unordered_map<std::string, ScriptStats> stats;
+        for (const auto &script : _scripts) {
+            stats.emplace(script.path, script.stats);
+        }
+        return stats;
+    }
+
+    size_t LuaEngine::getMemoryUsage() const {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+        return _budget->getMemoryUsage();
+    }
+
+    LuaBudgetConfig LuaEngine::getBudget() const {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+        return _budget->getConfig();
+    }
+
+    void LuaEngine::setBudget(const LuaBudgetConfig &budget) {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+        _budget->setConfig(budget);
+        _budget->installHook(_lua.lua_state());
+    }
+
+    void LuaEngine::setDeterministic(uint64_t seed) {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+        LuaBudgetConfig budget = _budget->getConfig();
+        budget.tickBudget = std::chrono::microseconds{0};
+        budget.callBudget = std::chrono::microseconds{0};
+        setBudget(budget);
+
+        _random.seed(seed);
+        _simulationTime = 0.0;
+        _deterministic = true;
+        LOG_INFO("LuaEngine: deterministic mode enabled (seed " + std::to_string(seed) + ")");
+    }
+
+    bool LuaEngine::isDeterministic() const {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+        return _deterministic;
+    }
+
+    void LuaEngine::seedRandom(uint64_t seed) {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+        _random.seed(seed);
+    }
+
+    void LuaEngine::advanceTime(float deltaTime) {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+        _simulationTime += deltaTime;
+    }
+
+    double LuaEngine::getTime() const {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+        if (_deterministic) {
+            return _simulationTime;
+        }
+        return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+    }
+
+    void LuaEngine::registerScript(const std::string &scriptPath, const sol::table &scriptTable) {
+        auto it = _scriptIds.find(scriptPath);
+        if (it == _scriptIds.end()) {
+            it = _scriptIds.emplace(scriptPath, static_cast<ScriptId>(_scripts.size())).first;
+            _scripts.emplace_back();
+        }
+
+        LoadedScript &script = _scripts[it->second];
+        script.path = scriptPath;
+        script.onUpdate = sol::protected_function();
+        script.onUpdateBatch = sol::protected_function();
+
+        sol::optional<sol::protected_function> onUpdate = scriptTable["onUpdate"];
+        if (onUpdate) {
+            script.onUpdate = onUpdate.value();
+        }
+        sol::optional<sol::protected_function> onUpdateBatch = scriptTable["onUpdateBatch"];
+        if (onUpdateBatch) {
+            script.onUpdateBatch = onUpdateBatch.value();
+            if (!script.batchTable.valid()) {
+                script.batchEntities = _lua.create_table();
+                script.batchX = _lua.create_table();
+                script.batchY = _lua.create_table();
+                script.batchTable = _lua.create_table_with("count", 0, "entities", script.batchEntities, "x",
+                                                           script.batchX, "y", script.batchY);
+                script.batchSize = 0;
+            }
+        }
+    }
+
+    LuaEngine::ScriptId LuaEngine::resolveScript(const std::string &scriptPath) {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+
+        auto it = _scriptIds.find(scriptPath);
+        if (it != _scriptIds.end()) {
+            return it->second;
+        }
+        if (!loadScript(scriptPath)) {
+            return INVALID_SCRIPT_ID;
+        }
+        it = _scriptIds.find(scriptPath);
+        return (it != _scriptIds.end()) ? it->second : INVALID_SCRIPT_ID;
+    }
+
+    bool LuaEngine::hasUpdateBatch(ScriptId scriptId) const {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
+
+        return scriptId < _scripts.size() && _scripts[scriptId].onUpdateBatch.valid();
+    }
+
     void LuaEngine::executeUpdate(const std::string &scriptPath, ecs::wrapper::Entity entity,
                                   float deltaTime) {
         std::lock_guard<std::recursive_mutex> lock(_luaMutex);
@@ -199,85 +411,108 @@ namespace scripting {
             return;
         }
 
-        // wave_manager uses cached shared state (not per-entity)
-        bool isWaveManager = (scriptPath.find("wave_manager") != std::string::npos);
-
-        if (isWaveManager) {
-            // Use cached version for wave_manager (shared state, not per-entity)
-            if (_scriptCache.find(scriptPath) == _scriptCache.end()) {
-                if (!loadScript(scriptPath)) {
-                    return;
-                }
-            }
-
-            try {
-                sol::table script = _scriptCache[scriptPath];
-                sol::optional<sol::function> onUpdateOpt = script["onUpdate"];
+        const ScriptId scriptId = resolveScript(scriptPath);
+        if (scriptId != INVALID_SCRIPT_ID) {
+            executeUpdate(scriptId, entity, deltaTime);
+        }
+    }
 
-                if (!onUpdateOpt) {
-                    LOG_WARNING("Script " + scriptPath + " has no onUpdate function");
-                    return;
-                }
+    void LuaEngine::executeUpdate(ScriptId scriptId, ecs::wrapper::Entity entity, float deltaTime) {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
 
-                sol::protected_function onUpdate = onUpdateOpt.value();
-                sol::protected_function_result result = onUpdate(entity, deltaTime);
-                if (!result.valid()) {
-                    sol::error err = result;
-                    LOG_ERROR("Lua runtime error in " + scriptPath + ": " + std::string(err.what()));
-                }
-            } catch (const sol::error &e) {
-                LOG_ERROR("Lua runtime error in " + scriptPath + ": " + std::string(e.what()));
-            } catch (const std::exception &e) {
-                LOG_ERROR("C++ exception in executeUpdate: " + std::string(e.what()));
-            }
-            return;  // Exit here for wave_manager
+        if (!_world || !_bindingsInitialized) {
+            LOG_ERROR("LuaEngine not properly initialized. Call setWorld() first.");
+            return;
+        }
+        if (scriptId >= _scripts.size()) {
+            LOG_ERROR("Unknown script id: " + std::to_string(scriptId));
+            return;
         }
 
-        // For entity scripts (enemy_*): use simple cached script execution
-        // No complex per-entity environments - rely on local variables in Lua
-
-        // Use cached version (same as wave_manager)
-        if (_scriptCache.find(scriptPath) == _scriptCache.end()) {
-            if (!loadScript(scriptPath)) {
-                return;
-            }
+        LoadedScript &script = _scripts[scriptId];
+        if (!script.onUpdate.valid()) {
+            LOG_WARNING("Script " + script.path + " has no onUpdate function");
+            return;
+        }
+        if (!canRun(script)) {
+            return;
         }
 
         try {
-            sol::table script = _scriptCache[scriptPath];
-
-            // Validate that the table is still valid
-            if (!script.valid()) {
-                LOG_ERROR("Cached script table is invalid for: " + scriptPath);
-                _scriptCache.erase(scriptPath);  // Remove invalid cache
-                return;
+            sol::protected_function_result result =
+                budgetedCall(script.stats, &script, script.onUpdate, entity, deltaTime);
+            if (!result.valid()) {
+                sol::error err = result;
+                LOG_ERROR("Lua runtime error in " + script.path + ": " + std::string(err.what()));
             }
+        } catch (const sol::error &e) {
+            LOG_ERROR("Lua runtime error in " + script.path + ": " + std::string(e.what()));
+        } catch (const std::exception &e) {
+            LOG_ERROR("C++ exception in executeUpdate: " + std::string(e.what()));
+        }
+    }
 
-            sol::optional<sol::function> onUpdateOpt = script["onUpdate"];
+    bool LuaEngine::executeUpdateBatch(ScriptId scriptId, UpdateBatch &batch, float deltaTime) {
+        std::lock_guard<std::recursive_mutex> lock(_luaMutex);
 
-            if (!onUpdateOpt) {
-                LOG_WARNING("Script " + scriptPath + " has no onUpdate function");
-                return;
-            }
+        if (!_world || !_bindingsInitialized) {
+            LOG_ERROR("LuaEngine not properly initialized. Call setWorld() first.");
+            return false;
+        }
+        if (scriptId >= _scripts.size() || !_scripts[scriptId].onUpdateBatch.valid()) {
+            LOG_ERROR("Script id " + std::to_string(scriptId) + " has no onUpdateBatch function");
+            return false;
+        }
 
-            sol::protected_function onUpdate = onUpdateOpt.value();
+        LoadedScript &script = _scripts[scriptId];
+        const size_t count = batch.size();
+        if (!canRun(script)) {
+            return false;
+        }
 
-            // Validate function before calling
-            if (!onUpdate.valid()) {
-                LOG_ERROR("onUpdate function is invalid for: " + scriptPath);
-                return;
+        try {
+            // Fill the reused arrays in place, then drop leftovers from a bigger previous batch
+            for (size_t i = 0; i < count; ++i) {
+                const auto index = static_cast<int>(i + 1);
+                script.batchEntities.raw_set(index, batch.entities[i]);
+                script.batchX.raw_set(index, batch.x[i]);
+                script.batchY.raw_set(index, batch.y[i]);
             }
+            for (size_t i = count; i < script.batchSize; ++i) {
+                const auto index = static_cast<int>(i + 1);
+                script.batchEntities.raw_set(index, sol::lua_nil);
+                script.batchX.raw_set(index, sol::lua_nil);
+                script.batchY.raw_set(index, sol::lua_nil);
+            }
+            script.batchSize = count;
+            script.batchTable.raw_set("count", count);
 
-            sol::protected_function_result result = onUpdate(entity, deltaTime);
+            sol::protected_function_result result =
+                budgetedCall(script.stats, &script, script.onUpdateBatch, script.batchTable, deltaTime);
             if (!result.valid()) {
                 sol::error err = result;
-                LOG_ERROR("Lua runtime error in " + scriptPath + ": " + std::string(err.what()));
+                LOG_ERROR("Lua runtime error in " + script.path + ": " + std::string(err.what()));
+                return false;
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                const auto index = static_cast<int>(i + 1);
+                const sol::optional<float> x = script.batchX.raw_get<sol::optional<float>>(index);
+                const sol::optional<float> y = script.batchY.raw_get<sol::optional<float>>(index);
+                if (x) {
+                    batch.x[i] = x.value();
+                }
+                if (y) {
+                    batch.y[i] = y.value();
+                }
             }
+            return true;
         } catch (const sol::error &e) {
-            LOG_ERROR("Lua runtime error in " + scriptPath + ": " + std::string(e.what()));
+            LOG_ERROR("Lua runtime error in " + script.path + ": " + std::string(e.what()));
         } catch (const std::exception &e) {
-            LOG_ERROR("C++ exception in executeUpdate: " + std::string(e.what()));
+            LOG_ERROR("C++ exception in executeUpdateBatch: " + std::string(e.what()));
         }
+        return false;
     }
 
     template <typename... Args>
@@ -330,7 +565,9 @@ namespace scripting {
 
         for (auto &callback : _gameStartCallbacks) {
             try {
-                sol::protected_function_result result = callback(roomId);
+                sol::protected_function function = callback;
+                sol::protected_function_result result =
+                    budgetedCall(_callbackStats, nullptr, function, roomId);
                 if (!result.valid()) {
                     sol::error err = result;
                     LOG_ERROR("Lua error in game start callback: " + std::string(err.what()));
@@ -7,13 +7,17 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <sol/sol.hpp>
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include "LuaBudget.hpp"
+#include "common/ECS/Systems/DeterminismSystem/DeterministicRandom.hpp"
 #include "common/ECSWrapper/ECSWorld.hpp"
 
 namespace scripting {
@@ -27,11 +31,48 @@ namespace scripting {
      */
     class LuaEngine {
        public:
+        /**
+         * @brief Identifier of a loaded script, stable for the lifetime of the engine.
+         */
+        using ScriptId = uint32_t;
+
+        /**
+         * @brief ScriptId value meaning "script not loaded".
+         */
+        static constexpr ScriptId INVALID_SCRIPT_ID = std::numeric_limits<ScriptId>::max();
+
+        /**
+         * @struct UpdateBatch
+         * @brief Packed state of every entity running the same script this tick.
+         *
+         * Filled by LuaSystemAdapter and handed to the script's onUpdateBatch() as
+         * plain Lua arrays. Positions written by the script are copied back into
+         * x / y; entities without a Transform have hasTransform[i] == 0 and their
+         * position is ignored.
+         */
+        struct UpdateBatch {
+            std::vector<ecs::Address> entities;
+            std::vector<float> x;
+            std::vector<float> y;
+            std::vector<uint8_t> hasTransform;
+
+            void clear() {
+                entities.clear();
+                x.clear();
+                y.clear();
+                hasTransform.clear();
+            }
+
+            size_t size() const { return entities.size(); }
+        };
+
         /**
          * @brief Constructor with scripts directory path.
          * @param scriptsPath Base path for Lua scripts
+         * @param budget Memory and time limits of this engine's VM
          */
-        explicit LuaEngine(const std::string &scriptPath = "server/Scripting/scripts/");
+        explicit LuaEngine(const std::string &scriptPath = "server/Scripting/scripts/",
+                           const LuaBudgetConfig &budget = LuaBudgetConfig());
 
         /**
          * @brief Set the ECS world for entity operations.
@@ -51,6 +92,20 @@ namespace scripting {
          */
         bool loadScript(const std::string &scriptPath);
 
+        /**
+         * @brief Get the id of a script, loading it on first use.
+         * @param scriptPath Relative path to script file
+         * @return ScriptId The script id, or INVALID_SCRIPT_ID if it could not be loaded.
+         */
+        ScriptId resolveScript(const std::string &scriptPath);
+
+        /**
+         * @brief Check whether a loaded script defines onUpdateBatch(batch, deltaTime).
+         * @param scriptId Id returned by resolveScript()
+         * @return true if the script uses the batched update ABI
+         */
+        bool hasUpdateBatch(ScriptId scriptId) const;
+
         /**
          * @brief Execute onUpdate function for an entity's script.
          * @param scriptPath Path to the script
@@ -59,6 +114,31 @@ namespace scripting {
          */
         void executeUpdate(const std::string &scriptPath, ecs::wrapper::Entity entity, float deltaTime);
 
+        /**
+         * @brief Execute onUpdate function for an entity's script (no path lookup).
+         *
+         * Skipped, and counted as deferred, while the tick budget is spent or
+         * the script is throttled.
+         *
+         * @param scriptId Id returned by resolveScript()
+         * @param entity Entity wrapper
+         * @param deltaTime Frame delta time
+         */
+        void executeUpdate(ScriptId scriptId, ecs::wrapper::Entity entity, float deltaTime);
+
+        /**
+         * @brief Run a script's onUpdateBatch once for all of its entities.
+         *
+         * The script receives a table { count, entities, x, y } of 1-based
+         * arrays; the positions it writes are copied back into batch.x / batch.y.
+         *
+         * @param scriptId Id returned by resolveScript()
+         * @param batch Entities running the script and their positions (updated in place)
+         * @param deltaTime Frame delta time
+         * @return true if the script ran without error (false if deferred, failed or aborted)
+         */
+        bool executeUpdateBatch(ScriptId scriptId, UpdateBatch &batch, float deltaTime);
+
         /**
          * @brief Execute onGameStart function for an entity's script.
          * @param scriptPath Path to the script
@@ -99,10 +179,129 @@ namespace scripting {
          */
         void cleanupEntity(uint32_t entityId);
 
+        /**
+         * @brief Start a server tick: scripts share LuaBudgetConfig::tickBudget until endTick().
+         *
+         * Outside a tick only the per-call budget applies (and throttling is off).
+         */
+        void beginTick();
+
+        /**
+         * @brief End the current server tick.
+         */
+        void endTick();
+
+        /**
+         * @brief Check whether scripts may still start during the current tick.
+         * @return false once the tick budget is spent (always true outside a tick)
+         */
+        bool hasTickBudget() const;
+
+        /**
+         * @brief Count updates skipped by the caller because the tick budget is spent.
+         * @param scriptId Id returned by resolveScript()
+         * @param count Number of skipped calls
+         */
+        void deferUpdates(ScriptId scriptId, size_t count);
+
+        /**
+         * @brief Check whether a script is paused after exceeding its call budget.
+         * @param scriptId Id returned by resolveScript()
+         */
+        bool isThrottled(ScriptId scriptId) const;
+
+        /**
+         * @brief Get the CPU and allocation counters of a script.
+         * @param scriptPath Path the script was loaded with
+         * @return ScriptStats Counters (all zero if the script was never loaded)
+         */
+        ScriptStats getScriptStats(const std::string &scriptPath) const;
+
+        /**
+         * @brief Get the counters of every loaded script, keyed by script path.
+         */
+        std::unordered_map<std::string, ScriptStats> getAllScriptStats() const;
+
+        /**
+         * @brief Bytes currently held by this engine's Lua VM.
+         */
+        size_t getMemoryUsage() const;
+
+        /**
+         * @brief Get the memory and time limits of this engine.
+         */
+        LuaBudgetConfig getBudget() const;
+
+        /**
+         * @brief Change the memory and time limits of this engine.
+         */
+        void setBudget(const LuaBudgetConfig &budget);
+
+        /**
+         * @brief Make scripts reproducible: same seed and inputs, same script behaviour.
+         *
+         * Seeds random() / randomInt() / math.random, makes getTime() return
+         * simulated time, and turns off the wall-clock time budgets (whether a
+         * call is deferred or aborted would depend on host speed). The memory
+         * cap still applies.
+         *
+         * @param seed Seed of the script random generator
+         */
+        void setDeterministic(uint64_t seed);
+
+        /**
+         * @brief Check whether setDeterministic() was called.
+         */
+        bool isDeterministic() const;
+
+        /**
+         * @brief Restart the script random generator from a seed (math.randomseed).
+         */
+        void seedRandom(uint64_t seed);
+
+        /**
+         * @brief Get the generator behind random(), randomInt() and math.random.
+         */
+        ecs::DeterministicRandom &getRandom() { return _random; }
+
+        /**
+         * @brief Advance the simulated time returned by getTime() in deterministic mode.
+         * @param deltaTime Simulated seconds elapsed this tick
+         */
+        void advanceTime(float deltaTime);
+
+        /**
+         * @brief Time seen by scripts.
+         * @return double Simulated seconds in deterministic mode, process CPU time otherwise
+         */
+        double getTime() const;
+
        private:
+        /**
+         * @brief Hooks of a loaded script, resolved once at load time.
+         */
+        struct LoadedScript {
+            std::string path;
+            sol::protected_function onUpdate;
+            sol::protected_function onUpdateBatch;
+            // Batch arrays, reused every tick to avoid creating Lua garbage
+            sol::table batchTable;
+            sol::table batchEntities;
+            sol::table batchX;
+            sol::table batchY;
+            size_t batchSize = 0;  // Entries written by the previous batch
+            // Budget accounting
+            ScriptStats stats;
+            uint32_t throttleStrikes = 0;  // Consecutive aborted calls
+            uint64_t resumeTick = 0;       // First tick the script may run again
+        };
+
+        std::unique_ptr<LuaBudget> _budget;  // Declared before _lua: the VM allocates through it
         sol::state _lua;
         std::string _scriptPath;
         std::unordered_map<std::string, sol::table> _scriptCache;
+        std::unordered_map<std::string, ScriptId> _scriptIds;
+        std::vector<LoadedScript> _scripts;
         // Per-entity script state (for enemy scripts with local variables)
         std::unordered_map<uint32_t, std::unordered_map<std::string, sol::table>> _entityScriptCache;
         ecs::wrapper::ECSWorld *_world;
@@ -110,10 +309,24 @@ namespace scripting {
         mutable std::recursive_mutex _luaMutex;  // Protects _lua and _scriptCache from concurrent access
 
         void initializeBindings();
+        void registerScript(const std::string &scriptPath, const sol::table &scriptTable);
+        bool canRun(LoadedScript &script);
+        template <typename... Args>
+        sol::protected_function_result budgetedCall(ScriptStats &stats, LoadedScript *script,
+                                                    sol::protected_function &function, Args &&...args);
         //void bindComponents();
 
         // Game start callbacks registered via onGameStart()
         std::vector<sol::function> _gameStartCallbacks;
+        ScriptStats _callbackStats;  // Game start callbacks are not tied to one script
+
+        uint64_t _tick = 0;
+        bool _inTick = false;
+
+        // Deterministic mode
+        ecs::DeterministicRandom _random;
+        bool _deterministic = false;
+        double _simulationTime = 0.0;
     };
 
 }  // namespace scripting
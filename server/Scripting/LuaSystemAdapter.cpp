@@ -6,7 +6,9 @@
 */
 
 #include "LuaSystemAdapter.hpp"
+#include <optional>
 #include "common/ECS/Components/LuaScript.hpp"
+#include "common/ECS/Components/Transform.hpp"
 #include "common/Logger/Logger.hpp"
 
 namespace scripting {
@@ -27,54 +29,152 @@ namespace scripting {
             return;
         }
 
-        auto entities = registry.getEntitiesWithMask(this->getComponentMask());
+        for (auto &group : _groups) {
+            group.batch.clear();
+        }
+
+        // Group entities by script; scripts run after the pass since they call back into the registry
+        registry.each<ecs::LuaScript>([this](ecs::Address entityAddr, const ecs::LuaScript &luaScript) {
+            const std::string &scriptPath = luaScript.getScriptPath();
+            if (scriptPath.empty()) {
+                return;
+            }
+
+            auto it = _groupIndex.find(scriptPath);
+            if (it == _groupIndex.end()) {
+                it = _groupIndex.emplace(scriptPath, _groups.size()).first;
+                _groups.emplace_back().scriptPath = scriptPath;
+            }
+            _groups[it->second].batch.entities.push_back(entityAddr);
+        });
+
+        // Scripts share the engine's tick budget. When it runs out, the remaining
+        // groups are deferred and the next tick starts with the first of them.
+        _luaEngine->advanceTime(deltaTime);
+        _luaEngine->beginTick();
+        const size_t groupCount = _groups.size();
+        std::optional<size_t> firstDeferred;
+
+        for (size_t n = 0; n < groupCount; ++n) {
+            const size_t index = (_resumeGroup + n) % groupCount;
+            auto &group = _groups[index];
+
+            if (group.batch.entities.empty()) {
+                continue;
+            }
+            if (group.scriptId == LuaEngine::INVALID_SCRIPT_ID) {
+                group.scriptId = _luaEngine->resolveScript(group.scriptPath);
+                if (group.scriptId == LuaEngine::INVALID_SCRIPT_ID) {
+                    continue;
+                }
+            }
+            if (firstDeferred) {
+                _luaEngine->deferUpdates(group.scriptId, group.batch.entities.size());
+                continue;
+            }
+
+            const bool completed = _luaEngine->hasUpdateBatch(group.scriptId)
+                                       ? _updateBatched(registry, group, deltaTime)
+                                       : _updatePerEntity(registry, group, deltaTime);
+            if (!completed) {
+                firstDeferred = index;
+            }
+        }
+
+        _luaEngine->endTick();
+        _resumeGroup = firstDeferred.value_or(0);
+    }
 
-        static int logCounter = 0;
-        if (++logCounter % 60 == 0) {
-            //LOG_INFO("LuaSystemAdapter: Processing " + std::to_string(entities.size()) +
-            //        " entities with LuaScript component");
+    bool LuaSystemAdapter::_updateBatched(ecs::Registry &registry, ScriptGroup &group, float deltaTime) {
+        auto &batch = group.batch;
+
+        if (!_luaEngine->hasTickBudget()) {
+            _luaEngine->deferUpdates(group.scriptId, batch.size());
+            return false;
+        }
+
+        // Read positions now rather than during grouping: a script run earlier this
+        // tick may have moved or destroyed these entities
+        size_t alive = 0;
+        for (const auto entityAddr : batch.entities) {
+            if (!registry.hasComponent<ecs::LuaScript>(entityAddr)) {
+                _luaEngine->cleanupEntity(entityAddr);
+                continue;
+            }
+            batch.entities[alive++] = entityAddr;
+            const bool hasTransform = registry.hasComponent<ecs::Transform>(entityAddr);
+            const auto position =
+                hasTransform ? registry.getComponent<ecs::Transform>(entityAddr).getPosition()
+                             : ecs::Transform::Vector2{0.0f, 0.0f};
+            batch.x.push_back(position.x);
+            batch.y.push_back(position.y);
+            batch.hasTransform.push_back(hasTransform ? 1 : 0);
+        }
+        batch.entities.resize(alive);
+        if (alive == 0) {
+            return true;
+        }
+        group.initialX.assign(batch.x.begin(), batch.x.end());
+        group.initialY.assign(batch.y.begin(), batch.y.end());
+
+        if (!_luaEngine->executeUpdateBatch(group.scriptId, batch, deltaTime)) {
+            // Failed, aborted or throttled: only a spent tick budget defers the next groups
+            return _luaEngine->hasTickBudget();
+        }
+
+        // Write back only what the script changed, so edits made through the
+        // Entity API (or to destroyed entities) are left alone
+        for (size_t i = 0; i < batch.size(); ++i) {
+            const bool moved = batch.x[i] != group.initialX[i] || batch.y[i] != group.initialY[i];
+            if (!batch.hasTransform[i] || !moved) {
+                continue;
+            }
+            const auto entityAddr = batch.entities[i];
+            if (!registry.hasComponent<ecs::Transform>(entityAddr)) {
+                continue;
+            }
+            registry.getComponent<ecs::Transform>(entityAddr).setPosition(batch.x[i], batch.y[i]);
         }
+        return true;
+    }
 
-        for (const auto &entityAddr : entities) {
+    bool LuaSystemAdapter::_updatePerEntity(ecs::Registry &registry, ScriptGroup &group, float deltaTime) {
+        const auto &entities = group.batch.entities;
+
+        for (size_t i = 0; i < entities.size(); ++i) {
+            const auto entityAddr = entities[i];
+            if (!_luaEngine->hasTickBudget()) {
+                _luaEngine->deferUpdates(group.scriptId, entities.size() - i);
+                return false;
+            }
             try {
                 // Check if entity still has LuaScript component
                 // (may have been destroyed by previous script execution)
-                try {
-                    if (!registry.hasComponent<ecs::LuaScript>(entityAddr)) {
-                        continue;
-                    }
-                } catch (...) {
-                    // Entity doesn't exist anymore, skip it
+                if (!registry.hasComponent<ecs::LuaScript>(entityAddr)) {
                     _luaEngine->cleanupEntity(entityAddr);
                     continue;
                 }
 
-                auto &luaScript = registry.getComponent<ecs::LuaScript>(entityAddr);
-                const std::string &scriptPath = luaScript.getScriptPath();
-
-                if (scriptPath.empty()) {
-                    continue;
-                }
-
                 // Convert Registry address to ECSWorld Entity wrapper
                 ecs::wrapper::Entity entity = _world->getEntity(entityAddr);
 
                 if (!entity.isValid()) {
                     LOG_WARNING("Invalid entity " + std::to_string(entityAddr) +
-                                " for script: " + scriptPath);
+                                " for script: " + group.scriptPath);
                     // Clean up script cache for invalid entity
                     _luaEngine->cleanupEntity(entityAddr);
                     continue;
                 }
 
                 // Execute the script via LuaEngine
-                _luaEngine->executeUpdate(scriptPath, entity, deltaTime);
+                _luaEngine->executeUpdate(group.scriptId, entity, deltaTime);
 
             } catch (const std::exception &e) {
                 LOG_ERROR("Error executing Lua script for entity " + std::to_string(entityAddr) + ": " +
                           std::string(e.what()));
             }
         }
+        return true;
     }
 
     ecs::ComponentMask LuaSystemAdapter::getComponentMask() const {
@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include "LuaEngine.hpp"
 #include "common/ECS/Components/LuaScript.hpp"
 #include "common/ECS/Systems/ISystem.hpp"
@@ -20,6 +23,14 @@ namespace scripting {
      * Integrates the Lua scripting engine with the ECS system,
      * executing scripts attached to entities via LuaScript components.
      * Requires LuaScript component.
+     *
+     * Entities are grouped by script every tick. A script defining
+     * onUpdateBatch(batch, deltaTime) is called once for its whole group
+     * with packed positions; other scripts get one onUpdate(entity, deltaTime)
+     * call per entity.
+     *
+     * Scripts share the LuaEngine tick budget: once it is spent the remaining
+     * groups are deferred to the next tick, which starts with them.
      */
     class LuaSystemAdapter : public ecs::ISystem {
        public:
@@ -49,8 +60,29 @@ namespace scripting {
         ecs::ComponentMask getComponentMask() const override;
 
        private:
+        /**
+         * @brief Entities sharing a script during the current tick.
+         */
+        struct ScriptGroup {
+            std::string scriptPath;
+            LuaEngine::ScriptId scriptId = LuaEngine::INVALID_SCRIPT_ID;
+            LuaEngine::UpdateBatch batch;  // Buffers reused across ticks
+            std::vector<float> initialX;   // Positions before onUpdateBatch, to detect writes
+            std::vector<float> initialY;
+        };
+
+        /**
+         * @brief Run one group's script.
+         * @return false if the tick budget ran out before the whole group was updated
+         */
+        bool _updateBatched(ecs::Registry &registry, ScriptGroup &group, float deltaTime);
+        bool _updatePerEntity(ecs::Registry &registry, ScriptGroup &group, float deltaTime);
+
         LuaEngine *_luaEngine;
         ecs::wrapper::ECSWorld *_world;
+        std::unordered_map<std::string, size_t> _groupIndex;  // Script path -> index in _groups
+        std::vector<ScriptGroup> _groups;
+        size_t _resumeGroup = 0;  // First group to run next tick (the one deferred last tick)
     };
 
 }  // namespace scripting
@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** ScriptChunkCache implementation
+*/
+
+#include "ScriptChunkCache.hpp"
+#include "common/Logger/Logger.hpp"
+
+namespace scripting {
+
+    ScriptChunkCache &ScriptChunkCache::instance() {
+        static ScriptChunkCache cache;
+        return cache;
+    }
+
+    ScriptChunkCache::ScriptChunkCache() = default;
+
+    std::shared_ptr<const ScriptChunkCache::Chunk> ScriptChunkCache::get(const std::filesystem::path &path,
+                                                                         std::string &error) {
+        namespace fs = std::filesystem;
+
+        std::error_code ec;
+        const auto modified = fs::last_write_time(path, ec);
+        const auto fileSize = ec ? 0 : fs::file_size(path, ec);
+        if (ec) {
+            error = ec.message();
+            return nullptr;
+        }
+
+        const std::string key = path.lexically_normal().string();
+        {
+            std::shared_lock lock(_mutex);
+            auto it = _chunks.find(key);
+            if (it != _chunks.end() && it->second->modified == modified && it->second->fileSize == fileSize) {
+                _hits.fetch_add(1, std::memory_order_relaxed);
+                return it->second;
+            }
+        }
+
+        auto chunk = std::make_shared<Chunk>();
+        chunk->chunkName = path.string();
+        chunk->modified = modified;
+        chunk->fileSize = fileSize;
+        {
+            std::lock_guard lock(_compileMutex);
+
+            const sol::load_result loadResult = _compiler.load_file(path.string());
+            if (!loadResult.valid()) {
+                const sol::error err = loadResult;
+                error = err.what();
+                return nullptr;
+            }
+            const sol::protected_function function = loadResult;
+            const sol::bytecode bytecode = function.dump();
+            chunk->bytecode.assign(bytecode.as_string_view());
+        }
+        _compilations.fetch_add(1, std::memory_order_relaxed);
+        LOG_DEBUG("Compiled Lua chunk: " + key + " (" + std::to_string(chunk->bytecode.size()) + " bytes)");
+
+        std::unique_lock lock(_mutex);
+        _chunks[key] = chunk;
+        return chunk;
+    }
+
+    void ScriptChunkCache::clear() {
+        std::unique_lock lock(_mutex);
+        _chunks.clear();
+    }
+
+    size_t ScriptChunkCache::size() const {
+        std::shared_lock lock(_mutex);
+        return _chunks.size();
+    }
+
+}  // namespace scripting
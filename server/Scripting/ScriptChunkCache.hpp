@@ -0,0 +1,99 @@
+/*
+** EPITECH PROJECT, 2025
+** RTYPE
+** File description:
+** ScriptChunkCache - Process-wide cache of compiled Lua chunks
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <sol/sol.hpp>
+#include <string>
+#include <unordered_map>
+
+namespace scripting {
+
+    /**
+     * @class ScriptChunkCache
+     * @brief Compiles each Lua script once and shares its bytecode between rooms.
+     *
+     * Every room owns its own LuaEngine (and Lua VM), but all of them run the
+     * same files. Entries are keyed by path and invalidated when the file's
+     * modification time or size changes, so edited scripts are picked up by the
+     * next room. Lookups take a shared lock; compilation is serialized on a
+     * private Lua state that never executes anything.
+     *
+     * @code
+     * std::string error;
+     * auto chunk = ScriptChunkCache::instance().get("server/Scripting/scripts/enemy_basic.lua", error);
+     * if (chunk) {
+     *     lua.load(chunk->bytecode, chunk->chunkName, sol::load_mode::binary);
+     * }
+     * @endcode
+     */
+    class ScriptChunkCache {
+       public:
+        /**
+         * @struct Chunk
+         * @brief Compiled script, immutable once published.
+         */
+        struct Chunk {
+            std::string chunkName;  ///< Name used in Lua error messages (the file path)
+            std::string bytecode;   ///< Output of lua_dump, loadable with sol::load_mode::binary
+            std::filesystem::file_time_type modified;
+            std::uintmax_t fileSize = 0;
+        };
+
+        /**
+         * @brief Get the process-wide cache.
+         */
+        static ScriptChunkCache &instance();
+
+        /**
+         * @brief Get the compiled chunk of a script, compiling it if missing or stale.
+         * @param path Path of the script file
+         * @param error Set to the compilation or I/O error when nullptr is returned
+         * @return std::shared_ptr<const Chunk> The chunk, or nullptr on failure.
+         */
+        std::shared_ptr<const Chunk> get(const std::filesystem::path &path, std::string &error);
+
+        /**
+         * @brief Drop every cached chunk.
+         */
+        void clear();
+
+        /**
+         * @brief Number of cached chunks.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Number of lookups served from the cache.
+         */
+        uint64_t getHits() const { return _hits.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Number of lookups that had to compile the script.
+         */
+        uint64_t getCompilations() const { return _compilations.load(std::memory_order_relaxed); }
+
+       private:
+        ScriptChunkCache();
+
+        mutable std::shared_mutex _mutex;
+        std::unordered_map<std::string, std::shared_ptr<const Chunk>> _chunks;
+
+        std::mutex _compileMutex;
+        sol::state _compiler;  // Only used to compile (load + dump), never runs a chunk
+
+        std::atomic<uint64_t> _hits{0};
+        std::atomic<uint64_t> _compilations{0};
+    };
+
+}  // namespace scripting
@@ -11,36 +11,51 @@ local entityStates = {}
 local baseSpeed = 180 -- horizontal movement speed (pixels per second)
 local sineSpeed = 2.5 -- oscillation frequency
 local sineAmplitude = 1 -- oscillation amplitude
-
-function onUpdate(entity, deltaTime)
-	if not entity:isValid() or not entity:hasTransform() then
-		return
-	end
-
-	local addr = entity:getAddress()
-	local transform = entity:getTransform()
-
-	-- Initialize per-entity state on first update
-	if not entityStates[addr] then
-		entityStates[addr] = {
-			time = 0,
-			startY = transform.y,
-			initialized = true,
-		}
+local sweepInterval = 120 -- batches between removals of states left by destroyed entities
+local batchCount = 0
+
+-- Batched update: called once per tick with every entity running this script.
+-- batch.entities / batch.x / batch.y are 1-based arrays of batch.count entries;
+-- positions written to batch.x / batch.y are applied to the entities' Transform.
+function onUpdateBatch(batch, deltaTime)
+	local entities, xs, ys = batch.entities, batch.x, batch.y
+	batchCount = batchCount + 1
+
+	for i = 1, batch.count do
+		local addr = entities[i]
+		local state = entityStates[addr]
+
+		-- Initialize per-entity state on first update
+		if not state then
+			state = {
+				time = 0,
+				startY = ys[i],
+			}
+			entityStates[addr] = state
+		end
+
+		-- Increment time for this specific entity
+		state.time = state.time + deltaTime
+		state.seen = batchCount
+
+		-- Move left + oscillate up/down in a sinusoidal pattern
+		local x = xs[i] - baseSpeed * deltaTime
+		xs[i] = x
+		ys[i] = state.startY + math.sin(state.time * sineSpeed * math.pi) * sineAmplitude
+
+		-- Cleanup state once off-screen (left side) to prevent memory leak;
+		-- entity destruction is handled by BoundarySystem
+		if x < -50 then
+			entityStates[addr] = nil
+		end
 	end
 
-	local state = entityStates[addr]
-
-	-- Increment time for this specific entity
-	state.time = state.time + deltaTime
-
-	-- Move left + oscillate up/down in a sinusoidal pattern
-	transform.x = transform.x - baseSpeed * deltaTime
-	transform.y = state.startY + math.sin(state.time * sineSpeed * math.pi) * sineAmplitude
-
-	-- Destroy if off-screen (left side) and cleanup state
-	if transform.x < -50 then
-		entityStates[addr] = nil -- Cleanup state to prevent memory leak
-		-- entity:destroy() -- Entity destruction handled by BoundarySystem
+	-- Entities destroyed on-screen (killed, collided) never reach x < -50
+	if batchCount % sweepInterval == 0 then
+		for addr, state in pairs(entityStates) do
+			if state.seen ~= batchCount then
+				entityStates[addr] = nil
+			end
+		end
 	end
 end
@@ -5,33 +5,17 @@
 ** enemy_basic.lua - Basic enemy behavior (linear left movement)
 ]]
 
--- Per-entity state storage (indexed by entity address)
-local entityStates = {}
-
 local baseSpeed = 15 -- pixels per second
 
-function onUpdate(entity, deltaTime)
-	if not entity:isValid() or not entity:hasTransform() then
-		return
-	end
-
-	local addr = entity:getAddress()
-
-	-- Initialize per-entity state if needed
-	if not entityStates[addr] then
-		entityStates[addr] = {
-			initialized = true,
-		}
-	end
-
-	local transform = entity:getTransform()
-
-	-- Move left at constant speed
-	transform.x = transform.x - baseSpeed * deltaTime
+-- Batched update: called once per tick with every entity running this script.
+-- batch.entities / batch.x / batch.y are 1-based arrays of batch.count entries;
+-- positions written to batch.x / batch.y are applied to the entities' Transform.
+function onUpdateBatch(batch, deltaTime)
+	local xs = batch.x
+	local step = baseSpeed * deltaTime
 
-	-- Cleanup if entity goes off-screen
-	if transform.x < -100 then
-		entityStates[addr] = nil
-		-- entity:destroy() -- Entity destruction handled by BoundarySystem
+	-- Move left at constant speed (off-screen entities are destroyed by BoundarySystem)
+	for i = 1, batch.count do
+		xs[i] = xs[i] - step
 	end
 end
@@ -33,16 +33,16 @@ function generateWave(waveNumber)
 		-- Alternate enemy types based on wave number
 		local enemyType = "basic"
 		local health = 50 * difficulty
-		local script = "enemy_basic.lua"
+		local movement = "linear"
 		
 		if waveNumber >= 3 and i % 3 == 0 then
 			enemyType = "advanced"
 			health = 100 * difficulty
-			script = "enemy_advanced.lua"
+			movement = "sine"
 		elseif waveNumber >= 2 and i % 2 == 0 then
 			enemyType = "fast"
 			health = 30 * difficulty
-			script = "enemy_basic.lua"
+			movement = { pattern = "zigzag", amplitude = 60, frequency = 0.8 }
 		end
 		
 		table.insert(wave.enemyConfigs, {
@@ -51,7 +51,7 @@ function generateWave(waveNumber)
 			x = 1200,
 			y = yPos,
 			health = health,
-			script = script
+			movement = movement
 		})
 	end
 	
@@ -16,9 +16,9 @@ level1.waves[1] = {
 	name = "Level 1 - Wave 1: Introduction",
 	duration = 12,
 	enemyConfigs = {
-		{ delay = 1.0, type = "basic", x = 1200, y = 200, health = 50, script = "enemy_basic.lua" },
-		{ delay = 3.0, type = "basic", x = 1200, y = 400, health = 50, script = "enemy_basic.lua" },
-		{ delay = 5.0, type = "basic", x = 1200, y = 600, health = 50, script = "enemy_basic.lua" },
+		{ delay = 1.0, type = "basic", x = 1200, y = 200, health = 50, movement = "linear" },
+		{ delay = 3.0, type = "basic", x = 1200, y = 400, health = 50, movement = "linear" },
+		{ delay = 5.0, type = "basic", x = 1200, y = 600, health = 50, movement = "linear" },
 	},
 }
 
@@ -26,11 +26,11 @@ level1.waves[2] = {
 	name = "Level 1 - Wave 2: Vitesse",
 	duration = 15,
 	enemyConfigs = {
-		{ delay = 0.5, type = "basic", x = 1200, y = 150, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.5, type = "fast", x = 1200, y = 350, health = 30, script = "enemy_basic.lua" },
-		{ delay = 2.5, type = "basic", x = 1200, y = 550, health = 50, script = "enemy_basic.lua" },
-		{ delay = 3.5, type = "fast", x = 1200, y = 750, health = 30, script = "enemy_basic.lua" },
-		{ delay = 5.0, type = "basic", x = 1200, y = 300, health = 50, script = "enemy_basic.lua" },
+		{ delay = 0.5, type = "basic", x = 1200, y = 150, health = 50, movement = "linear" },
+		{ delay = 1.5, type = "fast", x = 1200, y = 350, health = 30, movement = "linear" },
+		{ delay = 2.5, type = "basic", x = 1200, y = 550, health = 50, movement = "linear" },
+		{ delay = 3.5, type = "fast", x = 1200, y = 750, health = 30, movement = "linear" },
+		{ delay = 5.0, type = "basic", x = 1200, y = 300, health = 50, movement = "linear" },
 	},
 }
 
@@ -38,13 +38,13 @@ level1.waves[3] = {
 	name = "Level 1 - Wave 3: Formation",
 	duration = 18,
 	enemyConfigs = {
-		{ delay = 0.0, type = "basic", x = 1200, y = 400, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.5, type = "basic", x = 1250, y = 350, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.5, type = "basic", x = 1250, y = 450, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.0, type = "basic", x = 1300, y = 300, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.0, type = "basic", x = 1300, y = 500, health = 50, script = "enemy_basic.lua" },
-		{ delay = 4.0, type = "fast", x = 1200, y = 200, health = 30, script = "enemy_basic.lua" },
-		{ delay = 4.0, type = "fast", x = 1200, y = 600, health = 30, script = "enemy_basic.lua" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 400, health = 50, movement = "linear" },
+		{ delay = 0.5, type = "basic", x = 1250, y = 350, health = 50, movement = "linear" },
+		{ delay = 0.5, type = "basic", x = 1250, y = 450, health = 50, movement = "linear" },
+		{ delay = 1.0, type = "basic", x = 1300, y = 300, health = 50, movement = "linear" },
+		{ delay = 1.0, type = "basic", x = 1300, y = 500, health = 50, movement = "linear" },
+		{ delay = 4.0, type = "fast", x = 1200, y = 200, health = 30, movement = "linear" },
+		{ delay = 4.0, type = "fast", x = 1200, y = 600, health = 30, movement = "linear" },
 	},
 }
 
@@ -21,9 +21,9 @@ waveSystem.waves[1] = {
 	name = "Wave 1: Basics",
 	duration = 10,
 	enemyConfigs = {
-		{ delay = 0.0, type = "basic", x = 1200, y = 200, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.0, type = "basic", x = 1200, y = 400, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.0, type = "basic", x = 1200, y = 600, health = 50, script = "enemy_basic.lua" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 200, health = 50, movement = "linear" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 400, health = 50, movement = "linear" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 600, health = 50, movement = "linear" },
 	},
 }
 
@@ -31,11 +31,11 @@ waveSystem.waves[2] = {
 	name = "Wave 2: Formation",
 	duration = 15,
 	enemyConfigs = {
-		{ delay = 0.5, type = "basic", x = 1200, y = 150, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.0, type = "basic", x = 1200, y = 350, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.5, type = "basic", x = 1200, y = 550, health = 50, script = "enemy_basic.lua" },
-		{ delay = 2.0, type = "basic", x = 1250, y = 250, health = 50, script = "enemy_basic.lua" },
-		{ delay = 2.5, type = "basic", x = 1250, y = 450, health = 50, script = "enemy_basic.lua" },
+		{ delay = 0.5, type = "basic", x = 1200, y = 150, health = 50, movement = "linear" },
+		{ delay = 1.0, type = "basic", x = 1200, y = 350, health = 50, movement = "linear" },
+		{ delay = 1.5, type = "basic", x = 1200, y = 550, health = 50, movement = "linear" },
+		{ delay = 2.0, type = "basic", x = 1250, y = 250, health = 50, movement = "linear" },
+		{ delay = 2.5, type = "basic", x = 1250, y = 450, health = 50, movement = "linear" },
 	},
 }
 
@@ -44,12 +44,12 @@ waveSystem.waves[3] = {
 	name = "Wave 3: Challenge",
 	duration = 15,
 	enemyConfigs = {
-		{ delay = 0.0, type = "basic", x = 1200, y = 100, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.3, type = "basic", x = 1200, y = 300, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.6, type = "basic", x = 1200, y = 500, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.9, type = "basic", x = 1200, y = 700, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.5, type = "basic", x = 1250, y = 200, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.5, type = "basic", x = 1250, y = 600, health = 50, script = "enemy_basic.lua" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 100, health = 50, movement = "linear" },
+		{ delay = 0.3, type = "basic", x = 1200, y = 300, health = 50, movement = "linear" },
+		{ delay = 0.6, type = "basic", x = 1200, y = 500, health = 50, movement = "linear" },
+		{ delay = 0.9, type = "basic", x = 1200, y = 700, health = 50, movement = "linear" },
+		{ delay = 1.5, type = "basic", x = 1250, y = 200, health = 50, movement = "linear" },
+		{ delay = 1.5, type = "basic", x = 1250, y = 600, health = 50, movement = "linear" },
 	},
 }
 
@@ -58,14 +58,14 @@ waveSystem.waves[4] = {
 	name = "Wave 4: Double Line",
 	duration = 15,
 	enemyConfigs = {
-		{ delay = 0.0, type = "basic", x = 1200, y = 150, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.0, type = "basic", x = 1200, y = 650, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.5, type = "basic", x = 1250, y = 250, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.5, type = "basic", x = 1250, y = 550, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.0, type = "basic", x = 1300, y = 350, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.0, type = "basic", x = 1300, y = 450, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.5, type = "basic", x = 1350, y = 200, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.5, type = "basic", x = 1350, y = 600, health = 50, script = "enemy_basic.lua" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 150, health = 50, movement = "linear" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 650, health = 50, movement = "linear" },
+		{ delay = 0.5, type = "basic", x = 1250, y = 250, health = 50, movement = "linear" },
+		{ delay = 0.5, type = "basic", x = 1250, y = 550, health = 50, movement = "linear" },
+		{ delay = 1.0, type = "basic", x = 1300, y = 350, health = 50, movement = "linear" },
+		{ delay = 1.0, type = "basic", x = 1300, y = 450, health = 50, movement = "linear" },
+		{ delay = 1.5, type = "basic", x = 1350, y = 200, health = 50, movement = "linear" },
+		{ delay = 1.5, type = "basic", x = 1350, y = 600, health = 50, movement = "linear" },
 	},
 }
 
@@ -74,14 +74,14 @@ waveSystem.waves[5] = {
 	name = "Wave 5: Formation",
 	duration = 18,
 	enemyConfigs = {
-		{ delay = 0.0, type = "basic", x = 1200, y = 200, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.0, type = "basic", x = 1200, y = 400, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.0, type = "basic", x = 1200, y = 600, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.0, type = "basic", x = 1250, y = 150, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.0, type = "basic", x = 1250, y = 350, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.0, type = "basic", x = 1250, y = 550, health = 50, script = "enemy_basic.lua" },
-		{ delay = 2.0, type = "basic", x = 1300, y = 300, health = 50, script = "enemy_basic.lua" },
-		{ delay = 2.0, type = "basic", x = 1300, y = 500, health = 50, script = "enemy_basic.lua" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 200, health = 50, movement = "linear" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 400, health = 50, movement = "linear" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 600, health = 50, movement = "linear" },
+		{ delay = 1.0, type = "basic", x = 1250, y = 150, health = 50, movement = "linear" },
+		{ delay = 1.0, type = "basic", x = 1250, y = 350, health = 50, movement = "linear" },
+		{ delay = 1.0, type = "basic", x = 1250, y = 550, health = 50, movement = "linear" },
+		{ delay = 2.0, type = "basic", x = 1300, y = 300, health = 50, movement = "linear" },
+		{ delay = 2.0, type = "basic", x = 1300, y = 500, health = 50, movement = "linear" },
 	},
 }
 
@@ -90,16 +90,16 @@ waveSystem.waves[6] = {
 	name = "Wave 6: Cascade",
 	duration = 20,
 	enemyConfigs = {
-		{ delay = 0.0, type = "basic", x = 1200, y = 100, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.3, type = "basic", x = 1200, y = 200, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.6, type = "basic", x = 1200, y = 300, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.9, type = "basic", x = 1200, y = 400, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.2, type = "basic", x = 1200, y = 500, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.5, type = "basic", x = 1200, y = 600, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.8, type = "basic", x = 1200, y = 700, health = 50, script = "enemy_basic.lua" },
-		{ delay = 2.5, type = "basic", x = 1300, y = 150, health = 50, script = "enemy_basic.lua" },
-		{ delay = 2.5, type = "basic", x = 1300, y = 400, health = 50, script = "enemy_basic.lua" },
-		{ delay = 2.5, type = "basic", x = 1300, y = 650, health = 50, script = "enemy_basic.lua" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 100, health = 50, movement = "linear" },
+		{ delay = 0.3, type = "basic", x = 1200, y = 200, health = 50, movement = "linear" },
+		{ delay = 0.6, type = "basic", x = 1200, y = 300, health = 50, movement = "linear" },
+		{ delay = 0.9, type = "basic", x = 1200, y = 400, health = 50, movement = "linear" },
+		{ delay = 1.2, type = "basic", x = 1200, y = 500, health = 50, movement = "linear" },
+		{ delay = 1.5, type = "basic", x = 1200, y = 600, health = 50, movement = "linear" },
+		{ delay = 1.8, type = "basic", x = 1200, y = 700, health = 50, movement = "linear" },
+		{ delay = 2.5, type = "basic", x = 1300, y = 150, health = 50, movement = "linear" },
+		{ delay = 2.5, type = "basic", x = 1300, y = 400, health = 50, movement = "linear" },
+		{ delay = 2.5, type = "basic", x = 1300, y = 650, health = 50, movement = "linear" },
 	},
 }
 
@@ -108,19 +108,19 @@ waveSystem.waves[7] = {
 	name = "Wave 7: Swarm",
 	duration = 20,
 	enemyConfigs = {
-		{ delay = 0.0, type = "basic", x = 1200, y = 100, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.2, type = "basic", x = 1200, y = 200, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.4, type = "basic", x = 1200, y = 300, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.6, type = "basic", x = 1200, y = 400, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.8, type = "basic", x = 1200, y = 500, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.0, type = "basic", x = 1200, y = 600, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.2, type = "basic", x = 1200, y = 700, health = 50, script = "enemy_basic.lua" },
-		{ delay = 2.0, type = "basic", x = 1300, y = 150, health = 50, script = "enemy_basic.lua" },
-		{ delay = 2.2, type = "basic", x = 1300, y = 250, health = 50, script = "enemy_basic.lua" },
-		{ delay = 2.4, type = "basic", x = 1300, y = 350, health = 50, script = "enemy_basic.lua" },
-		{ delay = 2.6, type = "basic", x = 1300, y = 450, health = 50, script = "enemy_basic.lua" },
-		{ delay = 2.8, type = "basic", x = 1300, y = 550, health = 50, script = "enemy_basic.lua" },
-		{ delay = 3.0, type = "basic", x = 1300, y = 650, health = 50, script = "enemy_basic.lua" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 100, health = 50, movement = "linear" },
+		{ delay = 0.2, type = "basic", x = 1200, y = 200, health = 50, movement = "linear" },
+		{ delay = 0.4, type = "basic", x = 1200, y = 300, health = 50, movement = "linear" },
+		{ delay = 0.6, type = "basic", x = 1200, y = 400, health = 50, movement = "linear" },
+		{ delay = 0.8, type = "basic", x = 1200, y = 500, health = 50, movement = "linear" },
+		{ delay = 1.0, type = "basic", x = 1200, y = 600, health = 50, movement = "linear" },
+		{ delay = 1.2, type = "basic", x = 1200, y = 700, health = 50, movement = "linear" },
+		{ delay = 2.0, type = "basic", x = 1300, y = 150, health = 50, movement = "linear" },
+		{ delay = 2.2, type = "basic", x = 1300, y = 250, health = 50, movement = "linear" },
+		{ delay = 2.4, type = "basic", x = 1300, y = 350, health = 50, movement = "linear" },
+		{ delay = 2.6, type = "basic", x = 1300, y = 450, health = 50, movement = "linear" },
+		{ delay = 2.8, type = "basic", x = 1300, y = 550, health = 50, movement = "linear" },
+		{ delay = 3.0, type = "basic", x = 1300, y = 650, health = 50, movement = "linear" },
 	},
 }
 
@@ -129,15 +129,15 @@ waveSystem.waves[8] = {
 	name = "Wave 8: Reinforced",
 	duration = 22,
 	enemyConfigs = {
-		{ delay = 0.0, type = "basic", x = 1200, y = 200, health = 80, script = "enemy_basic.lua" },
-		{ delay = 0.0, type = "basic", x = 1200, y = 400, health = 80, script = "enemy_basic.lua" },
-		{ delay = 0.0, type = "basic", x = 1200, y = 600, health = 80, script = "enemy_basic.lua" },
-		{ delay = 1.0, type = "basic", x = 1250, y = 100, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.0, type = "basic", x = 1250, y = 700, health = 50, script = "enemy_basic.lua" },
-		{ delay = 2.0, type = "basic", x = 1300, y = 300, health = 80, script = "enemy_basic.lua" },
-		{ delay = 2.0, type = "basic", x = 1300, y = 500, health = 80, script = "enemy_basic.lua" },
-		{ delay = 3.0, type = "basic", x = 1350, y = 200, health = 50, script = "enemy_basic.lua" },
-		{ delay = 3.0, type = "basic", x = 1350, y = 600, health = 50, script = "enemy_basic.lua" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 200, health = 80, movement = "linear" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 400, health = 80, movement = "linear" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 600, health = 80, movement = "linear" },
+		{ delay = 1.0, type = "basic", x = 1250, y = 100, health = 50, movement = "linear" },
+		{ delay = 1.0, type = "basic", x = 1250, y = 700, health = 50, movement = "linear" },
+		{ delay = 2.0, type = "basic", x = 1300, y = 300, health = 80, movement = "linear" },
+		{ delay = 2.0, type = "basic", x = 1300, y = 500, health = 80, movement = "linear" },
+		{ delay = 3.0, type = "basic", x = 1350, y = 200, health = 50, movement = "linear" },
+		{ delay = 3.0, type = "basic", x = 1350, y = 600, health = 50, movement = "linear" },
 	},
 }
 
@@ -146,20 +146,20 @@ waveSystem.waves[9] = {
 	name = "Wave 9: Final Assault",
 	duration = 25,
 	enemyConfigs = {
-		{ delay = 0.0, type = "basic", x = 1200, y = 150, health = 60, script = "enemy_basic.lua" },
-		{ delay = 0.0, type = "basic", x = 1200, y = 400, health = 60, script = "enemy_basic.lua" },
-		{ delay = 0.0, type = "basic", x = 1200, y = 650, health = 60, script = "enemy_basic.lua" },
-		{ delay = 1.0, type = "basic", x = 1250, y = 100, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.2, type = "basic", x = 1250, y = 250, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.4, type = "basic", x = 1250, y = 400, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.6, type = "basic", x = 1250, y = 550, health = 50, script = "enemy_basic.lua" },
-		{ delay = 1.8, type = "basic", x = 1250, y = 700, health = 50, script = "enemy_basic.lua" },
-		{ delay = 3.0, type = "basic", x = 1300, y = 200, health = 60, script = "enemy_basic.lua" },
-		{ delay = 3.0, type = "basic", x = 1300, y = 350, health = 60, script = "enemy_basic.lua" },
-		{ delay = 3.0, type = "basic", x = 1300, y = 500, health = 60, script = "enemy_basic.lua" },
-		{ delay = 3.0, type = "basic", x = 1300, y = 650, health = 60, script = "enemy_basic.lua" },
-		{ delay = 4.5, type = "basic", x = 1400, y = 300, health = 80, script = "enemy_basic.lua" },
-		{ delay = 4.5, type = "basic", x = 1400, y = 500, health = 80, script = "enemy_basic.lua" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 150, health = 60, movement = "linear" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 400, health = 60, movement = "linear" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 650, health = 60, movement = "linear" },
+		{ delay = 1.0, type = "basic", x = 1250, y = 100, health = 50, movement = "linear" },
+		{ delay = 1.2, type = "basic", x = 1250, y = 250, health = 50, movement = "linear" },
+		{ delay = 1.4, type = "basic", x = 1250, y = 400, health = 50, movement = "linear" },
+		{ delay = 1.6, type = "basic", x = 1250, y = 550, health = 50, movement = "linear" },
+		{ delay = 1.8, type = "basic", x = 1250, y = 700, health = 50, movement = "linear" },
+		{ delay = 3.0, type = "basic", x = 1300, y = 200, health = 60, movement = "linear" },
+		{ delay = 3.0, type = "basic", x = 1300, y = 350, health = 60, movement = "linear" },
+		{ delay = 3.0, type = "basic", x = 1300, y = 500, health = 60, movement = "linear" },
+		{ delay = 3.0, type = "basic", x = 1300, y = 650, health = 60, movement = "linear" },
+		{ delay = 4.5, type = "basic", x = 1400, y = 300, health = 80, movement = "linear" },
+		{ delay = 4.5, type = "basic", x = 1400, y = 500, health = 80, movement = "linear" },
 	},
 }
 
@@ -168,19 +168,19 @@ waveSystem.waves[10] = {
 	name = "Wave 10: Endurance",
 	duration = 30,
 	enemyConfigs = {
-		{ delay = 0.0, type = "basic", x = 1200, y = 400, health = 100, script = "enemy_basic.lua" },
-		{ delay = 0.5, type = "basic", x = 1200, y = 200, health = 50, script = "enemy_basic.lua" },
-		{ delay = 0.5, type = "basic", x = 1200, y = 600, health = 50, script = "enemy_basic.lua" },
-		{ delay = 2.0, type = "basic", x = 1300, y = 150, health = 50, script = "enemy_basic.lua" },
-		{ delay = 2.0, type = "basic", x = 1300, y = 400, health = 80, script = "enemy_basic.lua" },
-		{ delay = 2.0, type = "basic", x = 1300, y = 650, health = 50, script = "enemy_basic.lua" },
-		{ delay = 4.0, type = "basic", x = 1400, y = 100, health = 50, script = "enemy_basic.lua" },
-		{ delay = 4.0, type = "basic", x = 1400, y = 300, health = 60, script = "enemy_basic.lua" },
-		{ delay = 4.0, type = "basic", x = 1400, y = 500, health = 60, script = "enemy_basic.lua" },
-		{ delay = 4.0, type = "basic", x = 1400, y = 700, health = 50, script = "enemy_basic.lua" },
-		{ delay = 6.0, type = "basic", x = 1500, y = 200, health = 80, script = "enemy_basic.lua" },
-		{ delay = 6.0, type = "basic", x = 1500, y = 400, health = 100, script = "enemy_basic.lua" },
-		{ delay = 6.0, type = "basic", x = 1500, y = 600, health = 80, script = "enemy_basic.lua" },
+		{ delay = 0.0, type = "basic", x = 1200, y = 400, health = 100, movement = "linear" },
+		{ delay = 0.5, type = "basic", x = 1200, y = 200, health = 50, movement = "linear" },
+		{ delay = 0.5, type = "basic", x = 1200, y = 600, health = 50, movement = "linear" },
+		{ delay = 2.0, type = "basic", x = 1300, y = 150, health = 50, movement = "linear" },
+		{ delay = 2.0, type = "basic", x = 1300, y = 400, health = 80, movement = "linear" },
+		{ delay = 2.0, type = "basic", x = 1300, y = 650, health = 50, movement = "linear" },
+		{ delay = 4.0, type = "basic", x = 1400, y = 100, health = 50, movement = "linear" },
+		{ delay = 4.0, type = "basic", x = 1400, y = 300, health = 60, movement = "linear" },
+		{ delay = 4.0, type = "basic", x = 1400, y = 500, health = 60, movement = "linear" },
+		{ delay = 4.0, type = "basic", x = 1400, y = 700, health = 50, movement = "linear" },
+		{ delay = 6.0, type = "basic", x = 1500, y = 200, health = 80, movement = "linear" },
+		{ delay = 6.0, type = "basic", x = 1500, y = 400, health = 100, movement = "linear" },
+		{ delay = 6.0, type = "basic", x = 1500, y = 600, health = 80, movement = "linear" },
 	},
 }
 
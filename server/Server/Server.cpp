@@ -10,12 +10,14 @@
 #include <chrono>
 #include <functional>
 #include <thread>
+#include <utility>
 #include "Capnp/ConnectionMessages.hpp"
 #include "Capnp/Messages/Messages.hpp"
 #include "Capnp/Messages/Shared/SharedTypes.hpp"
 #include "Capnp/NetworkMessages.hpp"
 #include "NetworkFactory.hpp"
 #include "common/ECS/Components/Animation.hpp"
+#include "common/ECS/Components/Buff.hpp"
 #include "common/ECS/Components/Enemy.hpp"
 #include "common/ECS/Components/Health.hpp"
 #include "common/ECS/Components/IComponent.hpp"
@@ -26,7 +28,10 @@
 #include "common/ECS/Components/Projectile.hpp"
 #include "common/ECS/Components/Sprite.hpp"
 #include "common/ECS/Components/Transform.hpp"
+#include "common/ECS/Components/Velocity.hpp"
 #include "common/ECS/Components/Wall.hpp"
+#include "common/ECS/Systems/MapSystem/MapSystem.hpp"
+#include "common/ECS/Systems/PlayerRules/PlayerRules.hpp"
 #include "common/ECSWrapper/ECSWorld.hpp"
 #include "common/Logger/Logger.hpp"
 #include "server/Commands/CommandContext.hpp"
@@ -110,10 +115,10 @@ bool Server::initialize() {
         LOG_INFO("Game ended - reason: ", event.getReason());
 
         // Find the room associated with this game and broadcast Game Over to all players
-        auto rooms = _roomManager->getAllRooms();
-        LOG_INFO("Broadcasting GameOver to ", rooms.size(), " room(s)");
+        std::shared_ptr<const server::RoomSnapshot> rooms = _roomManager->getRoomsSnapshot();
+        LOG_INFO("Broadcasting GameOver to ", rooms->rooms.size(), " room(s)");
 
-        for (const auto &room : rooms) {
+        for (const auto &room : rooms->rooms) {
             auto gameLogic = room->getGameLogic();
             if (gameLogic) {
                 // Send GameOver message to all players in this room
@@ -543,6 +548,7 @@ void Server::_handlePlayerInput(HostNetworkEvent &event) {
         if (!gameLogic) {
             return;
         }
+        gameLogic->updatePlayerLatency(playerId, event.peer->getRoundTripTime(), packet.interpolationDelayMs);
 
         // Iterate through all snapshots in the redundant packet
         // The packet contains a history of inputs. We try to apply all of them.
@@ -1258,8 +1264,9 @@ void Server::run() {
         if (_roomManager) {
             _roomManager->update(deltaTime);
 
-            auto rooms = _roomManager->getAllRooms();
-            for (const auto &room : rooms) {
+            // One room list generation for the whole iteration (no RoomManager mutex, no per-room refcount)
+            std::shared_ptr<const server::RoomSnapshot> rooms = _roomManager->getRoomsSnapshot();
+            for (const auto &room : rooms->rooms) {
                 if (room->getState() == server::RoomState::IN_PROGRESS && room->tryMarkGameStartSent()) {
                     _sendGameStartToRoom(room);
 
@@ -1267,10 +1274,10 @@ void Server::run() {
                     _broadcastRoomListToAll();
                 }
             }
-        }
 
-        _processPendingDestructions();
-        _broadcastGameState();
+            _processPendingDestructions(*rooms);
+            _broadcastGameState(*rooms);
+        }
 
         // Sleep to avoid busy-waiting (network processing is the bottleneck here)
         server::FrameTimer::sleepMilliseconds(16);  // ~60 Hz
@@ -1299,13 +1306,11 @@ void Server::stop() {
     }
 }
 
-void Server::_broadcastGameState() {
+void Server::_broadcastGameState(const server::RoomSnapshot &rooms) {
     using namespace RType::Messages;
 
-    // Get all rooms and broadcast each room's game state to its players
-    auto rooms = _roomManager->getAllRooms();
-
-    for (const auto &room : rooms) {
+    // Broadcast each room's game state to its players
+    for (const auto &room : rooms.rooms) {
         server::ServerLoop *roomLoop = room->getServerLoop();
         if (!roomLoop) {
             continue;
@@ -1320,20 +1325,10 @@ void Server::_broadcastGameState() {
 
         S2C::GameState state;
         state.serverTick = roomLoop->getCurrentTick();
+        state.scrollOffset = ecs::MapSystem::getScrollOffset(ecsWorld->getRegistry());
 
-        // Get all entities with Transform component
-        auto entities = ecsWorld->query<ecs::Transform>();
-
-        // Serialize each entity's state
-        for (auto &entity : entities) {
-            try {
-                S2C::EntityState entityState = _serializeEntity(entity, gameLogic.get());
-                state.entities.push_back(entityState);
-            } catch (const std::exception &e) {
-                LOG_ERROR("Failed to serialize entity: ", e.what());
-                continue;
-            }
-        }
+        // Serialize every entity with a Transform component in a single registry pass
+        state.entities = _serializeEntities(ecsWorld, gameLogic.get());
 
         // Serialize and create packet
         std::vector<uint8_t> payload = state.serialize();
@@ -1365,12 +1360,10 @@ void Server::_broadcastGameState() {
     }
 }
 
-void Server::_processPendingDestructions() {
+void Server::_processPendingDestructions(const server::RoomSnapshot &rooms) {
     using namespace RType::Messages;
 
-    auto rooms = _roomManager->getAllRooms();
-
-    for (const auto &room : rooms) {
+    for (const auto &room : rooms.rooms) {
         server::ServerLoop *roomLoop = room->getServerLoop();
         if (!roomLoop) {
             continue;
@@ -1381,8 +1374,12 @@ void Server::_processPendingDestructions() {
             continue;
         }
 
-        // Find all entities marked for destruction
-        auto pendingEntities = ecsWorld->query<ecs::PendingDestroy>();
+        // Find all entities marked for destruction (destroyed once the iteration is over)
+        std::vector<std::pair<ecs::Address, ecs::DestroyReason>> pendingEntities;
+        ecsWorld->forEach<ecs::PendingDestroy>(
+            [&pendingEntities](ecs::wrapper::Entity entity, const ecs::PendingDestroy &pendingDestroy) {
+                pendingEntities.emplace_back(entity.getAddress(), pendingDestroy.getReason());
+            });
 
         if (pendingEntities.empty()) {
             continue;
@@ -1399,13 +1396,11 @@ void Server::_processPendingDestructions() {
 
         // Process each entity marked for destruction
         std::vector<ecs::Address> toDestroy;
-        for (auto &entity : pendingEntities) {
-            ecs::Address entityId = entity.getAddress();
-            ecs::PendingDestroy &pendingDestroy = entity.get<ecs::PendingDestroy>();
-
+        toDestroy.reserve(pendingEntities.size());
+        for (const auto &[entityId, reason] : pendingEntities) {
             // Convert internal DestroyReason to network DestroyReason
             Shared::DestroyReason networkReason;
-            switch (pendingDestroy.getReason()) {
+            switch (reason) {
                 case ecs::DestroyReason::OutOfBounds:
                     networkReason = Shared::DestroyReason::OutOfBounds;
                     break;
@@ -1526,6 +1521,7 @@ void Server::_sendGameStartToRoom(std::shared_ptr<server::Room> room) {
         S2C::GameStart gameStart;
         gameStart.yourEntityId = entityId;
         gameStart.initialState.serverTick = roomLoop->getCurrentTick();
+        gameStart.initialState.scrollOffset = ecs::MapSystem::getScrollOffset(ecsWorld->getRegistry());
         gameStart.initialState.entities = entities;
         gameStart.mapConfig = mapConfig;
 
@@ -1641,6 +1637,7 @@ void Server::_sendGameStartToSpectator(uint32_t spectatorId, std::shared_ptr<ser
     S2C::GameStart gameStart;
     gameStart.yourEntityId = 0;
     gameStart.initialState.serverTick = roomLoop->getCurrentTick();
+    gameStart.initialState.scrollOffset = ecs::MapSystem::getScrollOffset(ecsWorld->getRegistry());
     gameStart.initialState.entities = entities;
     gameStart.mapConfig = mapConfig;
 
@@ -1746,32 +1743,33 @@ void Server::_broadcastRoomState(std::shared_ptr<server::Room> room) {
     LOG_INFO("✓ Broadcast RoomState to ", allRecipients.size(), " players in room '", room->getId(), "'");
 }
 
-RType::Messages::S2C::EntityState Server::_serializeEntity(ecs::wrapper::Entity &entity,
-                                                           server::IGameLogic *gameLogic) {
+RType::Messages::S2C::EntityState Server::_serializeEntity(uint32_t address, const ecs::Transform &transform,
+                                                           const SerializedComponents &components) {
     using namespace RType::Messages;
 
     S2C::EntityState entityState;
-    entityState.entityId = entity.getAddress();
-
-    // Get Transform (required - entity was queried with it, but might be destroyed by now)
-    if (!entity.has<ecs::Transform>()) {
-        throw std::runtime_error("Entity no longer has Transform component");
-    }
-    ecs::Transform &transform = entity.get<ecs::Transform>();
+    entityState.entityId = address;
     entityState.position.x = transform.getPosition().x;
     entityState.position.y = transform.getPosition().y;
 
+    // Replicated velocity: tangent of the client's interpolation curve
+    if (components.velocity) {
+        const auto direction = components.velocity->getDirection();
+        const float speed = components.velocity->getSpeed();
+        entityState.velocity.x = direction.x * speed;
+        entityState.velocity.y = direction.y * speed;
+    }
+
     // Get current animation if available
-    if (entity.has<ecs::Animation>()) {
-        entityState.currentAnimation = entity.get<ecs::Animation>().getCurrentClipName();
+    if (components.animation) {
+        entityState.currentAnimation = components.animation->getCurrentClipName();
     } else {
         entityState.currentAnimation = "idle";  // Default fallback
     }
 
     // Get sprite info if available
-    if (entity.has<ecs::Sprite>()) {
-        ecs::Sprite &sprite = entity.get<ecs::Sprite>();
-        const auto &rect = sprite.getSourceRect();
+    if (components.sprite) {
+        const auto &rect = components.sprite->getSourceRect();
         entityState.spriteX = rect.x;
         entityState.spriteY = rect.y;
         entityState.spriteW = rect.width;
@@ -1784,33 +1782,33 @@ RType::Messages::S2C::EntityState Server::_serializeEntity(ecs::wrapper::Entity
         entityState.spriteH = 17;
     }
 
+    const int health = components.health ? components.health->getCurrentHealth() : -1;
+
     // Determine entity type and get health
-    if (entity.has<ecs::Player>()) {
+    if (components.player) {
         entityState.type = Shared::EntityType::Player;
-        entityState.health = entity.has<ecs::Health>() ? entity.get<ecs::Health>().getCurrentHealth() : -1;
-
-        // Retrieve last processed sequence ID for this player
-        if (gameLogic) {
-            ecs::Player &player = entity.get<ecs::Player>();
-            entityState.lastProcessedInput = gameLogic->getLastProcessedInput(player.getPlayerId());
-        }
-    } else if (entity.has<ecs::Enemy>()) {
-        ecs::Enemy &enemy = entity.get<ecs::Enemy>();
+        entityState.health = health;
+
+        // Multishot pattern, so the owner predicts every projectile of its shots (WeaponSystem rules)
+        const ecs::Buff *buff = components.buff;
+        entityState.shotCount = static_cast<uint8_t>(ecs::PlayerRules::shotCount(
+            buff && buff->hasBuff(ecs::BuffType::MultiShot), buff && buff->hasBuff(ecs::BuffType::TripleShot),
+            buff && buff->hasBuff(ecs::BuffType::DoubleShot)));
+    } else if (components.enemy) {
         // Map enemy type to EntityType enum (simplified)
-        entityState.type =
-            (enemy.getEnemyType() == 0) ? Shared::EntityType::EnemyType1 : Shared::EntityType::EnemyType1;
-        entityState.health = entity.has<ecs::Health>() ? entity.get<ecs::Health>().getCurrentHealth() : -1;
-    } else if (entity.has<ecs::Projectile>()) {
-        ecs::Projectile &projectile = entity.get<ecs::Projectile>();
-        entityState.type =
-            projectile.isFriendly() ? Shared::EntityType::PlayerBullet : Shared::EntityType::EnemyBullet;
+        entityState.type = (components.enemy->getEnemyType() == 0) ? Shared::EntityType::EnemyType1
+                                                                   : Shared::EntityType::EnemyType1;
+        entityState.health = health;
+    } else if (components.projectile) {
+        entityState.type = components.projectile->isFriendly() ? Shared::EntityType::PlayerBullet
+                                                               : Shared::EntityType::EnemyBullet;
         entityState.health = -1;  // Projectiles don't have health
-    } else if (entity.has<ecs::Wall>()) {
+    } else if (components.wall) {
         entityState.type = Shared::EntityType::Wall;
-        entityState.health = entity.has<ecs::Health>() ? entity.get<ecs::Health>().getCurrentHealth() : -1;
-    } else if (entity.has<ecs::OrbitalModule>()) {
+        entityState.health = health;
+    } else if (components.orbitalModule) {
         entityState.type = Shared::EntityType::OrbitalModule;
-        entityState.health = entity.has<ecs::Health>() ? entity.get<ecs::Health>().getCurrentHealth() : -1;
+        entityState.health = health;
     } else {
         // Unknown entity type - default to generic
         entityState.type = Shared::EntityType::Player;
@@ -1867,12 +1865,31 @@ std::vector<RType::Messages::S2C::EntityState> Server::_serializeEntities(
     if (!world)
         return entities;
 
-    auto transforms = world->query<ecs::Transform>();
-    for (auto &entity : transforms) {
-        try {
-            entities.push_back(_serializeEntity(entity, gameLogic));
-        } catch (const std::exception &e) {
-            LOG_ERROR("Failed to serialize entity: ", e.what());
+    // Single locked pass over the registry: components are handed over directly. The callback runs
+    // under the registry lock, so the GameLogic input state (own mutex) is read once the pass is over.
+    std::vector<std::pair<size_t, uint32_t>> players;
+    world->forEach<ecs::Transform, ecs::Optional<ecs::Animation>, ecs::Optional<ecs::Sprite>,
+                   ecs::Optional<ecs::Health>, ecs::Optional<ecs::Player>, ecs::Optional<ecs::Enemy>,
+                   ecs::Optional<ecs::Projectile>, ecs::Optional<ecs::Wall>,
+                   ecs::Optional<ecs::OrbitalModule>, ecs::Optional<ecs::Velocity>,
+                   ecs::Optional<ecs::Buff>>(
+        [&](ecs::wrapper::Entity entity, const ecs::Transform &transform, const ecs::Animation *animation,
+            const ecs::Sprite *sprite, const ecs::Health *health, const ecs::Player *player,
+            const ecs::Enemy *enemy, const ecs::Projectile *projectile, const ecs::Wall *wall,
+            const ecs::OrbitalModule *orbitalModule, const ecs::Velocity *velocity,
+            const ecs::Buff *buff) {
+            SerializedComponents components{animation,  sprite, health,        player,   enemy,
+                                            projectile, wall,   orbitalModule, velocity, buff};
+            if (player) {
+                players.emplace_back(entities.size(), player->getPlayerId());
+            }
+            entities.push_back(_serializeEntity(entity.getAddress(), transform, components));
+        });
+
+    // Last input sequence ID processed for each player
+    if (gameLogic) {
+        for (const auto &[index, playerId] : players) {
+            entities[index].lastProcessedInput = gameLogic->getLastProcessedInput(playerId);
         }
     }
     return entities;
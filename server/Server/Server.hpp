@@ -23,6 +23,20 @@ namespace server {
     struct CommandContext;
 }  // namespace server
 
+namespace ecs {
+    class Animation;
+    class Buff;
+    class Enemy;
+    class Health;
+    class OrbitalModule;
+    class Player;
+    class Projectile;
+    class Sprite;
+    class Transform;
+    class Velocity;
+    class Wall;
+}  // namespace ecs
+
 namespace ecs::wrapper {
     class Entity;
 }
@@ -194,16 +208,18 @@ class Server {
 
     /**
      * @brief Broadcast game state to all connected clients
+     * @param rooms Room list generation of the current loop iteration
      */
-    void _broadcastGameState();
+    void _broadcastGameState(const server::RoomSnapshot &rooms);
 
     /**
      * @brief Process entities marked with PendingDestroy component
      * 
      * Sends EntityDestroyed messages to clients and removes entities from the registry.
      * This ensures clients properly cleanup entities instead of interpolating to old positions.
+     * @param rooms Room list generation of the current loop iteration
      */
-    void _processPendingDestructions();
+    void _processPendingDestructions(const server::RoomSnapshot &rooms);
 
     /**
      * @brief Send GameStart message to all players in a room
@@ -240,17 +256,33 @@ class Server {
     void _broadcastRoomListToAll();
 
     /**
-     * @brief Serialize a single entity to network format
-     * @param entity The entity to serialize
-     * @return EntityState structure ready for network transmission
+     * @struct SerializedComponents
+     * @brief Optional components read when serializing an entity (nullptr when absent)
      */
+    struct SerializedComponents {
+        const ecs::Animation *animation = nullptr;
+        const ecs::Sprite *sprite = nullptr;
+        const ecs::Health *health = nullptr;
+        const ecs::Player *player = nullptr;
+        const ecs::Enemy *enemy = nullptr;
+        const ecs::Projectile *projectile = nullptr;
+        const ecs::Wall *wall = nullptr;
+        const ecs::OrbitalModule *orbitalModule = nullptr;
+        const ecs::Velocity *velocity = nullptr;
+        const ecs::Buff *buff = nullptr;
+    };
+
     /**
      * @brief Serialize entity to EntityState
-     * @param entity ECS Entity
-     * @param gameLogic Optional pointer to GameLogic (to retrieve player input state)
-     */
-    RType::Messages::S2C::EntityState _serializeEntity(ecs::wrapper::Entity &entity,
-                                                       server::IGameLogic *gameLogic = nullptr);
+     * @param address Entity address
+     * @param transform Entity transform (required)
+     * @param components Optional components of the entity
+     * @return EntityState structure ready for network transmission (lastProcessedInput left unset)
+     *
+     * Called under the registry lock: must not take any other lock.
+     */
+    RType::Messages::S2C::EntityState _serializeEntity(uint32_t address, const ecs::Transform &transform,
+                                                       const SerializedComponents &components);
 
     /**
      * @brief Convert Action enum to directional input (dx, dy)
@@ -5,24 +5,43 @@
 ** main.cpp
 */
 
+#include <cstdlib>
 #include <iostream>
+#include <string>
+#include "common/Logger/Logger.hpp"
+#include "server/Rooms/Room.hpp"
 #include "server/Server/Server.hpp"
 
 int main(int argc, char **argv) {
+    // Usage: r-type_server [port] [--deterministic <seed>]
     uint16_t port = 4242;
-    if (argc > 1) {
-        port = static_cast<uint16_t>(std::atoi(argv[1]));
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--deterministic") {
+            if (i + 1 >= argc) {
+                std::cerr << "--deterministic requires a seed" << std::endl;
+                return 1;
+            }
+            server::Room::setDeterministicSeed(std::strtoull(argv[++i], nullptr, 10));
+        } else {
+            port = static_cast<uint16_t>(std::atoi(arg.c_str()));
+        }
     }
 
+    // Logging is formatted and written by a background thread
+    logger::Logger::startAsync();
+
     // Create and run server
     Server server(port);
 
     if (!server.initialize()) {
+        logger::Logger::stopAsync();
         std::cerr << "Failed to initialize server" << std::endl;
         return 1;
     }
 
     server.run();
 
+    logger::Logger::stopAsync();
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,151 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ECSIterationBenchmark - query() + get() versus templated forEach()
+*/
+
+#include <benchmark/benchmark.h>
+
+#include "common/ECS/Components/Health.hpp"
+#include "common/ECS/Components/Player.hpp"
+#include "common/ECS/Components/Transform.hpp"
+#include "common/ECS/Components/Velocity.hpp"
+#include "common/ECSWrapper/ECSWorld.hpp"
+
+namespace {
+
+    /**
+     * @brief Populate a world resembling a game room: every entity has a Transform,
+     * most move, some have health and a handful are players.
+     */
+    void populateWorld(ecs::wrapper::ECSWorld &world, int64_t entityCount) {
+        for (int64_t i = 0; i < entityCount; ++i) {
+            auto entity = world.createEntity();
+            entity.with(ecs::Transform(static_cast<float>(i), static_cast<float>(i % 600)));
+            if (i % 4 != 0) {
+                entity.with(ecs::Velocity(-1.0f, 0.0f, 200.0f));
+            }
+            if (i % 2 == 0) {
+                entity.with(ecs::Health(100, 100));
+            }
+            if (i % 250 == 0) {
+                entity.with(ecs::Player(0, 3, static_cast<uint32_t>(i)));
+            }
+        }
+    }
+
+    struct Sample {
+        float x = 0.0f;
+        float y = 0.0f;
+        float velX = 0.0f;
+        int health = 0;
+        int playerId = 0;
+    };
+
+}  // namespace
+
+// Pattern used by the server before forEach(): materialize an Entity vector,
+// then go back through the locked registry for every has<>() / get<>().
+static void BM_QueryThenGet(benchmark::State &state) {
+    ecs::wrapper::ECSWorld world;
+    populateWorld(world, state.range(0));
+    std::vector<Sample> samples;
+
+    for (auto _ : state) {
+        samples.clear();
+        auto entities = world.query<ecs::Transform>();
+        for (auto &entity : entities) {
+            Sample sample;
+            const auto &transform = entity.get<ecs::Transform>();
+            sample.x = transform.getPosition().x;
+            sample.y = transform.getPosition().y;
+            if (entity.has<ecs::Velocity>()) {
+                sample.velX = entity.get<ecs::Velocity>().getDirection().x;
+            }
+            if (entity.has<ecs::Health>()) {
+                sample.health = entity.get<ecs::Health>().getCurrentHealth();
+            }
+            if (entity.has<ecs::Player>()) {
+                sample.playerId = entity.get<ecs::Player>().getPlayerId();
+            }
+            samples.push_back(sample);
+        }
+        benchmark::DoNotOptimize(samples.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_QueryThenGet)->Arg(1000)->Arg(5000)->Arg(20000);
+
+static void BM_ForEach(benchmark::State &state) {
+    ecs::wrapper::ECSWorld world;
+    populateWorld(world, state.range(0));
+    std::vector<Sample> samples;
+
+    for (auto _ : state) {
+        samples.clear();
+        world.forEach<ecs::Transform, ecs::Optional<ecs::Velocity>, ecs::Optional<ecs::Health>,
+                      ecs::Optional<ecs::Player>>([&samples](ecs::wrapper::Entity,
+                                                             const ecs::Transform &transform,
+                                                             const ecs::Velocity *velocity,
+                                                             const ecs::Health *health,
+                                                             const ecs::Player *player) {
+            Sample sample;
+            sample.x = transform.getPosition().x;
+            sample.y = transform.getPosition().y;
+            sample.velX = velocity ? velocity->getDirection().x : 0.0f;
+            sample.health = health ? health->getCurrentHealth() : 0;
+            sample.playerId = player ? player->getPlayerId() : 0;
+            samples.push_back(sample);
+        });
+        benchmark::DoNotOptimize(samples.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ForEach)->Arg(1000)->Arg(5000)->Arg(20000);
+
+// Narrow query (few matches among many entities), like PendingDestroy lookups.
+static void BM_QueryNarrow(benchmark::State &state) {
+    ecs::wrapper::ECSWorld world;
+    populateWorld(world, state.range(0));
+
+    for (auto _ : state) {
+        int count = 0;
+        for (auto &entity : world.query<ecs::Player>()) {
+            count += entity.get<ecs::Player>().getPlayerId() >= 0 ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+}
+BENCHMARK(BM_QueryNarrow)->Arg(5000)->Arg(20000);
+
+static void BM_ForEachNarrow(benchmark::State &state) {
+    ecs::wrapper::ECSWorld world;
+    populateWorld(world, state.range(0));
+
+    for (auto _ : state) {
+        int count = 0;
+        world.forEach<ecs::Player>([&count](ecs::wrapper::Entity, const ecs::Player &player) {
+            count += player.getPlayerId() >= 0 ? 1 : 0;
+        });
+        benchmark::DoNotOptimize(count);
+    }
+}
+BENCHMARK(BM_ForEachNarrow)->Arg(5000)->Arg(20000);
+
+static void BM_ForEachParallel(benchmark::State &state) {
+    ecs::wrapper::ECSWorld world;
+    populateWorld(world, state.range(0));
+
+    for (auto _ : state) {
+        world.forEachParallel<ecs::Transform, ecs::Velocity>(
+            [](ecs::wrapper::Entity, ecs::Transform &transform, const ecs::Velocity &velocity) {
+                auto position = transform.getPosition();
+                transform.setPosition(position.x + velocity.getDirection().x * velocity.getSpeed() * 0.016f,
+                                      position.y);
+            },
+            1024);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ForEachParallel)->Arg(5000)->Arg(20000);
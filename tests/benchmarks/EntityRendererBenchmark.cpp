@@ -0,0 +1,105 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** EntityRendererBenchmark - CPU cost of the entity cache at 5k entities, on a headless graphics backend
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "client/Graphics/HeadlessGraphics/HeadlessGraphics.hpp"
+#include "client/Rendering/EntityRenderer.hpp"
+
+namespace {
+    using RType::Messages::Shared::EntityType;
+
+    /**
+     * @brief Type of the i-th entity of a wave-like mix: mostly projectiles, then enemies and walls.
+     */
+    EntityType typeOf(uint32_t index) {
+        if (index < 4) {
+            return EntityType::Player;
+        }
+        switch (index % 25) {
+            case 0:
+            case 1:
+                return EntityType::Wall;
+            case 2:
+                return EntityType::OrbitalModule;
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+            case 8:
+                return EntityType::EnemyType1;
+            default:
+                return (index % 2 == 0) ? EntityType::PlayerBullet : EntityType::EnemyBullet;
+        }
+    }
+
+    /**
+     * @brief Send one server update for every entity (positions shifted by the tick).
+     */
+    void applyUpdate(EntityRenderer &renderer, uint32_t entityCount, uint32_t tick) {
+        for (uint32_t i = 0; i < entityCount; ++i) {
+            const uint32_t id = i + 1;
+            const float x = static_cast<float>((i * 37 + tick * 4) % 1920);
+            const float y = static_cast<float>((i * 53) % 1080);
+            renderer.updateEntity(id, typeOf(i), x, y, 50, "idle", 0, 0, 17, 13, -240.0f, 0.0f, tick);
+        }
+    }
+}  // namespace
+
+// One GameState worth of updates: every entity found by ID and its columns written
+static void BM_EntityUpdate(benchmark::State &state) {
+    Graphics::HeadlessGraphics graphics;
+    EntityRenderer renderer(graphics);
+    const auto entityCount = static_cast<uint32_t>(state.range(0));
+    applyUpdate(renderer, entityCount, 0);
+
+    uint32_t tick = 1;
+    for (auto _ : state) {
+        applyUpdate(renderer, entityCount, tick++);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntityUpdate)->Arg(5000)->Unit(benchmark::kMicrosecond);
+
+// One frame of interpolation; a zero delta keeps every entity mid-way so each frame does the full work
+static void BM_EntityInterpolation(benchmark::State &state) {
+    Graphics::HeadlessGraphics graphics;
+    EntityRenderer renderer(graphics);
+    const auto entityCount = static_cast<uint32_t>(state.range(0));
+    applyUpdate(renderer, entityCount, 0);
+    applyUpdate(renderer, entityCount, 1);
+
+    for (auto _ : state) {
+        renderer.updateInterpolation(0.0f);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntityInterpolation)->Arg(5000)->Unit(benchmark::kMicrosecond);
+
+// One frame of draw submission (shapes, sprite batch, health bars) with the debug overlay off
+static void BM_EntityRender(benchmark::State &state) {
+    Graphics::HeadlessGraphics graphics;
+    graphics.LoadTexture("PlayerShips.gif", "assets/sprites/PlayerShips.gif");
+    graphics.LoadTexture("Projectiles", "assets/sprites/Projectiles.gif");
+    graphics.LoadTexture("OrbitalModule", "assets/sprites/Module.gif");
+    EntityRenderer renderer(graphics);
+    renderer.setDebugMode(false);
+    renderer.setMyEntityId(1);
+    applyUpdate(renderer, static_cast<uint32_t>(state.range(0)), 0);
+
+    for (auto _ : state) {
+        graphics.ResetDrawCallCount();
+        renderer.render();
+    }
+    state.counters["draw_calls"] = static_cast<double>(graphics.GetDrawCallCount());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntityRender)->Arg(5000)->Unit(benchmark::kMicrosecond);
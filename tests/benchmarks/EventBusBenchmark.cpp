@@ -0,0 +1,138 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** EventBusBenchmark - per-frame InputEvent / NetworkEvent delivery through the client EventBus
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+#include "Core/EventBus/EventBus.hpp"
+
+namespace {
+
+    // Logs (subscriptions, the previous bus's unheard events) go to /dev/null through the async backend
+    void startAsync(const benchmark::State &) {
+        logger::AsyncOptions options;
+        options.console = false;
+        options.filePath = "/dev/null";
+        logger::Logger::startAsync(options);
+    }
+
+    void stopAsync(const benchmark::State &) { logger::Logger::stopAsync(); }
+
+    /**
+     * @brief Previous EventBus: type_index map of type-erased callbacks, debug log on unheard events
+     */
+    class LegacyEventBus {
+       public:
+        template <typename T>
+        void subscribe(std::function<void(const T &)> callback) {
+            _subscribers[std::type_index(typeid(T))].push_back(
+                [callback = std::move(callback)](const IEvent &e) { callback(static_cast<const T &>(e)); });
+        }
+
+        template <typename T>
+        void publish(const T &event) {
+            auto it = _subscribers.find(std::type_index(typeid(T)));
+            if (it != _subscribers.end()) {
+                for (const auto &callback : it->second) {
+                    callback(event);
+                }
+            } else {
+                LOG_DEBUG("[EventBus] No subscribers for event: ", typeid(T).name());
+            }
+        }
+
+       private:
+        std::unordered_map<std::type_index, std::vector<std::function<void(const IEvent &)>>> _subscribers;
+    };
+
+    template <typename Bus>
+    void subscribeInputs(Bus &bus, int64_t count, uint64_t &sink) {
+        for (int64_t i = 0; i < count; ++i) {
+            bus.template subscribe<InputEvent>(
+                [&sink](const InputEvent &event) { sink += static_cast<uint64_t>(event.getAction()); });
+        }
+        // Other types registered too, as in the client
+        bus.template subscribe<UIEvent>([&sink](const UIEvent &) { sink++; });
+        bus.template subscribe<NetworkEvent>([&sink](const NetworkEvent &) { sink++; });
+    }
+
+}  // namespace
+
+static void BM_LegacyPublish(benchmark::State &state) {
+    LegacyEventBus bus;
+    uint64_t sink = 0;
+    subscribeInputs(bus, state.range(0), sink);
+    const InputEvent event(InputAction::SHOOT, InputState::PRESSED);
+
+    for (auto _ : state) {
+        bus.publish(event);
+    }
+    benchmark::DoNotOptimize(sink);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LegacyPublish)->Arg(0)->Arg(1)->Arg(4)->Arg(8)->Setup(startAsync)->Teardown(stopAsync);
+
+static void BM_ChannelPublish(benchmark::State &state) {
+    EventBus bus;
+    uint64_t sink = 0;
+    subscribeInputs(bus, state.range(0), sink);
+    const InputEvent event(InputAction::SHOOT, InputState::PRESSED);
+
+    for (auto _ : state) {
+        bus.publish(event);
+    }
+    benchmark::DoNotOptimize(sink);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ChannelPublish)->Arg(0)->Arg(1)->Arg(4)->Arg(8)->Setup(startAsync)->Teardown(stopAsync);
+
+// A frame's worth of events, each built and published. InputEvent carries no heap payload, so
+// only the bus is measured (a NetworkEvent's byte vector costs the same on both paths).
+template <typename Bus>
+static void eventFrame(benchmark::State &state, bool deferred) {
+    Bus bus;
+    uint64_t sink = 0;
+    subscribeInputs(bus, 2, sink);
+
+    for (auto _ : state) {
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            InputEvent event(InputAction::SHOOT, InputState::PRESSED, static_cast<uint32_t>(i));
+            if constexpr (std::is_same_v<Bus, EventBus>) {
+                if (deferred) {
+                    bus.enqueue(event);
+                    continue;
+                }
+            }
+            bus.publish(event);
+        }
+        if constexpr (std::is_same_v<Bus, EventBus>) {
+            bus.dispatchDeferred();
+        }
+    }
+    benchmark::DoNotOptimize(sink);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_LegacyFrame(benchmark::State &state) {
+    eventFrame<LegacyEventBus>(state, false);
+}
+BENCHMARK(BM_LegacyFrame)->Arg(4)->Arg(32)->Setup(startAsync)->Teardown(stopAsync);
+
+static void BM_ChannelFrame(benchmark::State &state) {
+    eventFrame<EventBus>(state, false);
+}
+BENCHMARK(BM_ChannelFrame)->Arg(4)->Arg(32)->Setup(startAsync)->Teardown(stopAsync);
+
+// The same frame enqueued, then drained at the fixed point of GameLoop::update()
+static void BM_ChannelDeferredFrame(benchmark::State &state) {
+    eventFrame<EventBus>(state, true);
+}
+BENCHMARK(BM_ChannelDeferredFrame)->Arg(4)->Arg(32)->Setup(startAsync)->Teardown(stopAsync);
@@ -0,0 +1,71 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** LoggerBenchmark - synchronous versus asynchronous logging cost on the caller
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <iostream>
+#include "common/Logger/Logger.hpp"
+
+namespace {
+
+    // Keep benchmark output readable: logs go to /dev/null in both modes
+    std::ofstream devNull("/dev/null");
+    std::streambuf *savedCout = nullptr;
+
+    void redirectCout(const benchmark::State &) { savedCout = std::cout.rdbuf(devNull.rdbuf()); }
+
+    void restoreCout(const benchmark::State &) { std::cout.rdbuf(savedCout); }
+
+    void startAsync(const benchmark::State &) {
+        logger::AsyncOptions options;
+        options.console = false;
+        options.filePath = "/dev/null";
+        options.ringCapacity = 1 << 16;
+        logger::Logger::startAsync(options);
+    }
+
+    void stopAsync(const benchmark::State &) { logger::Logger::stopAsync(); }
+
+}  // namespace
+
+// Previous behavior: format + localtime + locked, flushed write on the calling thread
+static void BM_SyncLog(benchmark::State &state) {
+    int entity = 0;
+    for (auto _ : state) {
+        LOG_INFO("[PROJECTILE HIT] Player projectile (E", entity, ") hit enemy (E", entity + 1, ") for ", 25,
+                 " damage. HP: ", 75, "/", 100);
+        ++entity;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SyncLog)->Setup(redirectCout)->Teardown(restoreCout)->ThreadRange(1, 4)->UseRealTime();
+
+// Async backend: the caller only encodes its arguments into its own ring
+// (records dropped when the writer falls behind are not counted here)
+static void BM_AsyncLog(benchmark::State &state) {
+    int entity = 0;
+    for (auto _ : state) {
+        LOG_INFO("[PROJECTILE HIT] Player projectile (E", entity, ") hit enemy (E", entity + 1, ") for ", 25,
+                 " damage. HP: ", 75, "/", 100);
+        ++entity;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AsyncLog)->Setup(startAsync)->Teardown(stopAsync)->ThreadRange(1, 4)->UseRealTime();
+
+// Disabled level: compiled out in release builds (RTYPE_LOG_MIN_LEVEL), otherwise
+// a runtime check made before the arguments are evaluated
+static void BM_DisabledDebug(benchmark::State &state) {
+    logger::Logger::setLevel(logger::Level::INFO);
+    std::string expensive(64, 'x');
+    for (auto _ : state) {
+        LOG_DEBUG("Entity state: ", expensive + expensive, " at ", 1.0f, ",", 2.0f);
+    }
+    logger::Logger::setLevel(logger::Level::DEBUG);
+}
+BENCHMARK(BM_DisabledDebug);
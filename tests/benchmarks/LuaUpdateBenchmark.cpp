@@ -0,0 +1,81 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** LuaUpdateBenchmark - per-entity onUpdate versus batched onUpdateBatch
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "common/ECS/Components/LuaScript.hpp"
+#include "common/ECS/Components/Transform.hpp"
+#include "common/ECSWrapper/ECSWorld.hpp"
+#include "server/Scripting/LuaEngine.hpp"
+#include "server/Scripting/LuaSystemAdapter.hpp"
+
+namespace {
+
+    // Same movement (enemy_basic.lua) written against both script ABIs
+    constexpr const char *PER_ENTITY_SCRIPT = R"(
+        local baseSpeed = 15
+        function onUpdate(entity, deltaTime)
+            if not entity:isValid() or not entity:hasTransform() then
+                return
+            end
+            local transform = entity:getTransform()
+            transform.x = transform.x - baseSpeed * deltaTime
+        end
+    )";
+
+    constexpr const char *BATCH_SCRIPT = R"(
+        local baseSpeed = 15
+        function onUpdateBatch(batch, deltaTime)
+            local xs = batch.x
+            local step = baseSpeed * deltaTime
+            for i = 1, batch.count do
+                xs[i] = xs[i] - step
+            end
+        end
+    )";
+
+    std::string writeScripts() {
+        const auto dir = std::filesystem::temp_directory_path() / "rtype_lua_benchmark";
+        std::filesystem::create_directories(dir);
+        std::ofstream(dir / "per_entity.lua") << PER_ENTITY_SCRIPT;
+        std::ofstream(dir / "batch.lua") << BATCH_SCRIPT;
+        return dir.string() + "/";
+    }
+
+    void runEnemies(benchmark::State &state, const std::string &scriptName) {
+        ecs::wrapper::ECSWorld world;
+        scripting::LuaEngine engine(writeScripts());
+        engine.setWorld(&world);
+        scripting::LuaSystemAdapter system(&engine, &world);
+
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            world.createEntity()
+                .with(ecs::Transform(1200.0f + static_cast<float>(i % 100), static_cast<float>(i % 600)))
+                .with(ecs::LuaScript(scriptName));
+        }
+        system.update(world.getRegistry(), 1.0f / 60.0f);  // Load the script outside the timed loop
+
+        for (auto _ : state) {
+            system.update(world.getRegistry(), 1.0f / 60.0f);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+}  // namespace
+
+static void BM_LuaPerEntityUpdate(benchmark::State &state) {
+    runEnemies(state, "per_entity.lua");
+}
+BENCHMARK(BM_LuaPerEntityUpdate)->Arg(500)->Arg(2000);
+
+static void BM_LuaBatchUpdate(benchmark::State &state) {
+    runEnemies(state, "batch.lua");
+}
+BENCHMARK(BM_LuaBatchUpdate)->Arg(500)->Arg(2000);
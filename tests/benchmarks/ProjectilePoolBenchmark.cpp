@@ -0,0 +1,114 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ProjectilePoolBenchmark - heap allocations of a MultiShot projectile storm
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "common/ECS/Components/Buff.hpp"
+#include "common/ECS/Components/PendingDestroy.hpp"
+#include "common/ECS/Components/Transform.hpp"
+#include "common/ECS/Components/Weapon.hpp"
+#include "common/ECS/Registry.hpp"
+#include "common/ECS/Systems/BoundarySystem/BoundarySystem.hpp"
+#include "common/ECS/Systems/MovementSystem/MovementSystem.hpp"
+#include "common/ECS/Systems/WeaponSystem/WeaponSystem.hpp"
+#include "../common/AllocationCounter.hpp"
+
+namespace {
+    constexpr int PLAYER_COUNT = 4;
+    constexpr int TICK_RATE = 60;
+    constexpr int SIMULATED_SECONDS = 60;
+    constexpr int WARMUP_SECONDS = 5;
+    constexpr float DELTA_TIME = 1.0f / TICK_RATE;
+
+    /**
+     * @brief Server-like room: 4 players with a permanent MultiShot buff firing 5-way shots
+     * as fast as their weapon allows; projectiles fly off screen and are destroyed.
+     */
+    class ProjectileStorm {
+       public:
+        ProjectileStorm() : _boundarySystem(1920, 1080) {
+            for (int i = 0; i < PLAYER_COUNT; ++i) {
+                _players[i] = _registry.newEntity();
+                _registry.setComponent(_players[i], ecs::Transform(100.0f, 150.0f + i * 250.0f));
+                _registry.setComponent(_players[i], ecs::Weapon(7.0f, 0.0f, 0, 10));
+                _registry.setComponent(_players[i], ecs::Buff(ecs::BuffType::MultiShot, 0.0f, 1.0f));
+            }
+        }
+
+        /**
+         * @brief Simulate one server tick.
+         * @return int Number of projectiles fired this tick.
+         */
+        int tick() {
+            int fired = 0;
+            size_t before = AllocationCounter::count();
+            for (ecs::Address player : _players) {
+                if (_registry.getComponent<ecs::Weapon>(player).getCooldown() <= 0.0f) {
+                    _weaponSystem.fireWeapon(_registry, player, true);
+                    fired += 5;
+                }
+            }
+            prefabAllocations += AllocationCounter::count() - before;
+
+            _weaponSystem.update(_registry, DELTA_TIME);
+            _movementSystem.update(_registry, DELTA_TIME);
+            _boundarySystem.update(_registry, DELTA_TIME);
+
+            // The server destroys out-of-bounds entities once clients are notified
+            before = AllocationCounter::count();
+            _toDestroy.clear();
+            _registry.each<ecs::PendingDestroy>(
+                [this](ecs::Address address, const ecs::PendingDestroy &) { _toDestroy.push_back(address); });
+            for (ecs::Address address : _toDestroy) {
+                _registry.destroyEntity(address);
+            }
+            prefabAllocations += AllocationCounter::count() - before;
+            return fired;
+        }
+
+        /// Allocations made while spawning and destroying projectiles (systems excluded)
+        size_t prefabAllocations = 0;
+
+       private:
+        ecs::Registry _registry;
+        ecs::WeaponSystem _weaponSystem;
+        ecs::MovementSystem _movementSystem;
+        ecs::BoundarySystem _boundarySystem;
+        std::array<ecs::Address, PLAYER_COUNT> _players{};
+        std::vector<ecs::Address> _toDestroy;
+    };
+}  // namespace
+
+// 60 simulated seconds per iteration, after a short warm-up that fills the registry node pools
+static void BM_MultiShotStorm(benchmark::State &state) {
+    ProjectileStorm storm;
+    for (int i = 0; i < WARMUP_SECONDS * TICK_RATE; ++i) {
+        storm.tick();
+    }
+
+    storm.prefabAllocations = 0;
+    size_t allocations = 0;
+    int64_t projectiles = 0;
+    for (auto _ : state) {
+        const size_t before = AllocationCounter::count();
+        for (int i = 0; i < SIMULATED_SECONDS * TICK_RATE; ++i) {
+            projectiles += storm.tick();
+        }
+        allocations += AllocationCounter::count() - before;
+    }
+
+    const double ticks = static_cast<double>(state.iterations()) * SIMULATED_SECONDS * TICK_RATE;
+    const double shots = static_cast<double>(std::max<int64_t>(projectiles, 1));
+    state.counters["allocs_per_tick"] = static_cast<double>(allocations) / ticks;
+    state.counters["prefab_allocs_per_projectile"] = static_cast<double>(storm.prefabAllocations) / shots;
+    state.counters["projectiles"] = static_cast<double>(projectiles);
+}
+BENCHMARK(BM_MultiShotStorm)->Unit(benchmark::kMillisecond);
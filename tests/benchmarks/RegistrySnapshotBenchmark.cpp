@@ -0,0 +1,108 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** RegistrySnapshotBenchmark - cost of saving and restoring a 5k-entity world for rollback
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "common/ECS/Components/Collider.hpp"
+#include "common/ECS/Components/Health.hpp"
+#include "common/ECS/Components/Sprite.hpp"
+#include "common/ECS/Components/Transform.hpp"
+#include "common/ECS/Components/Velocity.hpp"
+#include "common/ECS/Registry.hpp"
+#include "common/ECS/RegistrySnapshot.hpp"
+#include "../common/AllocationCounter.hpp"
+
+namespace {
+    constexpr float DELTA_TIME = 1.0f / 60.0f;
+    constexpr int CHURN_PER_TICK = 16;  ///< Entities destroyed and spawned by a simulated tick
+
+    /**
+     * @brief Fill a registry with moving, colliding, damageable sprites (texture key included).
+     */
+    std::vector<ecs::Address> populate(ecs::Registry &registry, int entityCount) {
+        std::vector<ecs::Address> entities;
+        entities.reserve(entityCount);
+        for (int i = 0; i < entityCount; ++i) {
+            ecs::Address entity = registry.newEntity();
+            const float x = static_cast<float>(i % 1920);
+            const float y = static_cast<float>(i % 1080);
+            registry.setComponent(entity, ecs::Transform(x, y));
+            registry.setComponent(entity, ecs::Velocity(-1.0f, 0.0f, 200.0f));
+            registry.setComponent(entity, ecs::Health(100));
+            registry.setComponent(entity, ecs::Collider(32.0f, 32.0f, 0.0f, 0.0f, 2, 5, false));
+            registry.setComponent(entity, ecs::Sprite("r-typesheet1", {0, 0, 32, 32}));
+            entities.push_back(entity);
+        }
+        return entities;
+    }
+
+    /**
+     * @brief One tick of divergence from the snapshot: everything moves, a few entities die and spawn.
+     */
+    void simulateTick(ecs::Registry &registry, const std::vector<ecs::Address> &entities) {
+        registry.each<ecs::Transform, ecs::Velocity>(
+            [](ecs::Address, ecs::Transform &transform, const ecs::Velocity &velocity) {
+                const ecs::Transform::Vector2 position = transform.getPosition();
+                const float step = velocity.getDirection().x * velocity.getSpeed() * DELTA_TIME;
+                transform.setPosition(position.x + step, position.y);
+            });
+        for (int i = 0; i < CHURN_PER_TICK; ++i) {
+            registry.destroyEntity(entities[i]);
+        }
+        for (int i = 0; i < CHURN_PER_TICK; ++i) {
+            ecs::Address entity = registry.newEntity();
+            registry.setComponent(entity, ecs::Transform(1920.0f, 540.0f));
+            registry.setComponent(entity, ecs::Velocity(-1.0f, 0.0f, 400.0f));
+        }
+    }
+}  // namespace
+
+// Save the whole world into a snapshot reused from the previous save (steady state of a rollback ring)
+static void BM_SnapshotSave(benchmark::State &state) {
+    ecs::Registry registry;
+    populate(registry, static_cast<int>(state.range(0)));
+    ecs::RegistrySnapshot snapshot;
+    registry.saveSnapshot(snapshot);
+
+    size_t allocations = 0;
+    for (auto _ : state) {
+        const size_t before = AllocationCounter::count();
+        registry.saveSnapshot(snapshot);
+        allocations += AllocationCounter::count() - before;
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["allocs_per_save"] =
+        static_cast<double>(allocations) / static_cast<double>(state.iterations());
+    state.counters["components"] = static_cast<double>(snapshot.getComponentCount());
+}
+BENCHMARK(BM_SnapshotSave)->Arg(5000)->Unit(benchmark::kMicrosecond);
+
+// Roll back one simulated tick (moved entities, destroyed and spawned ones); the tick itself is not timed
+static void BM_SnapshotRestore(benchmark::State &state) {
+    ecs::Registry registry;
+    const std::vector<ecs::Address> entities = populate(registry, static_cast<int>(state.range(0)));
+    ecs::RegistrySnapshot snapshot;
+    registry.saveSnapshot(snapshot);
+
+    size_t allocations = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        simulateTick(registry, entities);
+        state.ResumeTiming();
+
+        const size_t before = AllocationCounter::count();
+        registry.restoreSnapshot(snapshot);
+        allocations += AllocationCounter::count() - before;
+    }
+
+    state.counters["allocs_per_restore"] =
+        static_cast<double>(allocations) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_SnapshotRestore)->Arg(5000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,79 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** RoomDispatchBenchmark - player -> room lookup done for every input packet
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include "server/Rooms/RoomManager/RoomManager.hpp"
+
+namespace {
+
+    constexpr uint32_t PLAYERS_PER_ROOM = 4;
+
+    /**
+     * @brief RoomManager with @p roomCount full rooms, built once per size
+     * (each Room owns a running game loop, so building them is expensive).
+     */
+    server::RoomManager &loadedManager(int64_t roomCount) {
+        static std::map<int64_t, std::unique_ptr<server::RoomManager>> managers;
+
+        auto &manager = managers[roomCount];
+        if (!manager) {
+            manager = std::make_unique<server::RoomManager>(nullptr);
+            uint32_t playerId = 1;
+            for (int64_t i = 0; i < roomCount; ++i) {
+                auto room = manager->createRoom("bench_" + std::to_string(i));
+                for (uint32_t p = 0; p < PLAYERS_PER_ROOM; ++p) {
+                    room->join(playerId++);
+                }
+            }
+        }
+        return *manager;
+    }
+
+    uint32_t nextPlayer(uint32_t &cursor, int64_t roomCount) {
+        cursor = cursor * 1664525u + 1013904223u;
+        return 1 + cursor % static_cast<uint32_t>(roomCount * PLAYERS_PER_ROOM);
+    }
+
+}  // namespace
+
+// Previous getRoomByPlayer(): copy the room list and scan every room's member vectors
+static void BM_InputDispatchScan(benchmark::State &state) {
+    server::RoomManager &manager = loadedManager(state.range(0));
+    uint32_t cursor = static_cast<uint32_t>(state.thread_index()) + 1;
+
+    for (auto _ : state) {
+        const uint32_t playerId = nextPlayer(cursor, state.range(0));
+        std::shared_ptr<server::Room> found;
+        for (const auto &room : manager.getAllRooms()) {
+            if (room->hasPlayer(playerId) || room->hasSpectator(playerId)) {
+                found = room;
+                break;
+            }
+        }
+        benchmark::DoNotOptimize(found ? found->getGameLogic() : nullptr);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_InputDispatchScan)->Arg(50)->Arg(200)->Arg(500)->ThreadRange(1, 8)->UseRealTime();
+
+// Indexed getRoomByPlayer()
+static void BM_InputDispatch(benchmark::State &state) {
+    server::RoomManager &manager = loadedManager(state.range(0));
+    uint32_t cursor = static_cast<uint32_t>(state.thread_index()) + 1;
+
+    for (auto _ : state) {
+        const uint32_t playerId = nextPlayer(cursor, state.range(0));
+        std::shared_ptr<server::Room> found = manager.getRoomByPlayer(playerId);
+        benchmark::DoNotOptimize(found ? found->getGameLogic() : nullptr);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_InputDispatch)->Arg(50)->Arg(200)->Arg(500)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,196 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** AssetManagerTest.cpp - Asynchronous texture loading, upload budget and map preload manifest
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Assets/AssetManager.hpp"
+#include "Assets/AssetManifest.hpp"
+#include "Graphics/HeadlessGraphics/HeadlessGraphics.hpp"
+
+using Assets::AssetManager;
+using Assets::AssetState;
+
+namespace {
+    /**
+     * @brief Headless backend decoding fake images (width = path length) and recording uploads
+     */
+    class StreamingGraphics : public Graphics::HeadlessGraphics {
+       public:
+        struct Upload {
+            std::string name;
+            int width;
+            int height;
+        };
+
+        bool DecodeImage(const char *filepath, Graphics::DecodedImage &image) const override {
+            const std::string path = filepath;
+            if (path.find("missing") != std::string::npos) {
+                return false;
+            }
+            image.width = static_cast<int>(path.size());
+            image.height = 2;
+            image.pixels.assign(static_cast<size_t>(image.width) * image.height * 4, 0xFF);
+            return true;
+        }
+
+        int CreateTextureFromMemory(const char *textureName, const void *pixels, int width, int height,
+                                    int format) override {
+            std::this_thread::sleep_for(uploadCost);
+            uploads.push_back({textureName, width, height});
+            return HeadlessGraphics::CreateTextureFromMemory(textureName, pixels, width, height, format);
+        }
+
+        std::vector<Upload> uploads;
+        std::chrono::microseconds uploadCost{0};
+    };
+
+    /**
+     * @brief Run frames until nothing is pending (or a generous timeout)
+     */
+    void pump(AssetManager &assets, double budget = 0.002) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (assets.GetPendingCount() > 0 && std::chrono::steady_clock::now() < deadline) {
+            if (assets.Update(budget) == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+}  // namespace
+
+TEST(AssetManagerTest, PlaceholderUntilDecodedThenSameHandle) {
+    StreamingGraphics graphics;
+    AssetManager assets(graphics);
+
+    assets.Request({"Ship", "assets/sprites/Ship.gif"});
+    EXPECT_EQ(assets.GetState("Ship"), AssetState::Pending);
+    ASSERT_EQ(graphics.uploads.size(), 1u);  // Placeholder, registered right away
+    EXPECT_EQ(graphics.uploads[0].width, 1);
+    const Graphics::TextureHandle handle = graphics.GetTextureHandle("Ship");
+    ASSERT_NE(handle, Graphics::INVALID_TEXTURE);
+
+    pump(assets);
+
+    EXPECT_EQ(assets.GetState("Ship"), AssetState::Ready);
+    ASSERT_EQ(graphics.uploads.size(), 2u);
+    EXPECT_EQ(graphics.uploads[1].width, static_cast<int>(std::string("assets/sprites/Ship.gif").size()));
+    EXPECT_EQ(graphics.GetTextureHandle("Ship"), handle);
+}
+
+TEST(AssetManagerTest, FailedDecodeKeepsPlaceholder) {
+    StreamingGraphics graphics;
+    AssetManager assets(graphics);
+
+    assets.Request({"Broken", "assets/missing.png"});
+    pump(assets);
+
+    EXPECT_EQ(assets.GetState("Broken"), AssetState::Failed);
+    EXPECT_EQ(assets.GetPendingCount(), 0u);
+    EXPECT_EQ(graphics.uploads.size(), 1u);  // Only the placeholder
+    EXPECT_NE(graphics.GetTextureHandle("Broken"), Graphics::INVALID_TEXTURE);
+}
+
+TEST(AssetManagerTest, NoPlaceholderWhenNotRequested) {
+    StreamingGraphics graphics;
+    AssetManager assets(graphics);
+
+    assets.Request({"backgrounds/bg.png", "assets/backgrounds/bg.png", false});
+    EXPECT_TRUE(graphics.uploads.empty());
+    EXPECT_EQ(graphics.GetTextureHandle("backgrounds/bg.png"), Graphics::INVALID_TEXTURE);
+
+    pump(assets);
+    EXPECT_EQ(assets.GetState("backgrounds/bg.png"), AssetState::Ready);
+    EXPECT_EQ(graphics.uploads.size(), 1u);
+}
+
+TEST(AssetManagerTest, UploadsAreSpreadOverFramesByBudget) {
+    StreamingGraphics graphics;
+    AssetManager assets(graphics);
+    std::vector<Assets::AssetRequest> manifest;
+    for (int i = 0; i < 4; ++i) {
+        manifest.push_back({"Sheet" + std::to_string(i), "assets/sheet.png", false});
+    }
+    assets.Preload(manifest);
+
+    // Wait for every decode, so only the budget limits the uploads
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    graphics.uploadCost = std::chrono::milliseconds(3);
+    size_t uploaded = 0;
+    int frames = 0;
+    while (uploaded < manifest.size() && std::chrono::steady_clock::now() < deadline) {
+        const size_t thisFrame = assets.Update(0.001);
+        EXPECT_LE(thisFrame, 1u);  // One upload already exceeds the 1 ms budget
+        uploaded += thisFrame;
+        frames += thisFrame > 0 ? 1 : 0;
+        if (thisFrame == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    EXPECT_EQ(uploaded, manifest.size());
+    EXPECT_EQ(frames, 4);
+}
+
+TEST(AssetManagerTest, RequestsAreDeduplicatedAndReloadsReplaceStaleDecodes) {
+    StreamingGraphics graphics;
+    AssetManager assets(graphics);
+
+    assets.Request({"Wall", "assets/a.png", false});
+    assets.Request({"Wall", "assets/a.png", false});
+    EXPECT_EQ(assets.GetPendingCount(), 1u);
+
+    // Another file before the first one is uploaded: only the latest is uploaded
+    assets.Request({"Wall", "assets/longer/b.png", false});
+    EXPECT_EQ(assets.GetPendingCount(), 1u);
+    pump(assets);
+
+    ASSERT_EQ(graphics.uploads.size(), 1u);
+    EXPECT_EQ(graphics.uploads[0].width, static_cast<int>(std::string("assets/longer/b.png").size()));
+    EXPECT_EQ(assets.GetState("Wall"), AssetState::Ready);
+}
+
+TEST(AssetManagerTest, UnloadDropsDecodeInFlight) {
+    StreamingGraphics graphics;
+    AssetManager assets(graphics);
+
+    assets.Request({"Module", "assets/module.gif", false});
+    assets.Unload("Module");
+    EXPECT_EQ(assets.GetState("Module"), AssetState::Missing);
+    EXPECT_EQ(assets.GetPendingCount(), 0u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    assets.Update(0.002);
+    EXPECT_TRUE(graphics.uploads.empty());
+}
+
+TEST(AssetManagerTest, MapManifestListsDistinctBackgrounds) {
+    const std::filesystem::path directory =
+        std::filesystem::temp_directory_path() / "rtype_asset_manifest_test";
+    std::filesystem::create_directories(directory);
+    std::ofstream(directory / "level_1.json") << R"({"mapId": "level_1", "background": "backgrounds/bg.png",
+                                                    "parallaxBackground": "backgrounds/stars.png"})";
+    std::ofstream(directory / "level_2.json") << R"({"mapId": "level_2", "background": "backgrounds/bg.png",
+                                                    "parallaxBackground": ""})";
+    std::ofstream(directory / "notes.txt") << "not a map";
+
+    const std::vector<Assets::AssetRequest> manifest = Assets::MapManifest(directory.string());
+    std::filesystem::remove_all(directory);
+
+    ASSERT_EQ(manifest.size(), 2u);
+    EXPECT_EQ(manifest[0].name, "backgrounds/bg.png");
+    EXPECT_EQ(manifest[0].path, "assets/backgrounds/bg.png");
+    EXPECT_FALSE(manifest[0].placeholder);
+    EXPECT_EQ(manifest[1].name, "backgrounds/stars.png");
+}
+
+TEST(AssetManagerTest, MissingMapDirectoryGivesEmptyManifest) {
+    EXPECT_TRUE(Assets::MapManifest("does/not/exist").empty());
+}
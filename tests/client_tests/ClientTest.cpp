@@ -6,3 +6,40 @@
 */
 
 #include <gtest/gtest.h>
+
+#include "Network/SnapshotIntake.hpp"
+
+TEST(SnapshotIntakeTest, RejectsStaleAndDuplicatedTicks) {
+    SnapshotIntake intake;
+
+    EXPECT_TRUE(intake.accept(10));
+    EXPECT_TRUE(intake.accept(12));
+    EXPECT_FALSE(intake.accept(11));  // Arrived late
+    EXPECT_FALSE(intake.accept(12));  // Duplicate
+    EXPECT_TRUE(intake.accept(13));
+    EXPECT_EQ(intake.getStaleCount(), 2u);
+}
+
+TEST(SnapshotIntakeTest, NewServerTimelineIsAccepted) {
+    SnapshotIntake intake;
+    EXPECT_TRUE(intake.accept(5000));
+
+    // A tick far behind the newest one comes from a restarted room loop
+    EXPECT_TRUE(intake.accept(3));
+    EXPECT_FALSE(intake.accept(2));
+
+    intake.reset();
+    EXPECT_TRUE(intake.accept(1));
+}
+
+TEST(SnapshotIntakeTest, CoalesceKeepsNewestAndAnchors) {
+    SnapshotIntake intake;
+    EXPECT_EQ(intake.coalesce(0), 0u);
+    EXPECT_EQ(intake.coalesce(1), 0u);
+    EXPECT_EQ(intake.coalesce(4), 3u);
+
+    intake.setInterpolationAnchors(1);
+    EXPECT_EQ(intake.coalesce(4), 2u);
+    EXPECT_EQ(intake.coalesce(2), 0u);
+    EXPECT_EQ(intake.getCoalescedCount(), 5u);
+}
@@ -0,0 +1,113 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** EventBusTest.cpp - Typed event channels and the deferred queue drained by the game loop
+*/
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+#include "Core/EventBus/EventBus.hpp"
+
+TEST(EventBusTest, PublishReachesSubscribersOfThatTypeInOrder) {
+    EventBus bus;
+    std::vector<std::string> calls;
+    const size_t first =
+        bus.subscribe<UIEvent>([&calls](const UIEvent &event) { calls.push_back("a" + event.getData()); });
+    const size_t second =
+        bus.subscribe<UIEvent>([&calls](const UIEvent &event) { calls.push_back("b" + event.getData()); });
+    EXPECT_EQ(first, 0u);
+    EXPECT_EQ(second, 1u);
+    bus.subscribe<InputEvent>([&calls](const InputEvent &) { calls.push_back("input"); });
+
+    bus.publish(UIEvent(UIEventType::SERVER_CONNECT, "1"));
+
+    ASSERT_EQ(calls.size(), 2u);
+    EXPECT_EQ(calls[0], "a1");
+    EXPECT_EQ(calls[1], "b1");
+}
+
+TEST(EventBusTest, PublishWithoutSubscribersIsIgnored) {
+    EventBus bus;
+    EXPECT_NO_THROW(bus.publish(NetworkEvent(NetworkMessageType::PING, {1, 2, 3})));
+}
+
+TEST(EventBusTest, EnqueuedEventsWaitForDispatch) {
+    EventBus bus;
+    std::vector<std::string> received;
+    bus.subscribe<UIEvent>([&received](const UIEvent &event) { received.push_back(event.getData()); });
+
+    bus.enqueue(UIEvent(UIEventType::AUTH_SUCCESS, "first"));
+    bus.enqueue(UIEvent(UIEventType::LOGIN_FAILED, "second"));
+    EXPECT_TRUE(received.empty());
+
+    EXPECT_EQ(bus.dispatchDeferred(), 2u);
+    ASSERT_EQ(received.size(), 2u);
+    EXPECT_EQ(received[0], "first");
+    EXPECT_EQ(received[1], "second");
+
+    EXPECT_EQ(bus.dispatchDeferred(), 0u);
+    EXPECT_EQ(received.size(), 2u);
+}
+
+TEST(EventBusTest, EventsEnqueuedWhileDispatchingWaitForTheNextDispatch) {
+    EventBus bus;
+    int delivered = 0;
+    bus.subscribe<UIEvent>([&bus, &delivered](const UIEvent &event) {
+        delivered++;
+        if (event.getData() == "again") {
+            bus.enqueue(UIEvent(UIEventType::SERVER_CONNECT, "done"));
+        }
+    });
+
+    bus.enqueue(UIEvent(UIEventType::SERVER_CONNECT, "again"));
+    EXPECT_EQ(bus.dispatchDeferred(), 1u);
+    EXPECT_EQ(delivered, 1);
+    EXPECT_EQ(bus.dispatchDeferred(), 1u);
+    EXPECT_EQ(delivered, 2);
+}
+
+TEST(EventBusTest, OtherThreadsEnqueueForTheGameThread) {
+    EventBus bus;
+    const std::thread::id gameThread = std::this_thread::get_id();
+    int delivered = 0;
+    bus.subscribe<UIEvent>([&](const UIEvent &) {
+        EXPECT_EQ(std::this_thread::get_id(), gameThread);
+        delivered++;
+    });
+
+    constexpr int PER_THREAD = 500;
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 4; ++t) {
+        producers.emplace_back([&bus]() {
+            for (int i = 0; i < PER_THREAD; ++i) {
+                bus.enqueue(UIEvent(UIEventType::CONNECTION_SUCCESS));
+            }
+        });
+    }
+    size_t total = 0;
+    while (total < 4 * PER_THREAD) {
+        total += bus.dispatchDeferred();
+    }
+    for (std::thread &producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_EQ(bus.dispatchDeferred(), 0u);
+    EXPECT_EQ(delivered, 4 * PER_THREAD);
+}
+
+TEST(EventBusTest, ClearDropsSubscribersAndDeferredEvents) {
+    EventBus bus;
+    int delivered = 0;
+    bus.subscribe<ConnectionEvent>([&delivered](const ConnectionEvent &) { delivered++; });
+    bus.enqueue(ConnectionEvent(ConnectionEvent::Status::CONNECTED));
+
+    bus.clear();
+    EXPECT_EQ(bus.dispatchDeferred(), 0u);
+    bus.publish(ConnectionEvent(ConnectionEvent::Status::FAILED));
+    EXPECT_EQ(delivered, 0);
+}
@@ -0,0 +1,178 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** FrameProfilerTest.cpp - Per-stage frame times, history ring and CSV / Chrome trace dumps
+*/
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "Core/Profiler/FrameProfiler.hpp"
+
+using Profiling::FrameProfiler;
+using Profiling::ScopedTimer;
+using Profiling::Stage;
+
+namespace {
+    double fakeTime = 0.0;
+
+    double fakeNow() {
+        return fakeTime;
+    }
+
+    size_t stageIndex(Stage stage) {
+        return static_cast<size_t>(stage);
+    }
+
+    size_t countOf(const std::string &text, const std::string &pattern) {
+        size_t count = 0;
+        for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+            count++;
+        }
+        return count;
+    }
+}  // namespace
+
+class FrameProfilerTest : public ::testing::Test {
+   protected:
+    void SetUp() override { fakeTime = 100.0; }
+
+    /**
+     * @brief One 16 ms frame: 2 ms network drain containing a 1 ms snapshot apply, then 3 ms of draws
+     */
+    static void typicalFrame(FrameProfiler &profiler) {
+        profiler.beginFrame();
+        {
+            ScopedTimer drain(&profiler, Stage::NetworkDrain);
+            fakeTime += 0.0005;
+            {
+                ScopedTimer apply(&profiler, Stage::SnapshotApply);
+                fakeTime += 0.001;
+            }
+            fakeTime += 0.0005;
+        }
+        {
+            ScopedTimer draw(&profiler, Stage::DrawSubmission);
+            fakeTime += 0.003;
+        }
+        fakeTime += 0.011;  // Buffer swap and frame cap
+    }
+};
+
+TEST_F(FrameProfilerTest, NestedStagesAreTimedExclusively) {
+    FrameProfiler profiler(fakeNow);
+    typicalFrame(profiler);
+    EXPECT_EQ(profiler.getFrameCount(), 0u);  // Still open
+
+    profiler.beginFrame();
+    ASSERT_EQ(profiler.getFrameCount(), 1u);
+
+    const Profiling::FrameSample &frame = profiler.getFrame(0);
+    EXPECT_NEAR(frame.seconds, 0.016, 1e-9);
+    EXPECT_NEAR(frame.stageSeconds[stageIndex(Stage::NetworkDrain)], 0.001, 1e-9);
+    EXPECT_NEAR(frame.stageSeconds[stageIndex(Stage::SnapshotApply)], 0.001, 1e-9);
+    EXPECT_NEAR(frame.stageSeconds[stageIndex(Stage::DrawSubmission)], 0.003, 1e-9);
+    EXPECT_EQ(frame.stageSeconds[stageIndex(Stage::Interpolation)], 0.0);
+    EXPECT_NEAR(frame.other(), 0.011, 1e-9);
+
+    EXPECT_NEAR(frame.stageStart[stageIndex(Stage::SnapshotApply)], 0.0005, 1e-9);
+    EXPECT_NEAR(frame.stageStart[stageIndex(Stage::DrawSubmission)], 0.002, 1e-9);
+}
+
+TEST_F(FrameProfilerTest, StageEnteredSeveralTimesAccumulates) {
+    FrameProfiler profiler(fakeNow);
+    profiler.beginFrame();
+    for (int step = 0; step < 3; ++step) {
+        ScopedTimer prediction(&profiler, Stage::Prediction);
+        fakeTime += 0.002;
+    }
+    profiler.beginFrame();
+
+    EXPECT_NEAR(profiler.getFrame(0).stageSeconds[stageIndex(Stage::Prediction)], 0.006, 1e-9);
+    EXPECT_EQ(profiler.getFrame(0).stageStart[stageIndex(Stage::Prediction)], 0.0);
+}
+
+TEST_F(FrameProfilerTest, HistoryKeepsTheLatestFrames) {
+    FrameProfiler profiler(fakeNow);
+    for (size_t i = 0; i < FrameProfiler::HISTORY + 10; ++i) {
+        profiler.beginFrame();
+        fakeTime += 0.001 * static_cast<double>(i % 5 + 1);
+    }
+    profiler.beginFrame();
+
+    ASSERT_EQ(profiler.getFrameCount(), FrameProfiler::HISTORY);
+    EXPECT_EQ(profiler.getFrame(0).index, FrameProfiler::HISTORY + 9);
+    EXPECT_EQ(profiler.getFrame(FrameProfiler::HISTORY - 1).index, 10u);
+
+    const Profiling::ProfileSummary summary = profiler.summarize();
+    EXPECT_EQ(summary.frames, FrameProfiler::HISTORY);
+    EXPECT_NEAR(summary.maxFrame, 0.005, 1e-9);
+    EXPECT_NEAR(summary.averageFrame, 0.003, 1e-9);
+}
+
+TEST_F(FrameProfilerTest, NullProfilerTimerDoesNothing) {
+    EXPECT_NO_THROW({ ScopedTimer timer(nullptr, Stage::UIUpdate); });
+}
+
+TEST_F(FrameProfilerTest, CsvHasOneLinePerFrameOldestFirst) {
+    FrameProfiler profiler(fakeNow);
+    typicalFrame(profiler);
+    typicalFrame(profiler);
+    profiler.beginFrame();
+
+    std::ostringstream csv;
+    csv << 1.5;  // The caller's format is restored afterwards
+    profiler.writeCsv(csv);
+    csv << ' ' << 1.5;
+
+    std::istringstream lines(csv.str());
+    std::string header;
+    std::string first;
+    std::string second;
+    std::getline(lines, header);
+    std::getline(lines, first);
+    std::getline(lines, second);
+    EXPECT_EQ(header,
+              "1.5frame,start_ms,frame_ms,network_drain_ms,snapshot_apply_ms,interpolation_ms,prediction_ms,"
+              "ui_update_ms,draw_submission_ms,other_ms");
+    EXPECT_EQ(first, "0,0.000,16.000,1.000,1.000,0.000,0.000,0.000,3.000,11.000");
+    EXPECT_EQ(second.rfind("1,16.000,16.000,", 0), 0u);
+    EXPECT_NE(csv.str().find(" 1.5"), std::string::npos);
+}
+
+TEST_F(FrameProfilerTest, ChromeTraceHasAnEventPerFrameAndStage) {
+    FrameProfiler profiler(fakeNow);
+    typicalFrame(profiler);
+    typicalFrame(profiler);
+    profiler.beginFrame();
+
+    std::ostringstream trace;
+    profiler.writeChromeTrace(trace);
+    const std::string json = trace.str();
+
+    EXPECT_EQ(countOf(json, R"("ph":"M")"), Profiling::STAGE_COUNT + 1);
+    EXPECT_EQ(countOf(json, R"("name":"Frame","ph":"X")"), 2u);
+    EXPECT_EQ(countOf(json, R"("name":"Snapshot apply","ph":"X")"), 2u);
+    EXPECT_EQ(countOf(json, R"("name":"Interpolation","ph":"X")"), 0u);
+    EXPECT_NE(json.find(R"("ts":16500.0,"dur":1000.0)"), std::string::npos);  // Second frame's snapshot apply
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.substr(json.size() - 2), "}\n");
+}
+
+TEST_F(FrameProfilerTest, DumpWritesBothFiles) {
+    FrameProfiler profiler(fakeNow);
+    typicalFrame(profiler);
+    profiler.beginFrame();
+
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "rtype_profiler_test";
+    std::filesystem::remove_all(directory);
+    ASSERT_TRUE(profiler.dump((directory / "nested" / "frames").string()));
+
+    EXPECT_TRUE(std::filesystem::exists(directory / "nested" / "frames.csv"));
+    EXPECT_TRUE(std::filesystem::exists(directory / "nested" / "frames.trace.json"));
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,87 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** LoadStatsTest.cpp - measurement summaries of the headless load-testing bots
+*/
+
+#include <gtest/gtest.h>
+
+#include "Headless/LoadStats.hpp"
+
+using Headless::BotStats;
+using Headless::JitterEstimator;
+using Headless::SampleSeries;
+
+TEST(LoadStatsTest, SummaryUsesNearestRankPercentiles) {
+    SampleSeries series;
+    for (int value = 100; value >= 1; --value) {
+        series.add(static_cast<double>(value));
+    }
+
+    const auto summary = series.summarize();
+    EXPECT_EQ(summary.count, 100u);
+    EXPECT_DOUBLE_EQ(summary.mean, 50.5);
+    EXPECT_DOUBLE_EQ(summary.p50, 50.0);
+    EXPECT_DOUBLE_EQ(summary.p95, 95.0);
+    EXPECT_DOUBLE_EQ(summary.p99, 99.0);
+    EXPECT_DOUBLE_EQ(summary.max, 100.0);
+}
+
+TEST(LoadStatsTest, EmptySeriesSummarizesToZero) {
+    const auto summary = SampleSeries().summarize();
+    EXPECT_EQ(summary.count, 0u);
+    EXPECT_DOUBLE_EQ(summary.max, 0.0);
+}
+
+TEST(LoadStatsTest, BotStatsMergeAddsSamplesAndCounters) {
+    BotStats first;
+    first.rttMs.add(10.0);
+    first.inputsSent = 3;
+    BotStats second;
+    second.rttMs.add(30.0);
+    second.inputsSent = 4;
+    second.staleSnapshots = 2;
+
+    first.merge(second);
+    EXPECT_EQ(first.rttMs.count(), 2u);
+    EXPECT_DOUBLE_EQ(first.rttMs.summarize().mean, 20.0);
+    EXPECT_EQ(first.inputsSent, 7u);
+    EXPECT_EQ(first.staleSnapshots, 2u);
+}
+
+TEST(LoadStatsTest, SteadyArrivalsHaveNoJitter) {
+    JitterEstimator jitter(1.0 / 60.0);
+    EXPECT_FALSE(jitter.onSnapshot(10, 1.0).has_value());
+
+    // One snapshot every two ticks, arriving exactly two ticks apart
+    for (uint32_t i = 1; i <= 10; ++i) {
+        auto transitDelta = jitter.onSnapshot(10 + i * 2, 1.0 + i * 2.0 / 60.0);
+        ASSERT_TRUE(transitDelta.has_value());
+        EXPECT_NEAR(*transitDelta, 0.0, 1e-9);
+    }
+    EXPECT_NEAR(jitter.getJitter(), 0.0, 1e-9);
+}
+
+TEST(LoadStatsTest, LateSnapshotIsMeasuredAndSmoothed) {
+    JitterEstimator jitter(0.01);
+    jitter.onSnapshot(1, 0.0);
+
+    // Sent one tick later, arrived 16 ms later: 6 ms of transit variation
+    auto transitDelta = jitter.onSnapshot(2, 0.016);
+    ASSERT_TRUE(transitDelta.has_value());
+    EXPECT_NEAR(*transitDelta, 0.006, 1e-9);
+    EXPECT_NEAR(jitter.getJitter(), 0.006 / 16.0, 1e-9);
+}
+
+TEST(LoadStatsTest, TickGoingBackStartsANewTimeline) {
+    JitterEstimator jitter(1.0 / 60.0);
+    jitter.onSnapshot(500, 10.0);
+    jitter.onSnapshot(501, 10.0 + 1.0 / 60.0);
+
+    // The room loop restarted at tick 0: no delta against the old timeline
+    EXPECT_FALSE(jitter.onSnapshot(0, 12.0).has_value());
+    auto transitDelta = jitter.onSnapshot(1, 12.0 + 1.0 / 60.0);
+    ASSERT_TRUE(transitDelta.has_value());
+    EXPECT_NEAR(*transitDelta, 0.0, 1e-9);
+}
@@ -0,0 +1,123 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** ProjectilePredictionTest.cpp - Predicted local shots and their merge into server projectiles
+*/
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include "Prediction/ProjectilePrediction.hpp"
+
+using Prediction::ProjectilePredictor;
+
+namespace {
+    constexpr float TICK = 1.0f / 60.0f;
+}
+
+TEST(ProjectilePredictionTest, ShotFliesAlongItsVelocity) {
+    ProjectilePredictor predictor;
+    predictor.spawn(100.0f, 200.0f, 500.0f, 0.0f);
+
+    for (int i = 0; i < 6; ++i) {
+        predictor.advance(TICK);
+    }
+
+    ASSERT_EQ(predictor.getShots().size(), 1u);
+    EXPECT_NEAR(predictor.getShots()[0].x, 150.0f, 1e-3f);
+    EXPECT_FLOAT_EQ(predictor.getShots()[0].y, 200.0f);
+}
+
+TEST(ProjectilePredictionTest, UnclaimedShotExpires) {
+    ProjectilePredictor predictor;
+    predictor.spawn(100.0f, 200.0f, 500.0f, 0.0f);
+
+    predictor.advance(ProjectilePredictor::MAX_AGE * 0.5f);
+    EXPECT_EQ(predictor.getShots().size(), 1u);
+    predictor.advance(ProjectilePredictor::MAX_AGE * 0.5f);
+    EXPECT_TRUE(predictor.getShots().empty());
+}
+
+TEST(ProjectilePredictionTest, ServerProjectileBehindTheShotIsMerged) {
+    ProjectilePredictor predictor;
+    predictor.spawn(100.0f, 200.0f, 500.0f, 0.0f);
+    predictor.advance(0.1f);  // Predicted shot at x = 150
+
+    // Authoritative projectile spawned a round trip later, at the muzzle
+    ASSERT_TRUE(predictor.claim(42, 100.0f, 201.0f, 500.0f, 0.0f));
+    EXPECT_TRUE(predictor.getShots().empty());
+
+    // Drawn where the predicted shot was, then the correction fades out
+    ProjectilePredictor::Offset offset = predictor.offsetOf(42);
+    EXPECT_NEAR(offset.x, 50.0f, 1e-3f);
+    EXPECT_NEAR(offset.y, -1.0f, 1e-3f);
+
+    predictor.advance(ProjectilePredictor::CORRECTION_TIME * 0.5f);
+    offset = predictor.offsetOf(42);
+    EXPECT_NEAR(offset.x, 25.0f, 1e-3f);
+
+    predictor.advance(ProjectilePredictor::CORRECTION_TIME * 0.5f);
+    EXPECT_FALSE(predictor.hasCorrections());
+    EXPECT_FLOAT_EQ(predictor.offsetOf(42).x, 0.0f);
+}
+
+TEST(ProjectilePredictionTest, ProjectilesOffTheLineOrGoingBackAreNotMerged) {
+    ProjectilePredictor predictor;
+    predictor.spawn(100.0f, 200.0f, 500.0f, 0.0f);
+    const float away = ProjectilePredictor::MATCH_TOLERANCE * 2.0f;
+
+    EXPECT_FALSE(predictor.claim(1, 100.0f, 200.0f + away, 500.0f, 0.0f));
+    EXPECT_FALSE(predictor.claim(2, 100.0f, 200.0f, -500.0f, 0.0f));
+    EXPECT_FALSE(predictor.claim(3, 100.0f + away, 200.0f, 500.0f, 0.0f));
+    EXPECT_FALSE(predictor.claim(4, 100.0f, 200.0f, 500.0f, 130.0f));  // 15 degrees off
+    EXPECT_EQ(predictor.getShots().size(), 1u);
+    EXPECT_FALSE(predictor.hasCorrections());
+}
+
+TEST(ProjectilePredictionTest, OldestShotIsClaimedFirst) {
+    ProjectilePredictor predictor;
+    predictor.spawn(100.0f, 200.0f, 500.0f, 0.0f);
+    predictor.advance(0.1f);
+    predictor.spawn(100.0f, 200.0f, 500.0f, 0.0f);
+
+    ASSERT_TRUE(predictor.claim(7, 100.0f, 200.0f, 500.0f, 0.0f));
+    ASSERT_EQ(predictor.getShots().size(), 1u);
+    EXPECT_FLOAT_EQ(predictor.getShots()[0].x, 100.0f);
+    EXPECT_NEAR(predictor.offsetOf(7).x, 50.0f, 1e-3f);
+}
+
+TEST(ProjectilePredictionTest, MultishotProjectilesAreMatchedByHeading) {
+    // DoubleShot: two projectiles 15 degrees apart leaving the muzzle at the same time
+    const float angle = 7.5f * 3.14159f / 180.0f;
+    const float vx = 500.0f * std::cos(angle);
+    const float vy = 500.0f * std::sin(angle);
+    ProjectilePredictor predictor;
+    predictor.spawn(100.0f, 195.0f, vx, -vy);
+    predictor.spawn(100.0f, 200.0f, vx, vy);
+    predictor.advance(0.1f);
+
+    // The lower projectile is replicated first: it takes the second predicted shot, not the oldest one
+    ASSERT_TRUE(predictor.claim(8, 100.0f + vx * 0.02f, 200.0f + vy * 0.02f, vx, vy));
+    ASSERT_EQ(predictor.getShots().size(), 1u);
+    EXPECT_LT(predictor.getShots()[0].velocityY, 0.0f);
+    EXPECT_NEAR(predictor.offsetOf(8).y, vy * 0.08f, 1e-3f);
+
+    // Right heading, but off the predicted line
+    EXPECT_FALSE(predictor.claim(9, 100.0f, 195.0f + ProjectilePredictor::MATCH_TOLERANCE * 2.0f, vx, -vy));
+    EXPECT_TRUE(predictor.claim(10, 100.0f, 195.0f, vx, -vy));
+}
+
+TEST(ProjectilePredictionTest, ForgetAndClearDropState) {
+    ProjectilePredictor predictor;
+    predictor.spawn(100.0f, 200.0f, 500.0f, 0.0f);
+    predictor.spawn(100.0f, 300.0f, 500.0f, 0.0f);
+    ASSERT_TRUE(predictor.claim(5, 100.0f, 200.0f, 500.0f, 0.0f));
+
+    predictor.forget(5);
+    EXPECT_FALSE(predictor.hasCorrections());
+    EXPECT_EQ(predictor.getShots().size(), 1u);
+
+    predictor.clear();
+    EXPECT_TRUE(predictor.getShots().empty());
+}
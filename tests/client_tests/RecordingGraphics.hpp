@@ -0,0 +1,74 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** RecordingGraphics.hpp - Headless IGraphics that records the textured draws it receives
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+#include "../../client/Graphics/HeadlessGraphics/HeadlessGraphics.hpp"
+
+/**
+ * @brief Headless graphics backend keeping a copy of every sprite run and counting draws by name
+ *
+ * Lets tests check what the renderer submits (texture grouping, order,
+ * rectangles) without a window or a GPU.
+ */
+class RecordingGraphics : public Graphics::HeadlessGraphics {
+   public:
+    /**
+     * @brief One DrawSpriteRun() call
+     */
+    struct Run {
+        Graphics::TextureHandle texture;            ///< Texture of the run
+        std::vector<Graphics::SpriteDraw> sprites;  ///< Sprites in submission order
+    };
+
+    void DrawSpriteRun(Graphics::TextureHandle texture,
+                       std::span<const Graphics::SpriteDraw> sprites) override {
+        HeadlessGraphics::DrawSpriteRun(texture, sprites);
+        runs.push_back(Run{texture, {sprites.begin(), sprites.end()}});
+    }
+
+    void DrawTexture(const char *textureName, int x, int y, unsigned int tint) override {
+        HeadlessGraphics::DrawTexture(textureName, x, y, tint);
+        namedTextureDraws++;
+    }
+
+    void DrawTextureEx(const char *textureName, int srcX, int srcY, int srcW, int srcH, float destX,
+                       float destY, float rotation, float scale, unsigned int tint) override {
+        HeadlessGraphics::DrawTextureEx(textureName, srcX, srcY, srcW, srcH, destX, destY, rotation, scale,
+                                        tint);
+        namedTextureDraws++;
+    }
+
+    void DrawTexturePro(const char *textureName, int srcX, int srcY, int srcW, int srcH, float destX,
+                        float destY, float destW, float destH, unsigned int tint) override {
+        HeadlessGraphics::DrawTexturePro(textureName, srcX, srcY, srcW, srcH, destX, destY, destW, destH,
+                                         tint);
+        namedTextureDraws++;
+    }
+
+    /**
+     * @brief Number of sprites received through sprite runs
+     */
+    size_t spriteCount() const {
+        size_t count = 0;
+        for (const Run &run : runs) {
+            count += run.sprites.size();
+        }
+        return count;
+    }
+
+    void clear() {
+        runs.clear();
+        namedTextureDraws = 0;
+    }
+
+    std::vector<Run> runs;         ///< Sprite runs received, in order
+    size_t namedTextureDraws = 0;  ///< Textures drawn by name (one lookup each)
+};
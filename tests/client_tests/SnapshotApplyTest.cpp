@@ -0,0 +1,111 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SnapshotApplyTest.cpp - Reader-based GameState apply path of the EntityRenderer
+*/
+
+#include <gtest/gtest.h>
+
+#include <vector>
+#include "../../client/Graphics/RaylibGraphics/RaylibGraphics.hpp"
+#include "../../client/Rendering/EntityRenderer.hpp"
+#include "Capnp/Messages/S2C/GameState.hpp"
+#include "../common/AllocationCounter.hpp"
+
+namespace {
+    /**
+     * @brief Serialize a GameState holding the given enemies, shifted by a per-tick offset
+     */
+    std::vector<uint8_t> makeSnapshot(uint32_t tick, const std::vector<uint32_t> &ids) {
+        RType::Messages::S2C::GameState state;
+        state.serverTick = tick;
+        for (uint32_t id : ids) {
+            RType::Messages::S2C::EntityState entity;
+            entity.entityId = id;
+            entity.type = RType::Messages::Shared::EntityType::EnemyType1;
+            entity.position = RType::Messages::Shared::Vec2(1000.0F - tick * 2.0F, id * 4.0F);
+            entity.health = 50;
+            entity.currentAnimation = "enemy_idle_animation";  // Longer than the small string buffer
+            state.entities.push_back(entity);
+        }
+        return state.serialize();
+    }
+
+    std::vector<uint32_t> idRange(uint32_t first, uint32_t last) {
+        std::vector<uint32_t> ids;
+        for (uint32_t id = first; id <= last; ++id) {
+            ids.push_back(id);
+        }
+        return ids;
+    }
+}  // namespace
+
+TEST(SnapshotApplyTest, SteadyStateApplyDoesNotAllocate) {
+    Graphics::RaylibGraphics graphics;
+    EntityRenderer renderer(graphics);
+    std::vector<uint64_t> buffer;
+
+    const std::vector<uint32_t> ids = idRange(1, 200);
+    std::vector<std::vector<uint8_t>> snapshots;
+    for (uint32_t tick = 0; tick < 30; ++tick) {
+        snapshots.push_back(makeSnapshot(tick, ids));
+    }
+
+    auto apply = [&renderer, &buffer](const std::vector<uint8_t> &data) {
+        RType::Messages::S2C::GameState::read(
+            data, buffer, [&renderer](::GameState::Reader state) { renderer.applyGameState(state, 0); });
+    };
+
+    // First snapshot creates the entities and sizes the read buffer
+    apply(snapshots[0]);
+
+    const size_t before = AllocationCounter::count();
+    for (size_t i = 1; i < snapshots.size(); ++i) {
+        apply(snapshots[i]);
+    }
+    const size_t allocations = AllocationCounter::count() - before;
+
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_EQ(renderer.getEntityCount(), ids.size());
+}
+
+TEST(SnapshotApplyTest, EntitiesMissingFromSnapshotAreRemoved) {
+    Graphics::RaylibGraphics graphics;
+    EntityRenderer renderer(graphics);
+    std::vector<uint64_t> buffer;
+    auto apply = [&renderer, &buffer](const std::vector<uint8_t> &data) {
+        RType::Messages::S2C::GameState::read(
+            data, buffer, [&renderer](::GameState::Reader state) { renderer.applyGameState(state, 0); });
+    };
+
+    apply(makeSnapshot(1, idRange(1, 5)));
+    ASSERT_EQ(renderer.getEntityCount(), 5u);
+
+    apply(makeSnapshot(2, idRange(1, 3)));
+    EXPECT_EQ(renderer.getEntityCount(), 3u);
+    EXPECT_FALSE(renderer.hasEntity(4));
+    EXPECT_FALSE(renderer.hasEntity(5));
+
+    // A new entity reuses the slot of a removed one
+    apply(makeSnapshot(3, {1, 2, 3, 6}));
+    EXPECT_EQ(renderer.getEntityCount(), 4u);
+    EXPECT_TRUE(renderer.hasEntity(6));
+}
+
+TEST(SnapshotApplyTest, PredictedEntityIsLeftToTheCaller) {
+    Graphics::RaylibGraphics graphics;
+    EntityRenderer renderer(graphics);
+    std::vector<uint64_t> buffer;
+
+    RType::Messages::S2C::GameState::read(makeSnapshot(1, idRange(1, 3)), buffer,
+                                          [&renderer](::GameState::Reader state) {
+                                              auto predicted = renderer.applyGameState(state, 2);
+                                              ASSERT_TRUE(predicted.has_value());
+                                              EXPECT_EQ(predicted->getEntityId(), 2u);
+                                          });
+
+    EXPECT_TRUE(renderer.hasEntity(1));
+    EXPECT_FALSE(renderer.hasEntity(2));
+    EXPECT_TRUE(renderer.hasEntity(3));
+}
@@ -0,0 +1,196 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SnapshotInterpolationTest.cpp - Hermite sampling and jitter-adaptive clock of the client interpolator
+*/
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include "Rendering/SnapshotInterpolation.hpp"
+
+using Interpolation::Clock;
+using Interpolation::Snapshot;
+using Interpolation::SnapshotRing;
+
+namespace {
+    constexpr double TICK = 1.0 / 60.0;
+
+    /**
+     * @brief Deterministic jitter source (LCG), uniform in [-amplitude, amplitude]
+     */
+    class JitterTrace {
+       public:
+        explicit JitterTrace(double amplitude) : _amplitude(amplitude) {}
+
+        double next() {
+            _state = _state * 1664525u + 1013904223u;
+            return ((_state >> 8) / static_cast<double>(1u << 24) * 2.0 - 1.0) * _amplitude;
+        }
+
+       private:
+        double _amplitude;
+        uint32_t _state = 12345u;
+    };
+
+    /**
+     * @brief Feed a clock snapshots sent every sendTicks, arriving after latency + jitter
+     * @return Fraction of arrivals at which the rendered tick was past the newest snapshot
+     */
+    double replay(Clock &clock, uint32_t sendTicks, double latency, JitterTrace &jitter, int snapshots) {
+        int starved = 0;
+        int measured = 0;
+        for (int i = 0; i < snapshots; ++i) {
+            const uint32_t tick = static_cast<uint32_t>(i) * sendTicks;
+            const double arrival = 100.0 + tick * TICK + latency + jitter.next();
+            clock.onSnapshot(tick, arrival);
+            if (i >= snapshots / 2) {  // Converged half of the trace
+                measured++;
+                // Just before the next snapshot is due: the worst moment for starvation
+                const double beforeNext = 100.0 + (tick + sendTicks) * TICK + latency;
+                if (clock.renderTick(beforeNext) > static_cast<double>(tick)) {
+                    starved++;
+                }
+            }
+        }
+        return static_cast<double>(starved) / measured;
+    }
+}  // namespace
+
+TEST(SnapshotInterpolationTest, HermiteWithReplicatedVelocityKeepsConstantSpeed) {
+    SnapshotRing ring;
+    ring.push(Snapshot{0.0F, 10.0F, 600.0F, 0.0F, 0});  // 600 px/s = 10 px/tick
+    ring.push(Snapshot{30.0F, 10.0F, 600.0F, 0.0F, 3});
+
+    const auto middle = Interpolation::sample(ring, 1.5, TICK, 6.0);
+    EXPECT_NEAR(middle.x, 15.0F, 1e-4F);
+    EXPECT_NEAR(middle.y, 10.0F, 1e-4F);
+    EXPECT_NEAR(Interpolation::sample(ring, 1.0, TICK, 6.0).x, 10.0F, 1e-4F);
+}
+
+TEST(SnapshotInterpolationTest, HermiteFollowsCurvesCloserThanLinear) {
+    // Circle of radius 100 px, one turn per second, sent every 6 ticks (10 Hz)
+    const double omega = 2.0 * std::numbers::pi;
+    auto state = [omega](uint32_t tick) {
+        const double t = tick * TICK;
+        return Snapshot{static_cast<float>(100.0 * std::cos(omega * t)),
+                        static_cast<float>(100.0 * std::sin(omega * t)),
+                        static_cast<float>(-100.0 * omega * std::sin(omega * t)),
+                        static_cast<float>(100.0 * omega * std::cos(omega * t)), tick};
+    };
+    SnapshotRing ring;
+    ring.push(state(0));
+    ring.push(state(6));
+
+    const double midTick = 3.0;
+    const auto hermite = Interpolation::sample(ring, midTick, TICK, 6.0);
+    const float linearX = (ring[0].x + ring[1].x) / 2.0F;
+    const float linearY = (ring[0].y + ring[1].y) / 2.0F;
+    const Snapshot truth = state(3);
+
+    const float hermiteError = std::hypot(hermite.x - truth.x, hermite.y - truth.y);
+    const float linearError = std::hypot(linearX - truth.x, linearY - truth.y);
+    EXPECT_LT(hermiteError, linearError / 10.0F);
+}
+
+TEST(SnapshotInterpolationTest, ZeroVelocityFallsBackToLinear) {
+    SnapshotRing ring;
+    ring.push(Snapshot{0.0F, 0.0F, 0.0F, 0.0F, 10});
+    ring.push(Snapshot{40.0F, -20.0F, 0.0F, 0.0F, 14});
+
+    const auto quarter = Interpolation::sample(ring, 11.0, TICK, 6.0);
+    EXPECT_NEAR(quarter.x, 10.0F, 1e-4F);
+    EXPECT_NEAR(quarter.y, -5.0F, 1e-4F);
+}
+
+TEST(SnapshotInterpolationTest, PicksThePairAroundTheRenderedTick) {
+    SnapshotRing ring;
+    for (uint32_t tick = 0; tick <= 9; tick += 3) {
+        ring.push(Snapshot{static_cast<float>(tick), 0.0F, 0.0F, 0.0F, tick});
+    }
+    for (double tick : {0.5, 2.0, 4.0, 7.5}) {
+        EXPECT_NEAR(Interpolation::sample(ring, tick, TICK, 6.0).x, static_cast<float>(tick), 1e-4F);
+    }
+}
+
+TEST(SnapshotInterpolationTest, ClampsBeforeOldestAndCapsExtrapolation) {
+    SnapshotRing ring;
+    ring.push(Snapshot{5.0F, 0.0F, 60.0F, 0.0F, 10});
+    ring.push(Snapshot{8.0F, 0.0F, 60.0F, 0.0F, 13});
+
+    EXPECT_FLOAT_EQ(Interpolation::sample(ring, 2.0, TICK, 6.0).x, 5.0F);
+    // 60 px/s = 1 px/tick past tick 13, capped at 6 ticks
+    EXPECT_NEAR(Interpolation::sample(ring, 15.0, TICK, 6.0).x, 10.0F, 1e-4F);
+    EXPECT_NEAR(Interpolation::sample(ring, 100.0, TICK, 6.0).x, 14.0F, 1e-4F);
+}
+
+TEST(SnapshotInterpolationTest, RingKeepsTheNewestSnapshots) {
+    SnapshotRing ring;
+    for (uint32_t tick = 0; tick < SnapshotRing::CAPACITY + 2; ++tick) {
+        ring.push(Snapshot{0.0F, 0.0F, 0.0F, 0.0F, tick});
+    }
+    ASSERT_EQ(ring.size(), SnapshotRing::CAPACITY);
+    EXPECT_EQ(ring[0].serverTick, 2u);
+    EXPECT_EQ(ring.back().serverTick, SnapshotRing::CAPACITY + 1);
+}
+
+TEST(SnapshotInterpolationTest, ClockWithoutJitterStaysAtMinimumDelay) {
+    Clock clock;
+    JitterTrace none(0.0);
+    EXPECT_DOUBLE_EQ(replay(clock, 2, 0.03, none, 400), 0.0);
+    EXPECT_NEAR(clock.getDelay(), clock.getConfig().minDelay, 1e-6);
+    EXPECT_NEAR(clock.getJitter(), 0.0, 1e-9);
+    EXPECT_NEAR(clock.getSendInterval(), 2 * TICK, 1e-9);
+}
+
+TEST(SnapshotInterpolationTest, ClockMapsServerTicksToLocalTime) {
+    Clock clock;
+    JitterTrace none(0.0);
+    replay(clock, 3, 0.04, none, 200);
+
+    // Snapshot of tick 600 arrived at 100 + 10 s + 40 ms: shown delay seconds later
+    const double arrival = 100.0 + 600 * TICK + 0.04;
+    EXPECT_NEAR(clock.renderTick(arrival + clock.getDelay()), 600.0, 1e-6);
+}
+
+TEST(SnapshotInterpolationTest, DelayGrowsWithJitterAndCoversLateArrivals) {
+    Clock steady;
+    JitterTrace none(0.0);
+    replay(steady, 3, 0.05, none, 600);
+
+    Clock jittery;
+    JitterTrace jitter(0.03);
+    const double starved = replay(jittery, 3, 0.05, jitter, 600);
+
+    EXPECT_GT(jittery.getJitter(), 0.005);
+    EXPECT_GT(jittery.getDelay(), steady.getDelay() + 0.02);
+    EXPECT_LE(jittery.getDelay(), jittery.getConfig().maxDelay);
+    EXPECT_LT(starved, 0.02);
+}
+
+TEST(SnapshotInterpolationTest, DelayCoversLowerSendRates) {
+    Clock clock;
+    JitterTrace jitter(0.01);
+    const double starved = replay(clock, 6, 0.05, jitter, 600);  // 10 Hz
+
+    EXPECT_NEAR(clock.getSendInterval(), 6 * TICK, 1e-6);
+    EXPECT_GT(clock.getDelay(), 6 * TICK);
+    EXPECT_DOUBLE_EQ(starved, 0.0);
+}
+
+TEST(SnapshotInterpolationTest, OlderTickStartsANewTimeline) {
+    Clock clock;
+    JitterTrace none(0.0);
+    replay(clock, 3, 0.04, none, 100);
+    ASSERT_TRUE(clock.isSynchronized());
+
+    // Room restarted: tick 0 arrives at 500 s
+    clock.onSnapshot(0, 500.0);
+    EXPECT_NEAR(clock.renderTick(500.0 + clock.getDelay()), 0.0, 1e-6);
+
+    clock.reset();
+    EXPECT_FALSE(clock.isSynchronized());
+}
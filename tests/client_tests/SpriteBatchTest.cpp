@@ -0,0 +1,111 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** SpriteBatchTest.cpp - Texture handles and sprite batch submission
+*/
+
+#include <gtest/gtest.h>
+
+#include <vector>
+#include "../../client/Rendering/EntityRenderer.hpp"
+#include "RecordingGraphics.hpp"
+
+namespace {
+    Graphics::SpriteDraw sprite(Graphics::TextureHandle texture, float destX, uint8_t layer = 0) {
+        return Graphics::SpriteDraw{texture, 0.0f, 0.0f, 8.0f, 8.0f, destX, 0.0f, 8.0f, 8.0f,
+                                    0xFFFFFFFF, layer};
+    }
+}  // namespace
+
+TEST(SpriteBatchTest, TextureHandlesAreResolvedOncePerName) {
+    RecordingGraphics graphics;
+
+    const Graphics::TextureHandle ships = graphics.LoadTexture("ships", "ships.png");
+    const Graphics::TextureHandle bullets = graphics.LoadTexture("bullets", "bullets.png");
+
+    EXPECT_NE(ships, Graphics::INVALID_TEXTURE);
+    EXPECT_NE(ships, bullets);
+    EXPECT_EQ(graphics.GetTextureHandle("ships"), ships);
+    EXPECT_EQ(graphics.LoadTexture("ships", "ships_v2.png"), ships);  // Reloading keeps the handle
+    EXPECT_EQ(graphics.GetTextureHandle("missing"), Graphics::INVALID_TEXTURE);
+}
+
+TEST(SpriteBatchTest, BatchIsSortedByTextureKeepingSubmissionOrder) {
+    RecordingGraphics graphics;
+    std::vector<Graphics::SpriteDraw> batch{sprite(1, 0.0f), sprite(0, 1.0f), sprite(1, 2.0f),
+                                            sprite(0, 3.0f), sprite(1, 4.0f)};
+
+    graphics.DrawSpriteBatch(batch);
+
+    ASSERT_EQ(graphics.runs.size(), 2u);
+    EXPECT_EQ(graphics.runs[0].texture, 0);
+    ASSERT_EQ(graphics.runs[0].sprites.size(), 2u);
+    EXPECT_EQ(graphics.runs[0].sprites[0].destX, 1.0f);
+    EXPECT_EQ(graphics.runs[0].sprites[1].destX, 3.0f);
+    EXPECT_EQ(graphics.runs[1].texture, 1);
+    ASSERT_EQ(graphics.runs[1].sprites.size(), 3u);
+    EXPECT_EQ(graphics.runs[1].sprites[0].destX, 0.0f);
+    EXPECT_EQ(graphics.runs[1].sprites[1].destX, 2.0f);
+    EXPECT_EQ(graphics.runs[1].sprites[2].destX, 4.0f);
+}
+
+TEST(SpriteBatchTest, LayersAreDrawnBackToFrontWhateverTheirTexture) {
+    RecordingGraphics graphics;
+    std::vector<Graphics::SpriteDraw> batch{sprite(0, 0.0f, 2), sprite(2, 1.0f, 1), sprite(1, 2.0f, 1),
+                                            sprite(2, 3.0f, 0), sprite(0, 4.0f, 2)};
+
+    graphics.DrawSpriteBatch(batch);
+
+    ASSERT_EQ(graphics.runs.size(), 4u);
+    EXPECT_EQ(graphics.runs[0].texture, 2);  // Layer 0
+    EXPECT_EQ(graphics.runs[0].sprites[0].destX, 3.0f);
+    EXPECT_EQ(graphics.runs[1].texture, 1);  // Layer 1, by texture
+    EXPECT_EQ(graphics.runs[2].texture, 2);
+    EXPECT_EQ(graphics.runs[2].sprites[0].destX, 1.0f);
+    EXPECT_EQ(graphics.runs[3].texture, 0);  // Layer 2, in submission order
+    ASSERT_EQ(graphics.runs[3].sprites.size(), 2u);
+    EXPECT_EQ(graphics.runs[3].sprites[0].destX, 0.0f);
+    EXPECT_EQ(graphics.runs[3].sprites[1].destX, 4.0f);
+}
+
+TEST(SpriteBatchTest, EntityRendererSubmitsEverySpriteInOneBatch) {
+    using RType::Messages::Shared::EntityType;
+    RecordingGraphics graphics;
+    graphics.LoadTexture("PlayerShips.gif", "assets/sprites/PlayerShips.gif");
+    graphics.LoadTexture("Projectiles", "assets/sprites/Projectiles.gif");
+    graphics.LoadTexture("Wall.png", "assets/sprites/Wall.png");
+    graphics.LoadTexture("OrbitalModule", "assets/sprites/Module.gif");
+
+    EntityRenderer renderer(graphics);
+    renderer.setDebugMode(false);
+    uint32_t id = 1;
+    for (int i = 0; i < 2; ++i) {
+        renderer.updateEntity(id++, EntityType::Player, 100.0f, 100.0f * i, 100, "idle", 0, 0, 33, 17);
+    }
+    for (int i = 0; i < 5; ++i) {
+        const EntityType type = (i % 2 == 0) ? EntityType::PlayerBullet : EntityType::EnemyBullet;
+        renderer.updateEntity(id++, type, 10.0f * i, 50.0f, -1, "shot", 267, 84, 17, 13);
+    }
+    renderer.updateEntity(id++, EntityType::OrbitalModule, 300.0f, 300.0f, -1, "spin", 0, 0, 17, 18);
+    for (int i = 0; i < 3; ++i) {
+        renderer.updateEntity(id++, EntityType::EnemyType1, 500.0f, 40.0f * i, 50, "idle", 0, 0, 0, 0);
+    }
+
+    renderer.render();
+
+    // One run per texture, back to front (players on top) whatever the handle order; enemies are plain shapes
+    ASSERT_EQ(graphics.runs.size(), 3u);
+    EXPECT_EQ(graphics.runs[0].texture, graphics.GetTextureHandle("OrbitalModule"));
+    EXPECT_EQ(graphics.runs[0].sprites.size(), 1u);
+    EXPECT_EQ(graphics.runs[1].texture, graphics.GetTextureHandle("Projectiles"));
+    EXPECT_EQ(graphics.runs[1].sprites.size(), 5u);
+    EXPECT_EQ(graphics.runs[2].texture, graphics.GetTextureHandle("PlayerShips.gif"));
+    EXPECT_EQ(graphics.runs[2].sprites.size(), 2u);
+    EXPECT_EQ(graphics.namedTextureDraws, 0u);
+
+    // Sprites keep the entity placement: centered on the entity, scaled 3x
+    const Graphics::SpriteDraw &module = graphics.runs[0].sprites[0];
+    EXPECT_FLOAT_EQ(module.destX + module.destW / 2.0f, 300.0f);
+    EXPECT_FLOAT_EQ(module.destW, 17.0f * 3.0f);
+}
@@ -0,0 +1,150 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** AllocationCounter - Heap allocation count of the test or benchmark process
+*/
+
+#include "AllocationCounter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace {
+    std::atomic<size_t> allocations{0};
+
+    void *allocate(std::size_t size) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return std::malloc(size != 0 ? size : 1);
+    }
+
+    void *allocateAligned(std::size_t size, std::align_val_t alignment) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        const auto align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+        return _aligned_malloc(size != 0 ? size : 1, align);
+#else
+        // aligned_alloc() wants a size that is a multiple of the alignment
+        const std::size_t rounded = (size + align - 1) / align * align;
+        return std::aligned_alloc(align, rounded != 0 ? rounded : align);
+#endif
+    }
+
+    void release(void *memory) noexcept {
+        std::free(memory);
+    }
+
+    void releaseAligned(void *memory) noexcept {
+#ifdef _WIN32
+        _aligned_free(memory);
+#else
+        std::free(memory);
+#endif
+    }
+
+    void *allocateOrThrow(std::size_t size) {
+        if (void *memory = allocate(size)) {
+            return memory;
+        }
+        throw std::bad_alloc();
+    }
+
+    void *allocateAlignedOrThrow(std::size_t size, std::align_val_t alignment) {
+        if (void *memory = allocateAligned(size, alignment)) {
+            return memory;
+        }
+        throw std::bad_alloc();
+    }
+}  // namespace
+
+size_t AllocationCounter::count() {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+// Count every heap allocation made by this process. Every replaceable form is
+// defined so that no allocation reaches the standard library's operator new
+// (which would pair with a delete below that it does not match).
+
+void *operator new(std::size_t size) {
+    return allocateOrThrow(size);
+}
+
+void *operator new[](std::size_t size) {
+    return allocateOrThrow(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    return allocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+    return allocate(size);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    return allocateAlignedOrThrow(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+    return allocateAlignedOrThrow(size, alignment);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return allocateAligned(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return allocateAligned(size, alignment);
+}
+
+void operator delete(void *memory) noexcept {
+    release(memory);
+}
+
+void operator delete[](void *memory) noexcept {
+    release(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+    release(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept {
+    release(memory);
+}
+
+void operator delete(void *memory, const std::nothrow_t &) noexcept {
+    release(memory);
+}
+
+void operator delete[](void *memory, const std::nothrow_t &) noexcept {
+    release(memory);
+}
+
+void operator delete(void *memory, std::align_val_t) noexcept {
+    releaseAligned(memory);
+}
+
+void operator delete[](void *memory, std::align_val_t) noexcept {
+    releaseAligned(memory);
+}
+
+void operator delete(void *memory, std::size_t, std::align_val_t) noexcept {
+    releaseAligned(memory);
+}
+
+void operator delete[](void *memory, std::size_t, std::align_val_t) noexcept {
+    releaseAligned(memory);
+}
+
+void operator delete(void *memory, std::align_val_t, const std::nothrow_t &) noexcept {
+    releaseAligned(memory);
+}
+
+void operator delete[](void *memory, std::align_val_t, const std::nothrow_t &) noexcept {
+    releaseAligned(memory);
+}
@@ -0,0 +1,21 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** AllocationCounter - Heap allocation count of the test or benchmark process
+*/
+
+#pragma once
+
+#include <cstddef>
+
+namespace AllocationCounter {
+    /**
+     * @brief Number of global operator new calls (every form) made by this process so far
+     *
+     * Linking AllocationCounter.cpp into an executable replaces the global
+     * allocation functions for the whole process. Compare two readings around
+     * the code under test; the counter is never reset.
+     */
+    size_t count();
+}  // namespace AllocationCounter
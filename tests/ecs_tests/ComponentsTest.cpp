@@ -6,9 +6,12 @@
 */
 
 #include <gtest/gtest.h>
+#include "../../common/Animation/AnimationDatabase.hpp"
+#include "../../common/ECS/Components/Animation.hpp"
 #include "../../common/ECS/Components/Collider.hpp"
 #include "../../common/ECS/Components/Enemy.hpp"
 #include "../../common/ECS/Components/Health.hpp"
+#include "../../common/ECS/Components/MovementPattern.hpp"
 #include "../../common/ECS/Components/Player.hpp"
 #include "../../common/ECS/Components/Projectile.hpp"
 #include "../../common/ECS/Components/Transform.hpp"
@@ -274,6 +277,84 @@ TEST(ColliderTest, HasUniqueComponentType) {
     EXPECT_EQ(collider.getType(), ecs::getComponentType<ecs::Collider>());
 }
 
+// ========================================
+// Animation / AnimationSet Component Tests
+// ========================================
+TEST(AnimationTest, ClipNamesAreInternedOnce) {
+    ecs::ClipId first = ecs::AnimationClipRegistry::intern("test_clip_a");
+    ecs::ClipId second = ecs::AnimationClipRegistry::intern("test_clip_a");
+    ecs::ClipId other = ecs::AnimationClipRegistry::intern("test_clip_b");
+
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(ecs::AnimationClipRegistry::name(first), "test_clip_a");
+    EXPECT_EQ(ecs::AnimationClipRegistry::find("test_clip_never_interned"), ecs::INVALID_CLIP_ID);
+    EXPECT_TRUE(ecs::AnimationClipRegistry::name(ecs::INVALID_CLIP_ID).empty());
+}
+
+TEST(AnimationTest, ClipNameAndIdStayInSync) {
+    ecs::Animation animation("player_idle", true, true);
+
+    EXPECT_EQ(animation.getCurrentClipName(), "player_idle");
+    EXPECT_EQ(animation.getCurrentClipId(), ecs::AnimationClipRegistry::find("player_idle"));
+
+    animation.setCurrentClipName("player_movement");
+    EXPECT_EQ(animation.getCurrentClipId(), ecs::AnimationClipRegistry::find("player_movement"));
+
+    animation.setCurrentClipId(ecs::AnimationClipRegistry::intern("player_idle"));
+    EXPECT_EQ(animation.getCurrentClipName(), "player_idle");
+}
+
+TEST(AnimationSetTest, FactoriesShareOneAsset) {
+    ecs::AnimationSet first = AnimDB::createPlayerAnimations();
+    ecs::AnimationSet second = AnimDB::createPlayerAnimations();
+
+    ASSERT_NE(first.getData(), nullptr);
+    EXPECT_EQ(first.getData(), second.getData());
+    EXPECT_EQ(first.getTextureKey(), "PlayerShip");
+    EXPECT_NE(first.getData(), AnimDB::createOrbitalModuleAnimations().getData());
+}
+
+TEST(AnimationSetTest, ClipLookupByIdAndName) {
+    ecs::AnimationSet bossBody = AnimDB::createBossBodyAnimations();
+    ecs::ClipId hurt = ecs::AnimationClipRegistry::find("hurt");
+
+    ASSERT_TRUE(bossBody.hasClip(hurt));
+    EXPECT_EQ(bossBody.getClip(hurt), bossBody.getClip("hurt"));
+    EXPECT_EQ(bossBody.getClip(hurt)->id, hurt);
+    EXPECT_EQ(bossBody.getClip(hurt)->nextClipId, ecs::AnimationClipRegistry::find("idle"));
+    EXPECT_FALSE(bossBody.hasClip("player_idle"));
+    EXPECT_FALSE(bossBody.hasClip(ecs::INVALID_CLIP_ID));
+    EXPECT_FALSE(ecs::AnimationSet().hasClip(hurt));
+}
+
+// ========================================
+// MovementPattern Component Tests
+// ========================================
+TEST(MovementPatternTest, FactoriesAndNamesSelectPattern) {
+    ecs::MovementPattern sine = ecs::MovementPattern::sine(120.0f, 40.0f, 0.5f);
+    EXPECT_EQ(sine.getPatternType(), ecs::MovementPatternType::SINE);
+    EXPECT_FLOAT_EQ(sine.getSpeed(), 120.0f);
+    EXPECT_FLOAT_EQ(sine.getAmplitude(), 40.0f);
+    EXPECT_FLOAT_EQ(sine.getFrequency(), 0.5f);
+    EXPECT_FALSE(sine.isStarted());
+
+    ecs::MovementPattern bezier =
+        ecs::MovementPattern::bezier({1.0f, 2.0f}, {3.0f, 4.0f}, {5.0f, 6.0f}, 2.0f);
+    EXPECT_EQ(bezier.getPatternType(), ecs::MovementPatternType::BEZIER);
+    EXPECT_FLOAT_EQ(bezier.getControlPoints()[2].y, 6.0f);
+
+    bezier.advance(0.5f);
+    EXPECT_TRUE(bezier.isStarted());
+    EXPECT_FLOAT_EQ(bezier.getElapsed(), 0.5f);
+    bezier.reset();
+    EXPECT_FLOAT_EQ(bezier.getElapsed(), 0.0f);
+
+    EXPECT_EQ(ecs::MovementPattern::typeFromString("zigzag"), ecs::MovementPatternType::ZIGZAG);
+    EXPECT_EQ(ecs::MovementPattern::typeFromString("homing"), ecs::MovementPatternType::HOMING);
+    EXPECT_FALSE(ecs::MovementPattern::typeFromString("spiral").has_value());
+}
+
 // ========================================
 // Component Type Uniqueness Test
 // ========================================
@@ -7,11 +7,13 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <iostream>
 #include <set>
 #include <vector>
 #include "IComponent.hpp"
 #include "Registry.hpp"
+#include "RegistrySnapshot.hpp"
 
 // Simple test components
 class TestComponentA : public ecs::IComponent {
@@ -341,6 +343,44 @@ TEST(RegistryOptimizationTest, AddressReuseMultiple) {
     ASSERT_EQ(new3, 7);
 }
 
+TEST(RegistryOptimizationTest, DoubleDestroyReleasesAddressOnce) {
+    ecs::Registry reg;
+    ecs::Address addr = reg.newEntity();
+
+    reg.destroyEntity(addr);
+    reg.destroyEntity(addr);
+
+    ecs::Address first = reg.newEntity();
+    ecs::Address second = reg.newEntity();
+    ASSERT_EQ(first, addr);
+    ASSERT_NE(second, addr);
+}
+
+TEST(RegistryOptimizationTest, RecycledNodesStartClean) {
+    ecs::Registry reg;
+    ecs::Address addr = reg.newEntity();
+    reg.setComponent(addr, TestDataComponent(42, "old"));
+    reg.addEntityProp<TestComponentA>(addr);
+    reg.destroyEntity(addr);
+
+    // Same address, recycled signature and component nodes
+    ecs::Address reused = reg.newEntity();
+    ASSERT_EQ(reused, addr);
+    ASSERT_EQ(reg.getSignature(reused).count(), 0);
+    ASSERT_FALSE(reg.hasComponent<TestDataComponent>(reused));
+
+    reg.setComponent(reused, TestDataComponent(7, "new"));
+    ASSERT_EQ(reg.getComponent<TestDataComponent>(reused).value, 7);
+    ASSERT_EQ(reg.getComponent<TestDataComponent>(reused).name, "new");
+
+    // Removed components are recycled as well
+    reg.removeComponent<TestDataComponent>(reused);
+    ecs::Address other = reg.newEntity();
+    reg.setComponent(other, TestDataComponent(3, "other"));
+    ASSERT_FALSE(reg.hasComponent<TestDataComponent>(reused));
+    ASSERT_EQ(reg.getComponent<TestDataComponent>(other).value, 3);
+}
+
 // ===== Tests for view() iteration =====
 
 TEST(RegistryViewTest, ViewWithSingleComponent) {
@@ -434,3 +474,313 @@ TEST(RegistryViewTest, ViewIterationPattern) {
     // Verify modifications (entities 0, 2, 4 have TestComponentA)
     ASSERT_EQ(entities.size(), 3);
 }
+
+class TestOtherDataComponent : public ecs::IComponent {
+   public:
+    int value;
+
+    TestOtherDataComponent() : value(0) {}
+    explicit TestOtherDataComponent(int v) : value(v) {}
+
+    ecs::ComponentType getType() const override { return ecs::getComponentType<TestOtherDataComponent>(); }
+};
+
+TEST(RegistryEachTest, EachVisitsMatchingEntitiesWithReferences) {
+    ecs::Registry reg;
+
+    for (int i = 0; i < 10; i++) {
+        ecs::Address e = reg.newEntity();
+        reg.setComponent(e, TestDataComponent(i, "entity" + std::to_string(i)));
+        if (i % 2 == 0) {
+            reg.setComponent(e, TestOtherDataComponent(100));
+        }
+    }
+
+    int visited = 0;
+    reg.each<TestDataComponent, TestOtherDataComponent>(
+        [&](ecs::Address, TestDataComponent &data, TestOtherDataComponent &other) {
+            data.value += other.value;
+            visited++;
+        });
+
+    ASSERT_EQ(visited, 5);
+    for (auto entity : reg.view<TestDataComponent, TestOtherDataComponent>()) {
+        ASSERT_GE(reg.getComponent<TestDataComponent>(entity).value, 100);
+    }
+}
+
+TEST(RegistryEachTest, EachOptionalTermIsNullWhenAbsent) {
+    ecs::Registry reg;
+
+    ecs::Address withOther = reg.newEntity();
+    reg.setComponent(withOther, TestDataComponent(1, "with"));
+    reg.setComponent(withOther, TestOtherDataComponent(7));
+
+    ecs::Address withoutOther = reg.newEntity();
+    reg.setComponent(withoutOther, TestDataComponent(2, "without"));
+
+    int visited = 0;
+    reg.each<TestDataComponent, ecs::Optional<TestOtherDataComponent>>(
+        [&](ecs::Address address, TestDataComponent &, TestOtherDataComponent *other) {
+            if (address == withOther) {
+                ASSERT_NE(other, nullptr);
+                ASSERT_EQ(other->value, 7);
+            } else {
+                ASSERT_EQ(other, nullptr);
+            }
+            visited++;
+        });
+
+    ASSERT_EQ(visited, 2);
+}
+
+TEST(RegistryEachTest, EachWithUnregisteredComponentVisitsNothing) {
+    ecs::Registry reg;
+
+    ecs::Address e = reg.newEntity();
+    reg.setComponent(e, TestDataComponent(1, "lonely"));
+
+    int visited = 0;
+    reg.each<TestDataComponent, TestComponentC>(
+        [&](ecs::Address, TestDataComponent &, TestComponentC &) { visited++; });
+
+    ASSERT_EQ(visited, 0);
+}
+
+TEST(RegistryEachTest, EachSkipsDestroyedEntities) {
+    ecs::Registry reg;
+
+    ecs::Address e1 = reg.newEntity();
+    ecs::Address e2 = reg.newEntity();
+    reg.setComponent(e1, TestOtherDataComponent(1));
+    reg.setComponent(e2, TestOtherDataComponent(2));
+    reg.destroyEntity(e1);
+
+    std::vector<ecs::Address> visited;
+    reg.each<TestOtherDataComponent>(
+        [&](ecs::Address address, TestOtherDataComponent &) { visited.push_back(address); });
+
+    ASSERT_EQ(visited.size(), 1);
+    ASSERT_EQ(visited[0], e2);
+}
+
+TEST(RegistryEachTest, EachParallelVisitsEveryEntityOnce) {
+    ecs::Registry reg;
+    constexpr int entityCount = 1000;
+
+    for (int i = 0; i < entityCount; i++) {
+        ecs::Address e = reg.newEntity();
+        reg.setComponent(e, TestOtherDataComponent(0));
+    }
+
+    reg.eachParallel<TestOtherDataComponent>(
+        [](ecs::Address, TestOtherDataComponent &other) { other.value++; }, 64);
+
+    int total = 0;
+    reg.each<TestOtherDataComponent>([&](ecs::Address, TestOtherDataComponent &other) {
+        ASSERT_EQ(other.value, 1);
+        total += other.value;
+    });
+    ASSERT_EQ(total, entityCount);
+}
+
+TEST(RegistryEachTest, EachParallelRethrowsCallbackError) {
+    ecs::Registry reg;
+
+    for (int i = 0; i < 10; i++) {
+        ecs::Address e = reg.newEntity();
+        reg.setComponent(e, TestOtherDataComponent(i));
+    }
+
+    ASSERT_THROW(reg.eachParallel<TestOtherDataComponent>(
+                     [](ecs::Address, TestOtherDataComponent &other) {
+                         if (other.value == 5) {
+                             throw std::runtime_error("boom");
+                         }
+                     },
+                     2),
+                 std::runtime_error);
+}
+
+// ===== Tests for snapshot and restore =====
+
+TEST(RegistrySnapshotTest, RestoreUndoesChangesSinceSave) {
+    ecs::Registry reg;
+    ecs::Address kept = reg.newEntity();
+    ecs::Address destroyed = reg.newEntity();
+    reg.setComponent(kept, TestDataComponent(1, "kept"));
+    reg.setComponent(destroyed, TestDataComponent(2, "destroyed"));
+    reg.setComponent(destroyed, TestOtherDataComponent(20));
+
+    ecs::RegistrySnapshot snapshot;
+    reg.saveSnapshot(snapshot);
+    ASSERT_EQ(snapshot.getEntityCount(), 2);
+    ASSERT_EQ(snapshot.getComponentCount(), 3);
+
+    reg.getComponent<TestDataComponent>(kept).name = "changed";
+    reg.setComponent(kept, TestOtherDataComponent(10));
+    reg.destroyEntity(destroyed);
+    ecs::Address created = reg.newEntity();
+    reg.setComponent(created, TestDataComponent(3, "created"));
+
+    reg.restoreSnapshot(snapshot);
+
+    ASSERT_EQ(reg.getComponent<TestDataComponent>(kept).name, "kept");
+    ASSERT_FALSE(reg.hasComponent<TestOtherDataComponent>(kept));
+    ASSERT_EQ(reg.getComponent<TestDataComponent>(destroyed).name, "destroyed");
+    ASSERT_EQ(reg.getComponent<TestOtherDataComponent>(destroyed).value, 20);
+    ASSERT_TRUE(reg.getSignature(destroyed).test(ecs::getComponentType<TestOtherDataComponent>()));
+
+    // The created entity reused the destroyed address: only the saved components remain
+    ASSERT_EQ(created, destroyed);
+    ASSERT_EQ(reg.getEntitiesWithMask(reg.getSignature(kept)).size(), 2);
+}
+
+TEST(RegistrySnapshotTest, RestoreRemovesCreatedEntitiesAndKeepsAddresses) {
+    ecs::Registry reg;
+    ecs::Address first = reg.newEntity();
+    ecs::Address second = reg.newEntity();
+    reg.setComponent(first, TestOtherDataComponent(1));
+    reg.destroyEntity(second);
+
+    ecs::RegistrySnapshot snapshot;
+    reg.saveSnapshot(snapshot);
+
+    ecs::Address reused = reg.newEntity();
+    ecs::Address fresh = reg.newEntity();
+    reg.setComponent(reused, TestOtherDataComponent(2));
+    reg.setComponent(fresh, TestOtherDataComponent(3));
+
+    reg.restoreSnapshot(snapshot);
+
+    int visited = 0;
+    reg.each<TestOtherDataComponent>([&](ecs::Address address, TestOtherDataComponent &other) {
+        ASSERT_EQ(address, first);
+        ASSERT_EQ(other.value, 1);
+        visited++;
+    });
+    ASSERT_EQ(visited, 1);
+    ASSERT_EQ(reg.getSignature(fresh), ecs::Signature());
+
+    // Address generation continues exactly as after the save
+    ASSERT_EQ(reg.newEntity(), reused);
+    ASSERT_EQ(reg.newEntity(), fresh);
+}
+
+TEST(RegistrySnapshotTest, RepeatedRollbackToSameSnapshot) {
+    ecs::Registry reg;
+    std::vector<ecs::Address> entities;
+    for (int i = 0; i < 50; i++) {
+        entities.push_back(reg.newEntity());
+        reg.setComponent(entities.back(), TestOtherDataComponent(i));
+    }
+
+    ecs::RegistrySnapshot snapshot;
+    reg.saveSnapshot(snapshot);
+
+    for (int round = 0; round < 3; round++) {
+        reg.each<TestOtherDataComponent>(
+            [](ecs::Address, TestOtherDataComponent &other) { other.value += 100; });
+        reg.destroyEntity(entities[round]);
+        reg.restoreSnapshot(snapshot);
+
+        int sum = 0;
+        reg.each<TestOtherDataComponent>(
+            [&sum](ecs::Address, TestOtherDataComponent &other) { sum += other.value; });
+        ASSERT_EQ(sum, 49 * 50 / 2);
+    }
+
+    // Saving again into the same snapshot replaces its content
+    reg.destroyEntity(entities[0]);
+    reg.saveSnapshot(snapshot);
+    ASSERT_EQ(snapshot.getEntityCount(), 49);
+    ASSERT_EQ(snapshot.getComponentCount(), 49);
+}
+
+TEST(RegistrySnapshotTest, ComponentsOfTypesWithoutSavedColumnAreRemoved) {
+    ecs::Registry reg;
+    ecs::Address tagged = reg.newEntity();
+    reg.addEntityProp<TestOtherDataComponent>(tagged);  // Signature bit only: nothing to save
+
+    ecs::RegistrySnapshot snapshot;
+    reg.saveSnapshot(snapshot);
+    ASSERT_EQ(snapshot.getComponentCount(), 0);
+
+    reg.setComponent(tagged, TestOtherDataComponent(5));
+    reg.restoreSnapshot(snapshot);
+
+    // The signature is the saved one, the data added since is gone
+    ASSERT_TRUE(reg.hasComponent<TestOtherDataComponent>(tagged));
+    ASSERT_THROW(reg.getComponent<TestOtherDataComponent>(tagged), std::runtime_error);
+}
+
+TEST(RegistrySnapshotTest, RestoreUnsavedSnapshotThrows) {
+    ecs::Registry reg;
+    ecs::RegistrySnapshot snapshot;
+    ASSERT_THROW(reg.restoreSnapshot(snapshot), std::runtime_error);
+}
+
+TEST(RegistryStructureVersionTest, ChangesOnlyWhenComponentsAreAddedOrRemoved) {
+    ecs::Registry reg;
+    EXPECT_EQ(reg.getStructureVersion<TestComponentA>(), 0u);
+
+    auto first = reg.newEntity();
+    auto second = reg.newEntity();
+    reg.setComponent(first, TestComponentA());
+    const uint64_t added = reg.getStructureVersion<TestComponentA>();
+    EXPECT_NE(added, 0u);
+
+    // Assigning an existing component or touching other types keeps the version
+    reg.setComponent(first, TestComponentA());
+    reg.setComponent(second, TestComponentB());
+    reg.removeComponent<TestComponentA>(second);
+    EXPECT_EQ(reg.getStructureVersion<TestComponentA>(), added);
+
+    reg.setComponent(second, TestComponentA());
+    const uint64_t addedAgain = reg.getStructureVersion<TestComponentA>();
+    EXPECT_NE(addedAgain, added);
+
+    reg.removeComponent<TestComponentA>(second);
+    const uint64_t removed = reg.getStructureVersion<TestComponentA>();
+    EXPECT_NE(removed, addedAgain);
+
+    reg.destroyEntity(first);
+    EXPECT_NE(reg.getStructureVersion<TestComponentA>(), removed);
+}
+
+TEST(RegistryOrderedIterationTest, QueriesVisitEntitiesByIncreasingAddress) {
+    ecs::Registry reg;
+    EXPECT_FALSE(reg.isOrderedIteration());
+    reg.setOrderedIteration(true);
+    EXPECT_TRUE(reg.isOrderedIteration());
+
+    // Interleave creations and removals so the hash maps are not in address order
+    std::vector<ecs::Address> entities;
+    for (int i = 0; i < 200; i++) {
+        entities.push_back(reg.newEntity());
+    }
+    for (size_t i = entities.size(); i-- > 0;) {
+        reg.setComponent(entities[i], TestComponentA());
+        if (i % 3 == 0) {
+            reg.setComponent(entities[i], TestComponentB());
+        }
+    }
+    for (size_t i = 0; i < entities.size(); i += 7) {
+        reg.removeComponent<TestComponentA>(entities[i]);
+        reg.setComponent(entities[i], TestComponentA());
+    }
+
+    const std::vector<ecs::Address> viewed = reg.view<TestComponentA>();
+    EXPECT_EQ(viewed.size(), entities.size());
+    EXPECT_TRUE(std::is_sorted(viewed.begin(), viewed.end()));
+
+    const ecs::Signature mask = (1ULL << ecs::getComponentType<TestComponentA>()) |
+                                (1ULL << ecs::getComponentType<TestComponentB>());
+    const std::vector<ecs::Address> masked = reg.getEntitiesWithMask(mask);
+    EXPECT_EQ(masked.size(), 67u);
+    EXPECT_TRUE(std::is_sorted(masked.begin(), masked.end()));
+
+    std::vector<ecs::Address> visited;
+    reg.each<TestComponentA>([&visited](ecs::Address address, TestComponentA &) { visited.push_back(address); });
+    EXPECT_EQ(visited, viewed);
+}
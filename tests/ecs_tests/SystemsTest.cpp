@@ -6,16 +6,33 @@
 */
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
+#include "Components/Collider.hpp"
+#include "Components/Enemy.hpp"
 #include "Components/Health.hpp"
+#include "Components/MapData.hpp"
+#include "Components/MovementPattern.hpp"
 #include "Components/PendingDestroy.hpp"
+#include "Components/Player.hpp"
 #include "Components/Projectile.hpp"
 #include "Components/Transform.hpp"
 #include "Components/Velocity.hpp"
+#include "Components/Wall.hpp"
 #include "Components/Weapon.hpp"
+#include "Prefabs/PrefabFactory.hpp"
 #include "Registry.hpp"
+#include "Systems/AISystem/AISystem.hpp"
 #include "Systems/BoundarySystem/BoundarySystem.hpp"
+#include "Systems/CollisionSystem/CollisionHistory.hpp"
+#include "Systems/CollisionSystem/CollisionSystem.hpp"
+#include "Systems/CollisionSystem/StaticGeometry.hpp"
+#include "Systems/DeterminismSystem/DeterminismSystem.hpp"
+#include "Systems/DeterminismSystem/DeterministicRandom.hpp"
 #include "Systems/HealthSystem/HealthSystem.hpp"
+#include "Systems/MapSystem/MapSystem.hpp"
 #include "Systems/MovementSystem/MovementSystem.hpp"
 #include "Systems/WeaponSystem/WeaponSystem.hpp"
 
@@ -267,6 +284,531 @@ TEST(BoundarySystemTest, AllDirectionsBoundaries) {
     EXPECT_TRUE(registry.hasComponent<ecs::PendingDestroy>(bottom));
 }
 
+TEST(BoundarySystemTest, WallsUseWorldCoordinates) {
+    ecs::Registry registry;
+    ecs::BoundarySystem boundarySystem(800, 600);
+
+    auto map = registry.newEntity();
+    registry.setComponent(map, ecs::MapData("test", 100.0f, "", ""));
+    ecs::MapSystem mapSystem;
+    mapSystem.update(registry, 5.0f);  // Camera at x = 500
+
+    auto visibleWall = registry.newEntity();
+    registry.setComponent(visibleWall, ecs::Transform(900.0f, 300.0f));  // Screen x = 400
+    registry.setComponent(visibleWall, ecs::Wall());
+
+    auto passedWall = registry.newEntity();
+    registry.setComponent(passedWall, ecs::Transform(300.0f, 300.0f));  // Screen x = -200
+    registry.setComponent(passedWall, ecs::Wall());
+
+    auto enemy = registry.newEntity();
+    registry.setComponent(enemy, ecs::Transform(300.0f, 300.0f));  // Not a wall: already screen space
+
+    boundarySystem.update(registry, 0.016f);
+
+    EXPECT_FALSE(registry.hasComponent<ecs::PendingDestroy>(visibleWall));
+    EXPECT_TRUE(registry.hasComponent<ecs::PendingDestroy>(passedWall));
+    EXPECT_FALSE(registry.hasComponent<ecs::PendingDestroy>(enemy));
+}
+
+// ========== MapSystem Tests ==========
+
+TEST(MapSystemTest, ScrollAdvancesOffsetWithoutMovingEntities) {
+    ecs::Registry registry;
+    ecs::MapSystem mapSystem;
+
+    EXPECT_FLOAT_EQ(ecs::MapSystem::getScrollOffset(registry), 0.0f);
+
+    auto map = registry.newEntity();
+    registry.setComponent(map, ecs::MapData("test", 60.0f, "", ""));
+
+    auto wall = registry.newEntity();
+    registry.setComponent(wall, ecs::Transform(400.0f, 300.0f));
+    registry.setComponent(wall, ecs::Wall());
+
+    for (int i = 0; i < 10; i++) {
+        mapSystem.update(registry, 0.1f);
+    }
+
+    EXPECT_NEAR(ecs::MapSystem::getScrollOffset(registry), 60.0f, 0.001f);
+    EXPECT_FLOAT_EQ(registry.getComponent<ecs::Transform>(wall).getPosition().x, 400.0f);
+}
+
+TEST(MapSystemTest, MovingEntitiesDriftWithTheScrollExceptPlayers) {
+    ecs::Registry registry;
+    ecs::MapSystem mapSystem;
+    ecs::MovementSystem moveSystem;
+
+    auto map = registry.newEntity();
+    registry.setComponent(map, ecs::MapData("test", 50.0f, "", ""));
+
+    auto pickup = ecs::PrefabFactory::createHealthPack(registry, 25, 400.0f, 300.0f);
+    auto enemy = registry.newEntity();
+    registry.setComponent(enemy, ecs::Enemy(0, 100));
+    registry.setComponent(enemy, ecs::Transform(800.0f, 200.0f));
+    registry.setComponent(enemy, ecs::Velocity(-1.0f, 0.0f, 100.0f));
+    auto player = registry.newEntity();
+    registry.setComponent(player, ecs::Player(0, 3, 1));
+    registry.setComponent(player, ecs::Transform(100.0f, 100.0f));
+    registry.setComponent(player, ecs::Velocity(0.0f, 0.0f, 200.0f));
+
+    for (int i = 0; i < 10; i++) {
+        moveSystem.update(registry, 0.1f);
+        mapSystem.update(registry, 0.1f);
+    }
+
+    // Same rate as when MapSystem shifted every non-player Transform
+    EXPECT_NEAR(registry.getComponent<ecs::Transform>(pickup).getPosition().x, 350.0f, 0.01f);
+    EXPECT_NEAR(registry.getComponent<ecs::Transform>(enemy).getPosition().x, 650.0f, 0.01f);
+    EXPECT_FLOAT_EQ(registry.getComponent<ecs::Transform>(player).getPosition().x, 100.0f);
+
+    // A completed map stops scrolling
+    registry.getComponent<ecs::MapData>(map).markCompleted();
+    EXPECT_FLOAT_EQ(ecs::MapSystem::getScrollSpeed(registry), 0.0f);
+    moveSystem.update(registry, 0.1f);
+    EXPECT_NEAR(registry.getComponent<ecs::Transform>(pickup).getPosition().x, 350.0f, 0.01f);
+}
+
+// ========== AISystem Tests ==========
+
+namespace {
+    ecs::Address spawnPatternEnemy(ecs::Registry &registry, float x, float y,
+                                   const ecs::MovementPattern &pattern) {
+        auto entity = registry.newEntity();
+        registry.setComponent(entity, ecs::Enemy(0, 100));
+        registry.setComponent(entity, ecs::Transform(x, y));
+        registry.setComponent(entity, ecs::Velocity(-1.0f, 0.0f, 100.0f));
+        registry.setComponent(entity, pattern);
+        return entity;
+    }
+
+    // Server tick order: MovementSystem integrates, AISystem prepares the next velocity
+    void runTicks(ecs::Registry &registry, int ticks, float deltaTime) {
+        ecs::MovementSystem moveSystem;
+        ecs::AISystem aiSystem;
+        for (int i = 0; i < ticks; i++) {
+            moveSystem.update(registry, deltaTime);
+            aiSystem.update(registry, deltaTime);
+        }
+    }
+}  // namespace
+
+TEST(AISystemTest, SinePatternFollowsClosedFormPath) {
+    ecs::Registry registry;
+    auto entity =
+        spawnPatternEnemy(registry, 1000.0f, 300.0f, ecs::MovementPattern::sine(120.0f, 50.0f, 0.5f));
+
+    // Velocity of the first AI tick is applied by the next movement step
+    ecs::AISystem aiSystem;
+    ecs::MovementSystem moveSystem;
+    const float dt = 1.0f / 60.0f;
+    aiSystem.update(registry, dt);
+    for (int i = 0; i < 45; i++) {
+        moveSystem.update(registry, dt);
+        aiSystem.update(registry, dt);
+    }
+
+    const float time = 45 * dt;
+    auto pos = registry.getComponent<ecs::Transform>(entity).getPosition();
+    EXPECT_NEAR(pos.x, 1000.0f - 120.0f * time, 0.05f);
+    EXPECT_NEAR(pos.y, 300.0f + 50.0f * std::sin(6.28318530718f * 0.5f * time), 0.05f);
+}
+
+TEST(AISystemTest, ZigZagStaysWithinAmplitude) {
+    ecs::Registry registry;
+    auto entity =
+        spawnPatternEnemy(registry, 1000.0f, 300.0f, ecs::MovementPattern::zigZag(100.0f, 40.0f, 1.0f));
+
+    ecs::AISystem aiSystem;
+    ecs::MovementSystem moveSystem;
+    aiSystem.update(registry, 0.01f);
+    float highest = 300.0f;
+    float lowest = 300.0f;
+    for (int i = 0; i < 200; i++) {
+        moveSystem.update(registry, 0.01f);
+        aiSystem.update(registry, 0.01f);
+        float y = registry.getComponent<ecs::Transform>(entity).getPosition().y;
+        highest = std::max(highest, y);
+        lowest = std::min(lowest, y);
+    }
+
+    EXPECT_NEAR(highest, 340.0f, 0.1f);
+    EXPECT_NEAR(lowest, 260.0f, 0.1f);
+    EXPECT_NEAR(registry.getComponent<ecs::Transform>(entity).getPosition().x, 800.0f, 0.1f);
+}
+
+TEST(AISystemTest, BezierReachesEndPointThenKeepsTangent) {
+    ecs::Registry registry;
+    auto entity = spawnPatternEnemy(
+        registry, 1000.0f, 300.0f,
+        ecs::MovementPattern::bezier({-100.0f, 200.0f}, {-300.0f, 200.0f}, {-400.0f, 0.0f}, 1.0f));
+
+    ecs::AISystem aiSystem;
+    ecs::MovementSystem moveSystem;
+    aiSystem.update(registry, 0.05f);
+    for (int i = 0; i < 20; i++) {
+        moveSystem.update(registry, 0.05f);
+        aiSystem.update(registry, 0.05f);
+    }
+
+    auto pos = registry.getComponent<ecs::Transform>(entity).getPosition();
+    EXPECT_NEAR(pos.x, 600.0f, 0.05f);
+    EXPECT_NEAR(pos.y, 300.0f, 0.05f);
+
+    // End tangent is 3 * (P3 - P2) / duration = (-300, -600) per second
+    auto velocity = registry.getComponent<ecs::Velocity>(entity);
+    EXPECT_NEAR(velocity.getDirection().x * velocity.getSpeed(), -300.0f, 0.5f);
+    EXPECT_NEAR(velocity.getDirection().y * velocity.getSpeed(), -600.0f, 0.5f);
+}
+
+TEST(AISystemTest, HomingTurnsTowardNearestPlayerAtBoundedRate) {
+    ecs::Registry registry;
+    auto closest = registry.newEntity();
+    registry.setComponent(closest, ecs::Player(0, 3, 1));
+    registry.setComponent(closest, ecs::Transform(500.0f, 500.0f));
+    auto farthest = registry.newEntity();
+    registry.setComponent(farthest, ecs::Player(0, 3, 2));
+    registry.setComponent(farthest, ecs::Transform(500.0f, -2000.0f));
+
+    // Enemy heads left; nearest player is straight down (90 degrees away)
+    auto entity = spawnPatternEnemy(registry, 500.0f, 0.0f, ecs::MovementPattern::homing(200.0f, 1.0f));
+    ecs::AISystem aiSystem;
+
+    aiSystem.update(registry, 0.5f);
+    auto velocity = registry.getComponent<ecs::Velocity>(entity);
+    EXPECT_FLOAT_EQ(velocity.getSpeed(), 200.0f);
+    EXPECT_NEAR(velocity.getDirection().x, -std::cos(0.5f), 1e-4f);
+    EXPECT_NEAR(velocity.getDirection().y, std::sin(0.5f), 1e-4f);
+
+    aiSystem.update(registry, 2.0f);
+    velocity = registry.getComponent<ecs::Velocity>(entity);
+    EXPECT_NEAR(velocity.getDirection().x, 0.0f, 1e-4f);
+    EXPECT_NEAR(velocity.getDirection().y, 1.0f, 1e-4f);
+}
+
+TEST(AISystemTest, EnemiesWithoutPatternKeepVelocityAndFire) {
+    ecs::Registry registry;
+    auto entity = registry.newEntity();
+    registry.setComponent(entity, ecs::Enemy(0, 100));
+    registry.setComponent(entity, ecs::Transform(1000.0f, 300.0f));
+    registry.setComponent(entity, ecs::Velocity(-1.0f, 0.0f, 150.0f));
+    registry.setComponent(entity, ecs::Weapon(0.33f, 2.0f, 1, 15));
+
+    runTicks(registry, 10, 0.1f);
+
+    auto velocity = registry.getComponent<ecs::Velocity>(entity);
+    EXPECT_FLOAT_EQ(velocity.getDirection().x, -1.0f);
+    EXPECT_FLOAT_EQ(velocity.getSpeed(), 150.0f);
+    EXPECT_TRUE(registry.getComponent<ecs::Weapon>(entity).shouldShoot());
+}
+
+TEST(AISystemTest, ZeroPatternSpeedUsesBaseSpeed) {
+    ecs::Registry registry;
+    auto entity = spawnPatternEnemy(registry, 1000.0f, 300.0f, ecs::MovementPattern::linear());
+
+    runTicks(registry, 10, 0.1f);
+
+    // Spawn velocity and pattern velocity agree: 10 steps at the 100 units/s base speed
+    EXPECT_NEAR(registry.getComponent<ecs::Transform>(entity).getPosition().x, 900.0f, 0.01f);
+}
+
+// ========== CollisionSystem Tests ==========
+
+TEST(StaticGeometryTest, QueryReturnsOnlyOverlappingBoxes) {
+    ecs::StaticGeometry geometry;
+    geometry.add({1, 500.0f, 0.0f, 600.0f, 100.0f, 16, 0xFFFFFFFF});
+    geometry.add({2, 0.0f, 0.0f, 400.0f, 100.0f, 16, 0xFFFFFFFF});  // Wide box starting far left
+    geometry.add({3, 1000.0f, 0.0f, 1050.0f, 100.0f, 16, 0xFFFFFFFF});
+    geometry.build();
+
+    std::vector<const ecs::StaticGeometry::Box *> hits;
+    geometry.query(350.0f, 10.0f, 360.0f, 20.0f, hits);
+    ASSERT_EQ(hits.size(), 1u);
+    EXPECT_EQ(hits[0]->wall, 2u);
+
+    geometry.query(390.0f, 10.0f, 520.0f, 20.0f, hits);
+    EXPECT_EQ(hits.size(), 2u);
+
+    geometry.query(700.0f, 10.0f, 900.0f, 20.0f, hits);
+    EXPECT_TRUE(hits.empty());
+
+    geometry.query(1010.0f, 200.0f, 1020.0f, 210.0f, hits);  // Below every box
+    EXPECT_TRUE(hits.empty());
+}
+
+namespace {
+    ecs::Address spawnWall(ecs::Registry &registry, float x, float y, bool destructible = false) {
+        auto wall = registry.newEntity();
+        registry.setComponent(wall, ecs::Transform(x, y));
+        registry.setComponent(wall, ecs::Wall(destructible));
+        registry.setComponent(wall, ecs::Collider(100.0f, 100.0f, 0.0f, 0.0f, 16, 0xFFFFFFFF, false));
+        if (destructible) {
+            registry.setComponent(wall, ecs::Health(50, 50));
+        }
+        return wall;
+    }
+
+    ecs::Address spawnPlayerShot(ecs::Registry &registry, float x, float y, ecs::Address owner = 0) {
+        auto shot = registry.newEntity();
+        registry.setComponent(shot, ecs::Transform(x, y));
+        registry.setComponent(shot, ecs::Projectile(20.0f, 5.0f, owner, true));
+        registry.setComponent(shot, ecs::Collider(10.0f, 10.0f, 0.0f, 0.0f, 4, 0xFFFFFFFF, false));
+        return shot;
+    }
+}  // namespace
+
+TEST(CollisionSystemTest, PlayerTouchingWallInWorldSpaceDies) {
+    ecs::Registry registry;
+    ecs::CollisionSystem collisionSystem;
+
+    auto map = registry.newEntity();
+    registry.setComponent(map, ecs::MapData("test", 100.0f, "", ""));
+    ecs::MapSystem mapSystem;
+    mapSystem.update(registry, 2.0f);  // Camera at x = 200
+
+    spawnWall(registry, 600.0f, 300.0f);  // Screen x = 400
+
+    auto player = registry.newEntity();
+    registry.setComponent(player, ecs::Player(0, 3, 1));
+    registry.setComponent(player, ecs::Transform(100.0f, 300.0f));
+    registry.setComponent(player, ecs::Health(100, 100));
+    registry.setComponent(player, ecs::Collider(50.0f, 50.0f, 0.0f, 0.0f, 1, 0xFFFFFFFF, false));
+
+    collisionSystem.update(registry, 0.016f);
+    EXPECT_EQ(registry.getComponent<ecs::Health>(player).getCurrentHealth(), 100);
+
+    registry.getComponent<ecs::Transform>(player).setPosition(400.0f, 300.0f);
+    collisionSystem.update(registry, 0.016f);
+    EXPECT_EQ(registry.getComponent<ecs::Health>(player).getCurrentHealth(), 0);
+}
+
+TEST(CollisionSystemTest, ProjectileStopsOnWallAndDamagesDestructibleWall) {
+    ecs::Registry registry;
+    ecs::CollisionSystem collisionSystem;
+
+    auto solid = spawnWall(registry, 200.0f, 100.0f);
+    auto breakable = spawnWall(registry, 200.0f, 400.0f, true);
+    auto shotOnSolid = spawnPlayerShot(registry, 160.0f, 100.0f);
+    auto shotOnBreakable = spawnPlayerShot(registry, 160.0f, 400.0f);
+    auto missedShot = spawnPlayerShot(registry, 500.0f, 250.0f);
+
+    collisionSystem.update(registry, 0.016f);
+
+    EXPECT_FALSE(registry.hasComponent<ecs::Transform>(shotOnSolid));
+    EXPECT_FALSE(registry.hasComponent<ecs::Transform>(shotOnBreakable));
+    EXPECT_TRUE(registry.hasComponent<ecs::Transform>(missedShot));
+    EXPECT_FALSE(registry.hasComponent<ecs::Health>(solid));
+    EXPECT_EQ(registry.getComponent<ecs::Health>(breakable).getCurrentHealth(), 30);
+}
+
+TEST(CollisionSystemTest, WallIndexFollowsAddedAndRemovedWalls) {
+    ecs::Registry registry;
+    ecs::CollisionSystem collisionSystem;
+
+    auto wall = spawnWall(registry, 200.0f, 100.0f);
+    collisionSystem.update(registry, 0.016f);
+
+    registry.destroyEntity(wall);
+    auto shot = spawnPlayerShot(registry, 200.0f, 100.0f);
+    collisionSystem.update(registry, 0.016f);
+    EXPECT_TRUE(registry.hasComponent<ecs::Transform>(shot));
+
+    spawnWall(registry, 200.0f, 100.0f);
+    collisionSystem.update(registry, 0.016f);
+    EXPECT_FALSE(registry.hasComponent<ecs::Transform>(shot));
+}
+
+TEST(CollisionSystemTest, WallIndexIsNotRebuiltWhileWallsAreUnchanged) {
+    ecs::Registry registry;
+    ecs::CollisionSystem collisionSystem;
+
+    auto wall = spawnWall(registry, 200.0f, 100.0f);
+    collisionSystem.update(registry, 0.016f);
+
+    // Walls are not walked again: a moved wall is only seen once the index is invalidated
+    registry.getComponent<ecs::Transform>(wall).setPosition(600.0f, 100.0f);
+    auto shot = spawnPlayerShot(registry, 600.0f, 100.0f);
+    collisionSystem.update(registry, 0.016f);
+    EXPECT_TRUE(registry.hasComponent<ecs::Transform>(shot));
+
+    collisionSystem.invalidateStaticGeometry();
+    collisionSystem.update(registry, 0.016f);
+    EXPECT_FALSE(registry.hasComponent<ecs::Transform>(shot));
+}
+
+TEST(CollisionHistoryTest, WindowBoundsRecordedTicks) {
+    ecs::CollisionHistory history(4);
+
+    for (uint64_t tick = 1; tick <= 10; tick++) {
+        auto &frame = history.beginFrame(tick);
+        frame.records.push_back({tick % 2 == 0 ? 7u : 9u, 0.0f, 0.0f, 1.0f, 1.0f, 2, 0xFFFFFFFF});
+        frame.records.push_back({3, 0.0f, 0.0f, 1.0f, 1.0f, 2, 0xFFFFFFFF});
+        history.endFrame();
+    }
+
+    EXPECT_EQ(history.size(), 4u);
+    EXPECT_EQ(history.find(6), nullptr);
+    EXPECT_EQ(history.find(11), nullptr);
+    ASSERT_NE(history.find(7), nullptr);
+    EXPECT_EQ(history.find(7)->tick, 7u);
+    EXPECT_NE(ecs::CollisionHistory::find(*history.find(7), 9), nullptr);
+    EXPECT_EQ(ecs::CollisionHistory::find(*history.find(7), 7), nullptr);
+
+    EXPECT_TRUE(history.isContinuous(3, 7));
+    EXPECT_TRUE(history.isContinuous(7, 10));
+    EXPECT_FALSE(history.isContinuous(7, 8));  // Missing at tick 9
+}
+
+TEST(CollisionSystemTest, LagCompensatedShotHitsEnemyWhereShooterSawIt) {
+    ecs::Registry registry;
+    ecs::CollisionSystem collisionSystem;
+
+    auto shooter = registry.newEntity();
+    registry.setComponent(shooter, ecs::Player(0, 3, 1));
+
+    auto enemy = registry.newEntity();
+    registry.setComponent(enemy, ecs::Enemy(0, 100));
+    registry.setComponent(enemy, ecs::Health(100, 100));
+    registry.setComponent(enemy, ecs::Transform(400.0f, 300.0f));
+    registry.setComponent(enemy, ecs::Collider(40.0f, 40.0f, 0.0f, 0.0f, 2, 0xFFFFFFFF, false));
+
+    // The enemy moves 50 units down per tick: at tick t it is at y = 250 + 50 * t
+    auto step = [&](int tick) {
+        registry.getComponent<ecs::Transform>(enemy).setPosition(400.0f, 250.0f + 50.0f * tick);
+        collisionSystem.update(registry, 0.016f);
+    };
+    for (int tick = 1; tick <= 10; tick++) {
+        step(tick);
+    }
+
+    // Without a view delay the shot is tested against the present only
+    auto shot = spawnPlayerShot(registry, 400.0f, 650.0f, shooter);  // Enemy position at tick 8
+    step(11);
+    EXPECT_TRUE(registry.hasComponent<ecs::Transform>(shot));
+    EXPECT_EQ(registry.getComponent<ecs::Health>(enemy).getCurrentHealth(), 100);
+    registry.destroyEntity(shot);
+
+    // The shooter sees the world 3 ticks late: tick 12 is resolved against tick 9
+    registry.getComponent<ecs::Player>(shooter).setViewDelayTicks(3);
+    shot = spawnPlayerShot(registry, 400.0f, 700.0f, shooter);
+    step(12);
+    EXPECT_FALSE(registry.hasComponent<ecs::Transform>(shot));
+    EXPECT_EQ(registry.getComponent<ecs::Health>(enemy).getCurrentHealth(), 80);
+
+    // Rewinding also means the present box no longer counts for that shooter
+    shot = spawnPlayerShot(registry, 400.0f, 900.0f, shooter);  // Enemy position at tick 13
+    step(13);
+    EXPECT_TRUE(registry.hasComponent<ecs::Transform>(shot));
+}
+
+// ========== DeterminismSystem Tests ==========
+
+namespace {
+    /**
+     * @brief Small room: a moving player and a wave of enemies, stepped with a determinism pass.
+     * @return std::vector<uint64_t> World hash after every tick
+     */
+    std::vector<uint64_t> runDeterministicRoom(int ticks) {
+        ecs::Registry registry;
+        ecs::MovementSystem movementSystem;
+        ecs::DeterminismSystem determinismSystem;
+
+        auto player = registry.newEntity();
+        registry.setComponent(player, ecs::Transform(50.0f, 300.0f));
+        registry.setComponent(player, ecs::Velocity(0.7071f, 0.7071f, 150.0f));
+        registry.setComponent(player, ecs::Player(0, 3, 1));
+        for (int i = 0; i < 8; i++) {
+            auto enemy = registry.newEntity();
+            registry.setComponent(enemy, ecs::Transform(800.0f + i * 33.3f, 100.0f + i * 57.1f));
+            registry.setComponent(enemy, ecs::Velocity(-1.0f, 0.1f * i, 93.7f));
+            registry.setComponent(enemy, ecs::Health(40, 40));
+        }
+
+        std::vector<uint64_t> hashes;
+        for (int tick = 0; tick < ticks; tick++) {
+            movementSystem.update(registry, 1.0f / 60.0f);
+            determinismSystem.update(registry, 1.0f / 60.0f);
+            hashes.push_back(determinismSystem.getWorldHash());
+        }
+        return hashes;
+    }
+}  // namespace
+
+TEST(DeterminismSystemTest, SnapsStateToFixedPointGrid) {
+    ecs::Registry registry;
+    ecs::DeterminismSystem determinismSystem;
+
+    auto entity = registry.newEntity();
+    registry.setComponent(entity, ecs::Transform(1.0f / 3.0f, 100.123456f));
+    registry.setComponent(entity, ecs::Velocity(0.1f, -0.3f, 123.456789f));
+
+    determinismSystem.update(registry, 0.016f);
+
+    const auto position = registry.getComponent<ecs::Transform>(entity).getPosition();
+    const auto &velocity = registry.getComponent<ecs::Velocity>(entity);
+    for (float value : {position.x, position.y, velocity.getDirection().x, velocity.getDirection().y,
+                        velocity.getSpeed()}) {
+        const double scaled = static_cast<double>(value) * ecs::DeterminismSystem::FIXED_SCALE;
+        EXPECT_EQ(scaled, std::round(scaled));
+        EXPECT_EQ(ecs::DeterminismSystem::quantize(value), value);
+    }
+    EXPECT_NEAR(position.x, 1.0f / 3.0f, 1.0f / 65536.0f);
+    EXPECT_EQ(determinismSystem.getTick(), 1u);
+}
+
+TEST(DeterminismSystemTest, IdenticalRunsProduceIdenticalHashes) {
+    const auto first = runDeterministicRoom(300);
+    const auto second = runDeterministicRoom(300);
+
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first.front(), first.back());  // The hash follows the simulation
+}
+
+TEST(DeterminismSystemTest, HashDependsOnStateNotStorageOrder) {
+    ecs::Registry registry;
+
+    auto first = registry.newEntity();
+    registry.setComponent(first, ecs::Transform(10.0f, 20.0f));
+    registry.setComponent(first, ecs::Health(100, 100));
+    auto second = registry.newEntity();
+    registry.setComponent(second, ecs::Transform(30.0f, 40.0f));
+    registry.setComponent(second, ecs::Health(100, 100));
+
+    const uint64_t hash = ecs::DeterminismSystem::computeWorldHash(registry);
+
+    // Re-inserting a component changes its storage position, not the world
+    registry.removeComponent<ecs::Health>(first);
+    registry.setComponent(first, ecs::Health(100, 100));
+    EXPECT_EQ(ecs::DeterminismSystem::computeWorldHash(registry), hash);
+
+    registry.getComponent<ecs::Health>(second).setCurrentHealth(99);
+    EXPECT_NE(ecs::DeterminismSystem::computeWorldHash(registry), hash);
+
+    registry.getComponent<ecs::Health>(second).setCurrentHealth(100);
+    registry.getComponent<ecs::Transform>(first).setPosition(10.0f + 1.0f / 65536.0f, 20.0f);
+    EXPECT_NE(ecs::DeterminismSystem::computeWorldHash(registry), hash);
+}
+
+TEST(DeterminismSystemTest, SeededRandomIsReproducible) {
+    ecs::DeterministicRandom first(42);
+    ecs::DeterministicRandom second(42);
+
+    for (int i = 0; i < 1000; i++) {
+        const int64_t value = first.nextInt(1, 100);
+        EXPECT_EQ(value, second.nextInt(1, 100));
+        EXPECT_GE(value, 1);
+        EXPECT_LE(value, 100);
+
+        const float real = first.nextFloat(-1.0f, 1.0f);
+        EXPECT_EQ(real, second.nextFloat(-1.0f, 1.0f));
+        EXPECT_GE(real, -1.0f);
+        EXPECT_LT(real, 1.0f);
+    }
+
+    second.seed(7);
+    EXPECT_NE(first.next(), second.next());
+}
+
 // ========== Integration Tests ==========
 
 TEST(SystemsIntegrationTest, MovementAndBoundary) {
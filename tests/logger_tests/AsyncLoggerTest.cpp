@@ -0,0 +1,204 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** AsyncLoggerTest.cpp - Ordering, overflow, drop accounting and shutdown of the asynchronous backend
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/Logger/Logger.hpp"
+
+namespace {
+    std::vector<std::string> readLines(const std::filesystem::path &path) {
+        std::vector<std::string> lines;
+        std::ifstream file(path);
+        for (std::string line; std::getline(file, line);) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    size_t countContaining(const std::vector<std::string> &lines, const std::string &pattern) {
+        size_t count = 0;
+        for (const std::string &line : lines) {
+            count += line.find(pattern) != std::string::npos ? 1 : 0;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Sum of the "[logger] N message(s) dropped" notices
+     */
+    size_t droppedReported(const std::vector<std::string> &lines) {
+        const std::string notice = "[logger] ";
+        size_t dropped = 0;
+        for (const std::string &line : lines) {
+            if (line.rfind(notice, 0) == 0) {
+                dropped += std::stoul(line.substr(notice.size()));
+            }
+        }
+        return dropped;
+    }
+}  // namespace
+
+class AsyncLoggerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        _path = std::filesystem::temp_directory_path() / "rtype_async_logger_test.log";
+        std::filesystem::remove(_path);
+        logger::Logger::setLevel(logger::Level::INFO);
+    }
+
+    void TearDown() override {
+        logger::Logger::stopAsync();
+        std::filesystem::remove(_path);
+    }
+
+    void start(size_t ringCapacity = 1024) {
+        logger::AsyncOptions options;
+        options.console = false;
+        options.filePath = _path.string();
+        options.ringCapacity = ringCapacity;
+        logger::Logger::startAsync(options);
+    }
+
+    std::filesystem::path _path;
+};
+
+TEST_F(AsyncLoggerTest, RecordsOfEachThreadKeepTheirOrder) {
+    constexpr int PER_THREAD = 2000;
+    start(4096);  // Room for every record: nothing is dropped even if the writer falls behind
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; ++t) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < PER_THREAD; ++i) {
+                LOG_INFO("thread ", t, " seq ", i);
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    logger::Logger::stopAsync();
+
+    const std::vector<std::string> lines = readLines(_path);
+    for (int t = 0; t < 3; ++t) {
+        const std::string tag = "thread " + std::to_string(t) + " seq ";
+        int expected = 0;
+        for (const std::string &line : lines) {
+            const size_t pos = line.find(tag);
+            if (pos != std::string::npos) {
+                EXPECT_EQ(std::stoi(line.substr(pos + tag.size())), expected);
+                expected++;
+            }
+        }
+        EXPECT_EQ(expected, PER_THREAD);
+    }
+    EXPECT_EQ(droppedReported(lines), 0u);
+}
+
+TEST_F(AsyncLoggerTest, MessagesLargerThanARecordAreWrittenWhole) {
+    start();
+    const std::string big(3 * logger::detail::LogRecord::PAYLOAD_SIZE, 'x');
+    LOG_INFO("big ", big, " end");
+    LOG_INFO("small ", 42, ' ', 1.5);
+    logger::Logger::stopAsync();
+
+    const std::vector<std::string> lines = readLines(_path);
+    EXPECT_EQ(countContaining(lines, "big " + big + " end"), 1u);
+    EXPECT_EQ(countContaining(lines, "small 42 1.5"), 1u);
+}
+
+TEST_F(AsyncLoggerTest, FlushWritesEverythingLoggedBefore) {
+    start();
+    for (int i = 0; i < 100; ++i) {
+        LOG_INFO("flushed ", i);
+    }
+    logger::Logger::flush();
+
+    EXPECT_EQ(countContaining(readLines(_path), "flushed "), 100u);
+}
+
+TEST_F(AsyncLoggerTest, DroppedRecordsAreCountedAndReported) {
+    start(2);
+    constexpr size_t TOTAL = 20000;
+    // Rings are per thread: a new thread gets one with the capacity above
+    std::thread([]() {
+        for (size_t i = 0; i < TOTAL; ++i) {
+            LOG_INFO("entry ", i);
+        }
+    }).join();
+    logger::Logger::stopAsync();
+
+    const std::vector<std::string> lines = readLines(_path);
+    const size_t written = countContaining(lines, "entry ");
+    EXPECT_EQ(written + droppedReported(lines), TOTAL);
+}
+
+TEST_F(AsyncLoggerTest, ErrorsAreNeverDropped) {
+    start(2);
+    constexpr size_t TOTAL = 20000;
+    std::thread([]() {
+        for (size_t i = 0; i < TOTAL; ++i) {
+            LOG_ERROR("failure ", i);
+        }
+    }).join();
+    logger::Logger::stopAsync();
+
+    const std::vector<std::string> lines = readLines(_path);
+    EXPECT_EQ(countContaining(lines, "failure "), TOTAL);
+    EXPECT_EQ(droppedReported(lines), 0u);
+}
+
+TEST_F(AsyncLoggerTest, StopLosesNothingLoggedConcurrently) {
+    start();
+    constexpr size_t PER_THREAD = 20000;
+    std::atomic<int> started{0};
+
+    testing::internal::CaptureStdout();  // Records logged after stop() go to the console
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&started]() {
+            started++;
+            for (size_t i = 0; i < PER_THREAD; ++i) {
+                LOG_ERROR("racing ", i);
+            }
+        });
+    }
+    while (started.load() < 4) {
+        std::this_thread::yield();
+    }
+    logger::Logger::stopAsync();
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    std::istringstream console(testing::internal::GetCapturedStdout());
+
+    std::vector<std::string> consoleLines;
+    for (std::string line; std::getline(console, line);) {
+        consoleLines.push_back(line);
+    }
+    EXPECT_EQ(countContaining(readLines(_path), "racing ") + countContaining(consoleLines, "racing "),
+              4 * PER_THREAD);
+}
+
+TEST_F(AsyncLoggerTest, RestartUsesTheNewOptions) {
+    start();
+    LOG_INFO("first run");
+    logger::Logger::stopAsync();
+    start(8);
+    LOG_INFO("second run");
+    logger::Logger::stopAsync();
+
+    const std::vector<std::string> lines = readLines(_path);
+    EXPECT_EQ(countContaining(lines, "first run"), 1u);
+    EXPECT_EQ(countContaining(lines, "second run"), 1u);
+}
@@ -6,6 +6,7 @@
 */
 
 #include <gtest/gtest.h>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include "common/ECS/Components/Health.hpp"
@@ -14,6 +15,7 @@
 #include "common/ECS/Components/Velocity.hpp"
 #include "common/ECSWrapper/ECSWorld.hpp"
 #include "server/Scripting/LuaEngine.hpp"
+#include "server/Scripting/ScriptChunkCache.hpp"
 
 class LuaEngineTest : public ::testing::Test {
    protected:
@@ -387,3 +389,156 @@ TEST_F(LuaEngineTest, AccessNonExistentComponentSafe) {
     bool hasComponent = lua["hasComponent"];
     EXPECT_FALSE(hasComponent);
 }
+
+// ========== Compiled Chunk Cache Tests ==========
+
+TEST_F(LuaEngineTest, CompiledChunkSharedBetweenEngines) {
+    createTestScript("shared_chunk.lua", R"(
+        sharedValue = 41
+        function onUpdate(entity, deltaTime)
+            sharedValue = sharedValue + 1
+        end
+    )");
+
+    auto &cache = scripting::ScriptChunkCache::instance();
+    const auto compilationsBefore = cache.getCompilations();
+
+    ASSERT_TRUE(luaEngine->loadScript("shared_chunk.lua"));
+
+    // A second room's engine reuses the chunk compiled for the first one
+    ecs::wrapper::ECSWorld otherWorld;
+    scripting::LuaEngine otherEngine("./test_scripts/");
+    otherEngine.setWorld(&otherWorld);
+    ASSERT_TRUE(otherEngine.loadScript("shared_chunk.lua"));
+    EXPECT_EQ(cache.getCompilations(), compilationsBefore + 1);
+
+    // Each VM still runs its own copy of the script state
+    auto entity = otherWorld.createEntity();
+    otherEngine.executeUpdate("shared_chunk.lua", entity, 0.016f);
+    EXPECT_EQ(otherEngine.getLuaState()["sharedValue"].get<int>(), 42);
+    EXPECT_EQ(luaEngine->getLuaState()["sharedValue"].get<int>(), 41);
+}
+
+TEST_F(LuaEngineTest, EditedScriptIsRecompiled) {
+    createTestScript("edited.lua", "version = 1\n");
+    ASSERT_TRUE(luaEngine->loadScript("edited.lua"));
+
+    createTestScript("edited.lua", "version = 2 -- edited\n");
+    scripting::LuaEngine otherEngine("./test_scripts/");
+    otherEngine.setWorld(world.get());
+    ASSERT_TRUE(otherEngine.loadScript("edited.lua"));
+
+    EXPECT_EQ(otherEngine.getLuaState()["version"].get<int>(), 2);
+}
+
+// ========== Budget Tests ==========
+
+TEST_F(LuaEngineTest, InfiniteLoopAbortedByCallBudget) {
+    createTestScript("infinite_loop.lua", R"(
+        function onUpdate(entity, deltaTime)
+            while true do end
+        end
+    )");
+
+    scripting::LuaBudgetConfig budget;
+    budget.callBudget = std::chrono::milliseconds(20);
+    luaEngine->setBudget(budget);
+
+    auto entity = world->createEntity();
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_NO_THROW(luaEngine->executeUpdate("infinite_loop.lua", entity, 0.016f));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+
+    const auto stats = luaEngine->getScriptStats("infinite_loop.lua");
+    EXPECT_EQ(stats.calls, 1u);
+    EXPECT_EQ(stats.budgetAborts, 1u);
+    EXPECT_GE(stats.cpuTime, std::chrono::milliseconds(20));
+}
+
+TEST_F(LuaEngineTest, PcallCannotSwallowBudgetAbort) {
+    createTestScript("pcall_loop.lua", R"(
+        function onUpdate(entity, deltaTime)
+            while true do
+                pcall(function() while true do end end)
+            end
+        end
+    )");
+
+    scripting::LuaBudgetConfig budget;
+    budget.callBudget = std::chrono::milliseconds(20);
+    luaEngine->setBudget(budget);
+
+    auto entity = world->createEntity();
+    const auto start = std::chrono::steady_clock::now();
+    luaEngine->executeUpdate("pcall_loop.lua", entity, 0.016f);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+    EXPECT_EQ(luaEngine->getScriptStats("pcall_loop.lua").budgetAborts, 1u);
+}
+
+TEST_F(LuaEngineTest, BudgetAbortWaitsForNestedBindingToReturn) {
+    createTestScript("nested_binding.lua", R"(
+        function onUpdate(entity, deltaTime)
+            withGuard(function()
+                for i = 1, 20000000 do end
+            end)
+            while true do end
+        end
+    )");
+
+    // A C++ binding re-entering Lua: an abort raised under it would longjmp over the guard
+    struct Guard {
+        int &destroyed;
+        ~Guard() { destroyed++; }
+    };
+    int guardsDestroyed = 0;
+    bool bindingReturned = false;
+    luaEngine->getLuaState().set_function("withGuard", [&](const sol::function &callback) {
+        Guard guard{guardsDestroyed};
+        callback();
+        bindingReturned = true;
+    });
+
+    scripting::LuaBudgetConfig budget;
+    budget.callBudget = std::chrono::milliseconds(1);
+    luaEngine->setBudget(budget);
+
+    auto entity = world->createEntity();
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_NO_THROW(luaEngine->executeUpdate("nested_binding.lua", entity, 0.016f));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+
+    EXPECT_TRUE(bindingReturned);
+    EXPECT_EQ(guardsDestroyed, 1);
+    EXPECT_EQ(luaEngine->getScriptStats("nested_binding.lua").budgetAborts, 1u);
+}
+
+TEST_F(LuaEngineTest, MemoryCapStopsRunawayAllocation) {
+    createTestScript("hoarder.lua", R"(
+        hoard = {}
+        function onUpdate(entity, deltaTime)
+            for i = 1, 100000000 do
+                hoard[i] = { i, i, i, i }
+            end
+        end
+    )");
+
+    scripting::LuaBudgetConfig budget;
+    budget.memoryLimit = 16 * 1024 * 1024;
+    budget.callBudget = std::chrono::seconds(5);
+    luaEngine->setBudget(budget);
+
+    auto entity = world->createEntity();
+    EXPECT_NO_THROW(luaEngine->executeUpdate("hoarder.lua", entity, 0.016f));
+    EXPECT_LE(luaEngine->getMemoryUsage(), budget.memoryLimit);
+    EXPECT_GT(luaEngine->getScriptStats("hoarder.lua").allocatedBytes, 0u);
+
+    // The VM is still usable once the script drops what it hoarded
+    luaEngine->getLuaState()["hoard"] = sol::lua_nil;
+    luaEngine->getLuaState().collect_garbage();
+    createTestScript("after_hoard.lua", R"(
+        ok = false
+        function onUpdate(entity, deltaTime) ok = true end
+    )");
+    luaEngine->executeUpdate("after_hoard.lua", entity, 0.016f);
+    EXPECT_TRUE(luaEngine->getLuaState()["ok"].get<bool>());
+}
@@ -6,8 +6,10 @@
 */
 
 #include <gtest/gtest.h>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <vector>
 #include "common/ECS/Components/LuaScript.hpp"
 #include "common/ECS/Components/Transform.hpp"
 #include "common/ECS/Registry.hpp"
@@ -323,3 +325,162 @@ TEST_F(LuaSystemAdapterTest, ConditionalBehavior) {
     // After 15 updates (150 units), should have bounced back
     EXPECT_LT(transform.getPosition().x, 100.0f);
 }
+
+// ========== Batched Update Tests ==========
+
+TEST_F(LuaSystemAdapterTest, BatchScriptCalledOncePerTick) {
+    createTestScript("batch_move.lua", R"(
+        batchCalls = 0
+        lastCount = 0
+        function onUpdateBatch(batch, deltaTime)
+            batchCalls = batchCalls + 1
+            lastCount = batch.count
+            for i = 1, batch.count do
+                batch.x[i] = batch.x[i] + 100 * deltaTime
+            end
+        end
+    )");
+
+    auto &registry = world->getRegistry();
+    std::vector<ecs::wrapper::Entity> entities;
+    for (int i = 0; i < 5; ++i) {
+        auto entity = world->createEntity();
+        entity.with(ecs::Transform(static_cast<float>(i * 10), 0.0f));
+        entity.with(ecs::LuaScript("batch_move.lua"));
+        entities.push_back(entity);
+    }
+
+    luaSystem->update(registry, 0.5f);
+
+    sol::state_view lua(luaEngine->getLuaState());
+    EXPECT_EQ(lua["batchCalls"].get<int>(), 1);
+    EXPECT_EQ(lua["lastCount"].get<int>(), 5);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_FLOAT_EQ(entities[i].get<ecs::Transform>().getPosition().x, i * 10.0f + 50.0f);
+        EXPECT_FLOAT_EQ(entities[i].get<ecs::Transform>().getPosition().y, 0.0f);
+    }
+}
+
+TEST_F(LuaSystemAdapterTest, BatchShrinksWhenEntitiesAreDestroyed) {
+    createTestScript("batch_count.lua", R"(
+        lastCount = 0
+        arrayLength = 0
+        function onUpdateBatch(batch, deltaTime)
+            lastCount = batch.count
+            arrayLength = #batch.entities
+        end
+    )");
+
+    auto &registry = world->getRegistry();
+    auto first = world->createEntity();
+    first.with(ecs::Transform(0.0f, 0.0f));
+    first.with(ecs::LuaScript("batch_count.lua"));
+    auto second = world->createEntity();
+    second.with(ecs::Transform(0.0f, 0.0f));
+    second.with(ecs::LuaScript("batch_count.lua"));
+
+    luaSystem->update(registry, 0.016f);
+    world->destroyEntity(second);
+    luaSystem->update(registry, 0.016f);
+
+    sol::state_view lua(luaEngine->getLuaState());
+    EXPECT_EQ(lua["lastCount"].get<int>(), 1);
+    EXPECT_EQ(lua["arrayLength"].get<int>(), 1);
+}
+
+TEST_F(LuaSystemAdapterTest, BatchAndPerEntityScriptsCoexist) {
+    createTestScript("batch_up.lua", R"(
+        function onUpdateBatch(batch, deltaTime)
+            for i = 1, batch.count do
+                batch.y[i] = batch.y[i] + 1
+            end
+        end
+    )");
+    createTestScript("single_right.lua", R"(
+        function onUpdate(entity, deltaTime)
+            local transform = entity:getTransform()
+            transform.x = transform.x + 1
+        end
+    )");
+
+    auto &registry = world->getRegistry();
+    auto batched = world->createEntity();
+    batched.with(ecs::Transform(0.0f, 0.0f));
+    batched.with(ecs::LuaScript("batch_up.lua"));
+    auto single = world->createEntity();
+    single.with(ecs::Transform(0.0f, 0.0f));
+    single.with(ecs::LuaScript("single_right.lua"));
+
+    luaSystem->update(registry, 0.016f);
+    luaSystem->update(registry, 0.016f);
+
+    // single_right.lua was loaded after batch_up.lua: it must not inherit its onUpdateBatch
+    EXPECT_FLOAT_EQ(batched.get<ecs::Transform>().getPosition().x, 0.0f);
+    EXPECT_FLOAT_EQ(batched.get<ecs::Transform>().getPosition().y, 2.0f);
+    EXPECT_FLOAT_EQ(single.get<ecs::Transform>().getPosition().x, 2.0f);
+    EXPECT_FLOAT_EQ(single.get<ecs::Transform>().getPosition().y, 0.0f);
+}
+
+TEST_F(LuaSystemAdapterTest, BatchEntityApiEditsArePreserved) {
+    createTestScript("batch_entity_api.lua", R"(
+        function onUpdateBatch(batch, deltaTime)
+            for i = 1, batch.count do
+                local transform = getEntity(batch.entities[i]):getTransform()
+                transform.x = 42
+            end
+        end
+    )");
+
+    auto &registry = world->getRegistry();
+    auto entity = world->createEntity();
+    entity.with(ecs::Transform(0.0f, 0.0f));
+    entity.with(ecs::LuaScript("batch_entity_api.lua"));
+
+    luaSystem->update(registry, 0.016f);
+
+    // batch.x was left untouched, so the write-back must not overwrite the Entity API edit
+    EXPECT_FLOAT_EQ(entity.get<ecs::Transform>().getPosition().x, 42.0f);
+}
+
+// ========== Budget Tests ==========
+
+TEST_F(LuaSystemAdapterTest, ExpensiveScriptThrottledOthersDeferredThenResumed) {
+    createTestScript("expensive.lua", R"(
+        function onUpdate(entity, deltaTime)
+            while true do end
+        end
+    )");
+    createTestScript("cheap.lua", R"(
+        function onUpdate(entity, deltaTime)
+            local transform = entity:getTransform()
+            transform.x = transform.x + 1
+        end
+    )");
+
+    scripting::LuaBudgetConfig budget;
+    budget.tickBudget = std::chrono::milliseconds(5);
+    budget.callBudget = std::chrono::milliseconds(20);
+    luaEngine->setBudget(budget);
+
+    auto &registry = world->getRegistry();
+    auto expensive = world->createEntity();
+    expensive.with(ecs::Transform(0.0f, 0.0f));
+    expensive.with(ecs::LuaScript("expensive.lua"));
+    auto cheap = world->createEntity();
+    cheap.with(ecs::Transform(0.0f, 0.0f));
+    cheap.with(ecs::LuaScript("cheap.lua"));
+
+    // Tick 1: the expensive script is aborted and spends the tick budget, cheap.lua is deferred
+    luaSystem->update(registry, 0.016f);
+    EXPECT_FLOAT_EQ(cheap.get<ecs::Transform>().getPosition().x, 0.0f);
+    EXPECT_EQ(luaEngine->getScriptStats("expensive.lua").budgetAborts, 1u);
+    EXPECT_EQ(luaEngine->getScriptStats("cheap.lua").deferredCalls, 1u);
+
+    // Tick 2: cheap.lua runs first, the expensive script is throttled instead of stalling the tick
+    const auto start = std::chrono::steady_clock::now();
+    luaSystem->update(registry, 0.016f);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+    EXPECT_FLOAT_EQ(cheap.get<ecs::Transform>().getPosition().x, 1.0f);
+    EXPECT_EQ(luaEngine->getScriptStats("expensive.lua").calls, 1u);
+    EXPECT_EQ(luaEngine->getScriptStats("expensive.lua").deferredCalls, 1u);
+}
@@ -91,3 +91,28 @@ TEST(GameStateTest, VariousEntityStates) {
     EXPECT_EQ(deserialized.entities[2].type, RType::Messages::Shared::EntityType::PlayerBullet);
     EXPECT_EQ(deserialized.entities[2].health, std::nullopt);
 }
+
+TEST(GameStateTest, ScrollOffsetRoundTrip) {
+    RType::Messages::S2C::GameState state;
+    state.serverTick = 7;
+    state.scrollOffset = 1234.5F;
+
+    auto deserialized = RType::Messages::S2C::GameState::deserialize(state.serialize());
+
+    EXPECT_EQ(deserialized.serverTick, 7);
+    EXPECT_FLOAT_EQ(deserialized.scrollOffset, 1234.5F);
+    EXPECT_FLOAT_EQ(RType::Messages::S2C::GameState().scrollOffset, 0.0F);
+}
+
+TEST(GameStateTest, PeekServerTickMatchesDeserialize) {
+    RType::Messages::S2C::GameState state;
+    state.serverTick = 123456;
+    for (int i = 0; i < 10; ++i) {
+        RType::Messages::S2C::EntityState entity;
+        entity.entityId = i;
+        state.entities.push_back(entity);
+    }
+
+    auto bytes = state.serialize();
+    EXPECT_EQ(RType::Messages::S2C::GameState::peekServerTick(bytes), 123456u);
+}
@@ -107,4 +107,17 @@ TEST(PlayerInputTest, HistoryRedundancy) {
     EXPECT_EQ(deserialized.inputs[0].sequenceId, 100);
     EXPECT_EQ(deserialized.inputs[1].sequenceId, 101);
     EXPECT_EQ(deserialized.inputs[2].sequenceId, 102);
-}
\ No newline at end of file
+}
+TEST(PlayerInputTest, InterpolationDelayRoundTrip) {
+    RType::Messages::C2S::PlayerInput input({{7, {RType::Messages::Shared::Action::Shoot}}}, 137);
+
+    auto deserialized = RType::Messages::C2S::PlayerInput::deserialize(input.serialize());
+
+    EXPECT_EQ(deserialized.interpolationDelayMs, 137u);
+    ASSERT_EQ(deserialized.inputs.size(), 1);
+    EXPECT_EQ(deserialized.inputs[0].sequenceId, 7);
+
+    // Not reported by older clients
+    RType::Messages::C2S::PlayerInput legacy(7, {});
+    EXPECT_EQ(RType::Messages::C2S::PlayerInput::deserialize(legacy.serialize()).interpolationDelayMs, 0u);
+}
@@ -6,8 +6,10 @@
 */
 
 #include <gtest/gtest.h>
+#include <array>
 #include <memory>
 #include "Game/Logic/GameLogic.hpp"
+#include "ECS/Components/Player.hpp"
 
 using namespace server;
 
@@ -214,4 +216,66 @@ TEST_F(GameLogicExtendedTest, LongRunningSession) {
         }
         gameLogic->update(1.0f / 60.0f, i);
     }
-}
\ No newline at end of file
+}
+TEST_F(GameLogicExtendedTest, ViewDelayUsesTheClientReportedInterpolationDelay) {
+    const uint32_t player = gameLogic->spawnPlayer(1, "TestPlayer");
+    ASSERT_NE(player, 0);
+
+    // Nominal 100 ms render delay until the client reports its own: 40 + 100 ms = 8.4 ticks
+    gameLogic->updatePlayerLatency(1, 40, 0);
+    gameLogic->processPlayerInput(1, 0, 0, false, 1);
+    gameLogic->update(1.0f / 60.0f, 0);
+    EXPECT_EQ(gameLogic->getRegistry().getComponent<ecs::Player>(player).getViewDelayTicks(), 8u);
+
+    // 40 + 160 ms = 12 ticks
+    gameLogic->updatePlayerLatency(1, 40, 160);
+    gameLogic->processPlayerInput(1, 0, 0, false, 2);
+    gameLogic->update(1.0f / 60.0f, 1);
+    EXPECT_EQ(gameLogic->getRegistry().getComponent<ecs::Player>(player).getViewDelayTicks(), 12u);
+
+    // A packet without a delay keeps the last reported one
+    gameLogic->updatePlayerLatency(1, 40, 0);
+    gameLogic->processPlayerInput(1, 0, 0, false, 3);
+    gameLogic->update(1.0f / 60.0f, 2);
+    EXPECT_EQ(gameLogic->getRegistry().getComponent<ecs::Player>(player).getViewDelayTicks(), 12u);
+}
+
+TEST_F(GameLogicExtendedTest, ViewDelayCountsQueuedInputsAsInputPeriods) {
+    const uint32_t player = gameLogic->spawnPlayer(1, "TestPlayer");
+    ASSERT_NE(player, 0);
+
+    // One input applied, three still queued: 40 + 160 ms + 3 * 16.7 ms = 15 ticks
+    gameLogic->updatePlayerLatency(1, 40, 160);
+    for (uint32_t sequenceId = 1; sequenceId <= 4; ++sequenceId) {
+        gameLogic->processPlayerInput(1, 0, 0, false, sequenceId);
+    }
+    gameLogic->update(1.0f / 60.0f, 0);
+    EXPECT_EQ(gameLogic->getRegistry().getComponent<ecs::Player>(player).getViewDelayTicks(), 15u);
+
+    // Sequence gaps (lost packets) are not waiting inputs: only the queue counts
+    gameLogic->processPlayerInput(1, 0, 0, false, 40);
+    gameLogic->update(1.0f / 60.0f, 1);
+    EXPECT_EQ(gameLogic->getRegistry().getComponent<ecs::Player>(player).getViewDelayTicks(), 15u);
+}
+
+TEST(GameLogicDeterminismTest, SameSeedAndInputsGiveTheSameHashes) {
+    std::array<std::shared_ptr<GameLogic>, 2> runs;
+    for (std::shared_ptr<GameLogic> &run : runs) {
+        run = std::make_shared<GameLogic>();
+        run->setDeterministic(42);
+        ASSERT_TRUE(run->isDeterministic());
+        ASSERT_TRUE(run->initialize());
+        run->spawnPlayer(2, "P2");
+        run->spawnPlayer(1, "P1");
+    }
+
+    for (uint32_t tick = 1; tick <= 300; ++tick) {
+        for (std::shared_ptr<GameLogic> &run : runs) {
+            run->processPlayerInput(1, (tick / 20) % 2 ? 1 : -1, tick % 3 == 0 ? 1 : 0, tick % 4 == 0, tick);
+            run->processPlayerInput(2, 0, (tick / 30) % 2 ? -1 : 1, tick % 6 == 0, tick);
+            run->update(1.0f / 60.0f, tick);
+        }
+        ASSERT_NE(runs[0]->getWorldHash(), 0u) << "tick " << tick;
+        ASSERT_EQ(runs[0]->getWorldHash(), runs[1]->getWorldHash()) << "tick " << tick;
+    }
+}
@@ -0,0 +1,216 @@
+/*
+** EPITECH PROJECT, 2025
+** rtype
+** File description:
+** PredictionParityTest.cpp - Client prediction and server simulation agree on the same input stream
+*/
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <memory>
+#include <vector>
+#include "ECS/Components/Buff.hpp"
+#include "Game/Logic/GameLogic.hpp"
+#include "Prediction/InputPrediction.hpp"
+#include "Prediction/ProjectilePrediction.hpp"
+
+using namespace server;
+using RType::Messages::Shared::Action;
+
+namespace {
+    constexpr float TICK = 1.0f / 60.0f;
+
+    /**
+     * @brief One tick of player input, as pressed on the client
+     */
+    struct TickInput {
+        int x;
+        int y;
+        bool shoot;
+    };
+
+    /**
+     * @brief Actions the client's GameLoop sends for an input
+     */
+    std::vector<Action> toActions(const TickInput &input) {
+        std::vector<Action> actions;
+        if (input.y < 0) {
+            actions.push_back(Action::MoveUp);
+        }
+        if (input.y > 0) {
+            actions.push_back(Action::MoveDown);
+        }
+        if (input.x < 0) {
+            actions.push_back(Action::MoveLeft);
+        }
+        if (input.x > 0) {
+            actions.push_back(Action::MoveRight);
+        }
+        if (input.shoot) {
+            actions.push_back(Action::Shoot);
+        }
+        return actions;
+    }
+
+    /**
+     * @brief Mixed straight and diagonal movement, mostly rightwards (stays on screen)
+     */
+    std::vector<TickInput> movementStream() {
+        const TickInput pattern[] = {{1, 0, false},  {1, 1, false},  {0, 1, false}, {1, -1, false},
+                                     {0, 0, false},  {-1, 1, false}, {1, 0, false}, {0, -1, false},
+                                     {-1, -1, false}, {1, 1, false}};
+        std::vector<TickInput> stream;
+        for (int i = 0; i < 120; ++i) {
+            stream.push_back(pattern[(i / 4) % std::size(pattern)]);
+        }
+        return stream;
+    }
+}  // namespace
+
+class PredictionParityTest : public ::testing::Test {
+   protected:
+    std::shared_ptr<GameLogic> gameLogic;
+    ecs::Address player = 0;
+
+    void SetUp() override {
+        gameLogic = std::make_shared<GameLogic>();
+        ASSERT_TRUE(gameLogic->initialize());
+        player = gameLogic->spawnPlayer(1, "Predicted");
+        ASSERT_NE(player, 0u);
+    }
+
+    ecs::PlayerRules::Vec2 serverPosition() {
+        const auto position = gameLogic->getECSWorld()->getEntity(player).get<ecs::Transform>().getPosition();
+        return {position.x, position.y};
+    }
+
+    std::vector<ecs::PlayerRules::Vec2> serverShots() {
+        std::vector<ecs::PlayerRules::Vec2> shots;
+        gameLogic->getECSWorld()->forEach<ecs::Projectile, ecs::Transform>(
+            [&shots](ecs::wrapper::Entity, const ecs::Projectile &projectile,
+                     const ecs::Transform &transform) {
+                if (projectile.isFriendly()) {
+                    shots.push_back({transform.getPosition().x, transform.getPosition().y});
+                }
+            });
+        return shots;
+    }
+};
+
+TEST_F(PredictionParityTest, PlayerPositionMatchesEveryTick) {
+    const GameRules &rules = gameLogic->getGameRules();
+    const auto speed = static_cast<float>(rules.getDefaultPlayerSpeed());
+    ecs::PlayerRules::Vec2 predicted = serverPosition();
+
+    uint32_t tick = 0;
+    for (const TickInput &input : movementStream()) {
+        const std::vector<Action> actions = toActions(input);
+        InputPrediction::applyMovement(predicted, InputPrediction::readActions(actions), speed, TICK);
+
+        gameLogic->processPlayerInput(1, input.x, input.y, input.shoot, tick);
+        gameLogic->update(TICK, tick);
+
+        const ecs::PlayerRules::Vec2 authoritative = serverPosition();
+        ASSERT_EQ(predicted.x, authoritative.x) << "tick " << tick;
+        ASSERT_EQ(predicted.y, authoritative.y) << "tick " << tick;
+        tick++;
+    }
+}
+
+TEST_F(PredictionParityTest, NormalAndChargedShotsMatchServerProjectiles) {
+    const GameRules &rules = gameLogic->getGameRules();
+    const auto speed = static_cast<float>(rules.getDefaultPlayerSpeed());
+    ecs::PlayerRules::Vec2 predicted = serverPosition();
+    ecs::PlayerRules::WeaponState weapon;
+    Prediction::ProjectilePredictor predictor;
+
+    // Tap (normal shot), then hold past the charge threshold while moving, each shot followed a while
+    std::vector<TickInput> stream;
+    stream.insert(stream.end(), 5, {0, 1, true});
+    stream.insert(stream.end(), 20, {1, 0, false});
+    stream.insert(stream.end(), 40, {1, -1, true});
+    stream.insert(stream.end(), 20, {0, 0, false});
+
+    uint32_t tick = 0;
+    int fired = 0;
+    for (const TickInput &input : stream) {
+        // Client, in server system order: projectiles move, then the player, then the weapon fires
+        predictor.advance(TICK);
+        const InputPrediction::Axes axes = InputPrediction::readActions(toActions(input));
+        InputPrediction::applyMovement(predicted, axes, speed, TICK);
+        if (auto charge = ecs::PlayerRules::stepWeapon(weapon, axes.shoot, rules.getDefaultPlayerFireRate(),
+                                                       ecs::PlayerRules::DEFAULT_CHARGE_RATE, TICK)) {
+            const ecs::PlayerRules::Shot shot = ecs::PlayerRules::releasedShot(*charge, 0.0f);
+            const ecs::PlayerRules::ProjectileSpawn spawn =
+                ecs::PlayerRules::projectileSpawn(predicted, true, shot.speed, 0, 1);
+            predictor.spawn(spawn.position.x, spawn.position.y, spawn.direction.x * spawn.speed,
+                            spawn.direction.y * spawn.speed);
+            fired++;
+        }
+
+        gameLogic->processPlayerInput(1, input.x, input.y, input.shoot, tick);
+        gameLogic->update(TICK, tick);
+
+        // Predicted shots are dropped after MAX_AGE, server ones fly on
+        const std::vector<ecs::PlayerRules::Vec2> authoritative = serverShots();
+        ASSERT_LE(predictor.getShots().size(), authoritative.size()) << "tick " << tick;
+        for (const Prediction::PredictedShot &shot : predictor.getShots()) {
+            bool found = false;
+            for (const ecs::PlayerRules::Vec2 &projectile : authoritative) {
+                found = found || (shot.x == projectile.x && shot.y == projectile.y);
+            }
+            EXPECT_TRUE(found) << "tick " << tick << ": no server projectile at " << shot.x << ", " << shot.y;
+        }
+        tick++;
+    }
+    EXPECT_EQ(fired, 2);
+}
+
+TEST_F(PredictionParityTest, DoubleShotSpreadMatchesServerProjectiles) {
+    gameLogic->getECSWorld()->getEntity(player).with(ecs::Buff(ecs::BuffType::DoubleShot, 0.0f, 1.0f));
+    const GameRules &rules = gameLogic->getGameRules();
+    const int shotCount = ecs::PlayerRules::shotCount(false, false, true);
+    ecs::PlayerRules::Vec2 predicted = serverPosition();
+    ecs::PlayerRules::WeaponState weapon;
+    Prediction::ProjectilePredictor predictor;
+
+    // One tap, then the pair flies on for a while
+    std::vector<TickInput> stream;
+    stream.insert(stream.end(), 5, {0, 0, true});
+    stream.insert(stream.end(), 20, {0, 0, false});
+
+    uint32_t tick = 0;
+    int fired = 0;
+    for (const TickInput &input : stream) {
+        predictor.advance(TICK);
+        const InputPrediction::Axes axes = InputPrediction::readActions(toActions(input));
+        if (auto charge = ecs::PlayerRules::stepWeapon(weapon, axes.shoot, rules.getDefaultPlayerFireRate(),
+                                                       ecs::PlayerRules::DEFAULT_CHARGE_RATE, TICK)) {
+            const ecs::PlayerRules::Shot shot = ecs::PlayerRules::releasedShot(*charge, 0.0f);
+            for (int i = 0; i < shotCount; ++i) {
+                const ecs::PlayerRules::ProjectileSpawn spawn =
+                    ecs::PlayerRules::projectileSpawn(predicted, true, shot.speed, i, shotCount);
+                predictor.spawn(spawn.position.x, spawn.position.y, spawn.direction.x * spawn.speed,
+                                spawn.direction.y * spawn.speed);
+            }
+            fired++;
+        }
+
+        gameLogic->processPlayerInput(1, input.x, input.y, input.shoot, tick);
+        gameLogic->update(TICK, tick);
+
+        const std::vector<ecs::PlayerRules::Vec2> authoritative = serverShots();
+        ASSERT_LE(predictor.getShots().size(), authoritative.size()) << "tick " << tick;
+        for (const Prediction::PredictedShot &shot : predictor.getShots()) {
+            bool found = false;
+            for (const ecs::PlayerRules::Vec2 &projectile : authoritative) {
+                found = found || (shot.x == projectile.x && shot.y == projectile.y);
+            }
+            EXPECT_TRUE(found) << "tick " << tick << ": no server projectile at " << shot.x << ", " << shot.y;
+        }
+        tick++;
+    }
+    EXPECT_EQ(fired, 1);
+    EXPECT_EQ(predictor.getShots().size(), 2u);
+}
@@ -6,6 +6,7 @@
 */
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <memory>
 #include <thread>
 #include "server/Rooms/Matchmaking/MatchmakingService.hpp"
@@ -146,6 +147,49 @@ TEST_F(RoomManagerExtendedTest, GetAllRoomsEmpty) {
     EXPECT_TRUE(rooms.empty());
 }
 
+TEST_F(RoomManagerExtendedTest, RoomsSnapshotIsImmutable) {
+    auto empty = roomManager->getRoomsSnapshot();
+    ASSERT_NE(empty, nullptr);
+    EXPECT_TRUE(empty->rooms.empty());
+
+    roomManager->createRoom("room1");
+    auto withRoom = roomManager->getRoomsSnapshot();
+
+    EXPECT_TRUE(empty->rooms.empty());
+    ASSERT_EQ(withRoom->rooms.size(), 1);
+    EXPECT_EQ(withRoom->rooms[0]->getId(), "room1");
+    EXPECT_GT(withRoom->generation, empty->generation);
+
+    roomManager->removeRoom("room1");
+    EXPECT_EQ(withRoom->rooms.size(), 1);
+    EXPECT_TRUE(roomManager->getRoomsSnapshot()->rooms.empty());
+}
+
+TEST_F(RoomManagerExtendedTest, RoomsSnapshotOnlyRebuiltOnChange) {
+    roomManager->createRoom("room1");
+    auto before = roomManager->getRoomsSnapshot();
+
+    roomManager->update(1.0f / 60.0f);
+    roomManager->getRoom("room1")->join(1);
+
+    EXPECT_EQ(roomManager->getRoomsSnapshot(), before);
+}
+
+TEST_F(RoomManagerExtendedTest, RoomCreationLatencyRecorded) {
+    EXPECT_EQ(roomManager->getRoomCreationStats().count, 0u);
+
+    auto room1 = roomManager->createRoom("room1");
+    auto room2 = roomManager->createRoom("room2");
+    roomManager->createRoom("room1");  // Already exists: not a new room
+
+    auto stats = roomManager->getRoomCreationStats();
+    EXPECT_EQ(stats.count, 2u);
+    EXPECT_EQ(stats.last, room2->getCreationLatency());
+    EXPECT_EQ(stats.max, std::max(room1->getCreationLatency(), room2->getCreationLatency()));
+    EXPECT_EQ(stats.total, room1->getCreationLatency() + room2->getCreationLatency());
+    EXPECT_GT(stats.max.count(), 0);
+}
+
 TEST_F(RoomManagerExtendedTest, GetPublicRooms) {
     roomManager->createRoom("public1", "Public1", 4, false);
     roomManager->createRoom("private1", "Private1", 4, true);
@@ -206,6 +250,53 @@ TEST_F(RoomManagerExtendedTest, GetRoomByPlayerInMultipleRooms) {
     EXPECT_EQ(found2, room2);
 }
 
+TEST_F(RoomManagerExtendedTest, GetRoomBySpectator) {
+    auto room = roomManager->createRoom("spectated-room");
+    ASSERT_NE(room, nullptr);
+
+    room->joinAsSpectator(300);
+
+    EXPECT_EQ(roomManager->getRoomByPlayer(300), room);
+}
+
+TEST_F(RoomManagerExtendedTest, GetRoomByPlayerAfterLeave) {
+    auto room = roomManager->createRoom("leave-room");
+    ASSERT_NE(room, nullptr);
+
+    room->join(100);
+    room->joinAsSpectator(101);
+    room->leave(100);
+    room->leave(101);
+
+    EXPECT_EQ(roomManager->getRoomByPlayer(100), nullptr);
+    EXPECT_EQ(roomManager->getRoomByPlayer(101), nullptr);
+}
+
+TEST_F(RoomManagerExtendedTest, GetRoomByPlayerAfterRoomRemoved) {
+    auto room = roomManager->createRoom("removed-room");
+    ASSERT_NE(room, nullptr);
+
+    room->join(100);
+    roomManager->removeRoom("removed-room");
+    EXPECT_EQ(roomManager->getRoomByPlayer(100), nullptr);
+
+    // The room is no longer tracked: later joins must not be indexed
+    room->join(101);
+    EXPECT_EQ(roomManager->getRoomByPlayer(101), nullptr);
+}
+
+TEST_F(RoomManagerExtendedTest, GetRoomByPlayerFallsBackToOtherRoom) {
+    auto room1 = roomManager->createRoom("first-room");
+    auto room2 = roomManager->createRoom("second-room");
+
+    room1->join(100);
+    room2->join(100);
+    EXPECT_EQ(roomManager->getRoomByPlayer(100), room1);
+
+    room1->leave(100);
+    EXPECT_EQ(roomManager->getRoomByPlayer(100), room2);
+}
+
 // ============================================================================
 // Tests de comptage
 // ============================================================================
@@ -6,9 +6,14 @@
 */
 
 #include <gtest/gtest.h>
+#include <atomic>
 #include <chrono>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <thread>
+#include <utility>
+#include <vector>
 #include "server/Rooms/IRoom.hpp"
 #include "server/Rooms/Lobby/Lobby.hpp"
 #include "server/Rooms/Room.hpp"
@@ -171,6 +176,53 @@ TEST_F(RoomTest, PrivateRoom) {
     EXPECT_TRUE(info.isPrivate);
 }
 
+TEST_F(RoomTest, MembershipCallbackReplaysCurrentMembers) {
+    room->join(1);
+    room->joinAsSpectator(2);
+
+    std::vector<std::pair<uint32_t, bool>> first;
+    room->setMembershipCallback(
+        [&first](uint32_t playerId, bool joined) { first.emplace_back(playerId, joined); });
+    EXPECT_EQ(first, (std::vector<std::pair<uint32_t, bool>>{{1, true}, {2, true}}));
+
+    room->setMembershipCallback(nullptr);
+    EXPECT_EQ(first, (std::vector<std::pair<uint32_t, bool>>{{1, true}, {2, true}, {1, false}, {2, false}}));
+}
+
+TEST_F(RoomTest, MembershipIndexStaysInSyncWithConcurrentJoins) {
+    std::mutex indexMutex;
+    std::set<uint32_t> index;
+    auto track = [&](uint32_t playerId, bool joined) {
+        std::scoped_lock lock(indexMutex);
+        if (joined) {
+            index.insert(playerId);
+        } else {
+            index.erase(playerId);
+        }
+    };
+
+    std::atomic<bool> done{false};
+    std::thread churn([this, &done]() {
+        for (int i = 0; i < 2000; ++i) {
+            room->join(7);
+            room->leave(7);
+        }
+        room->join(7);
+        done = true;
+    });
+    // Register and unregister while members come and go: each registration must see a consistent room
+    while (!done) {
+        room->setMembershipCallback(track);
+        room->setMembershipCallback(nullptr);
+        std::scoped_lock lock(indexMutex);
+        EXPECT_TRUE(index.empty());
+    }
+    churn.join();
+    room->setMembershipCallback(track);
+
+    EXPECT_EQ(index, (std::set<uint32_t>{7}));
+}
+
 // ============================================================================
 // RoomManager Tests
 // ============================================================================